@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#include <dali-test-suite-utils.h>
+#include <dali/devel-api/adaptor-framework/animated-image-loading.h>
+#include <dali/internal/imaging/common/animated-image-loading-impl.h>
+#include <dali/internal/system/common/async-task-manager-impl.h>
+
+using namespace Dali;
+using Dali::Internal::Adaptor::AsyncTaskManager;
+
+namespace
+{
+// test gif image, resolution: 100*100, 5 frames, delay: 1 second, disposal method: previous
+static const char* gGif_100_Prev = TEST_RESOURCE_DIR "/canvas-prev.gif";
+
+/**
+ * @brief Gives the workers time to decode the frames following the loaded one.
+ */
+void WaitForPrefetch()
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+}
+
+/**
+ * @brief Load a frame with and without the prefetch, and check they are the same.
+ */
+void LoadAndCompareFrame(Dali::AnimatedImageLoading& expectedLoading, Dali::AnimatedImageLoading& prefetchLoading, uint32_t frameIndex)
+{
+  Dali::PixelBuffer expected = expectedLoading.LoadFrame(frameIndex);
+  Dali::PixelBuffer actual   = prefetchLoading.LoadFrame(frameIndex);
+  DALI_TEST_CHECK(expected);
+  DALI_TEST_CHECK(actual);
+
+  DALI_TEST_EQUALS(actual.GetWidth(), 100u, TEST_LOCATION);
+  DALI_TEST_EQUALS(actual.GetHeight(), 100u, TEST_LOCATION);
+  DALI_TEST_CHECK(memcmp(actual.GetBuffer(), expected.GetBuffer(), 100u * 100u * Pixel::GetBytesPerPixel(expected.GetPixelFormat())) == 0);
+}
+
+} // namespace
+
+int UtcDaliAnimatedImageLoadingPrefetchP(void)
+{
+  tet_infoline("Test the frames decoded ahead on the worker threads are the frames loaded");
+
+  TestApplication application;
+
+  IntrusivePtr<AsyncTaskManager> manager = new AsyncTaskManager();
+
+  Dali::AnimatedImageLoading animatedImageLoading = Dali::AnimatedImageLoading::New(gGif_100_Prev, true);
+  Dali::AnimatedImageLoading prefetchLoading      = Dali::AnimatedImageLoading::New(gGif_100_Prev, true);
+
+  auto& prefetchLoadingImpl = Internal::Adaptor::GetImplementation(prefetchLoading);
+
+  // The frames are 1 second long, so 3 frames are decoded ahead.
+  prefetchLoading.SetPrefetchDuration(3000u);
+  DALI_TEST_EQUALS(prefetchLoading.GetMissedFrameCount(), 0u, TEST_LOCATION);
+
+  // The first frame is decoded by the caller.
+  LoadAndCompareFrame(animatedImageLoading, prefetchLoading, 0u);
+  DALI_TEST_EQUALS(prefetchLoadingImpl.GetPrefetchedFrameCount(), 0u, TEST_LOCATION);
+
+  // Play twice. Every later frame is prefetched.
+  const uint32_t frameOrder[] = {1u, 2u, 3u, 4u, 0u, 1u, 2u, 3u, 4u};
+  uint32_t       loadedCount  = 0u;
+  for(uint32_t frameIndex : frameOrder)
+  {
+    WaitForPrefetch();
+    LoadAndCompareFrame(animatedImageLoading, prefetchLoading, frameIndex);
+    DALI_TEST_EQUALS(prefetchLoadingImpl.GetPrefetchedFrameCount(), ++loadedCount, TEST_LOCATION);
+  }
+  DALI_TEST_EQUALS(prefetchLoading.GetMissedFrameCount(), 0u, TEST_LOCATION);
+
+  // Skipping a frame within the ring is served from it.
+  WaitForPrefetch();
+  LoadAndCompareFrame(animatedImageLoading, prefetchLoading, 1u);
+  DALI_TEST_EQUALS(prefetchLoadingImpl.GetPrefetchedFrameCount(), ++loadedCount, TEST_LOCATION);
+
+  // Seeking backwards is not.
+  WaitForPrefetch();
+  LoadAndCompareFrame(animatedImageLoading, prefetchLoading, 0u);
+  DALI_TEST_EQUALS(prefetchLoadingImpl.GetPrefetchedFrameCount(), loadedCount, TEST_LOCATION);
+
+  // A different size isn't served from the prefetched frames.
+  WaitForPrefetch();
+  Dali::PixelBuffer resized = prefetchLoading.LoadFrame(1u, ImageDimensions(50u, 50u));
+  DALI_TEST_CHECK(resized);
+  DALI_TEST_EQUALS(resized.GetWidth(), 50u, TEST_LOCATION);
+  DALI_TEST_EQUALS(resized.GetHeight(), 50u, TEST_LOCATION);
+  DALI_TEST_EQUALS(prefetchLoadingImpl.GetPrefetchedFrameCount(), loadedCount, TEST_LOCATION);
+
+  prefetchLoading.SetPrefetchDuration(0u);
+  DALI_TEST_EQUALS(prefetchLoading.GetMissedFrameCount(), 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(prefetchLoadingImpl.GetPrefetchedFrameCount(), 0u, TEST_LOCATION);
+
+  // Joins the worker threads.
+  manager.Reset();
+
+  END_TEST;
+}
+
+int UtcDaliAnimatedImageLoadingPrefetchDropped(void)
+{
+  tet_infoline("Test the prefetcher and the loading may be dropped while their tasks are queued");
+
+  TestApplication application;
+
+  IntrusivePtr<AsyncTaskManager> manager = new AsyncTaskManager();
+
+  Dali::AnimatedImageLoading animatedImageLoading = Dali::AnimatedImageLoading::New(gGif_100_Prev, true);
+  Dali::AnimatedImageLoading prefetchLoading      = Dali::AnimatedImageLoading::New(gGif_100_Prev, true);
+
+  auto& prefetchLoadingImpl = Internal::Adaptor::GetImplementation(prefetchLoading);
+
+  // Replace the prefetcher right after its tasks are added.
+  prefetchLoading.SetPrefetchDuration(3000u);
+  LoadAndCompareFrame(animatedImageLoading, prefetchLoading, 0u);
+  prefetchLoading.SetPrefetchDuration(2000u);
+
+  // The new prefetcher works.
+  LoadAndCompareFrame(animatedImageLoading, prefetchLoading, 0u);
+  WaitForPrefetch();
+  LoadAndCompareFrame(animatedImageLoading, prefetchLoading, 1u);
+  DALI_TEST_EQUALS(prefetchLoadingImpl.GetPrefetchedFrameCount(), 1u, TEST_LOCATION);
+
+  // Disable the prefetch, and drop the loading, while the tasks are queued.
+  LoadAndCompareFrame(animatedImageLoading, prefetchLoading, 2u);
+  prefetchLoading.SetPrefetchDuration(0u);
+  prefetchLoading.Reset();
+
+  WaitForPrefetch();
+
+  // Joins the worker threads, after the queued tasks ran.
+  manager.Reset();
+
+  END_TEST;
+}
@@ -0,0 +1,361 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <dali-test-suite-utils.h>
+#include <dali/internal/system/common/async-task-manager-impl.h>
+
+using namespace Dali;
+using Dali::Internal::Adaptor::AsyncTaskManager;
+
+namespace
+{
+void TestTaskCompleted(AsyncTaskPtr)
+{
+}
+
+class TestTask : public AsyncTask
+{
+public:
+  TestTask()
+  : AsyncTask(MakeCallback(&TestTaskCompleted))
+  {
+  }
+
+  void Process() override
+  {
+  }
+
+  Dali::StringView GetTaskName() const override
+  {
+    return "TestTask";
+  }
+};
+
+/**
+ * @brief A task which counts how many times it was processed.
+ */
+class CountingTask : public AsyncTask
+{
+public:
+  CountingTask(std::atomic<uint32_t>& processedCount)
+  : AsyncTask(MakeCallback(&TestTaskCompleted)),
+    mProcessedCount(processedCount)
+  {
+  }
+
+  void Process() override
+  {
+    mProcessedCount.fetch_add(1u, std::memory_order_release);
+  }
+
+  Dali::StringView GetTaskName() const override
+  {
+    return "CountingTask";
+  }
+
+private:
+  std::atomic<uint32_t>& mProcessedCount;
+};
+
+/**
+ * @brief A task whose Process() waits until the test releases it.
+ */
+class BlockingTask : public AsyncTask
+{
+public:
+  BlockingTask()
+  : AsyncTask(MakeCallback(&TestTaskCompleted))
+  {
+  }
+
+  void Process() override
+  {
+    std::unique_lock<std::mutex> lock(mMutex);
+    mStarted = true;
+    mCondition.notify_all();
+    mCondition.wait(lock, [this]() { return mReleased; });
+  }
+
+  Dali::StringView GetTaskName() const override
+  {
+    return "BlockingTask";
+  }
+
+  bool WaitUntilStarted()
+  {
+    std::unique_lock<std::mutex> lock(mMutex);
+    return mCondition.wait_for(lock, std::chrono::seconds(5), [this]() { return mStarted; });
+  }
+
+  void Release()
+  {
+    std::unique_lock<std::mutex> lock(mMutex);
+    mReleased = true;
+    mCondition.notify_all();
+  }
+
+private:
+  std::mutex              mMutex;
+  std::condition_variable mCondition;
+  bool                    mStarted{false};
+  bool                    mReleased{false};
+};
+
+/**
+ * @brief Wait until the count reaches the expected value, or a second passed.
+ */
+bool WaitForCount(const std::atomic<uint32_t>& count, uint32_t expected)
+{
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+  while(count.load(std::memory_order_acquire) < expected && std::chrono::steady_clock::now() < deadline)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return count.load(std::memory_order_acquire) >= expected;
+}
+
+} // namespace
+
+void utc_dali_internal_async_task_dependency_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_async_task_dependency_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliAsyncTaskDependencyChain(void)
+{
+  tet_infoline("Test each stage of a chain is released by the stage before it");
+
+  AsyncTaskPtr decode = new TestTask();
+  AsyncTaskPtr resize = new TestTask();
+  AsyncTaskPtr upload = new TestTask();
+
+  resize->AddDependency(decode);
+  upload->AddDependency(resize);
+
+  DALI_TEST_CHECK(!decode->HasPendingDependencies());
+  DALI_TEST_CHECK(resize->HasPendingDependencies());
+  DALI_TEST_CHECK(upload->HasPendingDependencies());
+
+  auto released = AsyncTaskManager::MarkTaskProcessed(decode);
+  DALI_TEST_EQUALS(released.size(), 1u, TEST_LOCATION);
+  DALI_TEST_CHECK(released[0] == resize);
+  DALI_TEST_CHECK(!resize->HasPendingDependencies());
+  DALI_TEST_CHECK(upload->HasPendingDependencies());
+
+  released = AsyncTaskManager::MarkTaskProcessed(resize);
+  DALI_TEST_EQUALS(released.size(), 1u, TEST_LOCATION);
+  DALI_TEST_CHECK(released[0] == upload);
+  DALI_TEST_CHECK(!upload->HasPendingDependencies());
+
+  DALI_TEST_CHECK(AsyncTaskManager::MarkTaskProcessed(upload).empty());
+
+  END_TEST;
+}
+
+int UtcDaliAsyncTaskDependencyDiamond(void)
+{
+  tet_infoline("Test a task with several predecessors is released by the last of them only");
+
+  AsyncTaskPtr source = new TestTask();
+  AsyncTaskPtr left   = new TestTask();
+  AsyncTaskPtr right  = new TestTask();
+  AsyncTaskPtr merge  = new TestTask();
+
+  left->AddDependency(source);
+  right->AddDependency(source);
+  merge->AddDependency(left);
+  merge->AddDependency(right);
+
+  auto released = AsyncTaskManager::MarkTaskProcessed(source);
+  DALI_TEST_EQUALS(released.size(), 2u, TEST_LOCATION);
+
+  DALI_TEST_CHECK(AsyncTaskManager::MarkTaskProcessed(right).empty());
+  DALI_TEST_CHECK(merge->HasPendingDependencies());
+
+  released = AsyncTaskManager::MarkTaskProcessed(left);
+  DALI_TEST_EQUALS(released.size(), 1u, TEST_LOCATION);
+  DALI_TEST_CHECK(released[0] == merge);
+  DALI_TEST_CHECK(!merge->HasPendingDependencies());
+
+  END_TEST;
+}
+
+int UtcDaliAsyncTaskDependencyIgnored(void)
+{
+  tet_infoline("Test processed predecessors, empty predecessors and the task itself are ignored");
+
+  AsyncTaskPtr processed = new TestTask();
+  AsyncTaskPtr task      = new TestTask();
+
+  DALI_TEST_CHECK(AsyncTaskManager::MarkTaskProcessed(processed).empty());
+
+  task->AddDependency(processed);
+  task->AddDependency(AsyncTaskPtr());
+  task->AddDependency(task);
+  DALI_TEST_CHECK(!task->HasPendingDependencies());
+  DALI_TEST_EQUALS(task->ReferenceCount(), 1, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliAsyncTaskDependencyDetach(void)
+{
+  tet_infoline("Test detached successors are not released when the predecessor is processed");
+
+  AsyncTaskPtr predecessor = new TestTask();
+  AsyncTaskPtr successor   = new TestTask();
+
+  successor->AddDependency(predecessor);
+  DALI_TEST_EQUALS(successor->ReferenceCount(), 2, TEST_LOCATION);
+
+  auto detached = AsyncTaskManager::DetachSuccessors(predecessor);
+  DALI_TEST_EQUALS(detached.size(), 1u, TEST_LOCATION);
+  DALI_TEST_CHECK(detached[0] == successor);
+  detached.clear();
+  DALI_TEST_EQUALS(successor->ReferenceCount(), 1, TEST_LOCATION);
+
+  DALI_TEST_CHECK(AsyncTaskManager::MarkTaskProcessed(predecessor).empty());
+  DALI_TEST_CHECK(successor->HasPendingDependencies());
+
+  END_TEST;
+}
+
+int UtcDaliAsyncTaskDependencyThreadSafe(void)
+{
+  tet_infoline("Test a successor is released exactly once while its predecessor is processed on another thread");
+
+  constexpr uint32_t TASK_COUNT = 2000u;
+
+  std::vector<AsyncTaskPtr> predecessors;
+  std::vector<AsyncTaskPtr> successors;
+  for(uint32_t i = 0u; i < TASK_COUNT; ++i)
+  {
+    predecessors.push_back(new TestTask());
+    successors.push_back(new TestTask());
+  }
+
+  std::vector<AsyncTaskPtr> released;
+  std::thread               worker([&]()
+  {
+    for(auto& predecessor : predecessors)
+    {
+      for(auto& successor : AsyncTaskManager::MarkTaskProcessed(predecessor))
+      {
+        released.push_back(successor);
+      }
+    }
+  });
+
+  for(uint32_t i = 0u; i < TASK_COUNT; ++i)
+  {
+    successors[i]->AddDependency(predecessors[i]);
+  }
+  worker.join();
+
+  // Every successor either saw its predecessor already processed, or was released by it once.
+  for(auto& successor : successors)
+  {
+    DALI_TEST_CHECK(!successor->HasPendingDependencies());
+    DALI_TEST_CHECK(std::count(released.begin(), released.end(), successor) <= 1);
+  }
+  tet_printf("%zu of %u successors were released by their predecessor\n", released.size(), TASK_COUNT);
+
+  END_TEST;
+}
+
+int UtcDaliAsyncTaskDependencyCanceledPredecessor(void)
+{
+  tet_infoline("Test a canceled task doesn't release its successors when it is processed");
+
+  AsyncTaskPtr predecessor = new TestTask();
+  AsyncTaskPtr successor   = new TestTask();
+  successor->AddDependency(predecessor);
+
+  // RemoveTask() cancels the successors while the predecessor may still run.
+  auto canceled = AsyncTaskManager::DetachSuccessors(predecessor);
+  DALI_TEST_EQUALS(canceled.size(), 1u, TEST_LOCATION);
+
+  // A successor added later isn't released either, until the task is added again.
+  AsyncTaskPtr lateSuccessor = new TestTask();
+  lateSuccessor->AddDependency(predecessor);
+
+  DALI_TEST_CHECK(AsyncTaskManager::MarkTaskProcessed(predecessor).empty());
+  DALI_TEST_CHECK(successor->HasPendingDependencies());
+  DALI_TEST_CHECK(lateSuccessor->HasPendingDependencies());
+
+  END_TEST;
+}
+
+int UtcDaliAsyncTaskDependencyRemoveRunningTask(void)
+{
+  tet_infoline("Test the successors of a task removed while it is running never run");
+
+  TestApplication application;
+
+  IntrusivePtr<AsyncTaskManager> manager = new AsyncTaskManager();
+
+  // Without the remove, the successor runs after its predecessor.
+  {
+    std::atomic<uint32_t>      processedCount(0u);
+    IntrusivePtr<BlockingTask> predecessor = new BlockingTask();
+    AsyncTaskPtr               successor   = new CountingTask(processedCount);
+    successor->AddDependency(predecessor);
+
+    manager->AddTask(successor);
+    manager->AddTask(predecessor);
+    DALI_TEST_CHECK(predecessor->WaitUntilStarted());
+    predecessor->Release();
+
+    DALI_TEST_CHECK(WaitForCount(processedCount, 1u));
+  }
+
+  // Removed while it runs, the successor is removed with it.
+  {
+    std::atomic<uint32_t>      processedCount(0u);
+    IntrusivePtr<BlockingTask> predecessor = new BlockingTask();
+    AsyncTaskPtr               successor   = new CountingTask(processedCount);
+    successor->AddDependency(predecessor);
+
+    manager->AddTask(successor);
+    manager->AddTask(predecessor);
+    DALI_TEST_CHECK(predecessor->WaitUntilStarted());
+
+    manager->RemoveTask(predecessor);
+    predecessor->Release();
+
+    DALI_TEST_CHECK(!WaitForCount(processedCount, 1u));
+    DALI_TEST_CHECK(successor->HasPendingDependencies());
+  }
+
+  // Joins the worker threads.
+  manager.Reset();
+
+  END_TEST;
+}
@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <adaptor-environment-variable.h>
+#include <dali-test-suite-utils.h>
+#include <dali/internal/system/common/async-task-manager-impl.h>
+#include <dali/internal/system/common/async-task-work-stealing-queue.h>
+#include <dali/internal/system/common/environment-variables.h>
+
+using namespace Dali;
+using Dali::Internal::Adaptor::WorkStealingTaskQueue;
+using Decision = WorkStealingTaskQueue::Decision;
+
+namespace
+{
+void TestTaskCompleted(AsyncTaskPtr)
+{
+}
+
+class TestTask : public AsyncTask
+{
+public:
+  TestTask(PriorityType priority = PriorityType::HIGH)
+  : AsyncTask(MakeCallback(&TestTaskCompleted), priority)
+  {
+  }
+
+  void Process() override
+  {
+  }
+
+  Dali::StringView GetTaskName() const override
+  {
+    return "TestTask";
+  }
+};
+
+Decision TakeAll(const AsyncTaskPtr&)
+{
+  return Decision::TAKE;
+}
+
+/**
+ * @brief A task which measures how long it waited in the queue.
+ */
+class BenchmarkTask : public AsyncTask
+{
+public:
+  BenchmarkTask(PriorityType priority, std::atomic<uint64_t>& totalLatency, std::atomic<uint32_t>& processedCount)
+  : AsyncTask(MakeCallback(&TestTaskCompleted), priority),
+    mTotalLatency(totalLatency),
+    mProcessedCount(processedCount)
+  {
+  }
+
+  void MarkEnqueued()
+  {
+    mEnqueueTime = std::chrono::steady_clock::now();
+  }
+
+  void Process() override
+  {
+    const auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mEnqueueTime).count();
+    mTotalLatency.fetch_add(static_cast<uint64_t>(latency), std::memory_order_relaxed);
+
+    // A little work, so workers don't only hammer the queue.
+    volatile uint32_t sum = 0u;
+    for(uint32_t i = 0u; i < 256u; ++i)
+    {
+      sum = sum + i;
+    }
+    mProcessedCount.fetch_add(1u, std::memory_order_release);
+  }
+
+  Dali::StringView GetTaskName() const override
+  {
+    return "BenchmarkTask";
+  }
+
+private:
+  std::atomic<uint64_t>&                mTotalLatency;
+  std::atomic<uint32_t>&                mProcessedCount;
+  std::chrono::steady_clock::time_point mEnqueueTime;
+};
+
+struct BenchmarkResult
+{
+  uint32_t processedCount;
+  double   tasksPerSecond;
+  double   averageLatencyMicroseconds;
+};
+
+/**
+ * @brief Add a burst of tasks to a real AsyncTaskManager from this thread, and wait until its workers ran them.
+ *
+ * @param[in] workStealing Whether the manager uses the work-stealing scheduler.
+ * @param[in] workerCount The number of worker threads.
+ * @param[in] lowPriorityWorkerCount The number of worker threads which may run LOW priority tasks.
+ * @param[in] taskCount The number of tasks in the burst. One in four is LOW priority.
+ */
+BenchmarkResult RunManagerBenchmark(bool workStealing, uint32_t workerCount, uint32_t lowPriorityWorkerCount, uint32_t taskCount)
+{
+  // The manager reads its configuration when it is created.
+  EnvironmentVariable::SetTestEnvironmentVariable(DALI_ENV_ASYNC_MANAGER_WORK_STEALING, workStealing ? "1" : "0");
+  EnvironmentVariable::SetTestEnvironmentVariable(DALI_ENV_ASYNC_MANAGER_THREAD_POOL_SIZE, std::to_string(workerCount).c_str());
+  EnvironmentVariable::SetTestEnvironmentVariable(DALI_ENV_ASYNC_MANAGER_LOW_PRIORITY_THREAD_POOL_SIZE, std::to_string(lowPriorityWorkerCount).c_str());
+
+  std::atomic<uint64_t> totalLatency(0u);
+  std::atomic<uint32_t> processedCount(0u);
+
+  std::vector<IntrusivePtr<BenchmarkTask>> tasks;
+  tasks.reserve(taskCount);
+  for(uint32_t i = 0u; i < taskCount; ++i)
+  {
+    tasks.push_back(new BenchmarkTask((i % 4u == 3u) ? AsyncTask::PriorityType::LOW : AsyncTask::PriorityType::HIGH, totalLatency, processedCount));
+  }
+
+  IntrusivePtr<Internal::Adaptor::AsyncTaskManager> manager = new Internal::Adaptor::AsyncTaskManager();
+
+  const auto start    = std::chrono::steady_clock::now();
+  const auto deadline = start + std::chrono::seconds(60);
+  for(auto& task : tasks)
+  {
+    task->MarkEnqueued();
+    manager->AddTask(AsyncTaskPtr(task.Get()));
+  }
+  while(processedCount.load(std::memory_order_acquire) < taskCount && std::chrono::steady_clock::now() < deadline)
+  {
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+  const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  // Joins the worker threads. The completion callbacks never run, as there is no event loop.
+  manager.Reset();
+
+  const uint32_t processed = processedCount.load();
+  return BenchmarkResult{processed, processed / seconds, processed ? static_cast<double>(totalLatency.load()) / processed / 1000.0 : 0.0};
+}
+
+} // namespace
+
+void utc_dali_internal_async_task_work_stealing_queue_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_async_task_work_stealing_queue_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliWorkStealingTaskQueuePriority(void)
+{
+  tet_infoline("Test HIGH priority tasks are taken before LOW priority tasks, from every deque");
+
+  WorkStealingTaskQueue queue(2u);
+  AsyncTaskPtr          lowTask   = new TestTask(AsyncTask::PriorityType::LOW);
+  AsyncTaskPtr          highTask1 = new TestTask(AsyncTask::PriorityType::HIGH);
+  AsyncTaskPtr          highTask2 = new TestTask(AsyncTask::PriorityType::HIGH);
+
+  queue.Push(lowTask);
+  queue.Push(highTask1);
+  queue.Push(highTask2);
+  DALI_TEST_EQUALS(queue.GetCount(), 3u, TEST_LOCATION);
+
+  AsyncTaskPtr first  = queue.Pop(TakeAll);
+  AsyncTaskPtr second = queue.Pop(TakeAll);
+  AsyncTaskPtr third  = queue.Pop(TakeAll);
+
+  DALI_TEST_CHECK(first == highTask1 || first == highTask2);
+  DALI_TEST_CHECK(second == highTask1 || second == highTask2);
+  DALI_TEST_CHECK(first != second);
+  DALI_TEST_CHECK(third == lowTask);
+  DALI_TEST_CHECK(!queue.Pop(TakeAll));
+  DALI_TEST_CHECK(queue.IsEmpty());
+
+  END_TEST;
+}
+
+int UtcDaliWorkStealingTaskQueueSkipPriority(void)
+{
+  tet_infoline("Test a skipped priority leaves its tasks queued");
+
+  WorkStealingTaskQueue queue(4u);
+  for(uint32_t i = 0u; i < 8u; ++i)
+  {
+    queue.Push(new TestTask(AsyncTask::PriorityType::LOW));
+  }
+
+  uint32_t decideCount = 0u;
+  auto     skipLow     = [&](const AsyncTaskPtr& task)
+  {
+    ++decideCount;
+    return task->GetPriorityType() == AsyncTask::PriorityType::LOW ? Decision::SKIP_PRIORITY : Decision::TAKE;
+  };
+
+  DALI_TEST_CHECK(!queue.Pop(skipLow));
+  DALI_TEST_EQUALS(decideCount, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(queue.GetCount(), 8u, TEST_LOCATION);
+
+  AsyncTaskPtr highTask = new TestTask(AsyncTask::PriorityType::HIGH);
+  queue.Push(highTask);
+  DALI_TEST_CHECK(queue.Pop(skipLow) == highTask);
+  DALI_TEST_EQUALS(queue.GetCount(), 8u, TEST_LOCATION);
+
+  // SKIP only leaves the one task, and tries every other task of every deque.
+  decideCount = 0u;
+  DALI_TEST_CHECK(!queue.Pop([&](const AsyncTaskPtr&)
+  {
+    ++decideCount;
+    return Decision::SKIP;
+  }));
+  DALI_TEST_EQUALS(decideCount, 8u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliWorkStealingTaskQueueSkip(void)
+{
+  tet_infoline("Test a skipped task doesn't block the tasks behind it, and keeps its place");
+
+  WorkStealingTaskQueue queue(1u);
+  AsyncTaskPtr          runningTask = new TestTask();
+  AsyncTaskPtr          nextTask    = new TestTask();
+  AsyncTaskPtr          lastTask    = new TestTask();
+
+  queue.Push(runningTask);
+  queue.Push(nextTask);
+  queue.Push(lastTask);
+
+  // As AsyncTaskManager does for a task which another worker is running.
+  auto skipRunning = [&](const AsyncTaskPtr& task)
+  {
+    return task == runningTask ? Decision::SKIP : Decision::TAKE;
+  };
+
+  DALI_TEST_CHECK(queue.Pop(skipRunning) == nextTask);
+  DALI_TEST_CHECK(queue.Pop(skipRunning) == lastTask);
+  DALI_TEST_CHECK(!queue.Pop(skipRunning));
+  DALI_TEST_EQUALS(queue.GetCount(), 1u, TEST_LOCATION);
+
+  DALI_TEST_CHECK(queue.Pop(TakeAll) == runningTask);
+  DALI_TEST_CHECK(queue.IsEmpty());
+
+  END_TEST;
+}
+
+int UtcDaliWorkStealingTaskQueueRemove(void)
+{
+  tet_infoline("Test every entry of a removed task leaves the queue, keeping the order of the others");
+
+  WorkStealingTaskQueue queue(1u);
+  AsyncTaskPtr          task = new TestTask();
+  std::vector<AsyncTaskPtr> others;
+
+  // Enough tasks to grow the ring buffer.
+  for(uint32_t i = 0u; i < 40u; ++i)
+  {
+    if(i % 10u == 0u)
+    {
+      queue.Push(task);
+    }
+    others.push_back(new TestTask());
+    queue.Push(others.back());
+  }
+  DALI_TEST_EQUALS(queue.GetCount(), 44u, TEST_LOCATION);
+
+  uint32_t visitCount = 0u;
+  {
+    WorkStealingTaskQueue::ScopedLock lock(queue);
+    queue.ForEachLocked([&](const AsyncTaskPtr& queuedTask)
+    {
+      visitCount += (queuedTask == task) ? 1u : 0u;
+    });
+  }
+  DALI_TEST_EQUALS(visitCount, 4u, TEST_LOCATION);
+
+  DALI_TEST_EQUALS(queue.Remove(task.Get()), 4u, TEST_LOCATION);
+  DALI_TEST_EQUALS(queue.Remove(task.Get()), 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(queue.GetCount(), 40u, TEST_LOCATION);
+  DALI_TEST_EQUALS(task->ReferenceCount(), 1, TEST_LOCATION);
+
+  for(auto& other : others)
+  {
+    DALI_TEST_CHECK(queue.Pop(TakeAll) == other);
+  }
+  DALI_TEST_CHECK(queue.IsEmpty());
+
+  END_TEST;
+}
+
+int UtcDaliWorkStealingTaskQueueSteal(void)
+{
+  tet_infoline("Test tasks added by a worker go to its own deque, and idle workers steal them");
+
+  constexpr uint32_t TASK_COUNT = 100u;
+
+  WorkStealingTaskQueue queue(2u);
+  uint32_t              producerIndex = 2u;
+  uint32_t              thiefIndex    = 2u;
+  uint32_t              ownCount      = 0u;
+  uint32_t              stolenCount   = 0u;
+
+  std::thread producer([&]()
+  {
+    producerIndex = queue.RegisterCurrentThread();
+    for(uint32_t i = 0u; i < TASK_COUNT; ++i)
+    {
+      queue.Push(new TestTask());
+    }
+    // Take one from our own deque.
+    ownCount += queue.Pop(TakeAll) ? 1u : 0u;
+  });
+  producer.join();
+
+  std::thread thief([&]()
+  {
+    thiefIndex = queue.RegisterCurrentThread();
+    while(queue.Pop(TakeAll))
+    {
+      ++stolenCount;
+    }
+  });
+  thief.join();
+
+  DALI_TEST_EQUALS(producerIndex, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(thiefIndex, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(ownCount, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(stolenCount, TASK_COUNT - 1u, TEST_LOCATION);
+
+  // Every worker slot is taken, and this thread isn't a worker.
+  DALI_TEST_EQUALS(queue.RegisterCurrentThread(), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(queue.GetCurrentWorkerIndex(), 2u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliWorkStealingTaskQueueBenchmark(void)
+{
+  tet_infoline("Compare the throughput and latency of a burst of tasks through AsyncTaskManager with both schedulers");
+
+  TestApplication application;
+
+  constexpr uint32_t WORKER_COUNT       = 8u;
+  constexpr uint32_t LOW_PRIORITY_COUNT = 6u;
+  constexpr uint32_t TASK_COUNT         = 20000u;
+
+  const BenchmarkResult listResult     = RunManagerBenchmark(false, WORKER_COUNT, LOW_PRIORITY_COUNT, TASK_COUNT);
+  const BenchmarkResult stealingResult = RunManagerBenchmark(true, WORKER_COUNT, LOW_PRIORITY_COUNT, TASK_COUNT);
+
+  tet_printf("AsyncTaskManager, %u workers, %u tasks\n", WORKER_COUNT, TASK_COUNT);
+  tet_printf("  list          %.0f tasks/s, enqueue to start %.1f us\n", listResult.tasksPerSecond, listResult.averageLatencyMicroseconds);
+  tet_printf("  work stealing %.0f tasks/s, enqueue to start %.1f us\n", stealingResult.tasksPerSecond, stealingResult.averageLatencyMicroseconds);
+
+  DALI_TEST_EQUALS(listResult.processedCount, TASK_COUNT, TEST_LOCATION);
+  DALI_TEST_EQUALS(stealingResult.processedCount, TASK_COUNT, TEST_LOCATION);
+
+  EnvironmentVariable::SetTestEnvironmentVariable(DALI_ENV_ASYNC_MANAGER_WORK_STEALING, "0");
+
+  END_TEST;
+}
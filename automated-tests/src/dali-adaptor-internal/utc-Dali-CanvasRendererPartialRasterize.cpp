@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstring>
+#include <functional>
+#include <utility>
+
+#include <adaptor-environment-variable.h>
+#include <dali-test-suite-utils.h>
+#include <dali/internal/canvas-renderer/generic/canvas-renderer-impl-generic.h>
+#include <dali/internal/system/common/environment-variables.h>
+#include <dali/public-api/adaptor-framework/canvas-renderer/canvas-renderer-drawable-group.h>
+#include <dali/public-api/adaptor-framework/canvas-renderer/canvas-renderer-shape.h>
+
+using namespace Dali;
+using Dali::Internal::Adaptor::CanvasRendererGeneric;
+
+namespace
+{
+const Vector2 VIEW_BOX(100.0f, 100.0f);
+
+using ShapePair = std::pair<Dali::CanvasRenderer::Shape, Dali::CanvasRenderer::Shape>;
+
+/**
+ * @brief Makes a canvas renderer, which rasterizes only the changed region or the whole buffer.
+ */
+Dali::CanvasRenderer MakeCanvasRenderer(bool partialRasterize)
+{
+  EnvironmentVariable::SetTestEnvironmentVariable(DALI_ENV_CANVAS_RENDERER_PARTIAL_RASTERIZE, partialRasterize ? "1" : "0");
+  Dali::CanvasRenderer canvasRenderer(CanvasRendererGeneric::New(VIEW_BOX).Get());
+  EnvironmentVariable::SetTestEnvironmentVariable(DALI_ENV_CANVAS_RENDERER_PARTIAL_RASTERIZE, "0");
+  return canvasRenderer;
+}
+
+Dali::CanvasRenderer::Shape MakeRect(float x, float y, float width, float height, const Vector4& color)
+{
+  Dali::CanvasRenderer::Shape shape = Dali::CanvasRenderer::Shape::New();
+  shape.AddRect(Rect<float>(x, y, width, height), Vector2::ZERO);
+  shape.SetFillColor(color);
+  return shape;
+}
+
+/**
+ * @brief The same drawables, added to a canvas renderer rasterizing the changed region and to one rasterizing the whole buffer.
+ */
+struct TestCanvases
+{
+  TestCanvases()
+  : partial(MakeCanvasRenderer(true)),
+    full(MakeCanvasRenderer(false))
+  {
+  }
+
+  /**
+   * @brief Makes the same drawables for both canvas renderers, and adds them.
+   */
+  template<typename T>
+  std::pair<T, T> Add(std::function<T()> make)
+  {
+    std::pair<T, T> drawables(make(), make());
+    partial.AddDrawable(drawables.first);
+    full.AddDrawable(drawables.second);
+    return drawables;
+  }
+
+  /**
+   * @brief Rasterizes both canvas renderers, and checks the buffers are the same.
+   */
+  bool RasterizeAndCompare()
+  {
+    partial.Commit();
+    partial.Rasterize();
+    full.Commit();
+    full.Rasterize();
+
+    Dali::PixelBuffer partialBuffer = static_cast<CanvasRendererGeneric&>(Internal::Adaptor::GetImplementation(partial)).GetTargetBuffer();
+    Dali::PixelBuffer fullBuffer    = static_cast<CanvasRendererGeneric&>(Internal::Adaptor::GetImplementation(full)).GetTargetBuffer();
+    if(!partialBuffer || !fullBuffer)
+    {
+      // Nothing is rasterized without ThorVG.
+      return !partialBuffer && !fullBuffer;
+    }
+
+    if(partialBuffer.GetWidth() != fullBuffer.GetWidth() || partialBuffer.GetHeight() != fullBuffer.GetHeight())
+    {
+      return false;
+    }
+    return memcmp(partialBuffer.GetBuffer(), fullBuffer.GetBuffer(), partialBuffer.GetWidth() * partialBuffer.GetHeight() * Pixel::GetBytesPerPixel(partialBuffer.GetPixelFormat())) == 0;
+  }
+
+  Dali::CanvasRenderer partial;
+  Dali::CanvasRenderer full;
+};
+
+} // namespace
+
+int UtcDaliCanvasRendererPartialRasterizeShapes(void)
+{
+  tet_infoline("Test the partial rasterization of moved and removed shapes is the same as the full rasterization");
+
+  TestApplication application;
+
+  TestCanvases canvases;
+
+  // A translucent background, blended with the shapes above it.
+  canvases.Add<Dali::CanvasRenderer::Shape>([]() { return MakeRect(0.0f, 0.0f, 100.0f, 100.0f, Vector4(0.0f, 0.0f, 1.0f, 0.5f)); });
+
+  auto moving  = canvases.Add<Dali::CanvasRenderer::Shape>([]() { return MakeRect(10.0f, 10.0f, 20.0f, 20.0f, Color::RED); });
+  auto removed = canvases.Add<Dali::CanvasRenderer::Shape>([]() { return MakeRect(60.0f, 60.0f, 10.0f, 10.0f, Color::GREEN); });
+  DALI_TEST_CHECK(canvases.RasterizeAndCompare());
+
+  // Move.
+  moving.first.Translate(Vector2(15.0f, 5.0f));
+  moving.second.Translate(Vector2(15.0f, 5.0f));
+  DALI_TEST_CHECK(canvases.RasterizeAndCompare());
+
+  // Change the color, and move a shape along with another.
+  moving.first.SetFillColor(Color::YELLOW);
+  moving.second.SetFillColor(Color::YELLOW);
+  removed.first.Translate(Vector2(-5.0f, 0.0f));
+  removed.second.Translate(Vector2(-5.0f, 0.0f));
+  DALI_TEST_CHECK(canvases.RasterizeAndCompare());
+
+  // Remove.
+  canvases.partial.RemoveDrawable(removed.first);
+  canvases.full.RemoveDrawable(removed.second);
+  DALI_TEST_CHECK(canvases.RasterizeAndCompare());
+
+  // Nothing changed.
+  DALI_TEST_CHECK(canvases.RasterizeAndCompare());
+
+  // Move out of the buffer.
+  moving.first.Translate(Vector2(200.0f, 0.0f));
+  moving.second.Translate(Vector2(200.0f, 0.0f));
+  DALI_TEST_CHECK(canvases.RasterizeAndCompare());
+
+  END_TEST;
+}
+
+int UtcDaliCanvasRendererPartialRasterizeGroup(void)
+{
+  tet_infoline("Test the partial rasterization of changed shapes in a group is the same as the full rasterization");
+
+  TestApplication application;
+
+  TestCanvases canvases;
+
+  ShapePair child(MakeRect(10.0f, 10.0f, 10.0f, 10.0f, Color::RED), MakeRect(10.0f, 10.0f, 10.0f, 10.0f, Color::RED));
+  ShapePair nestedChild(MakeRect(50.0f, 10.0f, 10.0f, 10.0f, Color::GREEN), MakeRect(50.0f, 10.0f, 10.0f, 10.0f, Color::GREEN));
+
+  auto nestedGroup = std::make_pair(Dali::CanvasRenderer::DrawableGroup::New(), Dali::CanvasRenderer::DrawableGroup::New());
+  nestedGroup.first.AddDrawable(nestedChild.first);
+  nestedGroup.second.AddDrawable(nestedChild.second);
+
+  // The group is transformed, so its children are drawn elsewhere than their own bounds.
+  auto group = canvases.Add<Dali::CanvasRenderer::DrawableGroup>([]() { return Dali::CanvasRenderer::DrawableGroup::New(); });
+  group.first.AddDrawable(child.first);
+  group.second.AddDrawable(child.second);
+  group.first.AddDrawable(nestedGroup.first);
+  group.second.AddDrawable(nestedGroup.second);
+  group.first.Translate(Vector2(20.0f, 30.0f));
+  group.second.Translate(Vector2(20.0f, 30.0f));
+  DALI_TEST_CHECK(canvases.RasterizeAndCompare());
+
+  // Move a child.
+  child.first.Translate(Vector2(5.0f, 20.0f));
+  child.second.Translate(Vector2(5.0f, 20.0f));
+  DALI_TEST_CHECK(canvases.RasterizeAndCompare());
+
+  // Change the color of a child in a nested group.
+  nestedChild.first.SetFillColor(Color::BLUE);
+  nestedChild.second.SetFillColor(Color::BLUE);
+  DALI_TEST_CHECK(canvases.RasterizeAndCompare());
+
+  // Move the group.
+  group.first.Translate(Vector2(-10.0f, 10.0f));
+  group.second.Translate(Vector2(-10.0f, 10.0f));
+  DALI_TEST_CHECK(canvases.RasterizeAndCompare());
+
+  // Remove a child from the group.
+  group.first.RemoveDrawable(child.first);
+  group.second.RemoveDrawable(child.second);
+  DALI_TEST_CHECK(canvases.RasterizeAndCompare());
+
+  // Empty the group.
+  group.first.RemoveAllDrawables();
+  group.second.RemoveAllDrawables();
+  DALI_TEST_CHECK(canvases.RasterizeAndCompare());
+
+  END_TEST;
+}
+
+int UtcDaliCanvasRendererPartialRasterizeComposition(void)
+{
+  tet_infoline("Test the partial rasterization of changed clip paths and masks is the same as the full rasterization");
+
+  TestApplication application;
+
+  TestCanvases canvases;
+
+  auto clipped = canvases.Add<Dali::CanvasRenderer::Shape>([]() { return MakeRect(0.0f, 0.0f, 50.0f, 50.0f, Color::RED); });
+  auto masked  = canvases.Add<Dali::CanvasRenderer::Shape>([]() { return MakeRect(50.0f, 50.0f, 50.0f, 50.0f, Color::GREEN); });
+
+  ShapePair clip(MakeRect(10.0f, 10.0f, 20.0f, 20.0f, Color::WHITE), MakeRect(10.0f, 10.0f, 20.0f, 20.0f, Color::WHITE));
+  clipped.first.SetClipPath(clip.first);
+  clipped.second.SetClipPath(clip.second);
+
+  // The mask is a group, whose drawables change.
+  ShapePair maskChild(MakeRect(60.0f, 60.0f, 20.0f, 20.0f, Color::WHITE), MakeRect(60.0f, 60.0f, 20.0f, 20.0f, Color::WHITE));
+  auto      mask = std::make_pair(Dali::CanvasRenderer::DrawableGroup::New(), Dali::CanvasRenderer::DrawableGroup::New());
+  mask.first.AddDrawable(maskChild.first);
+  mask.second.AddDrawable(maskChild.second);
+  masked.first.SetMask(mask.first, Dali::CanvasRenderer::Drawable::MaskType::ALPHA);
+  masked.second.SetMask(mask.second, Dali::CanvasRenderer::Drawable::MaskType::ALPHA);
+  DALI_TEST_CHECK(canvases.RasterizeAndCompare());
+
+  // Move the clip path.
+  clip.first.Translate(Vector2(15.0f, 10.0f));
+  clip.second.Translate(Vector2(15.0f, 10.0f));
+  DALI_TEST_CHECK(canvases.RasterizeAndCompare());
+
+  // Move a drawable of the mask.
+  maskChild.first.Translate(Vector2(-5.0f, 10.0f));
+  maskChild.second.Translate(Vector2(-5.0f, 10.0f));
+  DALI_TEST_CHECK(canvases.RasterizeAndCompare());
+
+  // Move the clipped drawable.
+  clipped.first.Translate(Vector2(10.0f, 0.0f));
+  clipped.second.Translate(Vector2(10.0f, 0.0f));
+  DALI_TEST_CHECK(canvases.RasterizeAndCompare());
+
+  END_TEST;
+}
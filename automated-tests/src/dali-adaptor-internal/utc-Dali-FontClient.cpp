@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,8 +23,11 @@
 #include <dali/devel-api/text-abstraction/font-client.h>
 #include <dali/internal/text/text-abstraction/font-client-log.h>
 #include <dali/internal/text/text-abstraction/plugin/font-client-utils.h>
+#include <dali/internal/text/text-abstraction/plugin/font-config-disk-cache.h>
+#include <dali/internal/text/text-abstraction/plugin/shared-glyph-cache.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <iostream>
 
@@ -971,3 +974,316 @@ int UtcDaliFontClientTestBitmapFont(void)
 
   END_TEST;
 }
+
+int UtcDaliFontClientFontConfigDiskCache(void)
+{
+  TestApplication application;
+  tet_infoline(" UtcDaliFontClientFontConfigDiskCache Check the fontconfig results are read back from the file");
+
+  using TextAbstraction::Internal::FontConfigDiskCache;
+
+  char        pathTemplate[] = "/tmp/dali-font-config-cache-XXXXXX";
+  const int   fileDescriptor = mkstemp(pathTemplate);
+  std::string path(pathTemplate);
+  close(fileDescriptor);
+  unlink(path.c_str());
+  setenv("DALI_FONT_CONFIG_CACHE_PATH", path.c_str(), 1);
+
+  FcConfig* fontConfig = FcInitLoadConfigAndFonts();
+
+  FontDescription request;
+  request.family = "DejaVuSans";
+  request.weight = FontWeight::BOLD;
+
+  FontDescription font;
+  font.path   = "/fonts/DejaVuSans-Bold.ttf";
+  font.family = "DejaVu Sans";
+  font.weight = FontWeight::BOLD;
+  font.type   = FontDescription::FACE_FONT;
+
+  FcCharSet* characterSet = FcCharSetCreate();
+  FcCharSetAddChar(characterSet, 'a');
+  FcCharSetAddChar(characterSet, 0xAC00);
+
+  {
+    FontConfigDiskCache cache;
+    DALI_TEST_CHECK(cache.IsEnabled());
+    cache.Load(fontConfig, FontPathList());
+
+    FontDescription foundFont;
+    FcCharSet*      foundCharacterSet = nullptr;
+    DALI_TEST_CHECK(!cache.FindFont(FontConfigDiskCache::RecordType::VALIDATED_FONT, request, foundFont, foundCharacterSet));
+
+    FontList                                    fontList{font};
+    TextAbstraction::Internal::CharacterSetList characterSetList;
+    characterSetList.PushBack(characterSet);
+    cache.CacheFont(FontConfigDiskCache::RecordType::VALIDATED_FONT, request, font, characterSet);
+    cache.CacheFontList(FontConfigDiskCache::RecordType::FONT_LIST, request, fontList, &characterSetList);
+    cache.Save();
+  }
+
+  {
+    FontConfigDiskCache cache;
+    cache.Load(fontConfig, FontPathList());
+
+    FontDescription foundFont;
+    FcCharSet*      foundCharacterSet = nullptr;
+    DALI_TEST_CHECK(cache.FindFont(FontConfigDiskCache::RecordType::VALIDATED_FONT, request, foundFont, foundCharacterSet));
+    DALI_TEST_EQUALS(foundFont.path, font.path, TEST_LOCATION);
+    DALI_TEST_EQUALS(foundFont.family, font.family, TEST_LOCATION);
+    DALI_TEST_EQUALS(foundFont.weight, font.weight, TEST_LOCATION);
+    DALI_TEST_CHECK(foundCharacterSet && FcCharSetEqual(foundCharacterSet, characterSet));
+    FcCharSetDestroy(foundCharacterSet);
+
+    FontList                                    fontList;
+    TextAbstraction::Internal::CharacterSetList characterSetList;
+    DALI_TEST_CHECK(cache.FindFontList(FontConfigDiskCache::RecordType::FONT_LIST, request, fontList, &characterSetList));
+    DALI_TEST_EQUALS(fontList.size(), 1u, TEST_LOCATION);
+    DALI_TEST_EQUALS(characterSetList.Count(), 1u, TEST_LOCATION);
+    DALI_TEST_CHECK(FcCharSetHasChar(characterSetList[0u], 0xAC00));
+    FcCharSetDestroy(characterSetList[0u]);
+
+    tet_infoline("Check a record of another query isn't found");
+    DALI_TEST_CHECK(!cache.FindFontList(FontConfigDiskCache::RecordType::SYSTEM_FONTS, request, fontList, nullptr));
+  }
+
+  tet_infoline("Check the file is ignored once a custom font directory is added");
+  {
+    char*             pathNamePtr = get_current_dir_name();
+    const std::string pathName(pathNamePtr);
+    free(pathNamePtr);
+
+    FontConfigDiskCache cache;
+    cache.Load(fontConfig, FontPathList{pathName + DEFAULT_FONT_DIR});
+
+    FontDescription foundFont;
+    FcCharSet*      foundCharacterSet = nullptr;
+    DALI_TEST_CHECK(!cache.FindFont(FontConfigDiskCache::RecordType::VALIDATED_FONT, request, foundFont, foundCharacterSet));
+  }
+
+  FcCharSetDestroy(characterSet);
+  FcConfigDestroy(fontConfig);
+  unlink(path.c_str());
+  unsetenv("DALI_FONT_CONFIG_CACHE_PATH");
+
+  END_TEST;
+}
+
+int UtcDaliFontClientSharedGlyphCache(void)
+{
+  TestApplication application;
+  tet_infoline(" UtcDaliFontClientSharedGlyphCache Check the glyphs rendered are shared by the font clients");
+
+  using TextAbstraction::Internal::SharedGlyphCache;
+
+  char        pathTemplate[] = "/tmp/dali-glyph-cache-XXXXXX";
+  const int   fileDescriptor = mkstemp(pathTemplate);
+  std::string path(pathTemplate);
+  close(fileDescriptor);
+  unlink(path.c_str());
+  setenv("DALI_SHARED_GLYPH_CACHE_PATH", path.c_str(), 1);
+  setenv("DALI_SHARED_GLYPH_CACHE_SIZE", "1", 1);
+
+  SharedGlyphCache& cache = SharedGlyphCache::Get();
+  DALI_TEST_CHECK(cache.IsEnabled());
+  DALI_TEST_CHECK(!cache.IsFull());
+
+  SharedGlyphCache::Key key;
+  key.fontKey            = SharedGlyphCache::GetFontKey("/fonts/DejaVuSans.ttf", 0u);
+  key.requestedPointSize = 12u * 64u;
+  key.horizontalDpi      = 96u;
+  key.verticalDpi        = 96u;
+  key.index              = 68u;
+
+  TextAbstraction::GlyphBufferData foundData;
+  DALI_TEST_CHECK(!cache.Find(key, foundData));
+
+  uint8_t buffer[] = {0x00, 0x7f, 0xff, 0x7f, 0x00, 0x7f};
+
+  TextAbstraction::GlyphBufferData compressedData;
+  compressedData.buffer          = buffer;
+  compressedData.width           = 3u;
+  compressedData.height          = 2u;
+  compressedData.format          = Pixel::L8;
+  compressedData.compressionType = TextAbstraction::GlyphBufferData::CompressionType::NO_COMPRESSION;
+
+  TextAbstraction::GlyphBufferData addedData;
+  DALI_TEST_CHECK(cache.Add(key, compressedData, sizeof(buffer), addedData));
+  DALI_TEST_CHECK(cache.Find(key, foundData));
+  DALI_TEST_CHECK(foundData.buffer == addedData.buffer);
+  DALI_TEST_CHECK(!foundData.isBufferOwned);
+  DALI_TEST_EQUALS(foundData.width, 3u, TEST_LOCATION);
+  DALI_TEST_EQUALS(foundData.height, 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(memcmp(foundData.buffer, buffer, sizeof(buffer)), 0, TEST_LOCATION);
+
+  tet_infoline("Check the glyph isn't found at another DPI");
+  key.verticalDpi = 120u;
+  DALI_TEST_CHECK(!cache.Find(key, foundData));
+  key.verticalDpi = 96u;
+
+  tet_infoline("Check another glyph isn't found");
+  key.isBoldRequired = true;
+  DALI_TEST_CHECK(!cache.Find(key, foundData));
+
+  tet_infoline("Check an entry whose buffer is smaller than its size isn't returned");
+  compressedData.width = 300u;
+  DALI_TEST_CHECK(!cache.Add(key, compressedData, sizeof(buffer), addedData));
+  DALI_TEST_CHECK(!cache.Find(key, foundData));
+  compressedData.width = 3u;
+
+  tet_infoline("Check a glyph rendered by a font client is used by another one");
+  char*             pathNamePtr = get_current_dir_name();
+  const std::string pathName(pathNamePtr);
+  free(pathNamePtr);
+
+  TextAbstraction::FontDescription fontDescription;
+  fontDescription.path   = pathName + DEFAULT_FONT_DIR + "/dejavu/DejaVuSans.ttf";
+  fontDescription.family = "DejaVuSans";
+
+  const uint32_t pointSize = 20u * TextAbstraction::FontClient::NUMBER_OF_POINTS_PER_ONE_UNIT_OF_POINT_SIZE;
+
+  const uint32_t dpi[] = {96u, 120u, 96u};
+
+  TextAbstraction::GlyphBufferData glyphBufferData[3u];
+  for(uint32_t index = 0u; index < 3u; ++index)
+  {
+    TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::New(dpi[index], dpi[index]);
+    TextAbstraction::FontId     fontId     = fontClient.GetFontId(fontDescription, pointSize);
+    fontClient.CreateBitmap(fontId, 68, false, false, glyphBufferData[index], 0);
+    DALI_TEST_CHECK(glyphBufferData[index].buffer != nullptr);
+  }
+
+  tet_infoline("Check a glyph rendered at another DPI isn't used");
+  DALI_TEST_CHECK(glyphBufferData[0u].buffer != glyphBufferData[1u].buffer);
+  DALI_TEST_CHECK(glyphBufferData[0u].width < glyphBufferData[1u].width);
+  DALI_TEST_CHECK(glyphBufferData[0u].buffer == glyphBufferData[2u].buffer);
+  DALI_TEST_EQUALS(glyphBufferData[0u].width, glyphBufferData[2u].width, TEST_LOCATION);
+
+  unlink(path.c_str());
+  unsetenv("DALI_SHARED_GLYPH_CACHE_PATH");
+  unsetenv("DALI_SHARED_GLYPH_CACHE_SIZE");
+
+  END_TEST;
+}
+
+int UtcDaliFontClientCreateDistanceFieldBitmap(void)
+{
+  TestApplication application;
+  tet_infoline(" UtcDaliFontClientCreateDistanceFieldBitmap Check a distance field is created once for any point size");
+
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+
+  char*             pathNamePtr = get_current_dir_name();
+  const std::string pathName(pathNamePtr);
+  free(pathNamePtr);
+
+  const std::string fontPath = pathName + DEFAULT_FONT_DIR + "/dejavu/DejaVuSans.ttf";
+
+  TextAbstraction::FontId     fontId     = fontClient.GetFontId(fontPath, 20u * TextAbstraction::FontClient::NUMBER_OF_POINTS_PER_ONE_UNIT_OF_POINT_SIZE);
+  TextAbstraction::GlyphIndex glyphIndex = fontClient.GetGlyphIndex(fontId, 'O');
+
+  TextAbstraction::GlyphBufferData data;
+  TextAbstraction::GlyphInfo       glyphInfo;
+  DALI_TEST_CHECK(fontClient.CreateDistanceFieldBitmap(fontId, glyphIndex, data, glyphInfo));
+  DALI_TEST_CHECK(data.buffer != nullptr);
+  DALI_TEST_CHECK(!data.isBufferOwned);
+  DALI_TEST_EQUALS(data.format, Pixel::L8, TEST_LOCATION);
+
+  // The field is sampled per em, and spreads around the outline.
+  const float spread = static_cast<float>(TextAbstraction::FontClient::DISTANCE_FIELD_SPREAD) / static_cast<float>(TextAbstraction::FontClient::DISTANCE_FIELD_PIXELS_PER_EM);
+  DALI_TEST_EQUALS(glyphInfo.width, static_cast<float>(data.width) / static_cast<float>(TextAbstraction::FontClient::DISTANCE_FIELD_PIXELS_PER_EM), Math::MACHINE_EPSILON_100, TEST_LOCATION);
+  DALI_TEST_GREATER(glyphInfo.width, 2.f * spread, TEST_LOCATION);
+  DALI_TEST_GREATER(glyphInfo.advance, 0.f, TEST_LOCATION);
+
+  tet_infoline("Check the corner of the field is outside of the glyph, and the ring of the 'O' is inside");
+  DALI_TEST_CHECK(data.buffer[0] < 128u);
+  DALI_TEST_CHECK(data.buffer[(data.height / 2u) * data.width + TextAbstraction::FontClient::DISTANCE_FIELD_SPREAD + 4u] >= 128u);
+
+  tet_infoline("Check the field is cached");
+  TextAbstraction::GlyphBufferData cachedData;
+  TextAbstraction::GlyphInfo       cachedGlyphInfo;
+  DALI_TEST_CHECK(fontClient.CreateDistanceFieldBitmap(fontId, glyphIndex, cachedData, cachedGlyphInfo));
+  DALI_TEST_CHECK(cachedData.buffer == data.buffer);
+
+  tet_infoline("Check a space has no field");
+  TextAbstraction::GlyphBufferData spaceData;
+  DALI_TEST_CHECK(fontClient.CreateDistanceFieldBitmap(fontId, fontClient.GetGlyphIndex(fontId, ' '), spaceData, glyphInfo));
+  DALI_TEST_EQUALS(spaceData.width, 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliFontClientCreateBitmaps(void)
+{
+  TestApplication application;
+  tet_infoline(" UtcDaliFontClientCreateBitmaps Check the glyphs rasterized in parallel are the ones of CreateBitmap");
+
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+
+  char*             pathNamePtr = get_current_dir_name();
+  const std::string pathName(pathNamePtr);
+  free(pathNamePtr);
+
+  const std::string fontPath = pathName + DEFAULT_FONT_DIR + "/dejavu/DejaVuSans.ttf";
+
+  TextAbstraction::FontId fontIds[] = {fontClient.GetFontId(fontPath, 20u * TextAbstraction::FontClient::NUMBER_OF_POINTS_PER_ONE_UNIT_OF_POINT_SIZE),
+                                       fontClient.GetFontId(fontPath, 35u * TextAbstraction::FontClient::NUMBER_OF_POINTS_PER_ONE_UNIT_OF_POINT_SIZE)};
+
+  // Enough glyphs to wake the worker threads, with styles and outlines.
+  const std::string text = "Hello World! 0123456789 The quick brown fox";
+
+  std::vector<TextAbstraction::FontClient::BitmapRequest> requests;
+  for(const auto fontId : fontIds)
+  {
+    for(std::size_t index = 0u; index < text.size(); ++index)
+    {
+      TextAbstraction::FontClient::BitmapRequest request;
+      request.fontId           = fontId;
+      request.glyphIndex       = fontClient.GetGlyphIndex(fontId, text[index]);
+      request.isItalicRequired = (index % 3u == 1u);
+      request.isBoldRequired   = (index % 4u == 2u);
+      request.outlineWidth     = (index % 5u == 3u) ? 2 : 0;
+      requests.push_back(request);
+    }
+  }
+
+  // A font which doesn't exist.
+  TextAbstraction::FontClient::BitmapRequest invalidRequest;
+  invalidRequest.fontId     = 9999u;
+  invalidRequest.glyphIndex = 1u;
+  requests.push_back(invalidRequest);
+
+  std::vector<TextAbstraction::GlyphBufferData> bitmaps;
+  fontClient.CreateBitmaps(requests, bitmaps);
+  DALI_TEST_EQUALS(bitmaps.size(), requests.size(), TEST_LOCATION);
+
+  for(std::size_t index = 0u; index + 1u < requests.size(); ++index)
+  {
+    const auto& request = requests[index];
+    const auto& bitmap  = bitmaps[index];
+
+    TextAbstraction::GlyphBufferData data;
+    fontClient.CreateBitmap(request.fontId, request.glyphIndex, request.isItalicRequired, request.isBoldRequired, data, request.outlineWidth);
+
+    DALI_TEST_EQUALS(bitmap.width, data.width, TEST_LOCATION);
+    DALI_TEST_EQUALS(bitmap.height, data.height, TEST_LOCATION);
+    DALI_TEST_EQUALS(bitmap.format, data.format, TEST_LOCATION);
+    DALI_TEST_EQUALS(bitmap.compressionType, TextAbstraction::GlyphBufferData::CompressionType::NO_COMPRESSION, TEST_LOCATION);
+
+    const std::size_t bufferSize = static_cast<std::size_t>(data.width) * data.height * Pixel::GetBytesPerPixel(data.format);
+    if(bufferSize > 0u)
+    {
+      DALI_TEST_CHECK(bitmap.isBufferOwned);
+
+      std::vector<uint8_t> expected(bufferSize);
+      TextAbstraction::GlyphBufferData::Decompress(data, expected.data());
+      DALI_TEST_CHECK(memcmp(bitmap.buffer, expected.data(), bufferSize) == 0);
+    }
+  }
+
+  tet_infoline("Check the glyph of the invalid font is empty");
+  DALI_TEST_CHECK(bitmaps.back().buffer == nullptr);
+  DALI_TEST_EQUALS(bitmaps.back().width, 0u, TEST_LOCATION);
+
+  END_TEST;
+}
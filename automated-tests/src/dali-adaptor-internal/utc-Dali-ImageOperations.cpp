@@ -16,11 +16,18 @@
  */
 
 #include <dali-test-suite-utils.h>
+#include <dali/devel-api/adaptor-framework/pixel-buffer-devel.h>
 #include <dali/devel-api/common/ref-counted-dali-vector.h>
+#include <dali/internal/imaging/common/image-operations-parallel.h>
+#include <dali/internal/imaging/common/image-operations-simd.h>
 #include <dali/internal/imaging/common/image-operations.h>
 
 #include <sys/mman.h>
 #include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <vector>
 
 using namespace Dali::Internal::Platform;
 
@@ -1644,3 +1651,379 @@ int UtcDaliImageOperationsBilinearFilter1BPP(void)
 
   END_TEST;
 }
+
+namespace
+{
+using ImageOperationsSimd::InstructionSet;
+
+typedef void (*DownscaleFunction)(uint8_t*, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, BoxDimensionTest, uint32_t&, uint32_t&, uint32_t&);
+
+struct DownscaleKernel
+{
+  const char*       name;
+  uint32_t          bytesPerPixel;
+  DownscaleFunction function;
+};
+
+const DownscaleKernel DOWNSCALE_KERNELS[] = {
+  {"RGBA8888", 4u, DownscaleInPlacePow2RGBA8888},
+  {"RGB888", 3u, DownscaleInPlacePow2RGB888},
+  {"LA88", 2u, DownscaleInPlacePow2ComponentPair},
+  {"L8", 1u, DownscaleInPlacePow2SingleBytePerPixel},
+};
+
+/**
+ * @brief Fill a buffer with reproducible random bytes.
+ */
+void FillRandomBytes(Dali::Vector<uint8_t>& buffer, uint32_t size, long seed)
+{
+  buffer.ResizeUninitialized(size);
+  srand48(seed);
+  for(uint32_t i = 0; i < size; ++i)
+  {
+    buffer[i] = static_cast<uint8_t>(RandomComponent8());
+  }
+}
+
+/**
+ * @brief Run a downscale on a copy of the source with the given instruction set.
+ */
+void RunDownscale(const DownscaleKernel& kernel, InstructionSet instructionSet, const Dali::Vector<uint8_t>& source, uint32_t width, uint32_t height, Dali::Vector<uint8_t>& result)
+{
+  ImageOperationsSimd::SetInstructionSet(instructionSet);
+  result = source;
+
+  uint32_t outWidth, outHeight, outStride;
+  kernel.function(result.Begin(), width, height, width * kernel.bytesPerPixel, width / 8u, height / 8u, BoxDimensionTestBoth, outWidth, outHeight, outStride);
+  result.Resize(outStride * outHeight);
+}
+
+/**
+ * @return The time taken to run the function the given number of times, in microseconds.
+ */
+template<typename Function>
+double MeasureMicroseconds(uint32_t iterations, Function function)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for(uint32_t i = 0; i < iterations; ++i)
+  {
+    function();
+  }
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+/**
+ * @brief Test the vectorized kernels give exactly the same results as the scalar code.
+ */
+int UtcDaliImageOperationsSimdMatchesScalar(void)
+{
+  const InstructionSet supported = ImageOperationsSimd::GetSupportedInstructionSet();
+  tet_printf("Supported instruction set: %s\n", ImageOperationsSimd::GetInstructionSetName(supported));
+
+  // Odd sizes leave a scalar tail on every scanline.
+  const uint32_t width  = 517u;
+  const uint32_t height = 263u;
+
+  for(const auto& kernel : DOWNSCALE_KERNELS)
+  {
+    Dali::Vector<uint8_t> source, scalarResult, simdResult;
+    FillRandomBytes(source, width * height * kernel.bytesPerPixel, 19 * 23 * 47);
+
+    RunDownscale(kernel, InstructionSet::NONE, source, width, height, scalarResult);
+    RunDownscale(kernel, supported, source, width, height, simdResult);
+
+    DALI_TEST_EQUALS(scalarResult.Count(), simdResult.Count(), TEST_LOCATION);
+    DALI_TEST_CHECK(memcmp(scalarResult.Begin(), simdResult.Begin(), scalarResult.Count()) == 0);
+  }
+
+  Dali::Vector<uint8_t> source;
+  FillRandomBytes(source, width * height * 4u, 53 * 59);
+
+  const ImageDimensions desiredSizes[] = {ImageDimensions(123u, 77u), ImageDimensions(31u, 250u), ImageDimensions(700u, 300u)};
+  for(const auto& desired : desiredSizes)
+  {
+    const uint32_t        outputSize = desired.GetWidth() * desired.GetHeight() * 4u;
+    Dali::Vector<uint8_t> scalarResult, simdResult;
+    scalarResult.Resize(outputSize, 0u);
+    simdResult.Resize(outputSize, 0u);
+
+    ImageOperationsSimd::SetInstructionSet(InstructionSet::NONE);
+    LinearSample4BPP(source.Begin(), ImageDimensions(width, height), width * 4u, scalarResult.Begin(), desired);
+    ImageOperationsSimd::SetInstructionSet(supported);
+    LinearSample4BPP(source.Begin(), ImageDimensions(width, height), width * 4u, simdResult.Begin(), desired);
+    DALI_TEST_CHECK(memcmp(scalarResult.Begin(), simdResult.Begin(), outputSize) == 0);
+
+    if(desired.GetWidth() <= width && desired.GetHeight() <= height)
+    {
+      ImageOperationsSimd::SetInstructionSet(InstructionSet::NONE);
+      PointSample4BPP(source.Begin(), width, height, width * 4u, scalarResult.Begin(), desired.GetWidth(), desired.GetHeight());
+      ImageOperationsSimd::SetInstructionSet(supported);
+      PointSample4BPP(source.Begin(), width, height, width * 4u, simdResult.Begin(), desired.GetWidth(), desired.GetHeight());
+      DALI_TEST_CHECK(memcmp(scalarResult.Begin(), simdResult.Begin(), outputSize) == 0);
+    }
+  }
+
+  ImageOperationsSimd::SetInstructionSet(supported);
+  END_TEST;
+}
+
+/**
+ * @brief Micro-benchmark of the scalar and vectorized kernels, per pixel format.
+ */
+int UtcDaliImageOperationsSimdBenchmark(void)
+{
+  const InstructionSet supported  = ImageOperationsSimd::GetSupportedInstructionSet();
+  const uint32_t       width      = 1920u;
+  const uint32_t       height     = 1080u;
+  const uint32_t       iterations = 10u;
+  const double         pixels     = static_cast<double>(width) * height * iterations;
+
+  for(const auto& kernel : DOWNSCALE_KERNELS)
+  {
+    Dali::Vector<uint8_t> source, result;
+    FillRandomBytes(source, width * height * kernel.bytesPerPixel, 7);
+
+    const double scalarTime = MeasureMicroseconds(iterations, [&]() { RunDownscale(kernel, InstructionSet::NONE, source, width, height, result); });
+    const double simdTime   = MeasureMicroseconds(iterations, [&]() { RunDownscale(kernel, supported, source, width, height, result); });
+
+    tet_printf("DownscaleInPlacePow2 %-8s scalar %.3f ns/px, %s %.3f ns/px, speedup x%.2f\n", kernel.name, scalarTime * 1000.0 / pixels, ImageOperationsSimd::GetInstructionSetName(supported), simdTime * 1000.0 / pixels, scalarTime / simdTime);
+    DALI_TEST_CHECK(simdTime > 0.0);
+  }
+
+  Dali::Vector<uint8_t> source, result;
+  FillRandomBytes(source, width * height * 4u, 11);
+  result.Resize((width / 3u) * (height / 3u) * 4u);
+
+  const ImageDimensions inputSize(width, height);
+  const ImageDimensions outputSize(width / 3u, height / 3u);
+
+  const char* const names[] = {"LinearSample4BPP", "PointSample4BPP"};
+  for(uint32_t kernel = 0u; kernel < 2u; ++kernel)
+  {
+    auto sample = [&]() {
+      if(kernel == 0u)
+      {
+        LinearSample4BPP(source.Begin(), inputSize, width * 4u, result.Begin(), outputSize);
+      }
+      else
+      {
+        PointSample4BPP(source.Begin(), width, height, width * 4u, result.Begin(), outputSize.GetWidth(), outputSize.GetHeight());
+      }
+    };
+
+    ImageOperationsSimd::SetInstructionSet(InstructionSet::NONE);
+    const double scalarTime = MeasureMicroseconds(iterations, sample);
+    ImageOperationsSimd::SetInstructionSet(supported);
+    const double simdTime = MeasureMicroseconds(iterations, sample);
+
+    const double outputPixels = static_cast<double>(outputSize.GetWidth()) * outputSize.GetHeight() * iterations;
+    tet_printf("%s scalar %.3f ns/px, %s %.3f ns/px, speedup x%.2f\n", names[kernel], scalarTime * 1000.0 / outputPixels, ImageOperationsSimd::GetInstructionSetName(supported), simdTime * 1000.0 / outputPixels, scalarTime / simdTime);
+    DALI_TEST_CHECK(simdTime > 0.0);
+  }
+
+  END_TEST;
+}
+
+namespace
+{
+/**
+ * @brief Blur a copy of the source with the given instruction set.
+ */
+Dali::PixelBuffer RunGaussianBlur(InstructionSet instructionSet, const Dali::Vector<uint8_t>& source, uint32_t width, uint32_t height, Dali::Pixel::Format format, float blurRadius, Dali::DevelPixelBuffer::GaussianBlurMode mode)
+{
+  ImageOperationsSimd::SetInstructionSet(instructionSet);
+  Dali::PixelBuffer pixelBuffer = Dali::PixelBuffer::New(width, height, format);
+  memcpy(pixelBuffer.GetBuffer(), source.Begin(), source.Count());
+  Dali::DevelPixelBuffer::ApplyGaussianBlur(pixelBuffer, blurRadius, mode);
+  return pixelBuffer;
+}
+
+} // namespace
+
+/**
+ * @brief Test the vectorized blur kernels give exactly the same results as the scalar code.
+ */
+int UtcDaliImageOperationsSimdGaussianBlurMatchesScalar(void)
+{
+  const InstructionSet supported = ImageOperationsSimd::GetSupportedInstructionSet();
+  const uint32_t       width     = 67u;
+  const uint32_t       height    = 41u;
+
+  Dali::Vector<uint8_t> source;
+  FillRandomBytes(source, width * height * 4u, 29 * 31);
+
+  for(const float blurRadius : {1.0f, 6.5f, 50.0f})
+  {
+    // The box blur sums are integers, and the convolution is built without fused multiply-adds, so both match exactly.
+    for(const auto mode : {Dali::DevelPixelBuffer::GaussianBlurMode::FAST, Dali::DevelPixelBuffer::GaussianBlurMode::ACCURATE})
+    {
+      Dali::PixelBuffer scalarResult = RunGaussianBlur(InstructionSet::NONE, source, width, height, Dali::Pixel::RGBA8888, blurRadius, mode);
+      Dali::PixelBuffer simdResult   = RunGaussianBlur(supported, source, width, height, Dali::Pixel::RGBA8888, blurRadius, mode);
+      DALI_TEST_CHECK(memcmp(scalarResult.GetBuffer(), simdResult.GetBuffer(), source.Count()) == 0);
+    }
+  }
+
+  ImageOperationsSimd::SetInstructionSet(supported);
+  END_TEST;
+}
+
+/**
+ * @brief Micro-benchmark of the Gaussian blur modes for a large radius.
+ */
+int UtcDaliImageOperationsGaussianBlurBenchmark(void)
+{
+  const InstructionSet supported  = ImageOperationsSimd::GetSupportedInstructionSet();
+  const uint32_t       width      = 720u;
+  const uint32_t       height     = 480u;
+  const float          blurRadius = 40.0f;
+
+  Dali::Vector<uint8_t> source;
+  FillRandomBytes(source, width * height * 4u, 37);
+
+  const double pixels       = static_cast<double>(width) * height;
+  const auto   accurateMode = Dali::DevelPixelBuffer::GaussianBlurMode::ACCURATE;
+  const auto   fastMode     = Dali::DevelPixelBuffer::GaussianBlurMode::FAST;
+
+  const double accurateScalarTime = MeasureMicroseconds(1u, [&]() { RunGaussianBlur(InstructionSet::NONE, source, width, height, Dali::Pixel::RGBA8888, blurRadius, accurateMode); });
+  const double accurateSimdTime   = MeasureMicroseconds(1u, [&]() { RunGaussianBlur(supported, source, width, height, Dali::Pixel::RGBA8888, blurRadius, accurateMode); });
+  const double fastScalarTime     = MeasureMicroseconds(1u, [&]() { RunGaussianBlur(InstructionSet::NONE, source, width, height, Dali::Pixel::RGBA8888, blurRadius, fastMode); });
+  const double fastSimdTime       = MeasureMicroseconds(1u, [&]() { RunGaussianBlur(supported, source, width, height, Dali::Pixel::RGBA8888, blurRadius, fastMode); });
+
+  tet_printf("GaussianBlur radius %.0f ACCURATE scalar %.3f ns/px, %s %.3f ns/px\n", blurRadius, accurateScalarTime * 1000.0 / pixels, ImageOperationsSimd::GetInstructionSetName(supported), accurateSimdTime * 1000.0 / pixels);
+  tet_printf("GaussianBlur radius %.0f FAST scalar %.3f ns/px, %s %.3f ns/px, speedup over ACCURATE x%.2f\n", blurRadius, fastScalarTime * 1000.0 / pixels, ImageOperationsSimd::GetInstructionSetName(supported), fastSimdTime * 1000.0 / pixels, accurateSimdTime / fastSimdTime);
+  DALI_TEST_CHECK(fastSimdTime > 0.0);
+
+  ImageOperationsSimd::SetInstructionSet(supported);
+  END_TEST;
+}
+
+namespace
+{
+/**
+ * @brief Run an image operation with the given maximum number of bands.
+ */
+template<typename Function>
+void RunWithBandCount(uint32_t bandCount, Function function)
+{
+  const uint32_t previousBandCount = ImageOperationsParallel::GetMaximumBandCount();
+  ImageOperationsParallel::SetMaximumBandCount(bandCount);
+  function();
+  ImageOperationsParallel::SetMaximumBandCount(previousBandCount);
+}
+
+/**
+ * @brief Rotate or shear the source with the given maximum number of bands.
+ */
+void RunShear(bool rotate, uint32_t bandCount, const Dali::Vector<uint8_t>& source, uint32_t width, uint32_t height, float radians, Dali::Vector<uint8_t>& result)
+{
+  RunWithBandCount(bandCount, [&]() {
+    uint8_t* pixelsOut = nullptr;
+    uint32_t widthOut  = 0u;
+    uint32_t heightOut = 0u;
+    if(rotate)
+    {
+      RotateByShear(source.Begin(), width, height, width * 4u, 4u, radians, pixelsOut, widthOut, heightOut);
+    }
+    else
+    {
+      HorizontalShear(source.Begin(), width, height, width * 4u, 4u, radians, pixelsOut, widthOut, heightOut);
+    }
+
+    result.Clear();
+    if(pixelsOut)
+    {
+      result.Resize(widthOut * heightOut * 4u);
+      memcpy(result.Begin(), pixelsOut, result.Count());
+      free(pixelsOut);
+    }
+  });
+}
+
+} // namespace
+
+int UtcDaliImageOperationsParallelBandCount(void)
+{
+  RunWithBandCount(1u, [&]() {
+    DALI_TEST_EQUALS(ImageOperationsParallel::CalculateBandCount(4096u, 4096u), 1u, TEST_LOCATION);
+  });
+
+  RunWithBandCount(4u, [&]() {
+    // Small images aren't worth splitting.
+    DALI_TEST_EQUALS(ImageOperationsParallel::CalculateBandCount(64u, 64u), 1u, TEST_LOCATION);
+    DALI_TEST_EQUALS(ImageOperationsParallel::CalculateBandCount(4096u, 4096u), 4u, TEST_LOCATION);
+    // Never more bands than rows.
+    DALI_TEST_EQUALS(ImageOperationsParallel::CalculateBandCount(2u, 1u << 20u), 2u, TEST_LOCATION);
+
+    std::vector<uint32_t> visits(1000u, 0u);
+    ImageOperationsParallel::ForEachBand(1000u, 1024u, [&](uint32_t begin, uint32_t end) {
+      for(uint32_t i = begin; i < end; ++i)
+      {
+        ++visits[i];
+      }
+    });
+    DALI_TEST_CHECK(std::all_of(visits.begin(), visits.end(), [](uint32_t visit) { return visit == 1u; }));
+  });
+
+  END_TEST;
+}
+
+/**
+ * @brief Test splitting the image operations into bands gives exactly the same results as running them serially.
+ */
+int UtcDaliImageOperationsParallelMatchesSerial(void)
+{
+  const uint32_t width      = 1031u;
+  const uint32_t height     = 719u;
+  const uint32_t bandCount = 8u;
+
+  for(const auto& kernel : DOWNSCALE_KERNELS)
+  {
+    Dali::Vector<uint8_t> source, serialResult, parallelResult;
+    FillRandomBytes(source, width * height * kernel.bytesPerPixel, 3 * 5 * 7);
+
+    const InstructionSet instructionSet = ImageOperationsSimd::GetInstructionSet();
+    RunWithBandCount(1u, [&]() { RunDownscale(kernel, instructionSet, source, width, height, serialResult); });
+    RunWithBandCount(bandCount, [&]() { RunDownscale(kernel, instructionSet, source, width, height, parallelResult); });
+
+    DALI_TEST_EQUALS(serialResult.Count(), parallelResult.Count(), TEST_LOCATION);
+    DALI_TEST_CHECK(memcmp(serialResult.Begin(), parallelResult.Begin(), serialResult.Count()) == 0);
+  }
+
+  Dali::Vector<uint8_t> source, serialResult, parallelResult;
+  FillRandomBytes(source, width * height * 4u, 11 * 13);
+
+  const ImageDimensions inputSize(width, height);
+  const ImageDimensions outputSize(613u, 401u);
+  const uint32_t        outputBytes = outputSize.GetWidth() * outputSize.GetHeight() * 4u;
+  serialResult.Resize(outputBytes, 0u);
+  parallelResult.Resize(outputBytes, 0u);
+
+  RunWithBandCount(1u, [&]() { LinearSample4BPP(source.Begin(), inputSize, width * 4u, serialResult.Begin(), outputSize); });
+  RunWithBandCount(bandCount, [&]() { LinearSample4BPP(source.Begin(), inputSize, width * 4u, parallelResult.Begin(), outputSize); });
+  DALI_TEST_CHECK(memcmp(serialResult.Begin(), parallelResult.Begin(), outputBytes) == 0);
+
+  RunWithBandCount(1u, [&]() { PointSample4BPP(source.Begin(), width, height, width * 4u, serialResult.Begin(), outputSize.GetWidth(), outputSize.GetHeight()); });
+  RunWithBandCount(bandCount, [&]() { PointSample4BPP(source.Begin(), width, height, width * 4u, parallelResult.Begin(), outputSize.GetWidth(), outputSize.GetHeight()); });
+  DALI_TEST_CHECK(memcmp(serialResult.Begin(), parallelResult.Begin(), outputBytes) == 0);
+
+  RunWithBandCount(1u, [&]() { LanczosSample4BPP(source.Begin(), inputSize, width * 4u, serialResult.Begin(), outputSize); });
+  RunWithBandCount(bandCount, [&]() { LanczosSample4BPP(source.Begin(), inputSize, width * 4u, parallelResult.Begin(), outputSize); });
+  DALI_TEST_CHECK(memcmp(serialResult.Begin(), parallelResult.Begin(), outputBytes) == 0);
+
+  for(const float radians : {0.3f, -0.6f, 2.0f})
+  {
+    RunShear(true, 1u, source, width, height, radians, serialResult);
+    RunShear(true, bandCount, source, width, height, radians, parallelResult);
+    DALI_TEST_EQUALS(serialResult.Count(), parallelResult.Count(), TEST_LOCATION);
+    DALI_TEST_CHECK(memcmp(serialResult.Begin(), parallelResult.Begin(), serialResult.Count()) == 0);
+  }
+
+  RunShear(false, 1u, source, width, height, 0.5f, serialResult);
+  RunShear(false, bandCount, source, width, height, 0.5f, parallelResult);
+  DALI_TEST_EQUALS(serialResult.Count(), parallelResult.Count(), TEST_LOCATION);
+  DALI_TEST_CHECK(memcmp(serialResult.Begin(), parallelResult.Begin(), serialResult.Count()) == 0);
+
+  END_TEST;
+}
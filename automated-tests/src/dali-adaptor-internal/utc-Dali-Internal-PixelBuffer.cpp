@@ -24,8 +24,12 @@
 
 // Internal headers are allowed here
 
+#include <dali/internal/imaging/common/image-operations-simd.h>
+#include <dali/internal/imaging/common/image-operations.h>
+#include <dali/internal/imaging/common/pixel-kernels.h>
 #include <dali/internal/imaging/common/pixel-manipulation.h>
 #include <dali/public-api/adaptor-framework/image-loading.h>
+#include <vector>
 
 using namespace Dali;
 using namespace Dali::Internal::Adaptor;
@@ -35,6 +39,102 @@ namespace
 // resolution: 96*96, pixel format: LA88
 const char* TEST_IMAGE_LA88 = TEST_IMAGE_DIR "/circle1-LA88.png";
 
+using Dali::Internal::Platform::MultiplyAndNormalizeColor;
+using Dali::Internal::Platform::ImageOperationsSimd::InstructionSet;
+namespace ImageOperationsSimd = Dali::Internal::Platform::ImageOperationsSimd;
+
+const Dali::Pixel::Format BYTE_FORMATS[] = {Pixel::A8, Pixel::L8, Pixel::LA88, Pixel::RGB888, Pixel::RGB8888, Pixel::BGR8888, Pixel::RGBA8888, Pixel::BGRA8888};
+const Dali::Pixel::Format MASK_FORMATS[] = {Pixel::A8, Pixel::L8, Pixel::LA88, Pixel::RGBA8888, Pixel::BGRA8888};
+
+/**
+ * @brief Fill the pixels with random values, a quarter of them 0 and a quarter of them 255.
+ */
+std::vector<uint8_t> CreateRandomPixels(uint32_t size)
+{
+  std::vector<uint8_t> pixels(size);
+  for(auto&& value : pixels)
+  {
+    const int kind = rand() % 4;
+    value          = (kind == 0) ? 0u : (kind == 1) ? 255u : static_cast<uint8_t>(rand());
+  }
+  return pixels;
+}
+
+uint8_t ReadMaskAlpha(uint8_t* pixel, Dali::Pixel::Format maskFormat)
+{
+  return (maskFormat == Pixel::L8) ? pixel[0] : ReadChannel(pixel, maskFormat, ALPHA);
+}
+
+/**
+ * @brief Premultiply the pixels channel by channel, as PixelBuffer::MultiplyColorByAlpha() does for the packed formats.
+ */
+void MultiplyColorByAlphaByChannel(uint8_t* pixels, Dali::Pixel::Format format, uint32_t width, uint32_t height, uint32_t strideBytes)
+{
+  const uint32_t bytesPerPixel = Pixel::GetBytesPerPixel(format);
+  for(uint32_t y = 0; y < height; ++y)
+  {
+    for(uint32_t x = 0; x < width; ++x)
+    {
+      uint8_t* pixel = pixels + y * strideBytes + x * bytesPerPixel;
+      uint8_t  alpha = ReadChannel(pixel, format, ALPHA);
+      if(!Pixel::HasAlpha(format) || alpha == 255u)
+      {
+        continue;
+      }
+      if(alpha == 0u)
+      {
+        memset(pixel, 0, bytesPerPixel);
+        continue;
+      }
+      for(const Channel& channel : {RED, GREEN, BLUE, LUMINANCE})
+      {
+        if(HasChannel(format, channel))
+        {
+          WriteChannel(pixel, format, channel, MultiplyAndNormalizeColor(ReadChannel(pixel, format, channel), alpha));
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Apply the mask channel by channel, as ApplyMaskToAlphaChannel() does for the packed formats.
+ */
+void ApplyMaskByChannel(uint8_t* pixels, Dali::Pixel::Format format, uint32_t strideBytes, uint8_t* mask, Dali::Pixel::Format maskFormat, uint32_t maskStrideBytes, uint32_t width, uint32_t height, bool isAlphaPreMultiplied)
+{
+  const uint32_t bytesPerPixel     = Pixel::GetBytesPerPixel(format);
+  const uint32_t maskBytesPerPixel = Pixel::GetBytesPerPixel(maskFormat);
+  for(uint32_t y = 0; y < height; ++y)
+  {
+    for(uint32_t x = 0; x < width; ++x)
+    {
+      uint8_t* pixel = pixels + y * strideBytes + x * bytesPerPixel;
+      uint8_t  alpha = ReadMaskAlpha(mask + y * maskStrideBytes + x * maskBytesPerPixel, maskFormat);
+      if(!isAlphaPreMultiplied)
+      {
+        if(Pixel::HasAlpha(format))
+        {
+          WriteChannel(pixel, format, ALPHA, MultiplyAndNormalizeColor(alpha, ReadChannel(pixel, format, ALPHA)));
+        }
+      }
+      else if(alpha == 0u)
+      {
+        memset(pixel, 0, bytesPerPixel);
+      }
+      else if(alpha < 255u)
+      {
+        for(const Channel& channel : {RED, GREEN, BLUE, LUMINANCE, ALPHA})
+        {
+          if(HasChannel(format, channel))
+          {
+            WriteChannel(pixel, format, channel, MultiplyAndNormalizeColor(ReadChannel(pixel, format, channel), alpha));
+          }
+        }
+      }
+    }
+  }
+}
+
 } // namespace
 
 void utc_dali_internal_pixel_data_startup()
@@ -240,3 +340,108 @@ int UtcDaliPixelManipulation03N(void)
 
   END_TEST;
 }
+
+int UtcDaliPixelKernelsMultiplyColorByAlpha(void)
+{
+  tet_infoline("Testing the pixel kernels premultiply each format like the channel by channel loop");
+
+  const InstructionSet supported = ImageOperationsSimd::GetSupportedInstructionSet();
+  for(const InstructionSet instructionSet : {InstructionSet::NONE, supported})
+  {
+    ImageOperationsSimd::SetInstructionSet(instructionSet);
+    for(const Dali::Pixel::Format format : BYTE_FORMATS)
+    {
+      // An odd width and a padded stride leave a scalar tail on every row.
+      const uint32_t width       = 37u;
+      const uint32_t height      = 3u;
+      const uint32_t strideBytes = width * Pixel::GetBytesPerPixel(format) + 5u;
+
+      std::vector<uint8_t> expected = CreateRandomPixels(strideBytes * height);
+      std::vector<uint8_t> result   = expected;
+
+      MultiplyColorByAlphaByChannel(expected.data(), format, width, height, strideBytes);
+      DALI_TEST_CHECK(PixelKernels::MultiplyColorByAlpha(result.data(), format, width, height, strideBytes));
+      DALI_TEST_CHECK(expected == result);
+    }
+  }
+  ImageOperationsSimd::SetInstructionSet(supported);
+
+  END_TEST;
+}
+
+int UtcDaliPixelKernelsApplyMaskToAlphaChannel(void)
+{
+  tet_infoline("Testing the pixel kernels apply a mask to each format like the channel by channel loop");
+
+  const InstructionSet supported = ImageOperationsSimd::GetSupportedInstructionSet();
+  for(const InstructionSet instructionSet : {InstructionSet::NONE, supported})
+  {
+    ImageOperationsSimd::SetInstructionSet(instructionSet);
+    for(const Dali::Pixel::Format format : BYTE_FORMATS)
+    {
+      for(const Dali::Pixel::Format maskFormat : MASK_FORMATS)
+      {
+        const uint32_t width           = 37u;
+        const uint32_t height          = 3u;
+        const uint32_t strideBytes     = width * Pixel::GetBytesPerPixel(format) + 5u;
+        const uint32_t maskStrideBytes = width * Pixel::GetBytesPerPixel(maskFormat) + 3u;
+
+        const std::vector<uint8_t> pixels = CreateRandomPixels(strideBytes * height);
+        std::vector<uint8_t>       mask   = CreateRandomPixels(maskStrideBytes * height);
+
+        for(const bool isAlphaPreMultiplied : {false, true})
+        {
+          std::vector<uint8_t> expected = pixels;
+          std::vector<uint8_t> result   = pixels;
+
+          ApplyMaskByChannel(expected.data(), format, strideBytes, mask.data(), maskFormat, maskStrideBytes, width, height, isAlphaPreMultiplied);
+          DALI_TEST_CHECK(PixelKernels::ApplyMaskToAlphaChannel(result.data(), format, strideBytes, mask.data(), maskFormat, maskStrideBytes, width, height, isAlphaPreMultiplied));
+          DALI_TEST_CHECK(expected == result);
+        }
+
+        // The masked RGBA8888 buffer has the color channels of the pixels, and their alpha multiplied by the mask.
+        const uint32_t       destinationStrideBytes = width * 4u;
+        std::vector<uint8_t> masked(destinationStrideBytes * height);
+        DALI_TEST_CHECK(PixelKernels::CreateMaskedRGBA8888(pixels.data(), format, strideBytes, mask.data(), maskFormat, maskStrideBytes, masked.data(), destinationStrideBytes, width, height));
+
+        const uint32_t bytesPerPixel     = Pixel::GetBytesPerPixel(format);
+        const uint32_t maskBytesPerPixel = Pixel::GetBytesPerPixel(maskFormat);
+        bool           matches           = true;
+        for(uint32_t y = 0; y < height; ++y)
+        {
+          for(uint32_t x = 0; x < width; ++x)
+          {
+            uint8_t* pixel     = const_cast<uint8_t*>(pixels.data()) + y * strideBytes + x * bytesPerPixel;
+            uint8_t* result    = masked.data() + y * destinationStrideBytes + x * 4u;
+            uint8_t  maskAlpha = ReadMaskAlpha(mask.data() + y * maskStrideBytes + x * maskBytesPerPixel, maskFormat);
+            uint8_t  alpha     = Pixel::HasAlpha(format) ? MultiplyAndNormalizeColor(maskAlpha, ReadChannel(pixel, format, ALPHA)) : maskAlpha;
+
+            matches = matches && result[0] == ReadChannel(pixel, format, RED) && result[1] == ReadChannel(pixel, format, GREEN) && result[2] == ReadChannel(pixel, format, BLUE) && result[3] == alpha;
+          }
+        }
+        DALI_TEST_CHECK(matches);
+      }
+    }
+  }
+  ImageOperationsSimd::SetInstructionSet(supported);
+
+  END_TEST;
+}
+
+int UtcDaliPixelKernelsPackedFormatsN(void)
+{
+  tet_infoline("Testing the pixel kernels leave the packed formats to the generic loops");
+
+  uint8_t pixels[8] = {0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0};
+  uint8_t mask[4]   = {0x00, 0x40, 0x80, 0xFF};
+
+  DALI_TEST_CHECK(!PixelKernels::MultiplyColorByAlpha(pixels, Pixel::RGBA4444, 4u, 1u, 8u));
+  DALI_TEST_CHECK(!PixelKernels::ApplyMaskToAlphaChannel(pixels, Pixel::RGBA5551, 8u, mask, Pixel::A8, 4u, 4u, 1u, false));
+  DALI_TEST_CHECK(!PixelKernels::ApplyMaskToAlphaChannel(pixels, Pixel::RGBA8888, 8u, mask, Pixel::RGB888, 4u, 1u, 1u, true));
+
+  // The pixels are untouched.
+  DALI_TEST_EQUALS(pixels[0], 0x12, TEST_LOCATION);
+  DALI_TEST_EQUALS(pixels[7], 0xF0, TEST_LOCATION);
+
+  END_TEST;
+}
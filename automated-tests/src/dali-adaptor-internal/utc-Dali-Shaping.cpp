@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/dali.h>
+#include <dali/devel-api/text-abstraction/font-client.h>
+#include <dali/devel-api/text-abstraction/glyph-info.h>
+#include <dali/devel-api/text-abstraction/shaping.h>
+#include <dali/internal/text/text-abstraction/shaping-impl.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <thread>
+#include <vector>
+
+using namespace Dali;
+
+namespace
+{
+const std::string DEFAULT_FONT_DIR("/resources/fonts");
+
+TextAbstraction::FontId GetDejaVuSansFontId(TextAbstraction::FontClient& fontClient)
+{
+  char*             pathNamePtr = get_current_dir_name();
+  const std::string pathName(pathNamePtr);
+  free(pathNamePtr);
+
+  TextAbstraction::FontDescription fontDescription;
+  fontDescription.path   = pathName + DEFAULT_FONT_DIR + "/dejavu/DejaVuSans.ttf";
+  fontDescription.family = "DejaVuSans";
+  fontDescription.width  = TextAbstraction::FontWidth::NONE;
+  fontDescription.weight = TextAbstraction::FontWeight::NORMAL;
+  fontDescription.slant  = TextAbstraction::FontSlant::NONE;
+
+  return fontClient.GetFontId(fontDescription, TextAbstraction::FontClient::DEFAULT_POINT_SIZE);
+}
+
+std::vector<TextAbstraction::GlyphInfo> Shape(TextAbstraction::Shaping& shaping, TextAbstraction::FontClient& fontClient, TextAbstraction::FontId fontId, const std::vector<TextAbstraction::Character>& text)
+{
+  const TextAbstraction::Length numberOfGlyphs = shaping.Shape(fontClient, text.data(), text.size(), fontId, TextAbstraction::LATIN);
+
+  std::vector<TextAbstraction::GlyphInfo>      glyphs(numberOfGlyphs);
+  std::vector<TextAbstraction::CharacterIndex> glyphToCharacterMap(numberOfGlyphs);
+  shaping.GetGlyphs(glyphs.data(), glyphToCharacterMap.data());
+  return glyphs;
+}
+
+const std::vector<TextAbstraction::Character> HELLO_WORLD{'H', 'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l', 'd'};
+} // namespace
+
+int UtcDaliShapingCachedRunP(void)
+{
+  TestApplication application;
+  tet_infoline("UtcDaliShapingCachedRunP Check a run shaped twice is found in the cache");
+
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::New(96u, 96u);
+  TextAbstraction::Shaping    shaping    = TextAbstraction::Shaping::New();
+
+  TextAbstraction::FontId fontId = GetDejaVuSansFontId(fontClient);
+  DALI_TEST_CHECK(fontId != 0u);
+
+  uint32_t hitCount, missCount;
+  TextAbstraction::Internal::Shaping::GetCacheStatistics(hitCount, missCount);
+
+  std::vector<TextAbstraction::GlyphInfo> firstGlyphs = Shape(shaping, fontClient, fontId, HELLO_WORLD);
+  DALI_TEST_EQUALS(firstGlyphs.size(), HELLO_WORLD.size(), TEST_LOCATION);
+
+  uint32_t firstHitCount, firstMissCount;
+  TextAbstraction::Internal::Shaping::GetCacheStatistics(firstHitCount, firstMissCount);
+  DALI_TEST_EQUALS(firstHitCount, hitCount, TEST_LOCATION);
+  DALI_TEST_EQUALS(firstMissCount, missCount + 1u, TEST_LOCATION);
+
+  std::vector<TextAbstraction::GlyphInfo> secondGlyphs = Shape(shaping, fontClient, fontId, HELLO_WORLD);
+  DALI_TEST_EQUALS(secondGlyphs.size(), firstGlyphs.size(), TEST_LOCATION);
+
+  uint32_t secondHitCount, secondMissCount;
+  TextAbstraction::Internal::Shaping::GetCacheStatistics(secondHitCount, secondMissCount);
+  DALI_TEST_EQUALS(secondHitCount, firstHitCount + 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(secondMissCount, firstMissCount, TEST_LOCATION);
+
+  for(std::size_t index = 0u; index < firstGlyphs.size(); ++index)
+  {
+    DALI_TEST_EQUALS(secondGlyphs[index].index, firstGlyphs[index].index, TEST_LOCATION);
+    DALI_TEST_EQUALS(secondGlyphs[index].advance, firstGlyphs[index].advance, TEST_LOCATION);
+  }
+
+  tet_infoline("Check the cache isn't used once the font cache is cleared");
+  fontClient.ClearCache();
+  fontId = GetDejaVuSansFontId(fontClient);
+  Shape(shaping, fontClient, fontId, HELLO_WORLD);
+
+  uint32_t clearedHitCount, clearedMissCount;
+  TextAbstraction::Internal::Shaping::GetCacheStatistics(clearedHitCount, clearedMissCount);
+  DALI_TEST_EQUALS(clearedHitCount, secondHitCount, TEST_LOCATION);
+  DALI_TEST_EQUALS(clearedMissCount, secondMissCount + 1u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliShapingMultipleThreadsP(void)
+{
+  TestApplication application;
+  tet_infoline("UtcDaliShapingMultipleThreadsP Check a Shaping can be used by several threads at once");
+
+  TextAbstraction::Shaping shaping = TextAbstraction::Shaping::New();
+
+  constexpr uint32_t NUMBER_OF_THREADS = 4u;
+  constexpr uint32_t NUMBER_OF_LOOPS   = 50u;
+
+  // The FontClient is not thread-safe, so each thread uses its own one, created here as the application would.
+  std::vector<TextAbstraction::FontClient> fontClients;
+  std::vector<TextAbstraction::FontId>     fontIds;
+  for(uint32_t threadIndex = 0u; threadIndex < NUMBER_OF_THREADS; ++threadIndex)
+  {
+    fontClients.push_back(TextAbstraction::FontClient::New(96u, 96u));
+    fontIds.push_back(GetDejaVuSansFontId(fontClients.back()));
+    DALI_TEST_CHECK(fontIds.back() != 0u);
+  }
+
+  std::vector<uint8_t>     results(NUMBER_OF_THREADS, 0u);
+  std::vector<std::thread> threads;
+  for(uint32_t threadIndex = 0u; threadIndex < NUMBER_OF_THREADS; ++threadIndex)
+  {
+    threads.emplace_back([&shaping, &results, &fontClients, &fontIds, threadIndex]() {
+      // Every thread shapes a text of a different length, so the results can't be mixed up.
+      std::vector<TextAbstraction::Character> text(HELLO_WORLD.begin(), HELLO_WORLD.begin() + 2u + threadIndex);
+
+      bool result = true;
+      for(uint32_t loop = 0u; loop < NUMBER_OF_LOOPS; ++loop)
+      {
+        result = result && (Shape(shaping, fontClients[threadIndex], fontIds[threadIndex], text).size() == text.size());
+      }
+      results[threadIndex] = result ? 1u : 0u;
+    });
+  }
+
+  for(auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  for(uint32_t threadIndex = 0u; threadIndex < NUMBER_OF_THREADS; ++threadIndex)
+  {
+    DALI_TEST_CHECK(results[threadIndex] == 1u);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliShapingGetGlyphsReleasesRunP(void)
+{
+  TestApplication application;
+  tet_infoline("UtcDaliShapingGetGlyphsReleasesRunP Check the shaped run is released by GetGlyphs()");
+
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::New(96u, 96u);
+  TextAbstraction::Shaping    shaping    = TextAbstraction::Shaping::New();
+
+  TextAbstraction::FontId fontId = GetDejaVuSansFontId(fontClient);
+  DALI_TEST_CHECK(fontId != 0u);
+
+  std::vector<TextAbstraction::GlyphInfo> glyphs = Shape(shaping, fontClient, fontId, HELLO_WORLD);
+  DALI_TEST_EQUALS(glyphs.size(), HELLO_WORLD.size(), TEST_LOCATION);
+  DALI_TEST_CHECK(glyphs[0].fontId == fontId);
+
+  // Nothing is left to get.
+  std::vector<TextAbstraction::GlyphInfo>      secondGlyphs(HELLO_WORLD.size());
+  std::vector<TextAbstraction::CharacterIndex> glyphToCharacterMap(HELLO_WORLD.size(), 0xffu);
+  shaping.GetGlyphs(secondGlyphs.data(), glyphToCharacterMap.data());
+
+  for(std::size_t index = 0u; index < secondGlyphs.size(); ++index)
+  {
+    DALI_TEST_EQUALS(secondGlyphs[index].fontId, 0u, TEST_LOCATION);
+    DALI_TEST_EQUALS(glyphToCharacterMap[index], 0xffu, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
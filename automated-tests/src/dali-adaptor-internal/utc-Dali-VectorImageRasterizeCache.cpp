@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/internal/vector-image/common/vector-image-rasterize-cache.h>
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <thread>
+
+using namespace Dali;
+using Dali::Internal::Adaptor::VectorImageRasterizeCache;
+
+namespace
+{
+constexpr uint32_t    IMAGE_SIZE        = 16u;
+constexpr std::size_t IMAGE_BYTE_SIZE   = IMAGE_SIZE * IMAGE_SIZE * 4u;
+constexpr std::size_t CACHE_BYTE_BUDGET = IMAGE_BYTE_SIZE * 4u;
+constexpr std::size_t FILE_BYTE_SIZE    = IMAGE_BYTE_SIZE + 48u; ///< With the header
+constexpr std::size_t DISK_BYTE_BUDGET  = FILE_BYTE_SIZE * 16u;
+constexpr const char* RASTERIZER        = "thorvg-1.0.0";
+
+Dali::PixelBuffer CreateImage(uint8_t value)
+{
+  Dali::PixelBuffer pixelBuffer = Dali::PixelBuffer::New(IMAGE_SIZE, IMAGE_SIZE, Pixel::RGBA8888);
+  memset(pixelBuffer.GetBuffer(), value, IMAGE_BYTE_SIZE);
+  return pixelBuffer;
+}
+
+bool HasValue(const Dali::PixelBuffer& pixelBuffer, uint8_t value)
+{
+  return pixelBuffer && pixelBuffer.GetBuffer()[0] == value && pixelBuffer.GetBuffer()[IMAGE_BYTE_SIZE - 1u] == value;
+}
+
+std::string PrepareDirectory()
+{
+  const std::string directory = (std::filesystem::temp_directory_path() / "utc-dali-vector-image-cache").string();
+  std::filesystem::remove_all(directory);
+  return directory;
+}
+
+uint32_t GetFileCount(const std::string& directory)
+{
+  uint32_t count = 0u;
+  for(const auto& entry : std::filesystem::directory_iterator(directory))
+  {
+    count += entry.path().extension() == ".rgba" ? 1u : 0u;
+  }
+  return count;
+}
+
+/**
+ * @brief Lets the modification time of the files written or read next be later than the previous ones.
+ */
+void WaitForNextFileTime()
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+}
+} // namespace
+
+void utc_dali_internal_vector_image_rasterize_cache_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_vector_image_rasterize_cache_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliVectorImageRasterizeCacheBudget(void)
+{
+  tet_infoline("Check the rasterized images beyond the budget are dropped, least recently used first");
+
+  VectorImageRasterizeCache cache(CACHE_BYTE_BUDGET, std::string(), DISK_BYTE_BUDGET, RASTERIZER);
+  DALI_TEST_CHECK(cache.IsEnabled());
+  DALI_TEST_CHECK(!cache.Find(1u, IMAGE_SIZE, IMAGE_SIZE));
+
+  for(uint8_t value = 1u; value <= 4u; ++value)
+  {
+    cache.Add(value, IMAGE_SIZE, IMAGE_SIZE, CreateImage(value));
+  }
+
+  // The image found is a copy.
+  Dali::PixelBuffer image = cache.Find(1u, IMAGE_SIZE, IMAGE_SIZE);
+  DALI_TEST_CHECK(HasValue(image, 1u));
+  memset(image.GetBuffer(), 0, IMAGE_BYTE_SIZE);
+  DALI_TEST_CHECK(HasValue(cache.Find(1u, IMAGE_SIZE, IMAGE_SIZE), 1u));
+
+  // Drops the image 2, as the image 1 was used since.
+  cache.Add(5u, IMAGE_SIZE, IMAGE_SIZE, CreateImage(5u));
+  DALI_TEST_CHECK(!cache.Find(2u, IMAGE_SIZE, IMAGE_SIZE));
+  DALI_TEST_CHECK(HasValue(cache.Find(1u, IMAGE_SIZE, IMAGE_SIZE), 1u));
+  DALI_TEST_CHECK(HasValue(cache.Find(5u, IMAGE_SIZE, IMAGE_SIZE), 5u));
+
+  // Another size is another image.
+  DALI_TEST_CHECK(!cache.Find(5u, IMAGE_SIZE, IMAGE_SIZE * 2u));
+
+  // An image larger than a quarter of the budget is not cached.
+  Dali::PixelBuffer largeImage = Dali::PixelBuffer::New(IMAGE_SIZE * 2u, IMAGE_SIZE, Pixel::RGBA8888);
+  cache.Add(6u, IMAGE_SIZE * 2u, IMAGE_SIZE, largeImage);
+  DALI_TEST_CHECK(!cache.Find(6u, IMAGE_SIZE * 2u, IMAGE_SIZE));
+
+  const VectorImageRasterizeCache::Statistics statistics = cache.GetStatistics();
+  DALI_TEST_EQUALS(statistics.hitCount, 4u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.missCount, 4u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.diskHitCount, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.evictionCount, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.byteSize, CACHE_BYTE_BUDGET, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliVectorImageRasterizeCacheDirectory(void)
+{
+  tet_infoline("Check the rasterized images are read back from the directory, by another process");
+
+  const std::string directory = PrepareDirectory();
+
+  {
+    VectorImageRasterizeCache cache(CACHE_BYTE_BUDGET, directory, DISK_BYTE_BUDGET, RASTERIZER);
+    for(uint8_t value = 1u; value <= 5u; ++value)
+    {
+      cache.Add(value, IMAGE_SIZE, IMAGE_SIZE, CreateImage(value));
+    }
+
+    // Dropped from memory, but still in the directory.
+    DALI_TEST_CHECK(HasValue(cache.Find(1u, IMAGE_SIZE, IMAGE_SIZE), 1u));
+    DALI_TEST_EQUALS(cache.GetStatistics().diskHitCount, 1u, TEST_LOCATION);
+  }
+  {
+    // The next launch.
+    VectorImageRasterizeCache cache(CACHE_BYTE_BUDGET, directory, DISK_BYTE_BUDGET, RASTERIZER);
+    DALI_TEST_CHECK(HasValue(cache.Find(3u, IMAGE_SIZE, IMAGE_SIZE), 3u));
+    DALI_TEST_CHECK(HasValue(cache.Find(3u, IMAGE_SIZE, IMAGE_SIZE), 3u));
+    DALI_TEST_CHECK(!cache.Find(6u, IMAGE_SIZE, IMAGE_SIZE));
+
+    const VectorImageRasterizeCache::Statistics statistics = cache.GetStatistics();
+    DALI_TEST_EQUALS(statistics.diskHitCount, 1u, TEST_LOCATION);
+    DALI_TEST_EQUALS(statistics.hitCount, 1u, TEST_LOCATION);
+    DALI_TEST_EQUALS(statistics.missCount, 1u, TEST_LOCATION);
+  }
+
+  // The data hash doesn't change between the launches.
+  const uint8_t data[] = "<svg/>";
+  DALI_TEST_EQUALS(VectorImageRasterizeCache::CalculateDataHash(data, sizeof(data)), VectorImageRasterizeCache::CalculateDataHash(data, sizeof(data)), TEST_LOCATION);
+  DALI_TEST_CHECK(VectorImageRasterizeCache::CalculateDataHash(data, sizeof(data)) != VectorImageRasterizeCache::CalculateDataHash(data, sizeof(data) - 1u));
+
+  // Nor between the launches with the same DPI, which changes it.
+  DALI_TEST_EQUALS(VectorImageRasterizeCache::CalculateDataHash(data, sizeof(data), 192u), VectorImageRasterizeCache::CalculateDataHash(data, sizeof(data), 192u), TEST_LOCATION);
+  DALI_TEST_CHECK(VectorImageRasterizeCache::CalculateDataHash(data, sizeof(data), 192u) != VectorImageRasterizeCache::CalculateDataHash(data, sizeof(data), 320u));
+  DALI_TEST_CHECK(VectorImageRasterizeCache::CalculateDataHash(data, sizeof(data), 192u) != VectorImageRasterizeCache::CalculateDataHash(data, sizeof(data)));
+
+  std::filesystem::remove_all(directory);
+  END_TEST;
+}
+
+int UtcDaliVectorImageRasterizeCacheDisabled(void)
+{
+  tet_infoline("Check nothing is cached with a zero budget");
+
+  VectorImageRasterizeCache cache(0u, std::string(), DISK_BYTE_BUDGET, RASTERIZER);
+  DALI_TEST_CHECK(!cache.IsEnabled());
+
+  cache.Add(1u, IMAGE_SIZE, IMAGE_SIZE, CreateImage(1u));
+  DALI_TEST_CHECK(!cache.Find(1u, IMAGE_SIZE, IMAGE_SIZE));
+  DALI_TEST_EQUALS(cache.GetStatistics().byteSize, static_cast<std::size_t>(0u), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliVectorImageRasterizeCacheDiskBudget(void)
+{
+  tet_infoline("Check the image files beyond the disk budget are removed, least recently used first");
+
+  const std::string directory = PrepareDirectory();
+
+  // Up to 4 files. A quarter of the budget is freed when it is exceeded.
+  const std::size_t diskByteBudget = FILE_BYTE_SIZE * 4u;
+  {
+    VectorImageRasterizeCache cache(CACHE_BYTE_BUDGET, directory, diskByteBudget, RASTERIZER);
+    for(uint8_t value = 1u; value <= 4u; ++value)
+    {
+      cache.Add(value, IMAGE_SIZE, IMAGE_SIZE, CreateImage(value));
+      WaitForNextFileTime();
+    }
+    DALI_TEST_EQUALS(GetFileCount(directory), 4u, TEST_LOCATION);
+    DALI_TEST_EQUALS(cache.GetStatistics().diskEvictionCount, 0u, TEST_LOCATION);
+  }
+  {
+    // The next launch reads the image 1, so the images 2 and 3 are the least recently used.
+    VectorImageRasterizeCache cache(CACHE_BYTE_BUDGET, directory, diskByteBudget, RASTERIZER);
+    DALI_TEST_CHECK(HasValue(cache.Find(1u, IMAGE_SIZE, IMAGE_SIZE), 1u));
+    WaitForNextFileTime();
+
+    cache.Add(5u, IMAGE_SIZE, IMAGE_SIZE, CreateImage(5u));
+    DALI_TEST_EQUALS(GetFileCount(directory), 3u, TEST_LOCATION);
+    DALI_TEST_EQUALS(cache.GetStatistics().diskEvictionCount, 2u, TEST_LOCATION);
+  }
+  {
+    VectorImageRasterizeCache cache(CACHE_BYTE_BUDGET, directory, diskByteBudget, RASTERIZER);
+    DALI_TEST_CHECK(HasValue(cache.Find(1u, IMAGE_SIZE, IMAGE_SIZE), 1u));
+    DALI_TEST_CHECK(!cache.Find(2u, IMAGE_SIZE, IMAGE_SIZE));
+    DALI_TEST_CHECK(!cache.Find(3u, IMAGE_SIZE, IMAGE_SIZE));
+    DALI_TEST_CHECK(HasValue(cache.Find(4u, IMAGE_SIZE, IMAGE_SIZE), 4u));
+    DALI_TEST_CHECK(HasValue(cache.Find(5u, IMAGE_SIZE, IMAGE_SIZE), 5u));
+  }
+  {
+    // Without a disk budget, nothing is written.
+    VectorImageRasterizeCache cache(CACHE_BYTE_BUDGET, directory, 0u, RASTERIZER);
+    cache.Add(6u, IMAGE_SIZE, IMAGE_SIZE, CreateImage(6u));
+    DALI_TEST_EQUALS(GetFileCount(directory), 3u, TEST_LOCATION);
+  }
+
+  std::filesystem::remove_all(directory);
+  END_TEST;
+}
+
+int UtcDaliVectorImageRasterizeCacheRasterizer(void)
+{
+  tet_infoline("Check the image files are only read back by the rasterizer which wrote them");
+
+  const std::string directory = PrepareDirectory();
+  {
+    VectorImageRasterizeCache cache(CACHE_BYTE_BUDGET, directory, DISK_BYTE_BUDGET, RASTERIZER);
+    cache.Add(1u, IMAGE_SIZE, IMAGE_SIZE, CreateImage(1u));
+  }
+  {
+    // Another version may rasterize the same data differently.
+    VectorImageRasterizeCache cache(CACHE_BYTE_BUDGET, directory, DISK_BYTE_BUDGET, "thorvg-1.0.1");
+    DALI_TEST_CHECK(!cache.Find(1u, IMAGE_SIZE, IMAGE_SIZE));
+    cache.Add(1u, IMAGE_SIZE, IMAGE_SIZE, CreateImage(2u));
+  }
+
+  // Both are kept, for the processes still using the first one.
+  DALI_TEST_EQUALS(GetFileCount(directory), 2u, TEST_LOCATION);
+  {
+    VectorImageRasterizeCache cache(CACHE_BYTE_BUDGET, directory, DISK_BYTE_BUDGET, RASTERIZER);
+    DALI_TEST_CHECK(HasValue(cache.Find(1u, IMAGE_SIZE, IMAGE_SIZE), 1u));
+  }
+  {
+    VectorImageRasterizeCache cache(CACHE_BYTE_BUDGET, directory, DISK_BYTE_BUDGET, "thorvg-1.0.1");
+    DALI_TEST_CHECK(HasValue(cache.Find(1u, IMAGE_SIZE, IMAGE_SIZE), 2u));
+  }
+
+  std::filesystem::remove_all(directory);
+  END_TEST;
+}
+
+int UtcDaliVectorImageRasterizeCacheLargeFile(void)
+{
+  tet_infoline("Check an image read from the directory isn't kept in memory if it is larger than a quarter of the budget");
+
+  const std::string directory = PrepareDirectory();
+
+  // Written by a process with a larger budget.
+  Dali::PixelBuffer largeImage = Dali::PixelBuffer::New(IMAGE_SIZE * 2u, IMAGE_SIZE, Pixel::RGBA8888);
+  memset(largeImage.GetBuffer(), 7, IMAGE_BYTE_SIZE * 2u);
+  {
+    VectorImageRasterizeCache cache(CACHE_BYTE_BUDGET * 2u, directory, DISK_BYTE_BUDGET, RASTERIZER);
+    cache.Add(1u, IMAGE_SIZE * 2u, IMAGE_SIZE, largeImage);
+    DALI_TEST_EQUALS(cache.GetStatistics().byteSize, IMAGE_BYTE_SIZE * 2u, TEST_LOCATION);
+  }
+  {
+    VectorImageRasterizeCache cache(CACHE_BYTE_BUDGET, directory, DISK_BYTE_BUDGET, RASTERIZER);
+    for(uint8_t value = 2u; value <= 5u; ++value)
+    {
+      cache.Add(value, IMAGE_SIZE, IMAGE_SIZE, CreateImage(value));
+    }
+
+    // Read from the directory every time, and doesn't drop the other images.
+    for(uint32_t count = 1u; count <= 2u; ++count)
+    {
+      Dali::PixelBuffer image = cache.Find(1u, IMAGE_SIZE * 2u, IMAGE_SIZE);
+      DALI_TEST_CHECK(image && image.GetBuffer()[0] == 7u && image.GetBuffer()[IMAGE_BYTE_SIZE * 2u - 1u] == 7u);
+      DALI_TEST_EQUALS(cache.GetStatistics().diskHitCount, count, TEST_LOCATION);
+    }
+
+    const VectorImageRasterizeCache::Statistics statistics = cache.GetStatistics();
+    DALI_TEST_EQUALS(statistics.byteSize, CACHE_BYTE_BUDGET, TEST_LOCATION);
+    DALI_TEST_EQUALS(statistics.evictionCount, 0u, TEST_LOCATION);
+    DALI_TEST_CHECK(HasValue(cache.Find(2u, IMAGE_SIZE, IMAGE_SIZE), 2u));
+  }
+
+  std::filesystem::remove_all(directory);
+  END_TEST;
+}
@@ -302,7 +302,7 @@ public:
   {
     //If it has the three last bits set to 1 - 111, then the three minimum functions to create a
     //Framebuffer texture have been called
-    if(mFramebufferStatus == 7)
+    if(mFramebufferStatus == 7 && !mFramebufferIncomplete)
     {
       return GL_FRAMEBUFFER_COMPLETE;
     }
@@ -450,6 +450,19 @@ public:
 
   inline void CopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) override
   {
+    std::stringstream out;
+    out << std::hex << target << ", " << std::dec << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height;
+
+    TraceCallStack::NamedParams namedParams;
+    namedParams["target"] << std::hex << target;
+    namedParams["level"] << level;
+    namedParams["xoffset"] << xoffset;
+    namedParams["yoffset"] << yoffset;
+    namedParams["x"] << x;
+    namedParams["y"] << y;
+    namedParams["width"] << width;
+    namedParams["height"] << height;
+    mTextureTrace.PushCall("CopyTexSubImage2D", out.str(), namedParams);
   }
 
   inline GLuint CreateProgram(void) override
@@ -694,6 +707,17 @@ public:
 
   inline void FramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) override
   {
+    std::stringstream out;
+    out << std::hex << target << ", " << attachment << ", " << textarget << ", " << std::dec << texture << ", " << level;
+
+    TraceCallStack::NamedParams namedParams;
+    namedParams["target"] << std::hex << target;
+    namedParams["attachment"] << std::hex << attachment;
+    namedParams["textarget"] << std::hex << textarget;
+    namedParams["texture"] << texture;
+    namedParams["level"] << level;
+    mTextureTrace.PushCall("FramebufferTexture2D", out.str(), namedParams);
+
     //Add 100 bit;
     mFramebufferStatus |= 4;
 
@@ -1740,6 +1764,10 @@ public:
 
   inline GLboolean UnmapBuffer(GLenum target) override
   {
+    std::stringstream out;
+    out << std::hex << target;
+    mBufferTrace.PushCall("UnmapBuffer", out.str());
+
     if(mMappedBuffer)
     {
       free(mMappedBuffer);
@@ -1800,6 +1828,15 @@ public:
 
   inline GLvoid* MapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) override
   {
+    std::stringstream out;
+    out << std::hex << target << ", " << std::dec << offset << ", " << length << ", " << std::hex << access;
+    TraceCallStack::NamedParams namedParams;
+    namedParams["target"] << std::hex << target;
+    namedParams["offset"] << offset;
+    namedParams["length"] << length;
+    namedParams["access"] << std::hex << access;
+    mBufferTrace.PushCall("MapBufferRange", out.str(), namedParams);
+
     mMappedBuffer = reinterpret_cast<GLvoid*>(malloc(offset + length));
     return mMappedBuffer;
   }
@@ -2032,6 +2069,10 @@ public:
 
   inline GLsync FenceSync(GLenum condition, GLbitfield flags) override
   {
+    if(mFenceSyncEnabled)
+    {
+      return reinterpret_cast<GLsync>(++mLastFenceSync);
+    }
     return NULL;
   }
 
@@ -2046,7 +2087,7 @@ public:
 
   inline GLenum ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) override
   {
-    return 0;
+    return (mFenceSyncEnabled && sync) ? mClientWaitSyncResult : 0;
   }
 
   inline void WaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) override
@@ -2263,6 +2304,30 @@ public: // TEST FUNCTIONS
   {
     mCheckFramebufferStatusResult = result;
   }
+
+  /**
+   * CheckFramebufferStatus() returns the result set by SetCheckFramebufferStatusResult() when enabled, e.g. for an attachment which can't be rendered to.
+   */
+  inline void SetFramebufferIncomplete(bool incomplete)
+  {
+    mFramebufferIncomplete = incomplete;
+  }
+
+  /**
+   * FenceSync() returns a null sync object unless enabled.
+   */
+  inline void SetFenceSyncEnabled(bool enabled)
+  {
+    mFenceSyncEnabled = enabled;
+  }
+
+  /**
+   * Sets what ClientWaitSync() returns for the sync objects of FenceSync(), e.g. GL_TIMEOUT_EXPIRED or GL_ALREADY_SIGNALED.
+   */
+  inline void SetClientWaitSyncResult(GLenum result)
+  {
+    mClientWaitSyncResult = result;
+  }
   inline void SetNumBinaryFormats(GLint numFormats)
   {
     mNumBinaryFormats = numFormats;
@@ -2667,6 +2732,10 @@ public:
   BufferDataCalls                       mBufferDataCalls;
   BufferSubDataCalls                    mBufferSubDataCalls;
   GLvoid*                               mMappedBuffer{nullptr};
+  bool                                  mFenceSyncEnabled{false};
+  bool                                  mFramebufferIncomplete{false};
+  uintptr_t                             mLastFenceSync{0u};
+  GLenum                                mClientWaitSyncResult{GL_ALREADY_SIGNALED};
   GLuint                                mLinkStatus;
   GLenum                                mGetErrorResult;
   GLubyte*                              mGetStringResult;
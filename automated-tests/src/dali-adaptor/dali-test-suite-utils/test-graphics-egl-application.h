@@ -340,6 +340,14 @@ public:
   {
   }
 
+  void BeginProgramPrecompile() override
+  {
+  }
+
+  void EndProgramPrecompile() override
+  {
+  }
+
   /**
    * Store cached configurations
    */
@@ -19,6 +19,7 @@
 #include <dali/dali.h>
 #include <dali/devel-api/adaptor-framework/animated-image-loading.h>
 #include <stdlib.h>
+#include <cstring>
 
 using namespace Dali;
 
@@ -27,6 +28,12 @@ namespace
 // test gif image, resolution: 100*100, 5 frames, delay: 1 second, disposal method: none
 static const char* gGif_100_None = TEST_RESOURCE_DIR "/canvas-none.gif";
 
+// test gif image, resolution: 100*100, 5 frames, delay: 1 second, disposal method: background
+static const char* gGif_100_Bgnd = TEST_RESOURCE_DIR "/canvas-bgnd.gif";
+
+// test gif image, resolution: 100*100, 5 frames, delay: 1 second, disposal method: previous
+static const char* gGif_100_Prev = TEST_RESOURCE_DIR "/canvas-prev.gif";
+
 // this image if not exist, for negative test
 static const char* gGifNonExist = "non-exist.gif";
 
@@ -109,3 +116,36 @@ int UtcDaliAnimatedImageLoadingInvalidGif(void)
 
   END_TEST;
 }
+
+int UtcDaliAnimatedImageLoadingStreamingP(void)
+{
+  // Frames are loaded out of order, so they are decoded again from the key frames.
+  const uint32_t frameOrder[] = {0u, 1u, 4u, 2u, 0u, 3u, 3u, 1u};
+
+  for(const char* url : {gGif_100_None, gGif_100_Bgnd, gGif_100_Prev})
+  {
+    Dali::AnimatedImageLoading animatedImageLoading = Dali::AnimatedImageLoading::New(url, true);
+
+    // 160KB keeps only 4 frames of 100*100, so 1 key frame.
+    setenv("DALI_GIF_STREAMING_FRAME_MEMORY", "160", 1);
+    Dali::AnimatedImageLoading streamingLoading = Dali::AnimatedImageLoading::New(url, true);
+    unsetenv("DALI_GIF_STREAMING_FRAME_MEMORY");
+
+    DALI_TEST_EQUALS(streamingLoading.GetImageCount(), animatedImageLoading.GetImageCount(), TEST_LOCATION);
+
+    for(uint32_t frameIndex : frameOrder)
+    {
+      Dali::PixelBuffer expected = animatedImageLoading.LoadFrame(frameIndex);
+      Dali::PixelBuffer actual   = streamingLoading.LoadFrame(frameIndex);
+      DALI_TEST_CHECK(expected);
+      DALI_TEST_CHECK(actual);
+
+      DALI_TEST_EQUALS(actual.GetWidth(), 100u, TEST_LOCATION);
+      DALI_TEST_EQUALS(actual.GetHeight(), 100u, TEST_LOCATION);
+      DALI_TEST_EQUALS(actual.GetPixelFormat(), expected.GetPixelFormat(), TEST_LOCATION);
+      DALI_TEST_CHECK(memcmp(actual.GetBuffer(), expected.GetBuffer(), 100u * 100u * Pixel::GetBytesPerPixel(expected.GetPixelFormat())) == 0);
+    }
+  }
+
+  END_TEST;
+}
@@ -17,6 +17,8 @@
 #include <dali-test-suite-utils.h>
 #include <dali/dali.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer-devel.h>
+#include <algorithm>
+#include <cstdlib>
 #include "mesh-builder.h"
 using namespace Dali;
 
@@ -921,6 +923,100 @@ int UtcDaliPixelBufferGaussianBlur03(void)
   END_TEST;
 }
 
+int UtcDaliPixelBufferGaussianBlurFast01(void)
+{
+  TestApplication application;
+
+  Dali::PixelBuffer imageData = Dali::PixelBuffer::New(10, 10, Pixel::RGBA8888);
+  FillCheckerboard(imageData);
+
+  unsigned char* buffer = imageData.GetBuffer();
+  DALI_TEST_EQUALS(buffer[43], 0xffu, TEST_LOCATION);
+  DALI_TEST_EQUALS(buffer[55], 0x00u, TEST_LOCATION);
+
+  DALI_TEST_EQUALS(true, DevelPixelBuffer::ApplyGaussianBlur(imageData, 0.0f, DevelPixelBuffer::GaussianBlurMode::FAST), TEST_LOCATION);
+
+  // Test that the pixels' alpha values are not changed because there is no blur
+  DALI_TEST_EQUALS(buffer[43], 0xffu, TEST_LOCATION);
+  DALI_TEST_EQUALS(buffer[55], 0x00u, TEST_LOCATION);
+
+  DALI_TEST_EQUALS(false, DevelPixelBuffer::ApplyGaussianBlur(imageData, -1.0f, DevelPixelBuffer::GaussianBlurMode::FAST), TEST_LOCATION);
+  DALI_TEST_EQUALS(buffer[43], 0xffu, TEST_LOCATION);
+  DALI_TEST_EQUALS(buffer[55], 0x00u, TEST_LOCATION);
+
+  DALI_TEST_EQUALS(true, DevelPixelBuffer::ApplyGaussianBlur(imageData, 4.0f, DevelPixelBuffer::GaussianBlurMode::FAST), TEST_LOCATION);
+
+  // Test that a wide blur averages the checkerboard to mid grey
+  DALI_TEST_EQUALS(static_cast<float>(buffer[43]), 127.5f, 8.0f, TEST_LOCATION);
+  DALI_TEST_EQUALS(static_cast<float>(buffer[55]), 127.5f, 8.0f, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliPixelBufferGaussianBlurFast02(void)
+{
+  TestApplication application;
+
+  // Test that the box blur approximation stays close to the Gaussian for every supported pixel size
+  const Pixel::Format formats[] = {Pixel::L8, Pixel::LA88, Pixel::RGB888, Pixel::RGBA8888};
+  for(const auto format : formats)
+  {
+    const uint32_t width         = 64u;
+    const uint32_t height        = 48u;
+    const uint32_t bytesPerPixel = Pixel::GetBytesPerPixel(format);
+
+    Dali::PixelBuffer accurate = Dali::PixelBuffer::New(width, height, format);
+    Dali::PixelBuffer fast     = Dali::PixelBuffer::New(width, height, format);
+
+    // A vertical edge, half black and half white.
+    const uint32_t strideBytes = width * bytesPerPixel;
+    for(uint32_t y = 0; y < height; ++y)
+    {
+      memset(accurate.GetBuffer() + y * strideBytes, 0x00, strideBytes / 2u);
+      memset(accurate.GetBuffer() + y * strideBytes + strideBytes / 2u, 0xff, strideBytes - strideBytes / 2u);
+    }
+    memcpy(fast.GetBuffer(), accurate.GetBuffer(), strideBytes * height);
+
+    DALI_TEST_EQUALS(true, DevelPixelBuffer::ApplyGaussianBlur(accurate, 10.0f, DevelPixelBuffer::GaussianBlurMode::ACCURATE), TEST_LOCATION);
+    DALI_TEST_EQUALS(true, DevelPixelBuffer::ApplyGaussianBlur(fast, 10.0f, DevelPixelBuffer::GaussianBlurMode::FAST), TEST_LOCATION);
+
+    int maximumDifference = 0;
+    for(uint32_t i = 0; i < strideBytes * height; ++i)
+    {
+      maximumDifference = std::max(maximumDifference, std::abs(static_cast<int>(accurate.GetBuffer()[i]) - static_cast<int>(fast.GetBuffer()[i])));
+    }
+    DALI_TEST_CHECK(maximumDifference <= 8);
+  }
+
+  // The accurate mode is what ApplyGaussianBlur() does
+  Dali::PixelBuffer imageData = Dali::PixelBuffer::New(10, 10, Pixel::RGBA8888);
+  Dali::PixelBuffer reference = Dali::PixelBuffer::New(10, 10, Pixel::RGBA8888);
+  FillCheckerboard(imageData);
+  FillCheckerboard(reference);
+  DALI_TEST_EQUALS(true, DevelPixelBuffer::ApplyGaussianBlur(imageData, 1.0f, DevelPixelBuffer::GaussianBlurMode::ACCURATE), TEST_LOCATION);
+  DALI_TEST_EQUALS(true, reference.ApplyGaussianBlur(1.0f), TEST_LOCATION);
+  DALI_TEST_CHECK(memcmp(imageData.GetBuffer(), reference.GetBuffer(), 10u * 10u * 4u) == 0);
+
+  END_TEST;
+}
+
+int UtcDaliPixelBufferGaussianBlurFast03N(void)
+{
+  TestApplication application;
+
+  Dali::PixelBuffer imageData = Dali::PixelBuffer::New(10, 10, Pixel::RGB565);
+  FillCheckerboard(imageData);
+
+  unsigned char* buffer = imageData.GetBuffer();
+
+  // Test that the pixels are not changed because not supported pixel format
+  DALI_TEST_EQUALS(false, DevelPixelBuffer::ApplyGaussianBlur(imageData, 1.0f, DevelPixelBuffer::GaussianBlurMode::FAST), TEST_LOCATION);
+  DALI_TEST_EQUALS(buffer[20], 0xffu, TEST_LOCATION);
+  DALI_TEST_EQUALS(buffer[26], 0x00u, TEST_LOCATION);
+
+  END_TEST;
+}
+
 int UtcDaliPixelBufferMultiplyColorByAlpha01(void)
 {
   TestApplication application;
@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/dali.h>
+
+#include <dali/internal/graphics/gles-impl/egl-graphics-controller.h>
+#include <dali/internal/graphics/gles-impl/gles-graphics-command-buffer.h>
+#include <test-actor-utils.h>
+#include <test-graphics-egl-application.h>
+
+using namespace Dali;
+
+namespace
+{
+uint32_t CountCommands(const Graphics::GLES::CommandBuffer& commandBuffer, Graphics::GLES::CommandType type)
+{
+  uint32_t count    = 0u;
+  auto     commands = commandBuffer.GetCommands(count);
+
+  uint32_t typeCount = 0u;
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    typeCount += (commands[i].type == type) ? 1u : 0u;
+  }
+  return typeCount;
+}
+
+/**
+ * Creates a program and a pipeline through the graphics controller.
+ * Pipelines created with different vertex sources use different GL programs.
+ */
+struct TestPipeline
+{
+  TestPipeline(Graphics::Controller& controller, const std::string& vertexSource, Graphics::PrimitiveTopology topology, Graphics::CullMode cullMode)
+  : vertexSource(vertexSource),
+    fragmentSource("myFragShaderSource")
+  {
+    Graphics::ShaderCreateInfo vertexShaderCreateInfo;
+    vertexShaderCreateInfo.SetPipelineStage(Graphics::PipelineStage::VERTEX_SHADER);
+    vertexShaderCreateInfo.SetSourceMode(Graphics::ShaderSourceMode::TEXT);
+    vertexShaderCreateInfo.SetSourceData(this->vertexSource.c_str());
+    vertexShaderCreateInfo.SetSourceSize(static_cast<uint32_t>(this->vertexSource.size()));
+    vertexShader = controller.CreateShader(vertexShaderCreateInfo, nullptr);
+
+    Graphics::ShaderCreateInfo fragmentShaderCreateInfo;
+    fragmentShaderCreateInfo.SetPipelineStage(Graphics::PipelineStage::FRAGMENT_SHADER);
+    fragmentShaderCreateInfo.SetSourceMode(Graphics::ShaderSourceMode::TEXT);
+    fragmentShaderCreateInfo.SetSourceData(fragmentSource.c_str());
+    fragmentShaderCreateInfo.SetSourceSize(static_cast<uint32_t>(fragmentSource.size()));
+    fragmentShader = controller.CreateShader(fragmentShaderCreateInfo, nullptr);
+
+    std::vector<Graphics::ShaderState> shaderStates{
+      Graphics::ShaderState().SetShader(*vertexShader).SetPipelineStage(Graphics::PipelineStage::VERTEX_SHADER),
+      Graphics::ShaderState().SetShader(*fragmentShader).SetPipelineStage(Graphics::PipelineStage::FRAGMENT_SHADER)};
+
+    Graphics::ProgramCreateInfo programCreateInfo;
+    programCreateInfo.SetShaderState(shaderStates);
+    programCreateInfo.SetName(this->vertexSource);
+    program = controller.CreateProgram(programCreateInfo, nullptr);
+
+    Graphics::ProgramState programState;
+    programState.SetProgram(*program);
+
+    Graphics::InputAssemblyState inputAssemblyState;
+    inputAssemblyState.SetTopology(topology);
+
+    Graphics::RasterizationState rasterizationState;
+    rasterizationState.SetCullMode(cullMode);
+
+    Graphics::VertexInputState vertexInputState;
+
+    Graphics::PipelineCreateInfo pipelineCreateInfo;
+    pipelineCreateInfo.SetProgramState(&programState);
+    pipelineCreateInfo.SetInputAssemblyState(&inputAssemblyState);
+    pipelineCreateInfo.SetRasterizationState(&rasterizationState);
+    pipelineCreateInfo.SetVertexInputState(&vertexInputState);
+    pipeline = controller.CreatePipeline(pipelineCreateInfo, nullptr);
+  }
+
+  std::string                             vertexSource;
+  std::string                             fragmentSource;
+  Graphics::UniquePtr<Graphics::Shader>   vertexShader;
+  Graphics::UniquePtr<Graphics::Shader>   fragmentShader;
+  Graphics::UniquePtr<Graphics::Program>  program;
+  Graphics::UniquePtr<Graphics::Pipeline> pipeline;
+};
+
+Graphics::UniquePtr<Graphics::CommandBuffer> CreatePrimaryCommandBuffer(Graphics::Controller& controller)
+{
+  return controller.CreateCommandBuffer(Graphics::CommandBufferCreateInfo().SetLevel(Graphics::CommandBufferLevel::PRIMARY), nullptr);
+}
+
+void Submit(Graphics::Controller& controller, Graphics::CommandBuffer& commandBuffer)
+{
+  Graphics::SubmitInfo submitInfo{{&commandBuffer}, 0 | Graphics::SubmitFlagBits::FLUSH};
+  controller.SubmitCommandBuffers(submitInfo);
+}
+
+} // namespace
+
+void utc_dali_graphics_command_buffer_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+void utc_dali_graphics_command_buffer_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliGraphicsCommandBufferRemoveRedundantState(void)
+{
+  TestGraphicsApplication app;
+  tet_infoline("Test repeated viewport and scissor commands are removed");
+
+  auto& controller    = app.GetGraphicsController();
+  auto  commandBuffer = controller.CreateCommandBuffer(Graphics::CommandBufferCreateInfo().SetLevel(Graphics::CommandBufferLevel::PRIMARY), nullptr);
+  auto& glesBuffer    = static_cast<Graphics::GLES::CommandBuffer&>(*commandBuffer);
+
+  commandBuffer->Begin(Graphics::CommandBufferBeginInfo());
+  commandBuffer->SetViewport({0.0f, 0.0f, 480.0f, 800.0f, 0.0f, 1.0f});
+  commandBuffer->SetScissor({0, 0, 480u, 800u});
+  commandBuffer->SetViewport({0.0f, 0.0f, 480.0f, 800.0f, 0.0f, 1.0f});
+  commandBuffer->SetScissor({0, 0, 480u, 800u});
+  commandBuffer->SetScissor({0, 0, 240u, 800u});
+  commandBuffer->End();
+
+  DALI_TEST_EQUALS(glesBuffer.RemoveRedundantCommands(), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(CountCommands(glesBuffer, Graphics::GLES::CommandType::SET_VIEWPORT), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(CountCommands(glesBuffer, Graphics::GLES::CommandType::SET_SCISSOR), 2u, TEST_LOCATION);
+
+  // Running it again changes nothing
+  DALI_TEST_EQUALS(glesBuffer.RemoveRedundantCommands(), 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliGraphicsCommandBufferRemoveUnusedBinds(void)
+{
+  TestGraphicsApplication app;
+  tet_infoline("Test texture binds overwritten before a draw are removed, and draws without a known pipeline are kept");
+
+  auto& controller    = app.GetGraphicsController();
+  auto  commandBuffer = controller.CreateCommandBuffer(Graphics::CommandBufferCreateInfo().SetLevel(Graphics::CommandBufferLevel::PRIMARY), nullptr);
+  auto& glesBuffer    = static_cast<Graphics::GLES::CommandBuffer&>(*commandBuffer);
+
+  commandBuffer->Begin(Graphics::CommandBufferBeginInfo());
+  commandBuffer->BindTextures({});
+  commandBuffer->BindTextures({});
+  commandBuffer->Draw(3u, 0u, 0u, 0u);
+  commandBuffer->BindTextures({});
+  commandBuffer->Draw(3u, 0u, 3u, 0u);
+  commandBuffer->End();
+
+  DALI_TEST_EQUALS(glesBuffer.RemoveRedundantCommands(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(CountCommands(glesBuffer, Graphics::GLES::CommandType::BIND_TEXTURES), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(CountCommands(glesBuffer, Graphics::GLES::CommandType::DRAW), 2u, TEST_LOCATION);
+
+  // Reset allows the recorded commands to be optimized again
+  commandBuffer->Reset();
+  commandBuffer->SetViewport({0.0f, 0.0f, 480.0f, 800.0f, 0.0f, 1.0f});
+  commandBuffer->SetViewport({0.0f, 0.0f, 480.0f, 800.0f, 0.0f, 1.0f});
+  DALI_TEST_EQUALS(glesBuffer.RemoveRedundantCommands(), 1u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliGraphicsCommandBufferRemovedCommandCount(void)
+{
+  TestGraphicsApplication app;
+  tet_infoline("Test the controller counts the commands removed from the command buffers submitted in a frame");
+
+  auto& controller = static_cast<Graphics::EglGraphicsController&>(app.GetGraphicsController());
+
+  TestPipeline pipeline(controller, "myVertShaderSource", Graphics::PrimitiveTopology::TRIANGLE_LIST, Graphics::CullMode::NONE);
+
+  controller.FrameStart();
+  DALI_TEST_EQUALS(controller.GetRemovedCommandCount(), 0u, TEST_LOCATION);
+
+  // A repeated viewport, a rebind of the drawn pipeline, and a draw merged with the previous one.
+  auto commandBuffer = CreatePrimaryCommandBuffer(controller);
+  commandBuffer->Begin(Graphics::CommandBufferBeginInfo());
+  commandBuffer->SetViewport({0.0f, 0.0f, 480.0f, 800.0f, 0.0f, 1.0f});
+  commandBuffer->SetViewport({0.0f, 0.0f, 480.0f, 800.0f, 0.0f, 1.0f});
+  commandBuffer->BindPipeline(*pipeline.pipeline);
+  commandBuffer->Draw(3u, 0u, 0u, 0u);
+  commandBuffer->BindPipeline(*pipeline.pipeline);
+  commandBuffer->Draw(3u, 0u, 3u, 0u);
+  commandBuffer->End();
+  Submit(controller, *commandBuffer);
+
+  DALI_TEST_EQUALS(controller.GetRemovedCommandCount(), 3u, TEST_LOCATION);
+
+  // The count adds up over the command buffers of the frame.
+  auto secondCommandBuffer = CreatePrimaryCommandBuffer(controller);
+  secondCommandBuffer->Begin(Graphics::CommandBufferBeginInfo());
+  secondCommandBuffer->SetScissor({0, 0, 480u, 800u});
+  secondCommandBuffer->SetScissor({0, 0, 480u, 800u});
+  secondCommandBuffer->End();
+  Submit(controller, *secondCommandBuffer);
+
+  DALI_TEST_EQUALS(controller.GetRemovedCommandCount(), 4u, TEST_LOCATION);
+
+  // And restarts with the next frame.
+  controller.FrameStart();
+  DALI_TEST_EQUALS(controller.GetRemovedCommandCount(), 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliGraphicsCommandBufferRemoveRedundantPipelineBinds(void)
+{
+  TestGraphicsApplication app;
+  tet_infoline("Test pipeline binds which change nothing are removed, and the GL calls still follow the bound pipelines");
+
+  auto& controller = app.GetGraphicsController();
+  auto& gl         = app.GetGlAbstraction();
+
+  TestPipeline frontPipeline(controller, "myFrontVertShaderSource", Graphics::PrimitiveTopology::TRIANGLE_LIST, Graphics::CullMode::FRONT);
+  TestPipeline backPipeline(controller, "myBackVertShaderSource", Graphics::PrimitiveTopology::TRIANGLE_LIST, Graphics::CullMode::BACK);
+
+  auto& drawTrace     = gl.GetDrawTrace();
+  auto& cullFaceTrace = gl.GetCullFaceTrace();
+  drawTrace.Enable(true);
+  cullFaceTrace.Enable(true);
+
+  auto  commandBuffer = CreatePrimaryCommandBuffer(controller);
+  auto& glesBuffer    = static_cast<Graphics::GLES::CommandBuffer&>(*commandBuffer);
+
+  commandBuffer->Begin(Graphics::CommandBufferBeginInfo());
+  commandBuffer->BindPipeline(*frontPipeline.pipeline);
+  commandBuffer->Draw(3u, 0u, 0u, 0u);
+  commandBuffer->BindPipeline(*backPipeline.pipeline);  // Overwritten before any draw
+  commandBuffer->BindPipeline(*frontPipeline.pipeline); // Already used by the last draw
+  commandBuffer->Draw(3u, 0u, 6u, 0u);
+  commandBuffer->BindPipeline(*backPipeline.pipeline);
+  commandBuffer->Draw(3u, 0u, 12u, 0u);
+  commandBuffer->End();
+
+  drawTrace.Reset();
+  cullFaceTrace.Reset();
+  Submit(controller, *commandBuffer);
+
+  DALI_TEST_EQUALS(CountCommands(glesBuffer, Graphics::GLES::CommandType::BIND_PIPELINE), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(CountCommands(glesBuffer, Graphics::GLES::CommandType::DRAW), 3u, TEST_LOCATION);
+
+  // Every draw reaches GL, and the cull face only changes for the draw with the other pipeline.
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawArrays"), 3, TEST_LOCATION);
+  DALI_TEST_EQUALS(drawTrace.TestMethodAndParams(0, "DrawArrays", "4, 0, 3"), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(drawTrace.TestMethodAndParams(1, "DrawArrays", "4, 6, 3"), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(drawTrace.TestMethodAndParams(2, "DrawArrays", "4, 12, 3"), true, TEST_LOCATION);
+
+  DALI_TEST_EQUALS(cullFaceTrace.CountMethod("CullFace"), 2, TEST_LOCATION);
+  DALI_TEST_EQUALS(cullFaceTrace.TestMethodAndParams(0, "CullFace", "404"), true, TEST_LOCATION); // GL_FRONT
+  DALI_TEST_EQUALS(cullFaceTrace.TestMethodAndParams(1, "CullFace", "405"), true, TEST_LOCATION); // GL_BACK
+
+  END_TEST;
+}
+
+int UtcDaliGraphicsCommandBufferMergeDraws(void)
+{
+  TestGraphicsApplication app;
+  tet_infoline("Test contiguous draws of a list topology with the same state reach GL as a single draw");
+
+  auto& controller = app.GetGraphicsController();
+  auto& drawTrace  = app.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable(true);
+
+  TestPipeline listPipeline(controller, "myListVertShaderSource", Graphics::PrimitiveTopology::TRIANGLE_LIST, Graphics::CullMode::NONE);
+  TestPipeline stripPipeline(controller, "myStripVertShaderSource", Graphics::PrimitiveTopology::TRIANGLE_STRIP, Graphics::CullMode::NONE);
+
+  // Contiguous triangle lists are merged, and a gap starts a new draw.
+  auto commandBuffer = CreatePrimaryCommandBuffer(controller);
+  commandBuffer->Begin(Graphics::CommandBufferBeginInfo());
+  commandBuffer->BindPipeline(*listPipeline.pipeline);
+  commandBuffer->Draw(3u, 0u, 0u, 0u);
+  commandBuffer->Draw(3u, 0u, 3u, 0u);
+  commandBuffer->Draw(6u, 0u, 6u, 0u);
+  commandBuffer->Draw(3u, 0u, 15u, 0u);
+  commandBuffer->End();
+
+  drawTrace.Reset();
+  Submit(controller, *commandBuffer);
+
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawArrays"), 2, TEST_LOCATION);
+  DALI_TEST_EQUALS(drawTrace.TestMethodAndParams(0, "DrawArrays", "4, 0, 12"), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(drawTrace.TestMethodAndParams(1, "DrawArrays", "4, 15, 3"), true, TEST_LOCATION);
+
+  // Instanced draws are kept.
+  auto instancedCommandBuffer = CreatePrimaryCommandBuffer(controller);
+  instancedCommandBuffer->Begin(Graphics::CommandBufferBeginInfo());
+  instancedCommandBuffer->BindPipeline(*listPipeline.pipeline);
+  instancedCommandBuffer->Draw(3u, 2u, 0u, 0u);
+  instancedCommandBuffer->Draw(3u, 2u, 3u, 0u);
+  instancedCommandBuffer->End();
+
+  drawTrace.Reset();
+  Submit(controller, *instancedCommandBuffer);
+
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawArraysInstanced"), 2, TEST_LOCATION);
+
+  // Strips can't be joined.
+  auto stripCommandBuffer = CreatePrimaryCommandBuffer(controller);
+  stripCommandBuffer->Begin(Graphics::CommandBufferBeginInfo());
+  stripCommandBuffer->BindPipeline(*stripPipeline.pipeline);
+  stripCommandBuffer->Draw(4u, 0u, 0u, 0u);
+  stripCommandBuffer->Draw(4u, 0u, 4u, 0u);
+  stripCommandBuffer->End();
+
+  drawTrace.Reset();
+  Submit(controller, *stripCommandBuffer);
+
+  DALI_TEST_EQUALS(drawTrace.CountMethod("DrawArrays"), 2, TEST_LOCATION);
+  DALI_TEST_EQUALS(drawTrace.TestMethodAndParams(0, "DrawArrays", "5, 0, 4"), true, TEST_LOCATION);
+  DALI_TEST_EQUALS(drawTrace.TestMethodAndParams(1, "DrawArrays", "5, 4, 4"), true, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliGraphicsCommandBufferReuseStorage(void)
+{
+  TestGraphicsApplication app;
+  tet_infoline("Test a reset command buffer records the same commands again without allocating");
+
+  auto& controller    = app.GetGraphicsController();
+  auto  commandBuffer = controller.CreateCommandBuffer(Graphics::CommandBufferCreateInfo().SetLevel(Graphics::CommandBufferLevel::PRIMARY), nullptr);
+  auto& glesBuffer    = static_cast<Graphics::GLES::CommandBuffer&>(*commandBuffer);
+
+  auto record = [&]()
+  {
+    commandBuffer->Begin(Graphics::CommandBufferBeginInfo());
+    for(uint32_t i = 0u; i < 200u; ++i)
+    {
+      commandBuffer->SetViewport({0.0f, 0.0f, 480.0f, static_cast<float>(i), 0.0f, 1.0f});
+      commandBuffer->BindTextures({});
+    }
+    commandBuffer->End();
+  };
+
+  record();
+  DALI_TEST_CHECK(glesBuffer.TakeStorageGrowCount() > 0u);
+
+  uint32_t commandCount = 0u;
+  uint32_t memorySize   = 0u;
+  glesBuffer.GetHighWaterMarks(commandCount, memorySize);
+  DALI_TEST_CHECK(commandCount >= 400u);
+
+  for(int frame = 0; frame < 3; ++frame)
+  {
+    commandBuffer->Reset();
+    record();
+    DALI_TEST_EQUALS(glesBuffer.TakeStorageGrowCount(), 0u, TEST_LOCATION);
+  }
+
+  uint32_t newCommandCount = 0u;
+  glesBuffer.GetHighWaterMarks(newCommandCount, memorySize);
+  DALI_TEST_EQUALS(newCommandCount, commandCount, TEST_LOCATION);
+
+  END_TEST;
+}
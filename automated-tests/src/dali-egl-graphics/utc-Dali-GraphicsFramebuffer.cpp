@@ -18,10 +18,15 @@
 #include <dali/dali.h>
 
 #include <dali/internal/graphics/gles-impl/egl-graphics-controller.h>
+#include <dali/internal/graphics/gles-impl/gles-graphics-framebuffer.h>
+#include <dali/internal/graphics/gles-impl/gles-sync-object.h>
 #include <test-actor-utils.h>
 #include <test-graphics-egl-application.h>
 #include <test-graphics-framebuffer.h>
 
+#include <algorithm>
+#include <vector>
+
 using namespace Dali;
 
 namespace
@@ -54,6 +59,13 @@ RenderTask CreateRenderTask(TestGraphicsApplication& application,
 
   return newTask;
 }
+
+TraceCallStack::NamedParams PixelPackTarget()
+{
+  TraceCallStack::NamedParams params;
+  params["target"] << std::hex << GL_PIXEL_PACK_BUFFER;
+  return params;
+}
 } // namespace
 
 void utc_dali_graphics_framebuffer_startup(void)
@@ -402,3 +414,140 @@ int UtcDaliGraphicsFramebufferAttachStencilAndDepthTexture(void)
 
   END_TEST;
 }
+
+int UtcDaliGraphicsFramebufferReadPixelsAsync(void)
+{
+  TestGraphicsApplication app;
+  tet_infoline("Test the render result of a synchronised render task is read through a pixel pack buffer on GLES3, and mapped once the read completed");
+
+  auto& controller = static_cast<Graphics::EglGraphicsController&>(app.GetGraphicsController());
+  controller.SetGLESVersion(Graphics::GLES::GLESVersion::GLES_30);
+
+  auto& gl = app.GetGlAbstraction();
+  gl.SetFenceSyncEnabled(true);
+  gl.SetClientWaitSyncResult(GL_TIMEOUT_EXPIRED);
+
+  auto& bufferTrace = gl.GetBufferTrace();
+  bufferTrace.Enable(true);
+  bufferTrace.EnableLogging(true);
+
+  uint32_t    width       = 16u;
+  uint32_t    height      = 16u;
+  FrameBuffer framebuffer = FrameBuffer::New(width, height, FrameBuffer::Attachment::NONE);
+  Texture     texture     = CreateTexture(TextureType::TEXTURE_2D, Pixel::RGBA8888, width, height);
+  framebuffer.AttachColorTexture(texture);
+
+  RenderTask renderTask = CreateRenderTask(app, framebuffer);
+  renderTask.SetRefreshRate(RenderTask::REFRESH_ONCE);
+  renderTask.SetProperty(RenderTask::Property::REQUIRES_SYNC, true);
+  renderTask.KeepRenderResult();
+
+  app.SendNotification();
+  app.Render(16);
+
+  // The pixels are read into a pixel pack buffer...
+  std::stringstream unbind;
+  unbind << std::hex << GL_PIXEL_PACK_BUFFER << ", " << 0;
+  DALI_TEST_CHECK(bufferTrace.FindMethodAndParams("BindBuffer", unbind.str()));
+
+  // ...which isn't mapped while the GPU hasn't finished.
+  app.SendNotification();
+  app.Render(16);
+  DALI_TEST_CHECK(!bufferTrace.FindMethodAndParams("MapBufferRange", PixelPackTarget()));
+
+  // Once it has, the pixels are copied to the render result.
+  gl.SetClientWaitSyncResult(GL_ALREADY_SIGNALED);
+  app.SendNotification();
+  app.Render(16);
+
+  DALI_TEST_CHECK(bufferTrace.FindMethodAndParams("MapBufferRange", PixelPackTarget()));
+  DALI_TEST_CHECK(bufferTrace.FindMethodAndParams("UnmapBuffer", PixelPackTarget()));
+
+  END_TEST;
+}
+
+int UtcDaliGraphicsFramebufferReadPixelsAsyncFramebufferDestroyed(void)
+{
+  TestGraphicsApplication app;
+  tet_infoline("Test a pending read of a framebuffer is cancelled when the framebuffer is destroyed first");
+
+  auto& controller = static_cast<Graphics::EglGraphicsController&>(app.GetGraphicsController());
+  controller.SetGLESVersion(Graphics::GLES::GLESVersion::GLES_30);
+
+  auto& gl = app.GetGlAbstraction();
+  gl.SetFenceSyncEnabled(true);
+  gl.SetClientWaitSyncResult(GL_TIMEOUT_EXPIRED);
+
+  auto& bufferTrace = gl.GetBufferTrace();
+  bufferTrace.Enable(true);
+  bufferTrace.EnableLogging(true);
+
+  Graphics::FramebufferCreateInfo framebufferCreateInfo;
+  framebufferCreateInfo.SetSize({16u, 16u});
+  auto framebuffer = controller.CreateFramebuffer(framebufferCreateInfo, nullptr);
+
+  auto  syncObject     = controller.CreateSyncObject(Graphics::SyncObjectCreateInfo{}, nullptr);
+  auto& glesSyncObject = static_cast<Graphics::GLES::SyncObject&>(*syncObject);
+  glesSyncObject.InitializeResource(); // As at the end of the render pass
+
+  // The client frees the destination along with the framebuffer.
+  const uint32_t       dataSize = 16u * 16u * 4u;
+  std::vector<uint8_t> destination(dataSize, 0x5a);
+  GLuint               packBuffer = 0u;
+  gl.GenBuffers(1, &packBuffer);
+  glesSyncObject.SetPendingReadback(static_cast<Graphics::GLES::Framebuffer&>(*framebuffer), packBuffer, destination.data(), dataSize);
+
+  DALI_TEST_CHECK(!syncObject->IsSynced());
+
+  bufferTrace.Reset();
+  framebuffer.reset();
+
+  // The pack buffer is deleted straight away, and the pixels are never copied.
+  TraceCallStack::NamedParams deleteParams;
+  deleteParams["id"] << packBuffer;
+  DALI_TEST_CHECK(bufferTrace.FindMethodAndParams("DeleteBuffers", deleteParams));
+
+  gl.SetClientWaitSyncResult(GL_ALREADY_SIGNALED);
+  DALI_TEST_CHECK(syncObject->IsSynced());
+  DALI_TEST_CHECK(!bufferTrace.FindMethodAndParams("MapBufferRange", PixelPackTarget()));
+  DALI_TEST_CHECK(std::all_of(destination.begin(), destination.end(), [](uint8_t value) { return value == 0x5a; }));
+
+  // Destroying the sync object afterwards is fine too.
+  syncObject.reset();
+
+  END_TEST;
+}
+
+int UtcDaliGraphicsFramebufferReadPixelsAsyncSyncObjectDestroyed(void)
+{
+  TestGraphicsApplication app;
+  tet_infoline("Test a framebuffer forgets a pending read when its sync object is destroyed first");
+
+  auto& controller = static_cast<Graphics::EglGraphicsController&>(app.GetGraphicsController());
+  controller.SetGLESVersion(Graphics::GLES::GLESVersion::GLES_30);
+
+  auto& gl = app.GetGlAbstraction();
+  gl.SetFenceSyncEnabled(true);
+  gl.SetClientWaitSyncResult(GL_TIMEOUT_EXPIRED);
+
+  Graphics::FramebufferCreateInfo framebufferCreateInfo;
+  framebufferCreateInfo.SetSize({16u, 16u});
+  auto framebuffer = controller.CreateFramebuffer(framebufferCreateInfo, nullptr);
+
+  auto syncObject = controller.CreateSyncObject(Graphics::SyncObjectCreateInfo{}, nullptr);
+  static_cast<Graphics::GLES::SyncObject&>(*syncObject).InitializeResource();
+
+  const uint32_t       dataSize = 16u * 16u * 4u;
+  std::vector<uint8_t> destination(dataSize, 0x5a);
+  GLuint               packBuffer = 0u;
+  gl.GenBuffers(1, &packBuffer);
+  static_cast<Graphics::GLES::SyncObject&>(*syncObject).SetPendingReadback(static_cast<Graphics::GLES::Framebuffer&>(*framebuffer), packBuffer, destination.data(), dataSize);
+
+  // The framebuffer must not cancel the read of a destroyed sync object.
+  syncObject.reset();
+  framebuffer.reset();
+
+  DALI_TEST_CHECK(std::all_of(destination.begin(), destination.end(), [](uint8_t value) { return value == 0x5a; }));
+
+  END_TEST;
+}
@@ -20,12 +20,17 @@
 
 #include <dali/integration-api/string-utils.h>
 #include <dali/internal/graphics/gles-impl/egl-graphics-controller.h>
+#include <dali/internal/graphics/gles-impl/gles-program-binary-archive.h>
 #include <test-actor-utils.h>
 #include <test-graphics-egl-application.h>
 #include <test-graphics-sampler.h>
 
 #include "mesh-builder.h"
 
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
 using namespace Dali;
 using Dali::Integration::ToDaliStringView;
 
@@ -305,6 +310,188 @@ int UtcDaliGraphicsShaderNewUsingProgramBinary(void)
   END_TEST;
 }
 
+int UtcDaliGraphicsProgramBinaryArchive(void)
+{
+  tet_infoline("UtcDaliProgram - Check the program binary archive finds the binaries appended by any process");
+
+  using Dali::Graphics::GLES::ProgramBinaryArchive;
+
+  const std::string path = (std::filesystem::temp_directory_path() / "utc-dali-program-binaries.archive").string();
+  std::filesystem::remove(path);
+
+  const std::vector<uint8_t> binary1(100u, 1u);
+  const std::vector<uint8_t> binary2(33u, 2u);
+  uint32_t                   format = 0u;
+  uint32_t                   size   = 0u;
+  {
+    ProgramBinaryArchive archive(path, 42u);
+    DALI_TEST_CHECK(archive.IsValid());
+    DALI_TEST_CHECK(archive.Find(1u, format, size) == nullptr);
+
+    DALI_TEST_CHECK(archive.Append(1u, 7u, binary1.data(), binary1.size()));
+    DALI_TEST_CHECK(archive.Append(2u, 8u, binary2.data(), binary2.size()));
+
+    const uint8_t* binary = archive.Find(2u, format, size);
+    DALI_TEST_CHECK(binary);
+    DALI_TEST_EQUALS(format, 8u, TEST_LOCATION);
+    DALI_TEST_EQUALS(size, 33u, TEST_LOCATION);
+    DALI_TEST_CHECK(memcmp(binary, binary2.data(), size) == 0);
+  }
+  {
+    // Another process opens the archive.
+    ProgramBinaryArchive archive(path, 42u);
+    DALI_TEST_EQUALS(archive.GetStatistics().entryCount, 2u, TEST_LOCATION);
+
+    const uint8_t* binary = archive.Find(1u, format, size);
+    DALI_TEST_CHECK(binary);
+    DALI_TEST_EQUALS(format, 7u, TEST_LOCATION);
+    DALI_TEST_EQUALS(size, 100u, TEST_LOCATION);
+    DALI_TEST_CHECK(memcmp(binary, binary1.data(), size) == 0);
+
+    archive.RecordLoad(true, std::chrono::microseconds(10));
+    archive.RecordLoad(false, std::chrono::microseconds(0));
+    DALI_TEST_EQUALS(archive.GetStatistics().hitCount, 1u, TEST_LOCATION);
+    DALI_TEST_EQUALS(archive.GetStatistics().missCount, 1u, TEST_LOCATION);
+    DALI_TEST_EQUALS(archive.GetStatistics().loadTime.count(), 10, TEST_LOCATION);
+  }
+  {
+    // An entry torn by a crash is dropped by the next append.
+    std::ofstream stream(path, std::ios::binary | std::ios::app);
+    stream.write("torn entry", 10);
+    stream.close();
+
+    ProgramBinaryArchive archive(path, 42u);
+    DALI_TEST_EQUALS(archive.GetStatistics().entryCount, 2u, TEST_LOCATION);
+    DALI_TEST_CHECK(archive.Append(3u, 9u, binary2.data(), binary2.size()));
+    DALI_TEST_CHECK(archive.Find(3u, format, size) != nullptr);
+    DALI_TEST_CHECK(archive.Find(1u, format, size) != nullptr);
+  }
+  {
+    // A corrupted entry is superseded by the binary appended again.
+    std::fstream stream(path, std::ios::binary | std::ios::in | std::ios::out);
+    stream.seekp(16 + 24 + 5); // The first binary, after the archive and entry headers.
+    stream.put(2);
+    stream.close();
+
+    ProgramBinaryArchive archive(path, 42u);
+    ProgramBinaryArchive otherArchive(path, 42u);
+    DALI_TEST_CHECK(archive.Find(1u, format, size) == nullptr);
+    DALI_TEST_CHECK(archive.Append(1u, 7u, binary1.data(), binary1.size()));
+
+    const uint8_t* binary = archive.Find(1u, format, size);
+    DALI_TEST_CHECK(binary);
+    DALI_TEST_CHECK(memcmp(binary, binary1.data(), size) == 0);
+
+    // Another process, which indexed the corrupted one, finds the appended one.
+    binary = otherArchive.Find(1u, format, size);
+    DALI_TEST_CHECK(binary);
+    DALI_TEST_CHECK(memcmp(binary, binary1.data(), size) == 0);
+  }
+  {
+    // A binary rejected by the driver is not found, until the binary of the compiled program replaces it.
+    const std::vector<uint8_t> binary3(100u, 3u);
+
+    ProgramBinaryArchive archive(path, 42u);
+    DALI_TEST_CHECK(archive.Find(1u, format, size) != nullptr);
+    archive.Invalidate(1u);
+    DALI_TEST_CHECK(archive.Find(1u, format, size) == nullptr);
+    DALI_TEST_CHECK(archive.Find(2u, format, size) != nullptr);
+
+    DALI_TEST_CHECK(archive.Append(1u, 7u, binary3.data(), binary3.size()));
+    const uint8_t* binary = archive.Find(1u, format, size);
+    DALI_TEST_CHECK(binary);
+    DALI_TEST_CHECK(memcmp(binary, binary3.data(), size) == 0);
+
+    // Another process finds the replacing binary.
+    ProgramBinaryArchive otherArchive(path, 42u);
+    binary = otherArchive.Find(1u, format, size);
+    DALI_TEST_CHECK(binary);
+    DALI_TEST_CHECK(memcmp(binary, binary3.data(), size) == 0);
+
+    // Appending the same binary again doesn't grow the archive.
+    const auto archiveSize = std::filesystem::file_size(path);
+    DALI_TEST_CHECK(otherArchive.Append(1u, 7u, binary3.data(), binary3.size()));
+    DALI_TEST_EQUALS(std::filesystem::file_size(path), archiveSize, TEST_LOCATION);
+  }
+  {
+    // The replaced binaries are compacted away, so the archive doesn't grow without bound.
+    ProgramBinaryArchive archive(path, 42u);
+    const uint32_t       entryCount = archive.GetStatistics().entryCount;
+    for(uint8_t i = 0u; i < 20u; ++i)
+    {
+      const std::vector<uint8_t> binary(100u, 10u + i);
+      archive.Invalidate(1u);
+      DALI_TEST_CHECK(archive.Append(1u, 7u, binary.data(), binary.size()));
+      DALI_TEST_CHECK(archive.Find(1u, format, size) != nullptr);
+    }
+    DALI_TEST_EQUALS(archive.GetStatistics().entryCount, entryCount, TEST_LOCATION);
+    DALI_TEST_CHECK(std::filesystem::file_size(path) < 4u * 128u * entryCount);
+
+    const std::vector<uint8_t> lastBinary(100u, 29u);
+    ProgramBinaryArchive       otherArchive(path, 42u);
+    const uint8_t*             binary = otherArchive.Find(1u, format, size);
+    DALI_TEST_CHECK(binary);
+    DALI_TEST_CHECK(memcmp(binary, lastBinary.data(), size) == 0);
+    DALI_TEST_CHECK(otherArchive.Find(2u, format, size) != nullptr);
+    DALI_TEST_CHECK(otherArchive.Find(3u, format, size) != nullptr);
+  }
+  {
+    // The binaries of another driver are ignored, and the archive is rewritten.
+    ProgramBinaryArchive otherDriverArchive(path, 42u);
+    const uint8_t*       binary = otherDriverArchive.Find(2u, format, size);
+    DALI_TEST_CHECK(binary);
+
+    ProgramBinaryArchive archive(path, 43u);
+    DALI_TEST_EQUALS(archive.GetStatistics().entryCount, 0u, TEST_LOCATION);
+    DALI_TEST_CHECK(archive.Find(1u, format, size) == nullptr);
+
+    DALI_TEST_CHECK(archive.Append(4u, 9u, binary2.data(), binary2.size()));
+    DALI_TEST_CHECK(archive.Find(4u, format, size) != nullptr);
+    DALI_TEST_CHECK(archive.Find(3u, format, size) == nullptr);
+
+    // The archive is replaced rather than truncated, so a binary found by another process stays readable.
+    DALI_TEST_CHECK(memcmp(binary, binary2.data(), binary2.size()) == 0);
+
+    // Which opens the new archive once it appends.
+    DALI_TEST_CHECK(otherDriverArchive.Append(5u, 9u, binary2.data(), binary2.size()));
+    DALI_TEST_CHECK(otherDriverArchive.Find(2u, format, size) == nullptr);
+    DALI_TEST_CHECK(otherDriverArchive.Find(5u, format, size) != nullptr);
+  }
+
+  std::filesystem::remove(path);
+  END_TEST;
+}
+
+int UtcDaliGraphicsProgramPrecompileFallback(void)
+{
+  TestGraphicsApplication app;
+  tet_infoline("UtcDaliProgram - Check the programs created while precompiling are linked at once when they can't be compiled in the background");
+
+  auto& controller = static_cast<Graphics::EglGraphicsController&>(app.GetGraphicsController());
+
+  // Neither GL_KHR_parallel_shader_compile nor a shared context is available in the test environment.
+  controller.BeginProgramPrecompile();
+  DALI_TEST_CHECK(controller.GetProgramPrecompileEngine() == nullptr);
+
+  Texture diffuse = CreateTexture(TextureType::TEXTURE_2D, Pixel::RGBA8888, 16u, 16u);
+  Actor   actor   = CreateRenderableActor(diffuse, VERT_SHADER_SOURCE2, FRAG_SHADER_SOURCE2);
+  app.GetScene().Add(actor);
+
+  auto& gl            = app.GetGlAbstraction();
+  auto& glShaderTrace = gl.GetShaderTrace();
+  glShaderTrace.Enable(true);
+
+  app.SendNotification();
+  app.Render(16);
+
+  controller.EndProgramPrecompile();
+
+  DALI_TEST_EQUALS(glShaderTrace.CountMethod("CreateProgram"), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(glShaderTrace.CountMethod("LinkProgram"), 1, TEST_LOCATION);
+
+  END_TEST;
+}
+
 int UtcDaliGraphicsShaderFlush(void)
 {
   // Note : This UTC will not works well since now GLES::ProgramImpl hold the reference of shader,
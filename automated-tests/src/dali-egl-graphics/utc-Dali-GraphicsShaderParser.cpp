@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -705,4 +705,57 @@ int UtcParserInOutLocation0(void)
     DALI_TEST_EQUALS(cmp, true, TEST_LOCATION);
   }
   END_TEST;
-}
\ No newline at end of file
+}
+
+int UtcParseGLES3ShaderForceUniformBlocks(void)
+{
+  tet_infoline("UtcParseGLES3ShaderForceUniformBlocks - Tests uniform blocks are kept for GLES3 when forced");
+
+  // The block names are not in the parser's exception list, so they are flattened by default where the platform flattens them.
+  auto vertexShader   = LoadTextFile(TEST_RESOURCE_DIR "/shaders/force-uniform-blocks.vert");
+  auto fragmentShader = LoadTextFile(TEST_RESOURCE_DIR "/shaders/force-uniform-blocks.frag");
+
+  std::vector<std::string> forcedStrings;
+  std::vector<std::string> normalStrings;
+
+  Internal::ShaderParser::ShaderParserInfo parseInfo{};
+  parseInfo.vertexShaderCode            = vertexShader;
+  parseInfo.fragmentShaderCode          = fragmentShader;
+  parseInfo.vertexShaderLegacyVersion   = 0;
+  parseInfo.fragmentShaderLegacyVersion = 0;
+  parseInfo.language                    = Internal::ShaderParser::OutputLanguage::GLSL_320_ES;
+  parseInfo.outputVersion               = 0;
+  parseInfo.forceUniformBlocks          = true;
+  Parse(parseInfo, forcedStrings);
+
+  parseInfo.forceUniformBlocks = false;
+  Parse(parseInfo, normalStrings);
+
+  {
+    bool cmp = CompareFileWithString(TEST_RESOURCE_DIR "/shaders/force-uniform-blocks.vert.gles3", forcedStrings[0]);
+    DALI_TEST_EQUALS(cmp, true, TEST_LOCATION);
+  }
+  {
+    bool cmp = CompareFileWithString(TEST_RESOURCE_DIR "/shaders/force-uniform-blocks.frag.gles3", forcedStrings[1]);
+    DALI_TEST_EQUALS(cmp, true, TEST_LOCATION);
+  }
+
+#ifdef _ARCH_ARM_
+  // Uniform blocks are flattened into standalone uniforms unless forced.
+  {
+    bool cmp = CompareFileWithString(TEST_RESOURCE_DIR "/shaders/force-uniform-blocks.vert.gles3.flattened", normalStrings[0]);
+    DALI_TEST_EQUALS(cmp, true, TEST_LOCATION);
+  }
+  {
+    bool cmp = CompareFileWithString(TEST_RESOURCE_DIR "/shaders/force-uniform-blocks.frag.gles3.flattened", normalStrings[1]);
+    DALI_TEST_EQUALS(cmp, true, TEST_LOCATION);
+  }
+  DALI_TEST_CHECK(forcedStrings[0] != normalStrings[0]);
+  DALI_TEST_CHECK(forcedStrings[1] != normalStrings[1]);
+#else
+  // Uniform blocks are always kept, so forcing them changes nothing.
+  DALI_TEST_EQUALS(forcedStrings[0], normalStrings[0], TEST_LOCATION);
+  DALI_TEST_EQUALS(forcedStrings[1], normalStrings[1], TEST_LOCATION);
+#endif
+  END_TEST;
+}
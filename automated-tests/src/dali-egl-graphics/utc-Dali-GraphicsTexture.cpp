@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -26,6 +26,40 @@ using namespace Dali;
 
 namespace
 {
+Graphics::UniquePtr<Graphics::Texture> CreateGraphicsTexture(Graphics::Controller& controller, Graphics::TextureType type, uint32_t size)
+{
+  return controller.CreateTexture(Graphics::TextureCreateInfo()
+                                    .SetTextureType(type)
+                                    .SetSize({size, size})
+                                    .SetFormat(Graphics::Format::R8G8B8A8_UNORM)
+                                    .SetUsageFlags(0u | Graphics::TextureUsageFlagBits::SAMPLE),
+                                  nullptr);
+}
+
+/**
+ * Copies a region of srcTexture to dstTexture, from the texel (4, 2) to (8, 8).
+ */
+void CopyTexture(Graphics::EglGraphicsController& controller, Graphics::Texture& srcTexture, Graphics::Texture& dstTexture, uint32_t srcWidth, uint32_t layer)
+{
+  Graphics::TextureUpdateInfo info{};
+  info.dstTexture   = &dstTexture;
+  info.dstOffset2D  = {8, 8};
+  info.layer        = layer;
+  info.level        = 0u;
+  info.srcReference = 0u;
+  info.srcExtent2D  = {8u, 8u};
+  info.srcOffset    = 2u * srcWidth + 4u;
+  info.srcSize      = 0u;
+  info.srcStride    = 0u;
+  info.srcFormat    = Graphics::Format::R8G8B8A8_UNORM;
+
+  Graphics::TextureUpdateSourceInfo source{};
+  source.sourceType            = Graphics::TextureUpdateSourceInfo::Type::TEXTURE;
+  source.textureSource.texture = &srcTexture;
+
+  controller.UpdateTextures({info}, {source});
+  controller.Flush();
+}
 } // namespace
 
 void utc_dali_graphics_draw_startup(void)
@@ -83,3 +117,173 @@ int UtcDaliTextureConvertUpload(void)
   DALI_TEST_EQUALS(namedParams["format"].str(), s.str(), TEST_LOCATION);
   END_TEST;
 }
+
+int UtcDaliTextureUploadFromStagingBuffer(void)
+{
+  TestGraphicsApplication app;
+  tet_infoline("Test that a MEMORY upload is staged in a pixel unpack buffer on GLES3");
+
+  auto& controller = static_cast<Graphics::EglGraphicsController&>(app.GetGraphicsController());
+  controller.SetGLESVersion(Graphics::GLES::GLESVersion::GLES_30);
+
+  auto& gl = app.GetGlAbstraction();
+  gl.EnableTextureCallTrace(true);
+  auto& bufferTrace = gl.GetBufferTrace();
+  bufferTrace.Enable(true);
+  bufferTrace.EnableLogging(true);
+
+  constexpr uint32_t size    = 16u;
+  auto               texture = controller.CreateTexture(Graphics::TextureCreateInfo()
+                                                          .SetTextureType(Graphics::TextureType::TEXTURE_2D)
+                                                          .SetSize({size, size})
+                                                          .SetFormat(Graphics::Format::R8G8B8A8_UNORM)
+                                                          .SetUsageFlags(0u | Graphics::TextureUsageFlagBits::SAMPLE),
+                                                        nullptr);
+
+  std::vector<uint8_t> pixels(size * size * 4u, 0x7fu);
+
+  Graphics::TextureUpdateInfo info{};
+  info.dstTexture   = texture.get();
+  info.dstOffset2D  = {0, 0};
+  info.layer        = 0u;
+  info.level        = 0u;
+  info.srcReference = 0u;
+  info.srcExtent2D  = {size, size};
+  info.srcOffset    = 0u;
+  info.srcSize      = static_cast<uint32_t>(pixels.size());
+  info.srcStride    = 0u;
+  info.srcFormat    = Graphics::Format::R8G8B8A8_UNORM;
+
+  Graphics::TextureUpdateSourceInfo source{};
+  source.sourceType          = Graphics::TextureUpdateSourceInfo::Type::MEMORY;
+  source.memorySource.memory = pixels.data();
+
+  controller.UpdateTextures({info}, {source});
+
+  // The pixels are copied when the upload is requested, so the source can change.
+  std::fill(pixels.begin(), pixels.end(), 0u);
+
+  controller.Flush();
+
+  std::stringstream unbind;
+  unbind << std::hex << GL_PIXEL_UNPACK_BUFFER << ", " << 0;
+  DALI_TEST_CHECK(bufferTrace.FindMethodAndParams("BindBuffer", unbind.str()));
+  DALI_TEST_CHECK(gl.GetTextureTrace().FindMethod("TexImage2D"));
+
+  END_TEST;
+}
+
+int UtcDaliTextureCopyFromTexture(void)
+{
+  TestGraphicsApplication app;
+  tet_infoline("Test that a TEXTURE source is copied on the GPU, from the texel at srcOffset");
+
+  auto& controller = static_cast<Graphics::EglGraphicsController&>(app.GetGraphicsController());
+
+  auto& gl = app.GetGlAbstraction();
+  gl.EnableTextureCallTrace(true);
+
+  auto srcTexture = CreateGraphicsTexture(controller, Graphics::TextureType::TEXTURE_2D, 32u);
+  auto dstTexture = CreateGraphicsTexture(controller, Graphics::TextureType::TEXTURE_2D, 16u);
+
+  CopyTexture(controller, *srcTexture, *dstTexture, 32u, 0u);
+
+  auto& textureTrace = gl.GetTextureTrace();
+  DALI_TEST_EQUALS(textureTrace.CountMethod("CopyTexSubImage2D"), 1, TEST_LOCATION);
+
+  std::stringstream out;
+  out << std::hex << GL_TEXTURE_2D << ", " << std::dec << "0, 8, 8, 4, 2, 8, 8";
+  DALI_TEST_CHECK(textureTrace.FindMethodAndParams("CopyTexSubImage2D", out.str()));
+  DALI_TEST_CHECK(!textureTrace.FindMethod("TexSubImage2D"));
+
+  TraceCallStack::NamedParams attachParams;
+  attachParams["textarget"] << std::hex << GL_TEXTURE_2D;
+  DALI_TEST_CHECK(textureTrace.FindMethodAndParams("FramebufferTexture2D", attachParams));
+
+  END_TEST;
+}
+
+int UtcDaliTextureCopyFromTextureCubemap(void)
+{
+  TestGraphicsApplication app;
+  tet_infoline("Test that a cube map is read through its first face, and written through the face of the layer");
+
+  auto& controller = static_cast<Graphics::EglGraphicsController&>(app.GetGraphicsController());
+
+  auto& gl = app.GetGlAbstraction();
+  gl.EnableTextureCallTrace(true);
+
+  auto srcTexture = CreateGraphicsTexture(controller, Graphics::TextureType::TEXTURE_CUBEMAP, 32u);
+  auto dstTexture = CreateGraphicsTexture(controller, Graphics::TextureType::TEXTURE_CUBEMAP, 16u);
+
+  CopyTexture(controller, *srcTexture, *dstTexture, 32u, 3u);
+
+  auto& textureTrace = gl.GetTextureTrace();
+
+  TraceCallStack::NamedParams attachParams;
+  attachParams["textarget"] << std::hex << GL_TEXTURE_CUBE_MAP_POSITIVE_X;
+  DALI_TEST_CHECK(textureTrace.FindMethodAndParams("FramebufferTexture2D", attachParams));
+
+  TraceCallStack::NamedParams attach2DParams;
+  attach2DParams["textarget"] << std::hex << GL_TEXTURE_2D;
+  DALI_TEST_CHECK(!textureTrace.FindMethodAndParams("FramebufferTexture2D", attach2DParams));
+
+  std::stringstream out;
+  out << std::hex << GL_TEXTURE_CUBE_MAP_POSITIVE_X + 3 << ", " << std::dec << "0, 8, 8, 4, 2, 8, 8";
+  DALI_TEST_CHECK(textureTrace.FindMethodAndParams("CopyTexSubImage2D", out.str()));
+
+  END_TEST;
+}
+
+int UtcDaliTextureCopyFromTextureIncompleteN(void)
+{
+  TestGraphicsApplication app;
+  tet_infoline("Test that a texture which can't be read through a framebuffer isn't copied");
+
+  auto& controller = static_cast<Graphics::EglGraphicsController&>(app.GetGraphicsController());
+
+  auto& gl = app.GetGlAbstraction();
+  gl.EnableTextureCallTrace(true);
+  gl.SetFramebufferIncomplete(true);
+  gl.SetCheckFramebufferStatusResult(GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT);
+
+  auto srcTexture = CreateGraphicsTexture(controller, Graphics::TextureType::TEXTURE_2D, 32u);
+  auto dstTexture = CreateGraphicsTexture(controller, Graphics::TextureType::TEXTURE_2D, 16u);
+
+  CopyTexture(controller, *srcTexture, *dstTexture, 32u, 0u);
+
+  auto& textureTrace = gl.GetTextureTrace();
+  DALI_TEST_CHECK(!textureTrace.FindMethod("CopyTexSubImage2D"));
+
+  // The source is detached all the same.
+  TraceCallStack::NamedParams detachParams;
+  detachParams["texture"] << 0;
+  DALI_TEST_CHECK(textureTrace.FindMethodAndParams("FramebufferTexture2D", detachParams));
+
+  gl.SetFramebufferIncomplete(false);
+  CopyTexture(controller, *srcTexture, *dstTexture, 32u, 0u);
+  DALI_TEST_EQUALS(textureTrace.CountMethod("CopyTexSubImage2D"), 1, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliTextureCopyFromTextureSameTextureN(void)
+{
+  TestGraphicsApplication app;
+  tet_infoline("Test that a texture can't be copied into itself");
+
+  auto& controller = static_cast<Graphics::EglGraphicsController&>(app.GetGraphicsController());
+
+  auto& gl = app.GetGlAbstraction();
+  gl.EnableTextureCallTrace(true);
+
+  auto texture = CreateGraphicsTexture(controller, Graphics::TextureType::TEXTURE_2D, 32u);
+
+  CopyTexture(controller, *texture, *texture, 32u, 0u);
+
+  auto& textureTrace = gl.GetTextureTrace();
+  DALI_TEST_CHECK(!textureTrace.FindMethod("CopyTexSubImage2D"));
+  DALI_TEST_CHECK(!textureTrace.FindMethod("FramebufferTexture2D"));
+
+  END_TEST;
+}
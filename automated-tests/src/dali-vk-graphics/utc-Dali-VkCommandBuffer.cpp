@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/dali.h>
+
+#include <dali/internal/graphics/vulkan-impl/vulkan-render-target.h>
+#include <test-graphics-vk-application.h>
+
+#include <thread>
+#include <vector>
+
+using namespace Dali;
+
+namespace
+{
+/**
+ * An offscreen render target, and the texture it renders to.
+ */
+struct TestOffscreen
+{
+  explicit TestOffscreen(Graphics::Controller& controller)
+  {
+    Graphics::TextureCreateInfo textureCreateInfo;
+    textureCreateInfo.SetTextureType(Graphics::TextureType::TEXTURE_2D)
+      .SetSize({64u, 64u})
+      .SetFormat(Graphics::Format::R8G8B8A8_UNORM)
+      .SetUsageFlags(0u | Graphics::TextureUsageFlagBits::COLOR_ATTACHMENT | Graphics::TextureUsageFlagBits::SAMPLE);
+    texture = controller.CreateTexture(textureCreateInfo, nullptr);
+
+    Graphics::FramebufferCreateInfo framebufferCreateInfo;
+    framebufferCreateInfo.SetSize({64u, 64u})
+      .SetColorAttachments({Graphics::ColorAttachment{0u, texture.get(), 0u, 0u}});
+    framebuffer = controller.CreateFramebuffer(framebufferCreateInfo, nullptr);
+
+    Graphics::RenderTargetCreateInfo renderTargetCreateInfo;
+    renderTargetCreateInfo.SetFramebuffer(framebuffer.get())
+      .SetExtent({64u, 64u})
+      .SetPreTransform(0 | Graphics::RenderTargetTransformFlagBits::TRANSFORM_IDENTITY_BIT);
+    renderTarget = controller.CreateRenderTarget(renderTargetCreateInfo, nullptr);
+  }
+
+  Graphics::UniquePtr<Graphics::Texture>      texture;
+  Graphics::UniquePtr<Graphics::Framebuffer>  framebuffer;
+  Graphics::UniquePtr<Graphics::RenderTarget> renderTarget;
+};
+
+Graphics::UniquePtr<Graphics::CommandBuffer> CreateCommandBuffer(Graphics::Controller& controller, Graphics::CommandBufferLevel level)
+{
+  return controller.CreateCommandBuffer(Graphics::CommandBufferCreateInfo().SetLevel(level), nullptr);
+}
+
+bool DependsOn(const Graphics::UniquePtr<Graphics::RenderTarget>& renderTarget, const Graphics::UniquePtr<Graphics::RenderTarget>& dependency)
+{
+  const auto& dependencies = static_cast<Graphics::Vulkan::RenderTarget*>(renderTarget.get())->GetDependencies();
+  return dependencies.find(static_cast<Graphics::Vulkan::RenderTarget*>(dependency.get())) != dependencies.end();
+}
+
+} // namespace
+
+void utc_dali_vk_command_buffer_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+void utc_dali_vk_command_buffer_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliVkCommandBufferSecondaryTextureDependencies(void)
+{
+  TestGraphicsApplication app;
+  tet_infoline("Test secondary command buffers recorded in parallel make the executing render target depend on the offscreen textures they bind");
+
+  app.SendNotification();
+  app.Render(16);
+
+  auto& controller = app.GetGraphicsController();
+
+  TestOffscreen offscreen(controller);
+  TestOffscreen target(controller);
+
+  // The offscreen pass generates the texture.
+  auto offscreenCommandBuffer = CreateCommandBuffer(controller, Graphics::CommandBufferLevel::PRIMARY);
+
+  Graphics::CommandBufferBeginInfo offscreenBeginInfo;
+  offscreenBeginInfo.renderTarget = offscreen.renderTarget.get();
+  offscreenCommandBuffer->Begin(offscreenBeginInfo);
+  offscreenCommandBuffer->BeginRenderPass(nullptr, offscreen.renderTarget.get(), {0, 0, 64u, 64u}, {});
+  offscreenCommandBuffer->EndRenderPass(nullptr);
+  offscreenCommandBuffer->End();
+
+  // Secondary command buffers are created on the render thread, and recorded without a render target on worker threads.
+  const uint32_t                                            SECONDARY_COUNT = 4u;
+  std::vector<Graphics::UniquePtr<Graphics::CommandBuffer>> secondaryCommandBuffers;
+  for(uint32_t i = 0u; i < SECONDARY_COUNT; ++i)
+  {
+    secondaryCommandBuffers.push_back(CreateCommandBuffer(controller, Graphics::CommandBufferLevel::SECONDARY));
+  }
+
+  Graphics::TextureBinding textureBinding;
+  textureBinding.texture = offscreen.texture.get();
+  textureBinding.sampler = nullptr;
+  textureBinding.binding = 0u;
+
+  std::vector<std::thread> threads;
+  for(auto& secondaryCommandBuffer : secondaryCommandBuffers)
+  {
+    threads.emplace_back([&secondaryCommandBuffer, &textureBinding]()
+    {
+      secondaryCommandBuffer->Begin(Graphics::CommandBufferBeginInfo());
+      secondaryCommandBuffer->BindTextures({textureBinding});
+      secondaryCommandBuffer->Draw(3u, 0u, 0u, 0u);
+      secondaryCommandBuffer->End();
+    });
+  }
+  for(auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  // Recording the secondaries adds no dependency, as they have no render target.
+  DALI_TEST_CHECK(!DependsOn(target.renderTarget, offscreen.renderTarget));
+
+  // The primary command buffer executing them depends on the offscreen pass.
+  auto primaryCommandBuffer = CreateCommandBuffer(controller, Graphics::CommandBufferLevel::PRIMARY);
+
+  Graphics::CommandBufferBeginInfo primaryBeginInfo;
+  primaryBeginInfo.renderTarget = target.renderTarget.get();
+  primaryCommandBuffer->Begin(primaryBeginInfo);
+
+  std::vector<const Graphics::CommandBuffer*> commandBuffers;
+  for(auto& secondaryCommandBuffer : secondaryCommandBuffers)
+  {
+    commandBuffers.push_back(secondaryCommandBuffer.get());
+  }
+  primaryCommandBuffer->ExecuteCommandBuffers(std::move(commandBuffers));
+  primaryCommandBuffer->End();
+
+  DALI_TEST_CHECK(DependsOn(target.renderTarget, offscreen.renderTarget));
+  DALI_TEST_CHECK(!DependsOn(offscreen.renderTarget, target.renderTarget));
+
+  END_TEST;
+}
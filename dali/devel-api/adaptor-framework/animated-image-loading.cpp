@@ -98,6 +98,16 @@ bool AnimatedImageLoading::HasLoadingSucceeded() const
   return GetImplementation(*this).HasLoadingSucceeded();
 }
 
+void AnimatedImageLoading::SetPrefetchDuration(uint32_t prefetchDuration)
+{
+  GetImplementation(*this).SetPrefetchDuration(prefetchDuration);
+}
+
+uint32_t AnimatedImageLoading::GetMissedFrameCount() const
+{
+  return GetImplementation(*this).GetMissedFrameCount();
+}
+
 AnimatedImageLoading::AnimatedImageLoading(Internal::Adaptor::AnimatedImageLoading* internal)
 : BaseHandle(internal)
 {
@@ -176,6 +176,27 @@ public:
    */
   bool HasLoadingSucceeded() const;
 
+  /**
+   * @brief Set how far ahead the frames following the loaded one are decoded on the worker threads.
+   *
+   * The decoded frames are kept in a ring of at most 8 frames, sized from the frame interval.
+   * It's DALI_ANIMATED_IMAGE_PREFETCH_DURATION by default, or 0.
+   * @note This should be called before any frame is loaded.
+   *
+   * @param[in] prefetchDuration The duration of the frames decoded ahead, in milliseconds. 0 disables the prefetch.
+   */
+  void SetPrefetchDuration(uint32_t prefetchDuration);
+
+  /**
+   * @brief Get the number of prefetched frames which missed their deadline.
+   *
+   * A frame misses its deadline when it is loaded before it's decoded, or when it's decoded later than
+   * the frame intervals allowed since the previous frame was loaded.
+   *
+   * @return The number of frames which missed their deadline. 0 if the prefetch is disabled.
+   */
+  uint32_t GetMissedFrameCount() const;
+
 public: // Not intended for application developers
   /// @cond internal
   /**
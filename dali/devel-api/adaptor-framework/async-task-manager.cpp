@@ -25,7 +25,9 @@ namespace Dali
 AsyncTask::AsyncTask(CallbackBase* callback, PriorityType priority, ThreadType threadType)
 : mCompletedCallback(UniquePtr<CallbackBase>(callback)),
   mPriorityType(priority),
-  mThreadType(threadType)
+  mThreadType(threadType),
+  mDependencyState(0u),
+  mSuccessors()
 {
 }
 
@@ -49,6 +51,16 @@ void AsyncTask::NotifyToReady()
   Internal::Adaptor::AsyncTaskManager::NotifyManagerToTaskReady(AsyncTaskPtr(this));
 }
 
+void AsyncTask::AddDependency(AsyncTaskPtr predecessor)
+{
+  Internal::Adaptor::AsyncTaskManager::AddTaskDependency(AsyncTaskPtr(this), predecessor);
+}
+
+bool AsyncTask::HasPendingDependencies() const
+{
+  return Internal::Adaptor::AsyncTaskManager::HasPendingDependencies(*this);
+}
+
 AsyncTaskManager::AsyncTaskManager() = default;
 
 AsyncTaskManager::~AsyncTaskManager() = default;
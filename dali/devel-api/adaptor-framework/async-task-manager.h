@@ -22,7 +22,9 @@
 #include <dali/public-api/common/unique-ptr.h>
 #include <dali/public-api/object/base-handle.h>
 #include <dali/public-api/signals/callback.h>
+#include <atomic>
 #include <string_view>
+#include <vector>
 
 // INTERNAL INCLUDES
 #include <dali/public-api/dali-adaptor-common.h>
@@ -114,6 +116,28 @@ public:
    */
   void NotifyToReady();
 
+  /**
+   * @brief Make this task wait until the given task has been processed.
+   *
+   * The task is not ready while it has unprocessed predecessors. When the last predecessor has been processed,
+   * this task is processed straight after it on the same worker thread, without going back to the main thread.
+   * So a pipeline like decode, resize, mask and upload runs as a chain of tasks without a frame of latency per stage.
+   * If a predecessor is removed from the AsyncTaskManager, this task is removed too.
+   *
+   * @note Must be called before this task is added to the AsyncTaskManager.
+   * @note A predecessor which has already been processed is ignored.
+   * @SINCE_2_5.37
+   * @param[in] predecessor The task which must be processed first.
+   */
+  void AddDependency(AsyncTaskPtr predecessor);
+
+  /**
+   * @brief Whether this task still waits for some of its predecessors.
+   * @SINCE_2_5.37
+   * @return True if some predecessors have not been processed yet.
+   */
+  bool HasPendingDependencies() const;
+
   /**
    * Destructor.
    * @SINCE_2_2.3
@@ -148,9 +172,13 @@ public:
   }
 
 private:
-  UniquePtr<CallbackBase> mCompletedCallback;
-  const PriorityType      mPriorityType;
-  ThreadType              mThreadType;
+  friend class Internal::Adaptor::AsyncTaskManager;
+
+  UniquePtr<CallbackBase>   mCompletedCallback;
+  const PriorityType        mPriorityType;
+  ThreadType                mThreadType;
+  std::atomic<uint32_t>     mDependencyState; ///< The number of unprocessed predecessors, and flags. Used by AsyncTaskManager.
+  std::vector<AsyncTaskPtr> mSuccessors;      ///< The tasks waiting for this task. Used by AsyncTaskManager.
 
   // Undefined
   AsyncTask(const AsyncTask& task) = delete;
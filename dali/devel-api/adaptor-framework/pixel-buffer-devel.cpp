@@ -77,6 +77,11 @@ bool Rotate(PixelBuffer pixelBuffer, Degree angle)
   return GetImplementation(pixelBuffer).Rotate(angle);
 }
 
+bool ApplyGaussianBlur(PixelBuffer pixelBuffer, float blurRadius, GaussianBlurMode mode)
+{
+  return GetImplementation(pixelBuffer).ApplyGaussianBlur(blurRadius, mode);
+}
+
 uint32_t GetBrightness(PixelBuffer pixelBuffer)
 {
   return GetImplementation(pixelBuffer).GetBrightness();
@@ -29,6 +29,15 @@ namespace Dali
 {
 namespace DevelPixelBuffer
 {
+/**
+ * @brief The trade-off between quality and speed of ApplyGaussianBlur().
+ */
+enum class GaussianBlurMode
+{
+  ACCURATE, ///< Convolve with the Gaussian. The cost per pixel grows with the blur radius.
+  FAST      ///< Approximate the Gaussian with three box blurs. The cost per pixel doesn't depend on the blur radius.
+};
+
 /**
  * @brief Converts a PixelBuffer into a PixelData, which can be uploaded to a texture.
  *
@@ -165,6 +174,22 @@ DALI_ADAPTOR_API bool IsAlphaPreMultiplied(PixelBuffer pixelBuffer);
  */
 DALI_ADAPTOR_API bool Rotate(PixelBuffer pixelBuffer, Degree angle);
 
+/**
+ * @brief Applies a Gaussian blur to the given pixel buffer, choosing between quality and speed.
+ *
+ * Large blur radii, e.g. for wallpapers and backdrops, are much faster in FAST mode. The FAST
+ * result differs slightly from the ACCURATE one, which matches PixelBuffer::ApplyGaussianBlur().
+ *
+ * @note Operation valid for pixel formats: A8, L8, LA88, RGB888, RGB8888, BGR8888,
+ * RGBA8888 and BGRA8888. Fails otherwise.
+ *
+ * @param[in] pixelBuffer The pixel buffer to blur
+ * @param[in] blurRadius The radius for Gaussian blur
+ * @param[in] mode The trade-off between quality and speed
+ * @return @c false if the gaussian blur fails (invalid pixel format or memory issues)
+ */
+DALI_ADAPTOR_API bool ApplyGaussianBlur(PixelBuffer pixelBuffer, float blurRadius, GaussianBlurMode mode);
+
 /**
  * @brief Gets the brightness of the given pixel buffer.
  *
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -51,6 +51,10 @@ const Size FontClient::MAX_SIZE_FIT_IN_ATLAS(MAX_TEXT_ATLAS_WIDTH - PADDING_TEXT
 
 const uint32_t FontClient::NUMBER_OF_POINTS_PER_ONE_UNIT_OF_POINT_SIZE = 64u; //Found this value from toolkit
 
+//Distance field glyphs
+const uint32_t FontClient::DISTANCE_FIELD_PIXELS_PER_EM = 64u;
+const uint32_t FontClient::DISTANCE_FIELD_SPREAD        = 8u;
+
 // For Debug
 static bool     TEXT_PERFORMANCE_LOG_SET                = false;
 static uint32_t TEXT_PERFORMANCE_LOG_THRESHOLD_TIME     = 0u;
@@ -280,6 +284,16 @@ PixelData FontClient::CreateBitmap(FontId fontId, GlyphIndex glyphIndex, int out
   return GetImplementation(*this).CreateBitmap(fontId, glyphIndex, outlineWidth);
 }
 
+void FontClient::CreateBitmaps(const std::vector<BitmapRequest>& requests, std::vector<GlyphBufferData>& data)
+{
+  GetImplementation(*this).CreateBitmaps(requests, data);
+}
+
+bool FontClient::CreateDistanceFieldBitmap(FontId fontId, GlyphIndex glyphIndex, GlyphBufferData& data, GlyphInfo& glyphInfo)
+{
+  return GetImplementation(*this).CreateDistanceFieldBitmap(fontId, glyphIndex, data, glyphInfo);
+}
+
 void FontClient::CreateVectorBlob(FontId fontId, GlyphIndex glyphIndex, VectorBlob*& blob, unsigned int& blobLength, unsigned int& nominalWidth, unsigned int& nominalHeight)
 {
   GetImplementation(*this).CreateVectorBlob(fontId, glyphIndex, blob, blobLength, nominalWidth, nominalHeight);
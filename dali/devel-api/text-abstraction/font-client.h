@@ -2,7 +2,7 @@
 #define DALI_PLATFORM_TEXT_ABSTRACTION_FONT_CLIENT_H
 
 /*
- * Copyright (c) 2025 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -84,6 +84,9 @@ public:
 
   static const uint32_t NUMBER_OF_POINTS_PER_ONE_UNIT_OF_POINT_SIZE; ///< Factor multiply point-size in toolkit.
 
+  static const uint32_t DISTANCE_FIELD_PIXELS_PER_EM; ///< The resolution of the distance field glyphs.
+  static const uint32_t DISTANCE_FIELD_SPREAD;        ///< The distance, in pixels of the distance field, from the outline of a glyph to the edge of its field.
+
   // For Debug
   static uint32_t GetPerformanceLogThresholdTime(); ///< Return performance log threshold time in miliseconds for debug.
   static bool     IsPerformanceLogEnabled();        ///< Whether performance log is enabled.
@@ -99,6 +102,18 @@ public:
     ColorBlendingMode colorblendingMode; ///< Whether the color of the image is multiplied by the color of the text.
   };
 
+  /**
+   * @brief A glyph to rasterize with CreateBitmaps().
+   */
+  struct BitmapRequest
+  {
+    FontId     fontId{0u};              ///< The identifier of the font.
+    GlyphIndex glyphIndex{0u};          ///< The index of a glyph within the font.
+    bool       isItalicRequired{false}; ///< Whether the glyph requires italic style.
+    bool       isBoldRequired{false};   ///< Whether the glyph requires bold style.
+    int        outlineWidth{0};         ///< The width of the glyph outline in pixels.
+  };
+
 public:
   /**
    * @brief Retrieve a handle to the FontClient instance.
@@ -474,6 +489,39 @@ public:
    */
   PixelData CreateBitmap(FontId fontId, GlyphIndex glyphIndex, int outlineWidth);
 
+  /**
+   * @brief Create the bitmap representations of many glyphs, e.g. to pack them in an atlas.
+   *
+   * The glyphs of scalable fonts are rasterized in parallel by worker threads, which use their own
+   * FreeType faces. The other glyphs, e.g. of bitmap fonts, color fonts and embedded items, are
+   * rasterized by the calling thread, as CreateBitmap() does.
+   *
+   * @param[in]  requests The glyphs to rasterize.
+   * @param[out] data     The bitmap of each request, in the same order. The buffers are not compressed, and are owned by the bitmaps.
+   *                      A glyph which could not be rendered has an empty bitmap.
+   */
+  void CreateBitmaps(const std::vector<BitmapRequest>& requests, std::vector<GlyphBufferData>& data);
+
+  /**
+   * @brief Create a signed distance field of a glyph, which can be scaled to render the glyph at any size.
+   *
+   * The field is sampled at DISTANCE_FIELD_PIXELS_PER_EM pixels per em, whatever the point size of the font,
+   * and covers DISTANCE_FIELD_SPREAD pixels around the outline of the glyph. A value of 128 is on the outline,
+   * bigger values are inside the glyph.
+   *
+   * @note This feature requires the vector based text rendering, and is not available on all platforms.
+   * @note The buffer is cached and owned by FontClient. It is valid until the next call of this method, or until the font caches are cleared.
+   *
+   * @param[in] fontId The identifier of the font.
+   * @param[in] glyphIndex The index of a glyph within the specified font.
+   * @param[out] data The distance field, in L8. Empty if the glyph has no outline to draw, e.g. a space.
+   * @param[out] glyphInfo The size and the bearing of the field, and the advance of the glyph, in ems.
+   *                       Multiply them by the size of the font in pixels to place the field.
+   *
+   * @return @e true if the distance field is created.
+   */
+  bool CreateDistanceFieldBitmap(FontId fontId, GlyphIndex glyphIndex, GlyphBufferData& data, GlyphInfo& glyphInfo);
+
   /**
    * @brief Create a vector representation of a glyph.
    *
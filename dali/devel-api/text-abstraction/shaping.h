@@ -2,7 +2,7 @@
 #define DALI_PLATFORM_TEXT_ABSTRACTION_SHAPING_H
 
 /*
- * Copyright (c) 2025 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -94,8 +94,9 @@ public:
    * @brief Create a handle to the new Shaping instance.
    *
    * @return A handle to the Shaping.
-   * @remarks All functions of this are not thread-safe,
-   * so create new handles for each worker thread to utilize them.
+   * @remarks Shape() and GetGlyphs() may be called by several threads at once, on any handle.
+   * GetGlyphs() returns the glyphs of the last Shape() called by the same thread, once.
+   * The FontClient given to Shape() still has to be used by one thread only.
    */
   static Shaping New();
 
@@ -123,6 +124,7 @@ public:
    *
    * @pre @p glyphInfo and @p glyphToCharacterMap must have enough space allocated for the number of glyphs.
    * Call first Shape() to shape the text and get the number of glyphs.
+   * The shaped text is released by this call; calling it again before the next Shape() writes nothing.
    *
    * @param[out] glyphInfo Vector with indices to the glyph within the font, glyph's metrics and advance.
    * @param[out] glyphToCharacterMap The glyph to character conversion map.
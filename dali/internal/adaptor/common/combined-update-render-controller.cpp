@@ -703,6 +703,9 @@ void CombinedUpdateRenderController::UpdateRenderThread()
       ShaderPreCompiler::RawShaderDataList precompiledShaderList;
       ShaderPreCompiler::Get().GetPreCompileShaderList(precompiledShaderList);
 
+      // Only issue the compilations where possible : the programs are completed at the following frames.
+      graphics.BeginProgramPrecompile();
+
       while(!precompiledShaderList.empty())
       {
         if(mIsPreCompileCancelled == TRUE)
@@ -740,6 +743,8 @@ void CombinedUpdateRenderController::UpdateRenderThread()
         // Pop last one.
         precompiledShaderList.pop_back();
       }
+
+      graphics.EndProgramPrecompile();
       TRACE_UPDATE_RENDER_END("DALI_PRECOMPILE_SHADER");
     }
     else
@@ -45,6 +45,115 @@ Dali::BaseHandle Create()
 }
 
 Dali::TypeRegistration type(typeid(Dali::CanvasRenderer), typeid(Dali::BaseHandle), Create);
+
+#ifdef THORVG_SUPPORT
+constexpr int   DIRTY_REGION_MARGIN = 1;   ///< Pixels added around the bounds of a drawable, for its antialiased edges
+constexpr float FULL_RASTERIZE_RATIO(0.8f); ///< Rasterize the whole buffer when the dirty region is larger than this ratio of it
+
+/**
+ * @brief Merges a rectangle into a region. An empty rectangle or region is ignored.
+ */
+void MergeRegion(Rect<int>& region, const Rect<int>& rect)
+{
+  if(rect.IsEmpty())
+  {
+    return;
+  }
+  if(region.IsEmpty())
+  {
+    region = rect;
+  }
+  else
+  {
+    region.Merge(rect);
+  }
+}
+#endif
+
+#ifdef THORVG_VERSION_1
+/**
+ * @brief The bounds of drawables in the root scene, before it is scaled.
+ */
+struct DrawableBounds
+{
+  void Merge(float x, float y)
+  {
+    left   = isEmpty ? x : std::min(left, x);
+    top    = isEmpty ? y : std::min(top, y);
+    right  = isEmpty ? x : std::max(right, x);
+    bottom = isEmpty ? y : std::max(bottom, y);
+
+    isEmpty = false;
+  }
+
+  float left{0.0f};
+  float top{0.0f};
+  float right{0.0f};
+  float bottom{0.0f};
+  bool  isEmpty{true};
+};
+
+tvg::Matrix MultiplyMatrix(const tvg::Matrix& lhs, const tvg::Matrix& rhs)
+{
+  return tvg::Matrix{lhs.e11 * rhs.e11 + lhs.e12 * rhs.e21 + lhs.e13 * rhs.e31,
+                     lhs.e11 * rhs.e12 + lhs.e12 * rhs.e22 + lhs.e13 * rhs.e32,
+                     lhs.e11 * rhs.e13 + lhs.e12 * rhs.e23 + lhs.e13 * rhs.e33,
+                     lhs.e21 * rhs.e11 + lhs.e22 * rhs.e21 + lhs.e23 * rhs.e31,
+                     lhs.e21 * rhs.e12 + lhs.e22 * rhs.e22 + lhs.e23 * rhs.e32,
+                     lhs.e21 * rhs.e13 + lhs.e22 * rhs.e23 + lhs.e23 * rhs.e33,
+                     lhs.e31 * rhs.e11 + lhs.e32 * rhs.e21 + lhs.e33 * rhs.e31,
+                     lhs.e31 * rhs.e12 + lhs.e32 * rhs.e22 + lhs.e33 * rhs.e32,
+                     lhs.e31 * rhs.e13 + lhs.e32 * rhs.e23 + lhs.e33 * rhs.e33};
+}
+
+/**
+ * @brief Adds the bounds of a drawable, transformed by the groups it belongs to.
+ *
+ * The drawables of a group are only pushed to its duplicate at commit, so the bounds of a group are
+ * the bounds of its drawables. A clip path or a mask only hides parts of the drawable, so they are
+ * within its bounds.
+ *
+ * @return false if the bounds can't be retrieved.
+ */
+bool AddDrawableBounds(const Dali::CanvasRenderer::Drawable& drawable, const tvg::Matrix& parentTransform, DrawableBounds& bounds)
+{
+  const Internal::Adaptor::Drawable& drawableImpl = Dali::GetImplementation(drawable);
+  tvg::Paint*                        tvgObject    = static_cast<tvg::Paint*>(drawableImpl.GetObject());
+  if(DALI_UNLIKELY(!tvgObject))
+  {
+    return false;
+  }
+
+  if(drawableImpl.GetType() == Drawable::Types::DRAWABLE_GROUP)
+  {
+    const tvg::Matrix                          transform         = MultiplyMatrix(parentTransform, tvgObject->transform());
+    const Dali::CanvasRenderer::DrawableGroup& group             = static_cast<const Dali::CanvasRenderer::DrawableGroup&>(drawable);
+    const Internal::Adaptor::DrawableGroup&    drawableGroupImpl = Dali::GetImplementation(group);
+    for(auto& it : drawableGroupImpl.GetDrawables())
+    {
+      if(!AddDrawableBounds(it, transform, bounds))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // The drawable itself is not pushed to the canvas, so its bounds only include its own transform.
+  float x, y, width, height;
+  if(tvgObject->bounds(&x, &y, &width, &height) != tvg::Result::Success)
+  {
+    return false;
+  }
+
+  for(const auto& corner : {std::make_pair(x, y), std::make_pair(x + width, y), std::make_pair(x, y + height), std::make_pair(x + width, y + height)})
+  {
+    bounds.Merge(parentTransform.e11 * corner.first + parentTransform.e12 * corner.second + parentTransform.e13,
+                 parentTransform.e21 * corner.first + parentTransform.e22 * corner.second + parentTransform.e23);
+  }
+  return true;
+}
+#endif
 } // unnamed namespace
 
 CanvasRenderer::CanvasRenderer(const Vector2& viewBox)
@@ -121,14 +230,20 @@ bool CanvasRenderer::Commit()
     return false;
   }
 
-  bool changed = false;
+  bool                  changed = false;
+  std::vector<uint32_t> changedDrawables;
 
-  for(auto& it : mDrawables)
+  for(uint32_t index = 0u; index < mDrawables.size(); ++index)
   {
+    auto& it = mDrawables[index];
     if(HaveDrawablesChanged(it))
     {
       UpdateDrawablesChanged(it, false);
       changed = true;
+      if(mPartialRasterize)
+      {
+        changedDrawables.push_back(index);
+      }
     }
   }
 
@@ -147,8 +262,23 @@ bool CanvasRenderer::Commit()
     effectMargin = GetEffectMargin();
   }
 #endif
-  MakeTargetBuffer(Vector2(mSize.width + static_cast<float>(effectMargin) * 2.0f,
-                           mSize.height + static_cast<float>(effectMargin) * 2.0f));
+  const Vector2 bufferSize(mSize.width + static_cast<float>(effectMargin) * 2.0f,
+                           mSize.height + static_cast<float>(effectMargin) * 2.0f);
+  MakeTargetBuffer(bufferSize);
+
+  float rootScale = 1.0f;
+  if(mViewBox != mSize && mViewBox.width > 0 && mViewBox.height > 0)
+  {
+    auto scaleX = mSize.width / mViewBox.width;
+    auto scaleY = mSize.height / mViewBox.height;
+    rootScale   = scaleX < scaleY ? scaleX : scaleY;
+  }
+
+  if(mPartialRasterize)
+  {
+    // A size, view box or effect change, or an added or removed drawable, rasterizes the whole buffer again.
+    UpdateDirtyRegion(changedDrawables, bufferSize, rootScale, mChanged || mEffect.type != EffectType::None);
+  }
   mChanged = false;
 
 #ifdef THORVG_VERSION_1
@@ -174,9 +304,7 @@ bool CanvasRenderer::Commit()
 
   if(mViewBox != mSize && mViewBox.width > 0 && mViewBox.height > 0)
   {
-    auto scaleX = mSize.width / mViewBox.width;
-    auto scaleY = mSize.height / mViewBox.height;
-    mTvgRoot->scale(scaleX < scaleY ? scaleX : scaleY);
+    mTvgRoot->scale(rootScale);
   }
 
 #ifdef THORVG_VERSION_1
@@ -518,14 +646,11 @@ bool CanvasRenderer::HaveDrawablesChanged(const Dali::CanvasRenderer::Drawable&
   {
     return true;
   }
+  // A clip path or a mask may be a group, whose drawables change.
   Dali::CanvasRenderer::Drawable compositeDrawable = drawableImpl.GetCompositionDrawable();
-  if(DALI_UNLIKELY(compositeDrawable))
+  if(DALI_UNLIKELY(compositeDrawable) && HaveDrawablesChanged(compositeDrawable))
   {
-    Internal::Adaptor::Drawable& compositeDrawableImpl = Dali::GetImplementation(compositeDrawable);
-    if(compositeDrawableImpl.GetChanged())
-    {
-      return true;
-    }
+    return true;
   }
 
   if(drawableImpl.GetType() == Drawable::Types::DRAWABLE_GROUP)
@@ -576,8 +701,7 @@ void CanvasRenderer::UpdateDrawablesChanged(Dali::CanvasRenderer::Drawable& draw
   Dali::CanvasRenderer::Drawable compositeDrawable = drawableImpl.GetCompositionDrawable();
   if(DALI_UNLIKELY(compositeDrawable))
   {
-    Internal::Adaptor::Drawable& compositeDrawableImpl = Dali::GetImplementation(compositeDrawable);
-    compositeDrawableImpl.SetChanged(changed);
+    UpdateDrawablesChanged(compositeDrawable, changed);
   }
 
   if(drawableImpl.GetType() == Drawable::Types::DRAWABLE_GROUP)
@@ -764,6 +888,86 @@ void CanvasRenderer::PushDrawableToGroup(Dali::CanvasRenderer::Drawable& drawabl
     return;
   }
 }
+
+bool CanvasRenderer::GetDrawableBounds(const Dali::CanvasRenderer::Drawable& drawable, float scale, Rect<int>& bounds) const
+{
+#ifdef THORVG_VERSION_1
+  const tvg::Matrix identity{1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+  DrawableBounds    drawableBounds;
+  if(!AddDrawableBounds(drawable, identity, drawableBounds))
+  {
+    return false;
+  }
+
+  if(drawableBounds.isEmpty)
+  {
+    // An empty group draws nothing.
+    bounds = Rect<int>();
+    return true;
+  }
+
+  const int left   = static_cast<int>(std::floor(drawableBounds.left * scale)) - DIRTY_REGION_MARGIN;
+  const int top    = static_cast<int>(std::floor(drawableBounds.top * scale)) - DIRTY_REGION_MARGIN;
+  const int right  = static_cast<int>(std::ceil(drawableBounds.right * scale)) + DIRTY_REGION_MARGIN;
+  const int bottom = static_cast<int>(std::ceil(drawableBounds.bottom * scale)) + DIRTY_REGION_MARGIN;
+
+  bounds = Rect<int>(left, top, right - left, bottom - top);
+  return true;
+#else
+  // The bounds are not retrieved in the canvas coordinates.
+  return false;
+#endif
+}
+
+void CanvasRenderer::UpdateDirtyRegion(const std::vector<uint32_t>& changedDrawables, const Vector2& bufferSize, float scale, bool fullRasterize)
+{
+  const Rect<int> bufferRect(0, 0, static_cast<int>(bufferSize.width), static_cast<int>(bufferSize.height));
+
+  if(!fullRasterize && mDrawableBounds.size() == mDrawables.size())
+  {
+    // Not rasterized yet, if committed more than once.
+    Rect<int> dirtyRegion = mDirtyRegion;
+    for(auto index : changedDrawables)
+    {
+      Rect<int> bounds;
+      if(!GetDrawableBounds(mDrawables[index], scale, bounds))
+      {
+        fullRasterize = true;
+        break;
+      }
+
+      // Where the drawable was, and where it is now.
+      MergeRegion(dirtyRegion, mDrawableBounds[index]);
+      MergeRegion(dirtyRegion, bounds);
+      mDrawableBounds[index] = bounds;
+    }
+
+    if(!fullRasterize)
+    {
+      if(!dirtyRegion.IsEmpty() && !dirtyRegion.Intersect(bufferRect))
+      {
+        // Changed outside of the buffer.
+        dirtyRegion = Rect<int>();
+      }
+
+      if(dirtyRegion.Area() <= bufferRect.Area() * FULL_RASTERIZE_RATIO)
+      {
+        mDirtyRegion = dirtyRegion;
+        return;
+      }
+    }
+  }
+
+  mDrawableBounds.resize(mDrawables.size());
+  for(uint32_t index = 0u; index < mDrawables.size(); ++index)
+  {
+    if(!GetDrawableBounds(mDrawables[index], scale, mDrawableBounds[index]))
+    {
+      mDrawableBounds[index] = bufferRect;
+    }
+  }
+  mDirtyRegion = bufferRect;
+}
 #endif
 
 } // namespace Adaptor
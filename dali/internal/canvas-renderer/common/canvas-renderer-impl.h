@@ -24,10 +24,12 @@
 #endif
 #include <dali/devel-api/threading/mutex.h>
 #include <dali/public-api/common/intrusive-ptr.h>
+#include <dali/public-api/math/rect.h>
 #include <dali/public-api/math/vector4.h>
 #include <dali/public-api/object/base-object.h>
 #include <dali/public-api/object/weak-handle.h>
 #include <dali/public-api/rendering/texture.h>
+#include <vector>
 
 // INTERNAL INCLUDES
 #include <dali/public-api/adaptor-framework/canvas-renderer/canvas-renderer-drawable.h>
@@ -187,6 +189,26 @@ private:
    * @param[in] group The scene object of tvg that can be drawable group.
    */
   void PushDrawableToGroup(Dali::CanvasRenderer::Drawable& drawable, tvg::Scene* group);
+
+  /**
+   * @brief Get the bounds of a drawable in the target buffer, including its antialiased edges.
+   * The bounds of a group are the bounds of its drawables, which include their clip paths and masks.
+   * @param[in] drawable The drawable object.
+   * @param[in] scale The scale of the root scene.
+   * @param[out] bounds The bounds of the drawable.
+   * @return Returns false if the bounds can't be retrieved.
+   */
+  bool GetDrawableBounds(const Dali::CanvasRenderer::Drawable& drawable, float scale, Rect<int>& bounds) const;
+
+  /**
+   * @brief Add the region covered by the changed drawables, before and after the change, to mDirtyRegion.
+   * The bounds of the drawables are kept for the next commit.
+   * @param[in] changedDrawables The indices of the changed drawables in mDrawables.
+   * @param[in] bufferSize The size of the target buffer.
+   * @param[in] scale The scale of the root scene.
+   * @param[in] fullRasterize Whether the whole target buffer must be rasterized again.
+   */
+  void UpdateDirtyRegion(const std::vector<uint32_t>& changedDrawables, const Vector2& bufferSize, float scale, bool fullRasterize);
 #endif
 
 protected:
@@ -269,6 +291,10 @@ protected:
 
   EffectParams mEffect{};
   bool         mEffectAutoPadding{true};
+
+  Rect<int>              mDirtyRegion;             ///< The region of the target buffer to rasterize again. Only used if mPartialRasterize.
+  std::vector<Rect<int>> mDrawableBounds;          ///< The bounds of mDrawables in the target buffer, at the last commit.
+  bool                   mPartialRasterize{false}; ///< Whether only the region of the changed drawables is rasterized again. Set by the platform.
 #endif
 };
 
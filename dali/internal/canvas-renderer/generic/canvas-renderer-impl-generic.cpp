@@ -19,10 +19,15 @@
 #include <dali/internal/canvas-renderer/generic/canvas-renderer-impl-generic.h>
 
 // EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
 #include <dali/integration-api/debug.h>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
 
 // INTERNAL INCLUDES
 #include <dali/internal/imaging/common/pixel-buffer-impl.h>
+#include <dali/internal/system/common/environment-variables.h>
 
 namespace Dali
 {
@@ -32,6 +37,9 @@ namespace Adaptor
 {
 namespace // unnamed namespace
 {
+#ifdef THORVG_SUPPORT
+constexpr uint32_t BYTES_PER_PIXEL = 4u; ///< BGRA8888
+#endif
 } // unnamed namespace
 
 CanvasRendererPtr CanvasRendererGeneric::New(const Vector2& viewBox)
@@ -45,14 +53,34 @@ CanvasRendererGeneric::CanvasRendererGeneric(const Vector2& viewBox)
 : CanvasRenderer(viewBox)
 #ifdef THORVG_SUPPORT
   ,
-  mPixelBuffer(nullptr)
+  mPixelBuffer(nullptr),
+  mUploadRegion()
 #endif
 {
+#ifdef THORVG_VERSION_1
+  // The viewport of the canvas restricts the rasterization to the dirty region.
+  const char* partialRasterizeString = EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_CANVAS_RENDERER_PARTIAL_RASTERIZE);
+  mPartialRasterize                  = partialRasterizeString && std::strtoul(partialRasterizeString, nullptr, 10) != 0u;
+#endif
+}
+
+Dali::PixelBuffer CanvasRendererGeneric::GetTargetBuffer() const
+{
+#ifdef THORVG_SUPPORT
+  return mPixelBuffer;
+#else
+  return Dali::PixelBuffer();
+#endif
 }
 
 Dali::Texture CanvasRendererGeneric::OnGetRasterizedTexture()
 {
 #ifdef THORVG_SUPPORT
+  if(mPartialRasterize)
+  {
+    return UploadRasterizedRegion();
+  }
+
   if(mPixelBuffer)
   {
     auto width  = mPixelBuffer.GetWidth();
@@ -83,7 +111,56 @@ bool CanvasRendererGeneric::OnRasterize()
   Mutex::ScopedLock lock(mMutex);
 
 #ifdef THORVG_VERSION_1
-  if(mTvgCanvas->draw(true) != tvg::Result::Success)
+  bool clear = true;
+  if(mPartialRasterize && mPixelBuffer)
+  {
+    Rect<int> region = std::exchange(mDirtyRegion, Rect<int>());
+    if(region.IsEmpty())
+    {
+      // Nothing visible changed.
+      return true;
+    }
+
+    const int width  = static_cast<int>(mPixelBuffer.GetWidth());
+    const int height = static_cast<int>(mPixelBuffer.GetHeight());
+    if(region.width < width || region.height < height)
+    {
+      if(mTvgCanvas->viewport(region.x, region.y, region.width, region.height) == tvg::Result::Success)
+      {
+        // The rest of the buffer keeps the previous rasterization.
+        uint8_t* buffer = mPixelBuffer.GetBuffer();
+        for(int row = region.y; row < region.y + region.height; ++row)
+        {
+          memset(buffer + (row * width + region.x) * BYTES_PER_PIXEL, 0, region.width * BYTES_PER_PIXEL);
+        }
+        clear = false;
+      }
+      else
+      {
+        DALI_LOG_ERROR("ThorVG viewport fail [%p] (%d, %d, %d x %d). Rasterize the whole buffer\n", this, region.x, region.y, region.width, region.height);
+        region = Rect<int>(0, 0, width, height);
+      }
+    }
+
+    if(clear && mTvgCanvas->viewport(0, 0, width, height) != tvg::Result::Success)
+    {
+      // The previous viewport would be kept : rasterize the whole buffer next time.
+      DALI_LOG_ERROR("ThorVG viewport fail [%p] (0, 0, %d x %d)\n", this, width, height);
+      mDirtyRegion = Rect<int>(0, 0, width, height);
+      return false;
+    }
+
+    if(mUploadRegion.IsEmpty())
+    {
+      mUploadRegion = region;
+    }
+    else
+    {
+      mUploadRegion.Merge(region);
+    }
+  }
+
+  if(mTvgCanvas->draw(clear) != tvg::Result::Success)
 #else
   if(mTvgCanvas->draw() != tvg::Result::Success)
 #endif
@@ -103,7 +180,14 @@ bool CanvasRendererGeneric::OnRasterize()
 void CanvasRendererGeneric::OnMakeTargetBuffer(const Vector2& size)
 {
 #ifdef THORVG_SUPPORT
-  mPixelBuffer = Dali::PixelBuffer::New(static_cast<uint32_t>(size.width), static_cast<uint32_t>(size.height), Dali::Pixel::BGRA8888);
+  const uint32_t width  = static_cast<uint32_t>(size.width);
+  const uint32_t height = static_cast<uint32_t>(size.height);
+  // With the partial rasterization, the buffer of the same size keeps the previous rasterization.
+  if(!mPartialRasterize || !mPixelBuffer || mPixelBuffer.GetWidth() != width || mPixelBuffer.GetHeight() != height)
+  {
+    mPixelBuffer = Dali::PixelBuffer::New(width, height, Dali::Pixel::BGRA8888);
+    mDirtyRegion = Rect<int>(0, 0, static_cast<int>(width), static_cast<int>(height));
+  }
 
   unsigned char* pBuffer;
   pBuffer = mPixelBuffer.GetBuffer();
@@ -122,6 +206,59 @@ void CanvasRendererGeneric::OnMakeTargetBuffer(const Vector2& size)
 #endif
 }
 
+#ifdef THORVG_SUPPORT
+Dali::Texture CanvasRendererGeneric::UploadRasterizedRegion()
+{
+  Mutex::ScopedLock lock(mMutex);
+
+  if(!mPixelBuffer)
+  {
+    return mRasterizedTexture;
+  }
+
+  const uint32_t width  = mPixelBuffer.GetWidth();
+  const uint32_t height = mPixelBuffer.GetHeight();
+  if(width == 0u || height == 0u)
+  {
+    return Dali::Texture();
+  }
+
+  if(!mRasterizedTexture || mRasterizedTexture.GetWidth() != width || mRasterizedTexture.GetHeight() != height)
+  {
+    mRasterizedTexture = Dali::Texture::New(Dali::TextureType::TEXTURE_2D, Dali::Pixel::BGRA8888, width, height);
+    mUploadRegion      = Rect<int>(0, 0, static_cast<int>(width), static_cast<int>(height));
+  }
+
+  if(mUploadRegion.IsEmpty())
+  {
+    return mRasterizedTexture;
+  }
+
+  // Copy the rows of the region only : the buffer is kept for the next rasterization.
+  // DALi's PixelData::FREE requires memory allocated with malloc
+  const uint32_t regionStride = static_cast<uint32_t>(mUploadRegion.width) * BYTES_PER_PIXEL;
+  const uint32_t regionSize   = regionStride * static_cast<uint32_t>(mUploadRegion.height);
+  uint8_t*       regionBuffer = static_cast<uint8_t*>(malloc(regionSize));
+  if(!regionBuffer)
+  {
+    DALI_LOG_ERROR("Region buffer create to fail [%p]\n", this);
+    return mRasterizedTexture;
+  }
+
+  const uint8_t* source = mPixelBuffer.GetBuffer() + (static_cast<uint32_t>(mUploadRegion.y) * width + static_cast<uint32_t>(mUploadRegion.x)) * BYTES_PER_PIXEL;
+  for(uint32_t row = 0u; row < static_cast<uint32_t>(mUploadRegion.height); ++row)
+  {
+    memcpy(regionBuffer + row * regionStride, source + row * width * BYTES_PER_PIXEL, regionStride);
+  }
+
+  Dali::PixelData pixelData = Dali::PixelData::New(regionBuffer, regionSize, mUploadRegion.width, mUploadRegion.height, Dali::Pixel::BGRA8888, Dali::PixelData::FREE);
+  mRasterizedTexture.Upload(pixelData, 0u, 0u, mUploadRegion.x, mUploadRegion.y, mUploadRegion.width, mUploadRegion.height);
+
+  mUploadRegion = Rect<int>();
+  return mRasterizedTexture;
+}
+#endif
+
 } // namespace Adaptor
 
 } // namespace Internal
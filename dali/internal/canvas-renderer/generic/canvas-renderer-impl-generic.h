@@ -43,6 +43,12 @@ public:
    */
   static CanvasRendererPtr New(const Vector2& viewBox);
 
+  /**
+   * @brief Gets the buffer the drawables are rasterized into.
+   * @return The target buffer, or an empty handle if it isn't made yet.
+   */
+  Dali::PixelBuffer GetTargetBuffer() const;
+
 protected:
   /**
    * @copydoc Dali::CanvasRenderer::GetRasterizedTexture()
@@ -71,9 +77,19 @@ private:
    */
   virtual ~CanvasRendererGeneric() = default;
 
+#ifdef THORVG_SUPPORT
+  /**
+   * @brief Uploads the region of the buffer rasterized since the last upload to the texture.
+   * Only used if the partial rasterization is enabled.
+   * @return The rasterized texture.
+   */
+  Dali::Texture UploadRasterizedRegion();
+#endif
+
 private:
 #ifdef THORVG_SUPPORT
   Dali::PixelBuffer mPixelBuffer;
+  Rect<int>         mUploadRegion; ///< The region of mPixelBuffer rasterized since the last upload. Only used if mPartialRasterize.
 #endif
 };
 
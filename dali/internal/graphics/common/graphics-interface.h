@@ -416,6 +416,17 @@ public:
    */
   virtual void LogMemoryPools() = 0;
 
+  /**
+   * Start precompiling programs : the programs created from now on are compiled without waiting
+   * for the compilation. They are completed at the following frames, or when they are used.
+   */
+  virtual void BeginProgramPrecompile() = 0;
+
+  /**
+   * End precompiling programs : the programs created from now on are compiled at once.
+   */
+  virtual void EndProgramPrecompile() = 0;
+
 protected:
   GraphicsCreateInfo                  mCreateInfo;            ///< the surface creation info
   Integration::DepthBufferAvailable   mDepthBufferRequired;   ///< Whether the depth buffer is required
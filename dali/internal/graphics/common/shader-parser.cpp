@@ -530,7 +530,7 @@ bool ProcessTokenUNIFORM_BLOCK(IT& it, Program& program, OutputLanguage lang, Sh
       else if(lang >= OutputLanguage::GLSL_3 && lang <= OutputLanguage::GLSL_3_MAX)
       {
 #if IGNORE_UNIFORM_BLOCKS_FOR_NORMAL_CASES
-        if(gExceptUniformBlockNames.find(uniformBlockName) != gExceptUniformBlockNames.end())
+        if(program.forceUniformBlocks || gExceptUniformBlockNames.find(uniformBlockName) != gExceptUniformBlockNames.end())
 #endif
         {
           ss << "layout(std140) uniform" << l.line.substr(l.tokens[0].first + l.tokens[0].second).c_str() << "\n";
@@ -750,6 +750,7 @@ void Parse(const ShaderParserInfo& parseInfo, std::vector<std::string>& output)
 
   // Create program
   Program program;
+  program.forceUniformBlocks = parseInfo.forceUniformBlocks;
 
   if(parseInfo.vertexShaderLegacyVersion == 0u)
   {
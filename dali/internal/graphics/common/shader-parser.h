@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_GRAPHICS_SHADER_PARSER_H
 
 /*
- * Copyright (c) 2025 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -76,6 +76,7 @@ struct Program
   int                             uboBinding{0};
   int&                            samplerBinding{uboBinding}; // sampler bindings and ubo bindings are the same
   int                             attributeLocation{0};
+  bool                            forceUniformBlocks{false}; // copied from ShaderParserInfo
 
   std::vector<std::pair<std::string, uint32_t>> uniformBlocks;
 };
@@ -93,6 +94,8 @@ struct ShaderParserInfo
 
   std::string_view vertexShaderPrefix;   // this code will be added right after #version
   std::string_view fragmentShaderPrefix; // this code will be added right after #version
+
+  bool forceUniformBlocks{false}; // GLSL3: keep every UNIFORM_BLOCK as a real uniform block, even where the platform flattens them by default
 };
 
 /**
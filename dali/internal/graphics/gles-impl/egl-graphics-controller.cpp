@@ -23,6 +23,7 @@
 #include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/common/dali-utility.h>
 #include <algorithm>
+#include <numeric>
 
 // INTERNAL INCLUDES
 #include <dali/integration-api/adaptor-framework/render-surface-interface.h>
@@ -52,6 +53,9 @@
 #include <dali/internal/graphics/gles-impl/egl-graphics-controller-debug.h>
 DUMP_FRAME_INIT();
 
+extern std::string GetSystemProgramBinaryPath();
+extern std::string GetCustomProgramBinaryPath();
+
 namespace Dali::Graphics
 {
 namespace
@@ -180,7 +184,19 @@ constexpr Dali::Graphics::GraphicsFeatureFlags DEFAULT_GRAPHICS_FEATURE_FLAGS =
 
 DALI_INIT_TRACE_FILTER(gTraceFilter, DALI_TRACE_EGL, false);
 
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gGraphicsControllerLogFilter = Debug::Filter::New(Debug::NoLogging, false, "LOG_GRAPHICS_CONTROLLER");
+#endif
+
 bool gIsShuttingDown = true; ///< Global static flag to ensure that we have single graphics controller instance per each UpdateRender thread loop.
+
+// From render-texture.cpp
+bool IsSubImageUpload(const Graphics::TextureUpdateInfo& info, const Graphics::TextureCreateInfo& createInfo)
+{
+  return info.dstOffset2D.x != 0 || info.dstOffset2D.y != 0 ||
+         info.srcExtent2D.width != (createInfo.size.width / (1 << info.level)) ||
+         info.srcExtent2D.height != (createInfo.size.height / (1 << info.level));
+}
 } // namespace
 
 bool EglGraphicsController::IsShuttingDown()
@@ -193,6 +209,12 @@ EglGraphicsController::EglGraphicsController()
   mSyncPool(*this),
   mResourceInitializeFailed(false),
   mUseProgramBinary(false),
+  mUseProgramBinaryArchive(true),
+  mProgramBinaryArchiveReported(false),
+  mUseParallelPrecompile(true),
+  mIsPrecompilingPrograms(false),
+  mForceUniformBlocks(false),
+  mRemoveRedundantCommands(true),
   mDidPresent(false)
 {
 }
@@ -220,6 +242,18 @@ void EglGraphicsController::InitializeGLES(Integration::GlAbstraction& glAbstrac
 
   static auto enableShaderUseProgramBinaryString = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_SHADER_USE_PROGRAM_BINARY);
   mUseProgramBinary                              = enableShaderUseProgramBinaryString ? std::atoi(enableShaderUseProgramBinaryString) : true; // change default
+
+  static auto enableShaderUseProgramBinaryArchiveString = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_SHADER_USE_PROGRAM_BINARY_ARCHIVE);
+  mUseProgramBinaryArchive                              = enableShaderUseProgramBinaryArchiveString ? std::atoi(enableShaderUseProgramBinaryArchiveString) : true;
+
+  static auto enableShaderParallelPrecompileString = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_SHADER_PARALLEL_PRECOMPILE);
+  mUseParallelPrecompile                           = enableShaderParallelPrecompileString ? std::atoi(enableShaderParallelPrecompileString) : true;
+
+  static auto enableShaderUseUniformBlocksString = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_SHADER_USE_UNIFORM_BLOCKS);
+  mForceUniformBlocks                            = enableShaderUseUniformBlocksString ? std::atoi(enableShaderUseUniformBlocksString) : false;
+
+  static auto disableCommandBufferOptimizationString = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_DISABLE_COMMAND_BUFFER_OPTIMIZATION);
+  mRemoveRedundantCommands                           = disableCommandBufferOptimizationString ? !std::atoi(disableCommandBufferOptimizationString) : true;
 }
 
 void EglGraphicsController::Initialize(Integration::GraphicsSyncAbstraction& syncImplementation,
@@ -238,6 +272,44 @@ void EglGraphicsController::Initialize(Integration::GraphicsSyncAbstraction& syn
 void EglGraphicsController::FrameStart()
 {
   mCapacity = 0; // Reset the command buffer capacity at the start of the frame.
+
+#if defined(DEBUG_ENABLED)
+  // Log the GL calls of the last frame.
+  const uint32_t drawCount  = mGlCallCounts[static_cast<uint32_t>(GlCallType::DRAW)];
+  const uint32_t totalCount = std::accumulate(mGlCallCounts.begin(), mGlCallCounts.end(), 0u);
+  if(totalCount > 0u)
+  {
+    DALI_LOG_INFO(gGraphicsControllerLogFilter, Debug::Verbose, "GL calls per frame : %u (draw : %u, program : %u, uniform : %u, uniform buffer : %u), per draw : %.2f, removed commands : %u\n", totalCount, drawCount, mGlCallCounts[static_cast<uint32_t>(GlCallType::USE_PROGRAM)], mGlCallCounts[static_cast<uint32_t>(GlCallType::UNIFORM)], mGlCallCounts[static_cast<uint32_t>(GlCallType::UNIFORM_BUFFER)], drawCount ? static_cast<float>(totalCount - drawCount) / static_cast<float>(drawCount) : 0.0f, mRemovedCommandCount);
+    DALI_LOG_INFO(gGraphicsControllerLogFilter, Debug::Verbose, "Command buffer high water marks : %u commands, %u bytes, storage allocations : %u\n", mCommandHighWaterMark, mCommandMemoryHighWaterMark, mCommandStorageGrowCount);
+  }
+  mGlCallCounts.fill(0u);
+#endif
+  mRemovedCommandCount     = 0u;
+
+  if(DALI_UNLIKELY(mProgramPrecompileEngine))
+  {
+    // Complete the precompiled programs linked since the last frame.
+    mProgramPrecompileEngine->ProcessLinkedPrograms();
+    if(!mIsPrecompilingPrograms && mProgramPrecompileEngine->IsEmpty())
+    {
+      mProgramPrecompileEngine.reset();
+    }
+  }
+
+  // The programs of the first frame are created by now : log how the archives did at startup.
+  if(DALI_UNLIKELY(!mProgramBinaryArchiveReported))
+  {
+    for(auto&& archive : mProgramBinaryArchives)
+    {
+      if(archive && archive->GetStatistics().hitCount + archive->GetStatistics().missCount > 0u)
+      {
+        const auto& statistics = archive->GetStatistics();
+        DALI_LOG_RELEASE_INFO("Program binary archive %s : hit %u, miss %u, load time %lld us, open time %lld us\n", archive->GetPath().c_str(), statistics.hitCount, statistics.missCount, static_cast<long long>(statistics.loadTime.count()), static_cast<long long>(statistics.openTime.count()));
+        mProgramBinaryArchiveReported = true;
+      }
+    }
+  }
+  mCommandStorageGrowCount = 0u;
 }
 
 void EglGraphicsController::SetResourceBindingHints(const std::vector<SceneResourceBinding>& resourceBindings)
@@ -252,6 +324,18 @@ void EglGraphicsController::SubmitCommandBuffers(const SubmitInfo& submitInfo)
     // Push command buffers
     auto* commandBuffer = static_cast<GLES::CommandBuffer*>(cmdbuf);
     mCapacity += commandBuffer->GetCapacity();
+    mCommandStorageGrowCount += commandBuffer->TakeStorageGrowCount();
+
+    uint32_t commandCount = 0u;
+    uint32_t memorySize   = 0u;
+    commandBuffer->GetHighWaterMarks(commandCount, memorySize);
+    mCommandHighWaterMark       = std::max(mCommandHighWaterMark, commandCount);
+    mCommandMemoryHighWaterMark = std::max(mCommandMemoryHighWaterMark, memorySize);
+
+    if(mRemoveRedundantCommands)
+    {
+      mRemovedCommandCount += commandBuffer->RemoveRedundantCommands();
+    }
     uint32_t              numCmds = 0;
     [[maybe_unused]] auto cmdPtr  = commandBuffer->GetCommands(numCmds);
     mCommandQueue.push(commandBuffer);
@@ -274,6 +358,9 @@ void EglGraphicsController::Shutdown()
   DALI_ASSERT_ALWAYS(!gIsShuttingDown && "Don't call EglGraphicsController::Shutdown twice");
   gIsShuttingDown = true;
 
+  // Stop compiling the precompiled programs, before any program is destroyed.
+  mProgramPrecompileEngine.reset();
+
   // Final flush
   Flush();
 
@@ -679,6 +766,8 @@ void EglGraphicsController::ProcessCommandBuffer(const GLES::CommandBuffer& comm
   DALI_TRACE_BEGIN_WITH_MESSAGE_GENERATOR(gTraceFilter, "DALI_EGL_CONTROLLER_PROCESS", [&](std::ostringstream& oss)
   { oss << "[commandCount:" << count << "]"; });
 
+  GLES::SyncObject* renderPassSyncObject{nullptr}; // The sync object of the last render pass, if the client waits for it
+
   for(auto i = 0u; i < count; ++i)
   {
     auto& cmd = commands[i];
@@ -826,6 +915,7 @@ void EglGraphicsController::ProcessCommandBuffer(const GLES::CommandBuffer& comm
         }
 
         mCurrentContext->BeginRenderPass(descriptor, mTextureDependencyChecker);
+        renderPassSyncObject = nullptr;
 
         break;
       }
@@ -840,11 +930,13 @@ void EglGraphicsController::ProcessCommandBuffer(const GLES::CommandBuffer& comm
         {
           syncObject->InitializeResource();
         }
+        renderPassSyncObject = syncObject;
         break;
       }
       case GLES::CommandType::READ_PIXELS:
       {
-        mCurrentContext->ReadPixels(cmd.readPixelsBuffer.buffer);
+        // The client only reads the pixels once the sync object is signalled, so they can be read asynchronously.
+        mCurrentContext->ReadPixels(cmd.readPixelsBuffer.buffer, renderPassSyncObject);
         break;
       }
       case GLES::CommandType::PRESENT_RENDER_TARGET:
@@ -949,12 +1041,16 @@ void EglGraphicsController::ProcessTextureUpdateQueue()
     return;
   }
   DALI_TRACE_SCOPE(gTraceFilter, "DALI_EGL_CONTROLLER_TEXTURE_UPDATE");
+
+  // Staged uploads read from the current buffer of the ring, which must be unmapped first.
+  const uint32_t stagingBuffer = mTextureUploadRing ? mTextureUploadRing->Unmap() : 0u;
+
   while(!mTextureUpdateRequests.empty())
   {
     TextureUpdateRequest& request = mTextureUpdateRequests.front();
 
-    auto& info   = request.first;
-    auto& source = request.second;
+    auto& info   = request.info;
+    auto& source = request.source;
 
     switch(source.sourceType)
     {
@@ -971,17 +1067,14 @@ void EglGraphicsController::ProcessTextureUpdateQueue()
         auto        destInternalFormat = GLES::GLTextureFormatType(createInfo.format).internalFormat;
         auto        destFormat         = GLES::GLTextureFormatType(createInfo.format).format;
 
-        // From render-texture.cpp
-        const bool isSubImage(info.dstOffset2D.x != 0 || info.dstOffset2D.y != 0 ||
-                              info.srcExtent2D.width != (createInfo.size.width / (1 << info.level)) ||
-                              info.srcExtent2D.height != (createInfo.size.height / (1 << info.level)));
+        const bool isSubImage = IsSubImageUpload(info, createInfo);
 
         uint8_t* sourceBuffer                = nullptr;
         bool     sourceBufferReleaseRequired = false;
         if(source.sourceType == Graphics::TextureUpdateSourceInfo::Type::MEMORY)
         {
           sourceBuffer                = reinterpret_cast<uint8_t*>(source.memorySource.memory);
-          sourceBufferReleaseRequired = true;
+          sourceBufferReleaseRequired = !request.staged;
         }
         else
         {
@@ -999,7 +1092,8 @@ void EglGraphicsController::ProcessTextureUpdateQueue()
 
           uint8_t* srcBuffer = sourceBuffer;
 
-          if(mGlAbstraction->TextureRequiresConverting(srcFormat, destFormat, isSubImage))
+          // Staged uploads never need converting, see AllocateTextureUploadStaging().
+          if(!request.staged && mGlAbstraction->TextureRequiresConverting(srcFormat, destFormat, isSubImage))
           {
             // Convert RGB to RGBA if necessary.
             if(texture->TryConvertPixelData(sourceBuffer, info.srcFormat, createInfo.format, info.srcSize, info.srcStride, info.srcExtent2D.width, info.srcExtent2D.height, tempBuffer))
@@ -1028,6 +1122,12 @@ void EglGraphicsController::ProcessTextureUpdateQueue()
 
           mCurrentContext->BindTexture(bindTarget, texture->GetGLTexture());
 
+          if(request.staged)
+          {
+            // srcBuffer is an offset in the pixel unpack buffer.
+            mGlAbstraction->BindBuffer(GL_PIXEL_UNPACK_BUFFER, stagingBuffer);
+          }
+
           if(!isSubImage)
           {
             if(!texture->IsCompressed())
@@ -1081,6 +1181,11 @@ void EglGraphicsController::ProcessTextureUpdateQueue()
                                                       srcBuffer);
             }
           }
+          if(request.staged)
+          {
+            mGlAbstraction->BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+          }
+
           // Reset texture bind after using.
           mCurrentContext->BindTexture(bindTarget, 0);
         }
@@ -1098,6 +1203,48 @@ void EglGraphicsController::ProcessTextureUpdateQueue()
         }
         break;
       }
+      case Graphics::TextureUpdateSourceInfo::Type::TEXTURE:
+      {
+        auto* texture    = static_cast<GLES::Texture*>(info.dstTexture);
+        auto* srcTexture = static_cast<GLES::Texture*>(source.textureSource.texture);
+
+        // Skip texture copy if either texture is already discarded for this render loop.
+        if(srcTexture &&
+           mDiscardTextureSet.find(texture) == mDiscardTextureSet.end() &&
+           mDiscardTextureSet.find(srcTexture) == mDiscardTextureSet.end())
+        {
+          if(DALI_UNLIKELY(texture->IsCompressed() || srcTexture->IsNativeTexture()))
+          {
+            DALI_LOG_ERROR("Texture copy is not supported from a native texture, or to a compressed texture\n");
+            break;
+          }
+          if(DALI_UNLIKELY(srcTexture == texture))
+          {
+            // Reading from the framebuffer attachment being written is undefined.
+            DALI_LOG_ERROR("Texture copy is not supported within the same texture\n");
+            break;
+          }
+
+          const auto& createInfo = texture->GetCreateInfo();
+
+          // srcOffset is the index of the first texel of the region in the source texture.
+          const uint32_t srcWidth = Max(srcTexture->GetCreateInfo().size.width, 1u);
+          const Offset2D srcOffset{static_cast<int32_t>(info.srcOffset % srcWidth), static_cast<int32_t>(info.srcOffset / srcWidth)};
+
+          GLenum target{GL_TEXTURE_2D};
+          if(createInfo.textureType == Graphics::TextureType::TEXTURE_CUBEMAP)
+          {
+            target = GL_TEXTURE_CUBE_MAP_POSITIVE_X + info.layer;
+          }
+
+          // There is no CPU copy of the source to upload instead : its texels are only readable through the framebuffer.
+          if(mCurrentContext->CopyTexture(*srcTexture, srcOffset, info.srcExtent2D, *texture, target, info.level, info.dstOffset2D))
+          {
+            texture->SetMaxMipMapLevel(Max(texture->GetMaxMipMapLevel(), info.level));
+          }
+        }
+        break;
+      }
       default:
       {
         // TODO: other sources
@@ -1107,6 +1254,34 @@ void EglGraphicsController::ProcessTextureUpdateQueue()
 
     mTextureUpdateRequests.pop();
   }
+
+  if(mTextureUploadRing)
+  {
+    mTextureUploadRing->Advance();
+  }
+}
+
+uint8_t* EglGraphicsController::AllocateTextureUploadStaging(const TextureUpdateInfo& info, uint32_t& offset)
+{
+  if(mGLESVersion < GLES::GLESVersion::GLES_30 || !info.dstTexture)
+  {
+    return nullptr;
+  }
+
+  // Pixels converted on the CPU at upload time can't be read back from the buffer.
+  const auto& createInfo = static_cast<GLES::Texture*>(info.dstTexture)->GetCreateInfo();
+  if(mGlAbstraction->TextureRequiresConverting(GLES::GLTextureFormatType(info.srcFormat).format,
+                                               GLES::GLTextureFormatType(createInfo.format).format,
+                                               IsSubImageUpload(info, createInfo)))
+  {
+    return nullptr;
+  }
+
+  if(!mTextureUploadRing)
+  {
+    mTextureUploadRing = std::make_unique<GLES::TextureUploadRing>(*this);
+  }
+  return mTextureUploadRing->Allocate(info.srcSize, offset);
 }
 
 void EglGraphicsController::UpdateTextures(const std::vector<TextureUpdateInfo>&       updateInfoList,
@@ -1115,19 +1290,31 @@ void EglGraphicsController::UpdateTextures(const std::vector<TextureUpdateInfo>&
   // Store updates
   for(auto& info : updateInfoList)
   {
-    mTextureUpdateRequests.push(std::make_pair(info, sourceList[info.srcReference]));
-    auto& pair = mTextureUpdateRequests.back();
-    switch(pair.second.sourceType)
+    auto& request  = mTextureUpdateRequests.emplace();
+    request.info   = info;
+    request.source = sourceList[info.srcReference];
+    switch(request.source.sourceType)
     {
       case Graphics::TextureUpdateSourceInfo::Type::MEMORY:
       {
-        auto& info   = pair.first;
-        auto& source = pair.second;
+        auto& info   = request.info;
+        auto& source = request.source;
+
+        // On GLES3, copy the data straight into a pixel unpack buffer.
+        // It costs no CPU memory, so it doesn't count towards the flush below.
+        uint32_t stagingOffset = 0u;
+        if(uint8_t* stagingMemory = AllocateTextureUploadStaging(info, stagingOffset))
+        {
+          uint8_t* srcMemory = &reinterpret_cast<uint8_t*>(source.memorySource.memory)[info.srcOffset];
+
+          std::copy(srcMemory, srcMemory + info.srcSize, stagingMemory);
 
-        // allocate staging memory and copy the data
-        // TODO: using PBO with GLES3, this is just naive
-        // oldschool way
+          source.memorySource.memory = reinterpret_cast<void*>(static_cast<uintptr_t>(stagingOffset));
+          request.staged             = true;
+          break;
+        }
 
+        // Otherwise, or when the current buffer is full, allocate staging memory and copy the data
         uint8_t* stagingBuffer = reinterpret_cast<uint8_t*>(malloc(info.srcSize));
 
         if(DALI_UNLIKELY(stagingBuffer == nullptr))
@@ -1160,7 +1347,7 @@ void EglGraphicsController::UpdateTextures(const std::vector<TextureUpdateInfo>&
       }
       case Graphics::TextureUpdateSourceInfo::Type::TEXTURE:
       {
-        // TODO texture 2 texture in-GPU copy
+        // Copied on the GPU when the queue is processed, so it costs no CPU memory.
         break;
       }
     }
@@ -1233,6 +1420,48 @@ GLES::PipelineCache& EglGraphicsController::GetPipelineCache() const
   return *mPipelineCache;
 }
 
+GLES::ProgramBinaryArchive* EglGraphicsController::GetProgramBinaryArchive(bool internal)
+{
+  if(!mUseProgramBinaryArchive || DALI_UNLIKELY(!mGlAbstraction))
+  {
+    return nullptr;
+  }
+
+  auto& archive = mProgramBinaryArchives[internal ? 1u : 0u];
+  if(!archive)
+  {
+    // Binaries only load on the driver and GPU which created them.
+    uint64_t driverIdentity = 14695981039346656037ull;
+    for(const GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION, GL_SHADING_LANGUAGE_VERSION})
+    {
+      const auto* value = reinterpret_cast<const char*>(mGlAbstraction->GetString(name));
+      for(; value && *value; ++value)
+      {
+        driverIdentity = (driverIdentity ^ static_cast<uint8_t>(*value)) * 1099511628211ull;
+      }
+      driverIdentity = (driverIdentity ^ 0xFFu) * 1099511628211ull;
+    }
+
+    const std::string path = (internal ? GetSystemProgramBinaryPath() : GetCustomProgramBinaryPath()) + "program-binaries.archive";
+    archive                = std::make_unique<GLES::ProgramBinaryArchive>(path, driverIdentity);
+  }
+  return archive->IsValid() ? archive.get() : nullptr;
+}
+
+void EglGraphicsController::BeginProgramPrecompile()
+{
+  if(mUseParallelPrecompile && !mProgramPrecompileEngine)
+  {
+    mProgramPrecompileEngine = GLES::ProgramPrecompileEngine::New(*this);
+  }
+  mIsPrecompilingPrograms = true;
+}
+
+void EglGraphicsController::EndProgramPrecompile()
+{
+  mIsPrecompilingPrograms = false;
+}
+
 Graphics::Texture* EglGraphicsController::CreateTextureByResourceId(uint32_t resourceId, const Graphics::TextureCreateInfo& createInfo)
 {
   Graphics::Texture*                     ret = nullptr;
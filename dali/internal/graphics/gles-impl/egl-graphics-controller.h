@@ -20,8 +20,8 @@
 // EXTERNAL INCLUDES
 #include <dali/devel-api/common/map-wrapper.h>
 #include <dali/graphics-api/graphics-controller.h>
+#include <array>
 #include <memory>
-#include <queue>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -39,8 +39,12 @@
 #include <dali/internal/graphics/gles-impl/gles-graphics-shader.h>
 #include <dali/internal/graphics/gles-impl/gles-graphics-texture.h>
 #include <dali/internal/graphics/gles-impl/gles-graphics-types.h>
+#include <dali/internal/graphics/gles-impl/gles-program-binary-archive.h>
+#include <dali/internal/graphics/gles-impl/gles-program-precompile-engine.h>
+#include <dali/internal/graphics/gles-impl/gles-reusable-queue.h>
 #include <dali/internal/graphics/gles-impl/gles-sync-pool.h>
 #include <dali/internal/graphics/gles-impl/gles-texture-dependency-checker.h>
+#include <dali/internal/graphics/gles-impl/gles-texture-upload-ring.h>
 #include <dali/internal/graphics/gles-impl/gles2-graphics-memory.h>
 
 namespace Dali
@@ -640,7 +644,7 @@ public:
    *
    * @param[in,out] queue Reference to the create queue
    */
-  void ProcessDiscardQueue(std::queue<GLES::Pipeline*>& queue)
+  void ProcessDiscardQueue(GLES::ReusableQueue<GLES::Pipeline*>& queue)
   {
     while(!queue.empty())
     {
@@ -784,6 +788,15 @@ public:
    */
   void ProcessTextureUpdateQueue();
 
+  /**
+   * @brief Allocates staging memory in mTextureUploadRing for a MEMORY texture upload
+   *
+   * @param[in] info The texture upload
+   * @param[out] offset The offset of the memory in the current buffer of the ring
+   * @return The memory to copy the pixels to, or nullptr if the upload can't be staged
+   */
+  uint8_t* AllocateTextureUploadStaging(const TextureUpdateInfo& info, uint32_t& offset);
+
   /**
    * @brief Executes all pending texture mipmap generation
    */
@@ -924,6 +937,110 @@ public:
     return mUseProgramBinary;
   }
 
+  /**
+   * @brief Returns whether every uniform block is kept as a real uniform buffer on GLES3+
+   *
+   * By default some platforms flatten uniform blocks into standalone uniforms (see shader-parser.cpp).
+   * DALI_SHADER_USE_UNIFORM_BLOCKS overrides it.
+   * @return True if every uniform block is kept, false to use the platform default
+   */
+  bool IsForcingUniformBlocks() const
+  {
+    return mForceUniformBlocks;
+  }
+
+  /**
+   * @brief Returns the archive holding the program binaries, opening it on first use
+   *
+   * The internal and custom programs have one archive each, under their program binary path.
+   * DALI_SHADER_USE_PROGRAM_BINARY_ARCHIVE=0 stores one file per program instead.
+   * @param[in] internal Whether the archive of the internal programs is returned
+   * @return The archive, or nullptr if the archive is disabled or can't be opened
+   */
+  GLES::ProgramBinaryArchive* GetProgramBinaryArchive(bool internal);
+
+  /**
+   * @copydoc Dali::Graphics::GraphicsInterface::BeginProgramPrecompile()
+   *
+   * DALI_SHADER_PARALLEL_PRECOMPILE=0 compiles the programs at once instead.
+   */
+  void BeginProgramPrecompile();
+
+  /**
+   * @copydoc Dali::Graphics::GraphicsInterface::EndProgramPrecompile()
+   */
+  void EndProgramPrecompile();
+
+  /**
+   * @brief Returns the engine compiling the programs in the background, while programs are precompiled
+   * @return The engine, or nullptr if programs are not precompiled, or can't be compiled in the background
+   */
+  GLES::ProgramPrecompileEngine* GetProgramPrecompileEngine() const
+  {
+    return mIsPrecompilingPrograms ? mProgramPrecompileEngine.get() : nullptr;
+  }
+
+  /**
+   * @brief Returns the number of redundant commands removed from the command buffers submitted since the last FrameStart()
+   *
+   * Submitted command buffers go through GLES::CommandBuffer::RemoveRedundantCommands(),
+   * unless DALI_DISABLE_COMMAND_BUFFER_OPTIMIZATION is set.
+   * @return The number of removed commands
+   */
+  uint32_t GetRemovedCommandCount() const
+  {
+    return mRemovedCommandCount;
+  }
+
+  /**
+   * @brief Returns the number of command storage allocations made by the command buffers submitted since the last FrameStart()
+   *
+   * Command buffers keep their storage when they are reset, so this is zero in steady state rendering.
+   * @return The number of allocations
+   */
+  uint32_t GetCommandStorageGrowCount() const
+  {
+    return mCommandStorageGrowCount;
+  }
+
+  /**
+   * @brief Retrieves the most commands and payload bytes used by a single submitted command buffer
+   *
+   * @param[out] commandCount The largest number of commands
+   * @param[out] memorySize The largest size of the payload memory in bytes
+   */
+  void GetCommandHighWaterMarks(uint32_t& commandCount, uint32_t& memorySize) const
+  {
+    commandCount = mCommandHighWaterMark;
+    memorySize   = mCommandMemoryHighWaterMark;
+  }
+
+  /**
+   * @brief The kinds of per-draw GL calls counted for the debug output.
+   */
+  enum class GlCallType
+  {
+    DRAW,           ///< glDraw*
+    USE_PROGRAM,    ///< glUseProgram
+    UNIFORM,        ///< glUniform* for standalone uniforms
+    UNIFORM_BUFFER, ///< glBindBufferRange for uniform blocks
+    COUNT
+  };
+
+  /**
+   * @brief Counts GL calls made in the current frame.
+   * Only counted in debug builds, and logged every frame by FrameStart() with LOG_GRAPHICS_CONTROLLER.
+   *
+   * @param[in] type The kind of GL call
+   * @param[in] count The number of calls
+   */
+  void CountGlCalls(GlCallType type, uint32_t count = 1u)
+  {
+#if defined(DEBUG_ENABLED)
+    mGlCallCounts[static_cast<uint32_t>(type)] += count;
+#endif
+  }
+
   const Matrix& GetClipMatrix(const RenderTarget* renderTarget) const override;
 
   uint32_t GetDeviceLimitation(Dali::Graphics::DeviceCapability capability) override;
@@ -947,30 +1064,39 @@ private:
   Internal::Adaptor::EglSyncImplementation* mEglSyncImplementation{nullptr};
   Graphics::GraphicsInterface*              mGraphics{nullptr}; // Pointer to owning structure via interface.
 
-  std::queue<GLES::Texture*>               mCreateTextureQueue; ///< Create queue for texture resource
+  GLES::ReusableQueue<GLES::Texture*>      mCreateTextureQueue; ///< Create queue for texture resource
   std::unordered_set<const GLES::Texture*> mDiscardTextureSet;  ///< Discard queue for texture resource
 
-  std::queue<GLES::Buffer*> mCreateBufferQueue;  ///< Create queue for buffer resource
-  std::queue<GLES::Buffer*> mDiscardBufferQueue; ///< Discard queue for buffer resource
+  GLES::ReusableQueue<GLES::Buffer*> mCreateBufferQueue;  ///< Create queue for buffer resource
+  GLES::ReusableQueue<GLES::Buffer*> mDiscardBufferQueue; ///< Discard queue for buffer resource
 
-  std::queue<GLES::Program*>             mDiscardProgramQueue;       ///< Discard queue for program resource
-  std::queue<GLES::Pipeline*>            mDiscardPipelineQueue;      ///< Discard queue of pipelines
-  std::queue<GLES::RenderPass*>          mDiscardRenderPassQueue;    ///< Discard queue for renderpass resource
-  std::queue<GLES::RenderTarget*>        mDiscardRenderTargetQueue;  ///< Discard queue for rendertarget resource
-  std::queue<GLES::Shader*>              mDiscardShaderQueue;        ///< Discard queue of shaders
-  std::queue<GLES::Sampler*>             mDiscardSamplerQueue;       ///< Discard queue of samplers
-  std::queue<const GLES::CommandBuffer*> mDiscardCommandBufferQueue; ///< Discard queue of command buffers
-  std::queue<GLES::Framebuffer*>         mCreateFramebufferQueue;    ///< Create queue for framebuffer resource
-  std::queue<GLES::Framebuffer*>         mDiscardFramebufferQueue;   ///< Discard queue for framebuffer resource
+  GLES::ReusableQueue<GLES::Program*>             mDiscardProgramQueue;       ///< Discard queue for program resource
+  GLES::ReusableQueue<GLES::Pipeline*>            mDiscardPipelineQueue;      ///< Discard queue of pipelines
+  GLES::ReusableQueue<GLES::RenderPass*>          mDiscardRenderPassQueue;    ///< Discard queue for renderpass resource
+  GLES::ReusableQueue<GLES::RenderTarget*>        mDiscardRenderTargetQueue;  ///< Discard queue for rendertarget resource
+  GLES::ReusableQueue<GLES::Shader*>              mDiscardShaderQueue;        ///< Discard queue of shaders
+  GLES::ReusableQueue<GLES::Sampler*>             mDiscardSamplerQueue;       ///< Discard queue of samplers
+  GLES::ReusableQueue<const GLES::CommandBuffer*> mDiscardCommandBufferQueue; ///< Discard queue of command buffers
+  GLES::ReusableQueue<GLES::Framebuffer*>         mCreateFramebufferQueue;    ///< Create queue for framebuffer resource
+  GLES::ReusableQueue<GLES::Framebuffer*>         mDiscardFramebufferQueue;   ///< Discard queue for framebuffer resource
 
-  std::queue<GLES::CommandBuffer*> mCommandQueue; ///< we may have more in the future
+  GLES::ReusableQueue<GLES::CommandBuffer*> mCommandQueue; ///< we may have more in the future
 
-  using TextureUpdateRequest = std::pair<TextureUpdateInfo, TextureUpdateSourceInfo>;
-  std::queue<TextureUpdateRequest> mTextureUpdateRequests;
+  /**
+   * @brief A texture upload waiting for ProcessTextureUpdateQueue()
+   */
+  struct TextureUpdateRequest
+  {
+    TextureUpdateInfo       info;
+    TextureUpdateSourceInfo source;
+    bool                    staged{false}; ///< Whether the pixels are in mTextureUploadRing. source.memorySource.memory is then the offset in the buffer
+  };
+  GLES::ReusableQueue<TextureUpdateRequest> mTextureUpdateRequests;
+  std::unique_ptr<GLES::TextureUploadRing>  mTextureUploadRing{nullptr}; ///< Staging buffers of the MEMORY uploads on GLES3, created on first use
 
   std::unordered_map<uint32_t, Graphics::UniquePtr<Graphics::Texture>> mExternalTextureResources; ///< Used for ResourceId.
 
-  std::queue<const GLES::Texture*> mTextureMipmapGenerationRequests; ///< Queue for texture mipmap generation requests
+  GLES::ReusableQueue<const GLES::Texture*> mTextureMipmapGenerationRequests; ///< Queue for texture mipmap generation requests
 
   GLES::Context*                 mCurrentContext{nullptr}; ///< The current context
   std::unique_ptr<GLES::Context> mContext{nullptr};        ///< Context object handling command buffers execution
@@ -979,10 +1105,14 @@ private:
 
   std::unique_ptr<GLES::PipelineCache> mPipelineCache{nullptr}; ///< Internal pipeline cache
 
+  std::array<std::unique_ptr<GLES::ProgramBinaryArchive>, 2> mProgramBinaryArchives{}; ///< The archives of the custom and internal programs, opened on first use
+
+  std::unique_ptr<GLES::ProgramPrecompileEngine> mProgramPrecompileEngine{nullptr}; ///< Kept until the precompiled programs are completed
+
   GLES::GLESVersion mGLESVersion{GLES::GLESVersion::GLES_20}; ///< Runtime supported GLES version
   uint32_t          mTextureUploadTotalCPUMemoryUsed{0u};
 
-  std::queue<const GLES::CommandBuffer*> mPresentationCommandBuffers{}; ///< Queue of reusable command buffers used by presentation engine
+  GLES::ReusableQueue<const GLES::CommandBuffer*> mPresentationCommandBuffers{}; ///< Queue of reusable command buffers used by presentation engine
 
   void* mSharedContext{nullptr}; ///< Shared EGL context
 
@@ -991,8 +1121,21 @@ private:
   GLES::SyncPool mSyncPool;
   std::size_t    mCapacity{0u}; ///< Memory Usage (of command buffers)
 
+  std::array<uint32_t, static_cast<uint32_t>(GlCallType::COUNT)> mGlCallCounts{}; ///< GL calls made in the current frame (debug only)
+
+  uint32_t mRemovedCommandCount{0u};        ///< Redundant commands removed from the command buffers submitted in the current frame
+  uint32_t mCommandStorageGrowCount{0u};    ///< Command storage allocations of the command buffers submitted in the current frame
+  uint32_t mCommandHighWaterMark{0u};       ///< The most commands recorded into a submitted command buffer
+  uint32_t mCommandMemoryHighWaterMark{0u}; ///< The most payload bytes recorded into a submitted command buffer
+
   bool mResourceInitializeFailed : 1;
   bool mUseProgramBinary : 1;
+  bool mUseProgramBinaryArchive : 1;
+  bool mProgramBinaryArchiveReported : 1; ///< Whether the startup metrics of the program binary archives are logged
+  bool mUseParallelPrecompile : 1;
+  bool mIsPrecompilingPrograms : 1; ///< Whether the programs are created between BeginProgramPrecompile() and EndProgramPrecompile()
+  bool mForceUniformBlocks : 1;
+  bool mRemoveRedundantCommands : 1;
   bool mDidPresent : 1;
 };
 
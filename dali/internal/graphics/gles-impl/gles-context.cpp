@@ -29,6 +29,8 @@
 #include "gles-graphics-program.h"
 #include "gles-graphics-render-pass.h"
 #include "gles-graphics-render-target.h"
+#include "gles-graphics-texture.h"
+#include "gles-sync-object.h"
 #include "gles-texture-dependency-checker.h"
 
 #include <dali/internal/graphics/common/egl-include.h>
@@ -357,6 +359,7 @@ struct Context::Impl
       // Cache not hit. Update cache and call glBindBufferRange
       memcpy(&cachedBinding, &binding, sizeof(UniformBufferBindingDescriptor));
       gl->BindBufferRange(GL_UNIFORM_BUFFER, binding.binding, binding.buffer->GetGLBuffer(), GLintptr(binding.offset), GLintptr(binding.dataSize));
+      mController.CountGlCalls(EglGraphicsController::GlCallType::UNIFORM_BUFFER);
     }
   }
 
@@ -461,6 +464,8 @@ struct Context::Impl
 
   std::vector<Dali::GLuint> mDiscardedVAOList{};
 
+  Dali::GLuint mCopyFramebuffer{0u}; ///< Framebuffer to read the source texture of CopyTexture() from
+
   bool mGlContextCreated{false};    ///< True if the OpenGL context has been created
   bool mVertexBuffersChanged{true}; ///< True if BindVertexBuffers changed any buffer bindings
 
@@ -713,6 +718,7 @@ void Context::Flush(bool reset, const GLES::DrawCallDescriptor& drawCall, GLES::
                                   drawCall.draw.vertexCount,
                                   drawCall.draw.instanceCount);
         }
+        mImpl->mController.CountGlCalls(EglGraphicsController::GlCallType::DRAW);
         break;
       }
       case DrawCallDescriptor::Type::DRAW_INDEXED:
@@ -740,6 +746,7 @@ void Context::Flush(bool reset, const GLES::DrawCallDescriptor& drawCall, GLES::
                              drawCall.drawIndexed.indexCount,
                              indexBufferFormat,
                              reinterpret_cast<const void*>(static_cast<std::uintptr_t>(offset)));
+            mImpl->mController.CountGlCalls(EglGraphicsController::GlCallType::DRAW);
           }
           else
           {
@@ -760,6 +767,7 @@ void Context::Flush(bool reset, const GLES::DrawCallDescriptor& drawCall, GLES::
                                       indexBufferFormat,
                                       reinterpret_cast<const void*>(static_cast<std::uintptr_t>(offset)),
                                       drawCall.drawIndexed.instanceCount);
+            mImpl->mController.CountGlCalls(EglGraphicsController::GlCallType::DRAW);
           }
           else
           {
@@ -1223,7 +1231,7 @@ void Context::EndRenderPass(GLES::TextureDependencyChecker& dependencyChecker)
   }
 }
 
-void Context::ReadPixels(uint8_t* buffer)
+void Context::ReadPixels(uint8_t* buffer, GLES::SyncObject* syncObject)
 {
   if(buffer && mImpl->mCurrentRenderTarget)
   {
@@ -1239,8 +1247,25 @@ void Context::ReadPixels(uint8_t* buffer)
         framebuffer->Bind();
       }
 
-      gl->Finish(); // To guarantee ReadPixels.
-      gl->ReadPixels(0, 0, framebuffer->GetCreateInfo().size.width, framebuffer->GetCreateInfo().size.height, GL_RGBA, GL_UNSIGNED_BYTE, buffer);
+      const auto& size = framebuffer->GetCreateInfo().size;
+      if(syncObject && mImpl->mController.GetGLESVersion() >= GLESVersion::GLES_30)
+      {
+        // Read into a pixel pack buffer, so the GPU pipeline doesn't need to drain now.
+        const uint32_t dataSize   = size.width * size.height * 4u;
+        GLuint         packBuffer = 0u;
+        gl->GenBuffers(1, &packBuffer);
+        gl->BindBuffer(GL_PIXEL_PACK_BUFFER, packBuffer);
+        gl->BufferData(GL_PIXEL_PACK_BUFFER, dataSize, nullptr, GL_STREAM_READ);
+        gl->ReadPixels(0, 0, size.width, size.height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        gl->BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        syncObject->SetPendingReadback(*framebuffer, packBuffer, buffer, dataSize);
+      }
+      else
+      {
+        gl->Finish(); // To guarantee ReadPixels.
+        gl->ReadPixels(0, 0, size.width, size.height, GL_RGBA, GL_UNSIGNED_BYTE, buffer);
+      }
 
       if(latestBoundFrameBuffer != framebuffer->GetGlFramebufferId())
       {
@@ -1252,6 +1277,56 @@ void Context::ReadPixels(uint8_t* buffer)
   }
 }
 
+bool Context::CopyTexture(const GLES::Texture&      srcTexture,
+                          const Graphics::Offset2D& srcOffset,
+                          const Graphics::Extent2D& extent,
+                          const GLES::Texture&      dstTexture,
+                          GLenum                    dstTarget,
+                          uint32_t                  dstLevel,
+                          const Graphics::Offset2D& dstOffset)
+{
+  auto* gl = mImpl->GetGL();
+  if(DALI_UNLIKELY(!gl))
+  {
+    return false;
+  }
+
+  if(mImpl->mCopyFramebuffer == 0u)
+  {
+    gl->GenFramebuffers(1, &mImpl->mCopyFramebuffer);
+  }
+
+  auto latestBoundFrameBuffer = mImpl->mGlStateCache.mFrameBufferStateCache.GetCurrentFrameBuffer();
+
+  // A cube map is attached through its face, the first one being read.
+  const GLenum srcTarget = (srcTexture.GetCreateInfo().textureType == Graphics::TextureType::TEXTURE_CUBEMAP) ? GL_TEXTURE_CUBE_MAP_POSITIVE_X : GL_TEXTURE_2D;
+
+  gl->BindFramebuffer(GL_FRAMEBUFFER, mImpl->mCopyFramebuffer);
+  gl->FramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, srcTarget, srcTexture.GetGLTexture(), 0);
+
+  // The formats which can't be rendered to, e.g. luminance, alpha, or some float formats, can't be read either.
+  const GLenum status = gl->CheckFramebufferStatus(GL_FRAMEBUFFER);
+  const bool   copied = (status == GL_FRAMEBUFFER_COMPLETE);
+  if(DALI_LIKELY(copied))
+  {
+    const GLenum bindTarget = dstTexture.GetGlTarget();
+    BindTexture(bindTarget, dstTexture.GetGLTexture());
+    gl->CopyTexSubImage2D(dstTarget, dstLevel, dstOffset.x, dstOffset.y, srcOffset.x, srcOffset.y, extent.width, extent.height);
+    BindTexture(bindTarget, 0);
+  }
+  else
+  {
+    DALI_LOG_ERROR("Texture copy : the source texture (format %d) can't be read through a framebuffer [status:0x%x]\n", static_cast<int>(srcTexture.GetCreateInfo().format), status);
+  }
+
+  // Detach, so the framebuffer doesn't keep the source texture alive.
+  gl->FramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, srcTarget, 0, 0);
+
+  // Restore FBO bind after using.
+  gl->BindFramebuffer(GL_FRAMEBUFFER, latestBoundFrameBuffer);
+  return copied;
+}
+
 void Context::ClearState()
 {
   mImpl->mCurrentTextureBindings.Clear();
@@ -1621,6 +1696,7 @@ void Context::DiscardNonShareableCache()
   mImpl->mProgramVAOMap.clear();
   mImpl->mDiscardedVAOList.clear();
   mImpl->mProgramVAOCurrentState = 0u;
+  mImpl->mCopyFramebuffer        = 0u;
 
   // Pipeline objects themselves are not GL objects and survive, but the
   // cached "currently bound" pipeline no longer reflects driver state.
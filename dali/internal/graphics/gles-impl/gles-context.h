@@ -30,6 +30,7 @@ namespace GLES
 class Pipeline;
 class RenderPass;
 class RenderTarget;
+class SyncObject;
 class Texture;
 class TextureDependencyChecker;
 
@@ -150,9 +151,39 @@ public:
 
   /**
    * @brief Request to read pixels
+   *
+   * Without a sync object, waits for the GPU to finish and reads the pixels straight away.
+   * With one on GLES3, reads into a pixel pack buffer instead, and the pixels are copied
+   * to the buffer when the sync object is found signalled.
+   *
    * @param[out] buffer to load pixel data.
+   * @param[in] syncObject The sync object of the render pass the client waits for before reading the buffer, or nullptr
+   */
+  void ReadPixels(uint8_t* buffer, GLES::SyncObject* syncObject);
+
+  /**
+   * @brief Copies a region of a texture into another texture, without leaving the GPU.
+   *
+   * The source texture is attached to a framebuffer owned by the context, and the region
+   * is copied with glCopyTexSubImage2D. The framebuffer is created on first use, and is
+   * released with the GL context.
+   *
+   * @param[in] srcTexture The texture to copy from. Its level 0 is read, and the positive X face of a cube map
+   * @param[in] srcOffset The origin of the region in the source texture
+   * @param[in] extent The size of the region
+   * @param[in] dstTexture The texture to copy to. Must not be the source texture
+   * @param[in] dstTarget The target of the destination image, e.g. a cube map face
+   * @param[in] dstLevel The mipmap level of the destination image
+   * @param[in] dstOffset The origin of the region in the destination texture
+   * @return false if the source texture can't be read through a framebuffer, e.g. a luminance or alpha texture
    */
-  void ReadPixels(uint8_t* buffer);
+  bool CopyTexture(const GLES::Texture&      srcTexture,
+                   const Graphics::Offset2D& srcOffset,
+                   const Graphics::Extent2D& extent,
+                   const GLES::Texture&      dstTexture,
+                   GLenum                    dstTarget,
+                   uint32_t                  dstLevel,
+                   const Graphics::Offset2D& dstOffset);
 
   /**
    * @brief Returns the cache of GL state in the context
@@ -20,6 +20,7 @@
 
 // EXTERNAL HEADERS
 #include <dali/public-api/common/dali-utility.h>
+#include <algorithm>
 
 // INTERNAL INCLUDES
 #include "egl-graphics-controller.h"
@@ -36,6 +37,104 @@ namespace
 {
 constexpr uint32_t CPU_ALLOCATED_UBO_INDEX       = 0u;
 constexpr uint32_t GPU_ALLOCATED_UBO_INDEX_BEGIN = 1u;
+
+/**
+ * @brief Compares the bindings of two BIND_TEXTURES commands. nullptr means no binding.
+ */
+bool TextureBindingsEqual(const Command* lhs, const Command* rhs)
+{
+  const uint32_t count = lhs ? lhs->bindTextures.textureBindingsCount : 0u;
+  if(count != (rhs ? rhs->bindTextures.textureBindingsCount : 0u))
+  {
+    return false;
+  }
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    const auto& lhsBinding = lhs->bindTextures.textureBindings[i];
+    const auto& rhsBinding = rhs->bindTextures.textureBindings[i];
+    if(lhsBinding.texture != rhsBinding.texture || lhsBinding.sampler != rhsBinding.sampler || lhsBinding.binding != rhsBinding.binding)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Compares the bindings of two BIND_UNIFORM_BUFFER commands. nullptr means no binding.
+ */
+bool UniformBufferBindingsEqual(const Command* lhs, const Command* rhs)
+{
+  const uint32_t count = lhs ? lhs->bindUniformBuffers.uniformBufferBindingsCount : 0u;
+  if(count != (rhs ? rhs->bindUniformBuffers.uniformBufferBindingsCount : 0u))
+  {
+    return false;
+  }
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    const auto& lhsBinding = lhs->bindUniformBuffers.uniformBufferBindings[i];
+    const auto& rhsBinding = rhs->bindUniformBuffers.uniformBufferBindings[i];
+    if(lhsBinding.buffer != rhsBinding.buffer || lhsBinding.offset != rhsBinding.offset || lhsBinding.dataSize != rhsBinding.dataSize || lhsBinding.binding != rhsBinding.binding)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Compares the bindings of two BIND_VERTEX_BUFFERS commands.
+ */
+bool VertexBufferBindingsEqual(const Command& lhs, const Command& rhs)
+{
+  const uint32_t count = lhs.bindVertexBuffers.vertexBufferBindingsCount;
+  if(count != rhs.bindVertexBuffers.vertexBufferBindingsCount)
+  {
+    return false;
+  }
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    const auto& lhsBinding = lhs.bindVertexBuffers.vertexBufferBindings[i];
+    const auto& rhsBinding = rhs.bindVertexBuffers.vertexBufferBindings[i];
+    if(lhsBinding.buffer != rhsBinding.buffer || lhsBinding.offset != rhsBinding.offset)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Checks whether two draws of the topology can be drawn as one, i.e. the primitives don't share vertices.
+ */
+bool IsListTopology(Graphics::PrimitiveTopology topology)
+{
+  return topology == Graphics::PrimitiveTopology::POINT_LIST ||
+         topology == Graphics::PrimitiveTopology::LINE_LIST ||
+         topology == Graphics::PrimitiveTopology::TRIANGLE_LIST;
+}
+
+/**
+ * @brief Retrieves the size of an index in bytes, or zero if the format is unknown.
+ */
+uint32_t GetIndexSize(Graphics::Format format)
+{
+  switch(format)
+  {
+    case Graphics::Format::R16_UINT:
+    {
+      return 2u;
+    }
+    case Graphics::Format::R32_UINT:
+    {
+      return 4u;
+    }
+    default:
+    {
+      return 0u;
+    }
+  }
+}
 } // namespace
 
 class CommandPool
@@ -114,6 +213,7 @@ class CommandPool
         {
           data.resize(fixedCapacity);
           totalCapacity = data.size();
+          ++growCount;
         }
       }
 
@@ -122,10 +222,13 @@ class CommandPool
       {
         // Resize the memory size as ceil((offset + count - totalCapacity)) / Increment) * Increment
         // So the incremented size of data is always multiplied of the value Increment.
-        data.resize(data.size() + ((offset + count - totalCapacity - 1) / Increment + 1) * Increment);
+        // Grow at least twice as big, so a growing buffer reaches its working size in a few frames.
+        const uint32_t required = data.size() + ((offset + count - totalCapacity - 1) / Increment + 1) * Increment;
+        data.resize(std::max(required, data.size() * 2u));
 
         // update base pointer, required for address translation
         totalCapacity = data.size();
+        ++growCount;
       }
 
       basePtr = data.data();
@@ -142,11 +245,12 @@ class CommandPool
       return retval;
     }
 
-    // Rolls back pool
+    // Rolls back pool. The storage is kept for the next recording.
     void Rollback()
     {
-      offset = 0;
-      size   = 0;
+      highWaterMark = std::max(highWaterMark, offset);
+      offset        = 0;
+      size          = 0;
     }
 
     // Discards all data and storage
@@ -164,6 +268,8 @@ class CommandPool
     uint32_t increment{Increment};
     uint32_t alignment{Alignment};
     uint32_t fixedCapacity{0u};
+    uint32_t highWaterMark{0u}; ///< The largest offset reached by a recording
+    uint32_t growCount{0u};     ///< The number of times the storage was (re)allocated
     void*    basePtr{nullptr};
   };
 
@@ -235,10 +341,30 @@ public:
     return commandPool.data.ptr;
   }
 
+  Command* GetCommands(uint32_t& size)
+  {
+    size = commandPool.size;
+    return commandPool.data.ptr;
+  }
+
   std::size_t GetTotalCapacity() const
   {
     return commandPool.data.capacity + memoryPool.data.capacity;
   }
+
+  void GetHighWaterMarks(uint32_t& commandCount, uint32_t& memorySize) const
+  {
+    commandCount = std::max(commandPool.highWaterMark, commandPool.offset);
+    memorySize   = std::max(memoryPool.highWaterMark, memoryPool.offset);
+  }
+
+  uint32_t TakeGrowCount()
+  {
+    const uint32_t growCount = commandPool.growCount + memoryPool.growCount;
+    commandPool.growCount    = 0u;
+    memoryPool.growCount     = 0u;
+    return growCount;
+  }
 };
 
 /**
@@ -316,6 +442,7 @@ CommandBuffer::~CommandBuffer() = default;
 void CommandBuffer::Begin(const Graphics::CommandBufferBeginInfo& info)
 {
   mGlStateCommandCache->ResetCache();
+  mRedundantCommandsRemoved = false;
 }
 
 void CommandBuffer::End()
@@ -604,6 +731,7 @@ void CommandBuffer::Reset()
 {
   mCommandPool->Rollback(false);
   mGlStateCommandCache->ResetCache(); // Reset GL state cache
+  mRedundantCommandsRemoved = false;
 }
 
 void CommandBuffer::SetScissor(Graphics::Rect2D value)
@@ -772,6 +900,260 @@ void CommandBuffer::PresentRenderTarget(GLES::RenderTarget* renderTarget)
   return mCommandPool->GetCommands(size);
 }
 
+uint32_t CommandBuffer::RemoveRedundantCommands()
+{
+  if(mRedundantCommandsRemoved || !mCommandPool)
+  {
+    return 0u;
+  }
+  mRedundantCommandsRemoved = true;
+
+  uint32_t removedCount = 0u;
+  auto     remove       = [&removedCount](Command& command)
+  {
+    command.type = CommandType::FLUSH;
+    ++removedCount;
+  };
+
+  // State set by the commands seen so far. nullptr means unknown.
+  const GLES::Pipeline* drawnPipeline{nullptr};         ///< Pipeline used by the last draw
+  Command*              pendingPipeline{nullptr};       ///< BIND_PIPELINE not used by a draw yet
+  Command*              pendingTextures{nullptr};       ///< BIND_TEXTURES not used by a draw yet. Context clears textures after each draw.
+  Command*              pendingUniformBuffers{nullptr}; ///< BIND_UNIFORM_BUFFER not used by a draw yet. Context clears them after each draw.
+  const Command*        vertexBuffers{nullptr};
+  Command*              indexBuffer{nullptr};
+  bool                  indexBufferUsed{false};
+  const Command*        scissor{nullptr};
+  const Command*        viewport{nullptr};
+
+  // The last draw, while only texture and uniform buffer binds follow it, and the binds it used.
+  Command*       lastDraw{nullptr};
+  const Command* lastDrawTextures{nullptr};
+  const Command* lastDrawUniformBuffers{nullptr};
+
+  auto resetState = [&]()
+  {
+    drawnPipeline         = nullptr;
+    pendingPipeline       = nullptr;
+    pendingTextures       = nullptr;
+    pendingUniformBuffers = nullptr;
+    vertexBuffers         = nullptr;
+    indexBuffer           = nullptr;
+    scissor               = nullptr;
+    viewport              = nullptr;
+    lastDraw              = nullptr;
+  };
+
+  // Checks whether the draw continues the last one, with the same state.
+  auto canMergeWithLastDraw = [&](const Command& command)
+  {
+    if(!lastDraw || lastDraw->type != command.type || !drawnPipeline ||
+       !TextureBindingsEqual(pendingTextures, lastDrawTextures) || !UniformBufferBindingsEqual(pendingUniformBuffers, lastDrawUniformBuffers))
+    {
+      return false;
+    }
+
+    const auto* inputAssemblyState = drawnPipeline->GetPipeline().GetCreateInfo().inputAssemblyState;
+    if(!inputAssemblyState || !IsListTopology(inputAssemblyState->topology))
+    {
+      return false;
+    }
+
+    const auto& last = lastDraw->draw;
+    const auto& draw = command.draw;
+    if(command.type == CommandType::DRAW)
+    {
+      return last.draw.instanceCount == 0u && draw.draw.instanceCount == 0u &&
+             last.firstOffset + last.draw.vertexCount == draw.firstOffset;
+    }
+    if(command.type == CommandType::DRAW_INDEXED && indexBuffer)
+    {
+      // firstOffset of indexed draws is in bytes.
+      const uint32_t indexSize = GetIndexSize(indexBuffer->bindIndexBuffer.format);
+      return indexSize != 0u &&
+             last.drawIndexed.instanceCount == 0u && draw.drawIndexed.instanceCount == 0u &&
+             last.drawIndexed.vertexOffset == 0 && draw.drawIndexed.vertexOffset == 0 &&
+             last.firstOffset + last.drawIndexed.indexCount * indexSize == draw.firstOffset;
+    }
+    return false;
+  };
+
+  uint32_t count    = 0u;
+  Command* commands = mCommandPool->GetCommands(count);
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    auto& command = commands[i];
+    switch(command.type)
+    {
+      case CommandType::FLUSH:
+      {
+        break;
+      }
+      case CommandType::BIND_PIPELINE:
+      {
+        if(pendingPipeline)
+        {
+          remove(*pendingPipeline);
+          pendingPipeline = nullptr;
+        }
+        if(command.bindPipeline.pipeline == drawnPipeline)
+        {
+          remove(command);
+        }
+        else
+        {
+          pendingPipeline = &command;
+          lastDraw        = nullptr;
+        }
+        break;
+      }
+      case CommandType::BIND_TEXTURES:
+      {
+        if(pendingTextures)
+        {
+          remove(*pendingTextures);
+        }
+        pendingTextures = &command;
+        break;
+      }
+      case CommandType::BIND_UNIFORM_BUFFER:
+      {
+        if(pendingUniformBuffers)
+        {
+          remove(*pendingUniformBuffers);
+        }
+        pendingUniformBuffers = &command;
+        break;
+      }
+      case CommandType::BIND_VERTEX_BUFFERS:
+      {
+        if(vertexBuffers && VertexBufferBindingsEqual(*vertexBuffers, command))
+        {
+          remove(command);
+        }
+        else
+        {
+          vertexBuffers = &command;
+          lastDraw      = nullptr;
+        }
+        break;
+      }
+      case CommandType::BIND_INDEX_BUFFER:
+      {
+        if(indexBuffer && indexBuffer->bindIndexBuffer.buffer == command.bindIndexBuffer.buffer && indexBuffer->bindIndexBuffer.offset == command.bindIndexBuffer.offset && indexBuffer->bindIndexBuffer.format == command.bindIndexBuffer.format)
+        {
+          remove(command);
+        }
+        else
+        {
+          if(indexBuffer && !indexBufferUsed)
+          {
+            remove(*indexBuffer);
+          }
+          indexBuffer     = &command;
+          indexBufferUsed = false;
+          lastDraw        = nullptr;
+        }
+        break;
+      }
+      case CommandType::DRAW:
+      case CommandType::DRAW_INDEXED:
+      case CommandType::DRAW_INDEXED_INDIRECT:
+      {
+        indexBufferUsed |= (command.type != CommandType::DRAW);
+        if(!pendingPipeline && canMergeWithLastDraw(command))
+        {
+          if(command.type == CommandType::DRAW)
+          {
+            lastDraw->draw.draw.vertexCount += command.draw.draw.vertexCount;
+          }
+          else
+          {
+            lastDraw->draw.drawIndexed.indexCount += command.draw.drawIndexed.indexCount;
+          }
+          remove(command);
+          if(pendingTextures)
+          {
+            remove(*pendingTextures);
+          }
+          if(pendingUniformBuffers)
+          {
+            remove(*pendingUniformBuffers);
+          }
+        }
+        else
+        {
+          if(pendingPipeline)
+          {
+            drawnPipeline = pendingPipeline->bindPipeline.pipeline;
+          }
+          lastDraw               = &command;
+          lastDrawTextures       = pendingTextures;
+          lastDrawUniformBuffers = pendingUniformBuffers;
+        }
+        pendingPipeline       = nullptr;
+        pendingTextures       = nullptr;
+        pendingUniformBuffers = nullptr;
+        break;
+      }
+      case CommandType::SET_SCISSOR:
+      {
+        const auto& region = command.scissor.region;
+        if(scissor && scissor->scissor.region.x == region.x && scissor->scissor.region.y == region.y && scissor->scissor.region.width == region.width && scissor->scissor.region.height == region.height)
+        {
+          remove(command);
+        }
+        else
+        {
+          scissor  = &command;
+          lastDraw = nullptr;
+        }
+        break;
+      }
+      case CommandType::SET_VIEWPORT:
+      {
+        const auto& region = command.viewport.region;
+        if(viewport && viewport->viewport.region.x == region.x && viewport->viewport.region.y == region.y && viewport->viewport.region.width == region.width && viewport->viewport.region.height == region.height)
+        {
+          remove(command);
+        }
+        else
+        {
+          viewport = &command;
+          lastDraw = nullptr;
+        }
+        break;
+      }
+      case CommandType::EXECUTE_COMMAND_BUFFERS:
+      {
+        // Secondary command buffers are owned by the controller as well; only the command keeps them const.
+        for(uint32_t j = 0u; j < command.executeCommandBuffers.buffersCount; ++j)
+        {
+          removedCount += const_cast<CommandBuffer*>(command.executeCommandBuffers.buffers[j])->RemoveRedundantCommands();
+        }
+        resetState();
+        break;
+      }
+      case CommandType::BEGIN_RENDERPASS:
+      case CommandType::END_RENDERPASS:
+      case CommandType::PRESENT_RENDER_TARGET:
+      case CommandType::DRAW_NATIVE:
+      {
+        // May switch the context, or change the GL state outside of this buffer.
+        resetState();
+        break;
+      }
+      default:
+      {
+        // Other state changes and clears keep the binds, but must stay between the draws.
+        lastDraw = nullptr;
+        break;
+      }
+    }
+  }
+  return removedCount;
+}
+
 void CommandBuffer::DestroyResource()
 {
   if(DALI_LIKELY(mCommandPool))
@@ -803,4 +1185,19 @@ std::size_t CommandBuffer::GetCapacity()
   return total;
 }
 
+void CommandBuffer::GetHighWaterMarks(uint32_t& commandCount, uint32_t& memorySize) const
+{
+  commandCount = 0u;
+  memorySize   = 0u;
+  if(mCommandPool)
+  {
+    mCommandPool->GetHighWaterMarks(commandCount, memorySize);
+  }
+}
+
+uint32_t CommandBuffer::TakeStorageGrowCount()
+{
+  return mCommandPool ? mCommandPool->TakeGrowCount() : 0u;
+}
+
 } // namespace Dali::Graphics::GLES
@@ -461,6 +461,23 @@ public:
    */
   [[nodiscard]] const Command* GetCommands(uint32_t& size) const;
 
+  /**
+   * @brief Removes redundant commands before the command buffer is processed
+   *
+   * Removed commands are turned into FLUSH commands, which do nothing, so the buffer keeps its layout.
+   * - Binds of the pipeline, vertex buffers, index buffer, scissor and viewport that match the state already set.
+   * - Binds overwritten before any draw uses them.
+   * - Adjacent draws with the same state and contiguous ranges are merged into the first draw.
+   *
+   * The state at the start of the buffer, and after anything that may change it outside of
+   * this buffer (render passes, secondary command buffers, native drawing), is treated as unknown.
+   * So the result doesn't depend on the buffers processed before, and running it again changes nothing.
+   * Secondary command buffers are processed too.
+   *
+   * @return The number of removed commands, or zero if it already ran since the last Reset()
+   */
+  uint32_t RemoveRedundantCommands();
+
   /**
    * @brief Destroy the associated resources
    */
@@ -479,11 +496,29 @@ public:
   // Get the total memory usage of this command buffer
   std::size_t GetCapacity();
 
+  /**
+   * @brief Retrieves the most commands and payload bytes a single recording of this command buffer used
+   *
+   * Reset() keeps the storage, so once it has reached these sizes recording doesn't allocate.
+   * @param[out] commandCount The largest number of commands
+   * @param[out] memorySize The largest size of the payload memory (bindings, descriptors etc.) in bytes
+   */
+  void GetHighWaterMarks(uint32_t& commandCount, uint32_t& memorySize) const;
+
+  /**
+   * @brief Returns the number of times the command storage was allocated since the last call, and resets it
+   *
+   * @return The number of allocations, zero in steady state rendering
+   */
+  uint32_t TakeStorageGrowCount();
+
 private:
   std::unique_ptr<CommandPool> mCommandPool; ///< Pool of commands and transient memory
 
   struct GlStateCommandCache;
   std::unique_ptr<GlStateCommandCache> mGlStateCommandCache; ///< Stack of GL state caches
+
+  bool mRedundantCommandsRemoved{false}; ///< Whether RemoveRedundantCommands() ran since the last Reset()
 };
 } // namespace Dali::Graphics::GLES
 
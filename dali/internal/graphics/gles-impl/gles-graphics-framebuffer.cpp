@@ -22,11 +22,13 @@
 #include <dali/integration-api/gl-abstraction.h>
 #include <dali/integration-api/gl-defines.h>
 #include <dali/public-api/common/dali-utility.h>
+#include <algorithm>
 
 // Internal headers
 #include <dali/internal/graphics/gles-impl/gles-graphics-texture.h>
 #include "egl-graphics-controller.h"
 #include "gles-context.h"
+#include "gles-sync-object.h"
 
 namespace Dali::Graphics::GLES
 {
@@ -184,6 +186,8 @@ bool Framebuffer::InitializeResource()
 
 void Framebuffer::DestroyResource()
 {
+  CancelPendingReadbacks();
+
   if(DALI_LIKELY(!EglGraphicsController::IsShuttingDown()))
   {
     auto* gl = mController.GetGL();
@@ -258,9 +262,33 @@ void Framebuffer::DestroyResource()
 
 void Framebuffer::DiscardResource()
 {
+  // The client frees the destination of the pending reads along with this framebuffer, before it is destroyed.
+  CancelPendingReadbacks();
+
   mController.DiscardResource(this);
 }
 
+void Framebuffer::AddPendingReadback(SyncObject* syncObject)
+{
+  mPendingReadbacks.push_back(syncObject);
+}
+
+void Framebuffer::RemovePendingReadback(SyncObject* syncObject)
+{
+  mPendingReadbacks.erase(std::remove(mPendingReadbacks.begin(), mPendingReadbacks.end(), syncObject), mPendingReadbacks.end());
+}
+
+void Framebuffer::CancelPendingReadbacks()
+{
+  // CancelReadback() unregisters the sync object, so iterate over a copy.
+  auto pendingReadbacks = std::move(mPendingReadbacks);
+  mPendingReadbacks.clear();
+  for(auto* syncObject : pendingReadbacks)
+  {
+    syncObject->CancelReadback();
+  }
+}
+
 void Framebuffer::Bind()
 {
   auto* gl = mController.GetGL();
@@ -22,6 +22,7 @@
 #include <dali/graphics-api/graphics-framebuffer-create-info.h>
 #include <dali/graphics-api/graphics-framebuffer.h>
 #include <dali/integration-api/gl-abstraction.h>
+#include <vector>
 
 // INTERNAL INCLUDES
 #include "gles-graphics-resource.h"
@@ -29,6 +30,7 @@
 namespace Dali::Graphics::GLES
 {
 class Context;
+class SyncObject;
 using FramebufferResource = Resource<Graphics::Framebuffer, Graphics::FramebufferCreateInfo>;
 
 class Framebuffer : public FramebufferResource
@@ -91,7 +93,29 @@ public:
    */
   void InvalidateDepthStencilRenderBuffers();
 
+  /**
+   * @brief Registers an asynchronous read of this framebuffer, which completes when the sync object is signalled.
+   *
+   * The client owns the memory the pixels are copied to, and frees it with this framebuffer, so the read
+   * is cancelled if this framebuffer is discarded first.
+   *
+   * @param[in] syncObject The sync object holding the pending read
+   */
+  void AddPendingReadback(SyncObject* syncObject);
+
+  /**
+   * @brief Unregisters a read of this framebuffer which has completed or was released.
+   *
+   * @param[in] syncObject The sync object which held the read
+   */
+  void RemovePendingReadback(SyncObject* syncObject);
+
 private:
+  /**
+   * @brief Cancels the pending reads of this framebuffer, without copying their pixels.
+   */
+  void CancelPendingReadbacks();
+
   /**
    * Attach a texture to the specified attachment point
    * @param[in] texture The texture to bind
@@ -122,6 +146,8 @@ private:
   bool   mAttachedStencilWrite : 1;
   GLenum mAttachedAttachment;
   GLenum mAttachedInternalFormat;
+
+  std::vector<SyncObject*> mPendingReadbacks; ///< Sync objects with a read of this framebuffer pending
 };
 
 } // namespace Dali::Graphics::GLES
@@ -431,6 +431,12 @@ Graphics::UniquePtr<Graphics::Program> PipelineCache::GetProgram(const ProgramCr
 {
   ProgramImpl* cachedProgram = FindProgramImpl(programCreateInfo);
 
+  if(cachedProgram && cachedProgram->IsCreatePending() && !mImpl->controller.GetProgramPrecompileEngine())
+  {
+    // Precompiled in the background : complete it before it is used.
+    cachedProgram->FinishCreate();
+  }
+
   // Return same pointer if nothing changed
   if(oldProgram && *static_cast<GLES::Program*>(oldProgram.get()) == cachedProgram)
   {
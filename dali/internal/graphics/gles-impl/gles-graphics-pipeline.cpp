@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -100,6 +100,7 @@ void PipelineImpl::Bind(const uint32_t glProgram) const
   if(DALI_LIKELY(gl))
   {
     gl->UseProgram(glProgram);
+    GetController().CountGlCalls(EglGraphicsController::GlCallType::USE_PROGRAM);
   }
 }
 
@@ -24,10 +24,12 @@
 #else
 #include <unistd.h>
 #endif
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <locale>
+#include <utility>
 
 // INTERNAL HEADERS
 #include <dali/devel-api/adaptor-framework/file-loader.h>
@@ -37,6 +39,8 @@
 #include "egl-graphics-controller.h"
 #include "gles-graphics-reflection.h"
 #include "gles-graphics-shader.h"
+#include "gles-program-binary-archive.h"
+#include "gles-program-precompile-engine.h"
 
 static constexpr const char* FRAGMENT_SHADER_ADVANCED_BLEND_EQUATION_PREFIX =
   "#ifdef GL_KHR_blend_equation_advanced\n"
@@ -52,12 +56,25 @@ extern std::string GetCustomProgramBinaryPath();
 
 namespace
 {
-const char* VERSION_SEPARATOR = "-";
-const char* SHADER_SUFFIX     = ".shader";
+const char* VERSION_SEPARATOR     = "-";
+const char* SHADER_SUFFIX         = ".shader";
+const char* UNIFORM_BLOCKS_SUFFIX = "-ubo";
 
 #if defined(DEBUG_ENABLED)
 Debug::Filter* gGraphicsProgramLogFilter = Debug::Filter::New(Debug::NoLogging, false, "LOG_GRAPHICS_PROGRAM");
 #endif
+
+/**
+ * @brief FNV-1a hash, to key the programs in the program binary archive.
+ */
+void HashCombine(uint64_t& hash, const void* data, size_t size)
+{
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  for(size_t i = 0u; i < size; ++i)
+  {
+    hash = (hash ^ bytes[i]) * 1099511628211ull;
+  }
+}
 } // namespace
 
 namespace Dali::Graphics::GLES
@@ -136,6 +153,8 @@ struct ProgramImpl::Impl
   uint32_t               glProgram{};
   uint32_t               refCount{0u};
 
+  ProgramPrecompileEngine* precompileEngine{nullptr}; ///< The engine linking the program in the background, until FinishCreate()
+
   std::unique_ptr<GLES::Reflection> reflection{nullptr};
 
   // Uniform cache
@@ -163,6 +182,12 @@ bool ProgramImpl::Destroy()
     return false; // Early out if shutting down
   }
 
+  if(mImpl->precompileEngine)
+  {
+    // Don't delete the program while it is linked on another thread.
+    std::exchange(mImpl->precompileEngine, nullptr)->Finish(*this);
+  }
+
   if(mImpl->glProgram)
   {
     auto* gl = mImpl->controller.GetGL();
@@ -253,6 +278,9 @@ void ProgramImpl::Preprocess()
       parseInfo.language      = Internal::ShaderParser::OutputLanguage(glslVersion); // We default to GLSL3
       parseInfo.outputVersion = Max(vsh->GetGLSLVersion(), fsh->GetGLSLVersion());
 
+      // Real uniform buffers let a draw bind its whole block at once, instead of one glUniform call per member.
+      parseInfo.forceUniformBlocks = mImpl->controller.IsForcingUniformBlocks();
+
       std::vector<std::string> newShaders;
 
       Internal::ShaderParser::Parse(parseInfo, newShaders);
@@ -313,6 +341,16 @@ bool ProgramImpl::Create()
   {
     Preprocess();
     DALI_LOG_DEBUG_INFO("Program[%s] pre-process finish for program id : %u\n", mImpl->name.c_str(), program);
+
+    auto* precompileEngine = mImpl->controller.GetProgramPrecompileEngine();
+    if(precompileEngine && precompileEngine->Add(*this))
+    {
+      // Compiled and linked in the background. FinishCreate() completes the program.
+      DALI_LOG_DEBUG_INFO("Program[%s] compile and link in the background\n", mImpl->name.c_str());
+      mImpl->precompileEngine = precompileEngine;
+      return true;
+    }
+
     for(const auto& state : *info.shaderState)
     {
       const auto* shader = static_cast<const GLES::Shader*>(state.shader);
@@ -334,6 +372,42 @@ bool ProgramImpl::Create()
     DALI_LOG_DEBUG_INFO("ProgramBinary[%s] is already been created. Skip glCompile and glLink \n", mImpl->name.c_str());
   }
 
+  return CompleteCreate(cachedProgramBinary);
+}
+
+bool ProgramImpl::IsCreatePending() const
+{
+  return mImpl->precompileEngine != nullptr;
+}
+
+bool ProgramImpl::FinishCreate()
+{
+  if(!mImpl->precompileEngine)
+  {
+    return mImpl->glProgram != 0u;
+  }
+
+  auto* graphics = mImpl->controller.GetGraphicsInterface();
+  if(DALI_UNLIKELY(!mImpl->controller.GetGL() || !graphics))
+  {
+    return false;
+  }
+  graphics->ActivateResourceContext();
+
+  std::exchange(mImpl->precompileEngine, nullptr)->Finish(*this);
+  return CompleteCreate(false);
+}
+
+void ProgramImpl::CancelCreate()
+{
+  mImpl->precompileEngine = nullptr;
+}
+
+bool ProgramImpl::CompleteCreate(bool cachedProgramBinary)
+{
+  auto*      gl      = mImpl->controller.GetGL();
+  const auto program = mImpl->glProgram;
+
   GLint status{0};
   gl->GetProgramiv(program, GL_LINK_STATUS, &status);
   if(status != GL_TRUE)
@@ -452,15 +526,19 @@ void ProgramImpl::UpdateStandaloneUniformBlock(const char* ptr)
     return; // Early out if no GL found
   }
 
-  // Set uniforms
-  int  index    = 0;
-  auto cachePtr = reinterpret_cast<char*>(mImpl->uniformData.data());
+  // Set changed uniforms, and update the cache of those only
+  int      index        = 0;
+  uint32_t uniformCount = 0u;
+  auto     cachePtr     = reinterpret_cast<char*>(mImpl->uniformData.data());
   for(const auto& info : extraInfos)
   {
-    auto& setter = mImpl->uniformSetters[index++];
-    auto  offset = info.offset;
-    if(!memcmp4(&cachePtr[offset], &ptr[offset], info.size * info.arraySize))
+    auto&      setter = mImpl->uniformSetters[index++];
+    auto       offset = info.offset;
+    const auto size   = info.size * info.arraySize;
+    if(!memcmp4(&cachePtr[offset], &ptr[offset], size))
     {
+      memcpy(&cachePtr[offset], &ptr[offset], size);
+      ++uniformCount;
       switch(setter.type)
       {
         case UniformSetter::Type::FLOAT:
@@ -484,8 +562,7 @@ void ProgramImpl::UpdateStandaloneUniformBlock(const char* ptr)
       }
     }
   }
-  // Update caches
-  memmove(mImpl->uniformData.data(), ptr, mImpl->uniformData.size());
+  GetController().CountGlCalls(EglGraphicsController::GlCallType::UNIFORM, uniformCount);
 }
 
 void ProgramImpl::BuildStandaloneUniformCache()
@@ -609,13 +686,104 @@ std::string ProgramImpl::GetProgramBinaryName()
     totalShaderSize += shader->GetCreateInfo().sourceSize;
   }
 
-  std::string programBinaryName = std::to_string(ADAPTOR_MAJOR_VERSION) + VERSION_SEPARATOR + std::to_string(ADAPTOR_MINOR_VERSION) + VERSION_SEPARATOR + std::to_string(ADAPTOR_MICRO_VERSION) + VERSION_SEPARATOR + mImpl->name + VERSION_SEPARATOR + std::to_string(totalShaderSize) + SHADER_SUFFIX;
+  std::string programBinaryName = std::to_string(ADAPTOR_MAJOR_VERSION) + VERSION_SEPARATOR + std::to_string(ADAPTOR_MINOR_VERSION) + VERSION_SEPARATOR + std::to_string(ADAPTOR_MICRO_VERSION) + VERSION_SEPARATOR + mImpl->name + VERSION_SEPARATOR + std::to_string(totalShaderSize);
+
+  // Uniform blocks change the preprocessed code, so keep their binaries apart.
+  if(mImpl->controller.IsForcingUniformBlocks())
+  {
+    programBinaryName += UNIFORM_BLOCKS_SUFFIX;
+  }
+  programBinaryName += SHADER_SUFFIX;
   return programBinaryName;
 }
 
+uint64_t ProgramImpl::GetProgramBinaryKey()
+{
+  // Unlike the file name, the key covers the whole sources.
+  uint64_t       key              = 14695981039346656037ull;
+  const uint32_t version[]        = {ADAPTOR_MAJOR_VERSION, ADAPTOR_MINOR_VERSION, ADAPTOR_MICRO_VERSION};
+  const bool     useUniformBlocks = mImpl->controller.IsForcingUniformBlocks();
+  HashCombine(key, version, sizeof(version));
+  HashCombine(key, mImpl->name.data(), mImpl->name.size());
+  HashCombine(key, &useUniformBlocks, sizeof(useUniformBlocks));
+
+  for(const auto& state : *mImpl->createInfo.shaderState)
+  {
+    const auto* shader = static_cast<const GLES::Shader*>(state.shader);
+    if(shader)
+    {
+      const auto&    createInfo  = shader->GetCreateInfo();
+      const uint32_t glslVersion = shader->GetGLSLVersion();
+      HashCombine(key, &state.pipelineStage, sizeof(state.pipelineStage));
+      HashCombine(key, &glslVersion, sizeof(glslVersion));
+      HashCombine(key, createInfo.sourceData, createInfo.sourceSize);
+    }
+  }
+  return key;
+}
+
+bool ProgramImpl::LinkProgramBinary(uint32_t format, const void* binary, uint32_t size)
+{
+  auto* gl = mImpl->controller.GetGL();
+  if(DALI_UNLIKELY(!gl))
+  {
+    DALI_LOG_ERROR("Can't Get GL \n");
+    return false;
+  }
+
+  gl->ProgramBinary(mImpl->glProgram, format, binary, static_cast<GLsizei>(size));
+
+  GLint status{0};
+  gl->GetProgramiv(mImpl->glProgram, GL_LINK_STATUS, &status);
+  if(status != GL_TRUE)
+  {
+    char    output[4096];
+    GLsizei outputSize{0u};
+    gl->GetProgramInfoLog(mImpl->glProgram, 4096, &outputSize, output);
+
+    // log on error
+    DALI_LOG_ERROR("glProgramBinary[%s] failed:\n%s. Need to re-compile shader\n", mImpl->name.c_str(), output);
+    return false;
+  }
+  return true;
+}
+
 bool ProgramImpl::LoadProgramBinary()
 {
   const auto& info = mImpl->createInfo;
+
+  auto* archive = mImpl->controller.GetProgramBinaryArchive(info.internal);
+  if(archive)
+  {
+    const auto startTime = std::chrono::steady_clock::now();
+
+    uint32_t       format = 0u;
+    uint32_t       size   = 0u;
+    const uint8_t* binary = archive->Find(GetProgramBinaryKey(), format, size);
+    bool           loaded = binary && LinkProgramBinary(format, binary, size);
+    if(!binary)
+    {
+      // The binary may have been saved to its own file, before the archive was used.
+      loaded = LoadProgramBinaryFile(archive);
+    }
+    else if(!loaded)
+    {
+      // Rejected by the driver : the binary of the compiled program replaces it when it is saved.
+      archive->Invalidate(GetProgramBinaryKey());
+    }
+
+    archive->RecordLoad(loaded, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime));
+    DALI_LOG_DEBUG_INFO("Program binary of [%s] %s in the archive %s\n", mImpl->name.c_str(), loaded ? "loaded" : "not found", archive->GetPath().c_str());
+    return loaded;
+  }
+
+  return LoadProgramBinaryFile(nullptr);
+}
+
+bool ProgramImpl::LoadProgramBinaryFile(ProgramBinaryArchive* archive)
+{
+  const auto& info = mImpl->createInfo;
+
   std::string programBinaryName;
   if(info.internal)
   {
@@ -666,20 +834,17 @@ bool ProgramImpl::LoadProgramBinary()
 
     DALI_LOG_DEBUG_INFO("Program binary format : %d", formats[0]);
 
-  gl->ProgramBinary(mImpl->glProgram, formats[0], buffer.Begin(), static_cast<GLsizei>(buffer.Size()));
-
-    GLint status{0};
-    gl->GetProgramiv(mImpl->glProgram, GL_LINK_STATUS, &status);
-    if(status != GL_TRUE)
+    if(!LinkProgramBinary(formats[0], buffer.Begin(), static_cast<uint32_t>(buffer.Size())))
     {
-      char    output[4096];
-      GLsizei size{0u};
-      gl->GetProgramInfoLog(mImpl->glProgram, 4096, &size, output);
-
-      // log on error
-      DALI_LOG_ERROR("glProgramBinary[%s] failed:\n%s. Need to re-compile shader\n", mImpl->name.c_str(), output);
       return false;
     }
+
+    if(archive)
+    {
+      // Move it to the archive. The file is left for the processes which don't use the archive.
+      const bool programBinarySaved = archive->Append(GetProgramBinaryKey(), formats[0], reinterpret_cast<const uint8_t*>(buffer.Begin()), static_cast<uint32_t>(buffer.Size()));
+      DALI_LOG_DEBUG_INFO("ProgramBinary file %s is moved to the archive [success:%d]\n", programBinaryName.c_str(), programBinarySaved);
+    }
   }
 
   return result;
@@ -689,7 +854,7 @@ void ProgramImpl::SaveProgramBinary()
 {
   GLint  binaryLength{0u};
   GLint  binarySize{0u};
-  GLenum format;
+  GLenum format{0u};
   auto*  gl = mImpl->controller.GetGL();
   if(DALI_UNLIKELY(!gl))
   {
@@ -715,6 +880,15 @@ void ProgramImpl::SaveProgramBinary()
   DALI_LOG_DEBUG_INFO("Program binary format : %d", format);
 
   const auto& info = mImpl->createInfo;
+
+  auto* archive = mImpl->controller.GetProgramBinaryArchive(info.internal);
+  if(archive)
+  {
+    const bool programBinarySaved = archive->Append(GetProgramBinaryKey(), format, programBinary.data(), static_cast<uint32_t>(binaryLength));
+    DALI_LOG_DEBUG_INFO("ProgramBinary is saved [success:%d] archive = %s buffer size = %d \n", programBinarySaved, archive->GetPath().c_str(), binaryLength);
+    return;
+  }
+
   std::string programBinaryName;
   if(info.internal)
   {
@@ -27,6 +27,7 @@
 namespace Dali::Graphics::GLES
 {
 class Reflection;
+class ProgramBinaryArchive;
 
 /**
  * @brief Program implementation
@@ -61,10 +62,32 @@ public:
   /**
    * @brief Creates GL resource for this Program
    *
+   * While programs are precompiled, the program may be compiled and linked in the background.
+   * It must then be completed by FinishCreate() before it is used.
+   *
    * @return True on success
    */
   bool Create();
 
+  /**
+   * @brief Checks whether the program is linked in the background, and not completed yet.
+   *
+   * @return True if FinishCreate() must be called before the program is used
+   */
+  [[nodiscard]] bool IsCreatePending() const;
+
+  /**
+   * @brief Completes a program linked in the background, waiting for its link if needed.
+   *
+   * @return True on success, or if the program was completed already
+   */
+  bool FinishCreate();
+
+  /**
+   * @brief Leaves a program linked in the background unlinked, when the precompile engine is destroyed at shutdown.
+   */
+  void CancelCreate();
+
   /**
    * @brief Preprocesses shaders
    */
@@ -150,6 +173,13 @@ public:
   void BuildStandaloneUniformCache();
 
 private:
+  /**
+   * @brief Checks the link status of the program, saves its binary and builds its reflection.
+   * @param[in] cachedProgramBinary Whether the program was created from a program binary.
+   * @return true if the program is linked, false otherwise.
+   */
+  bool CompleteCreate(bool cachedProgramBinary);
+
   /**
    * @brief Checks whether the program binary is enabled or not.
    * @return true if the program binary is enabled, false otherwise.
@@ -163,13 +193,35 @@ private:
   std::string GetProgramBinaryName();
 
   /**
-   * @brief Loads the shader binary data from the file
+   * @brief Returns the key of the program in the program binary archive.
+   * @return The hash of the shader sources, the program name and the adaptor version.
+   */
+  uint64_t GetProgramBinaryKey();
+
+  /**
+   * @brief Creates the program from a program binary.
+   * @param[in] format The binary format.
+   * @param[in] binary The program binary.
+   * @param[in] size The size of the binary in bytes.
+   * @return true if the program is linked, false otherwise.
+   */
+  bool LinkProgramBinary(uint32_t format, const void* binary, uint32_t size);
+
+  /**
+   * @brief Loads the shader binary data from the program binary archive, or from the file if there is no archive.
    * @return true if the shader binary data is loaded successfully, false otherwise.
    */
   bool LoadProgramBinary();
 
   /**
-   * @brief Saves the shader binary data to a file.
+   * @brief Loads the shader binary data from its own file, as saved when there is no archive.
+   * @param[in] archive The archive to move the binary to once it is loaded, or nullptr.
+   * @return true if the shader binary data is loaded successfully, false otherwise.
+   */
+  bool LoadProgramBinaryFile(ProgramBinaryArchive* archive);
+
+  /**
+   * @brief Saves the shader binary data to the program binary archive, or to a file if there is no archive.
    */
   void SaveProgramBinary();
 
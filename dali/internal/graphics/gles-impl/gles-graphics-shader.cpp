@@ -319,6 +319,19 @@ bool ShaderImpl::HasPreprocessedCode() const
   return !mImpl->sourcePreprocessed.empty();
 }
 
+std::string_view ShaderImpl::GetSourceCode() const
+{
+  const auto src  = !mImpl->sourcePreprocessed.empty() ? reinterpret_cast<const char*>(mImpl->sourcePreprocessed.data()) : reinterpret_cast<const char*>(mImpl->createInfo.sourceData);
+  const auto size = !mImpl->sourcePreprocessed.empty() ? static_cast<uint32_t>(mImpl->sourcePreprocessed.size()) : mImpl->createInfo.sourceSize;
+
+  // null-terminated char already included. So we should remove last character (null terminator) from size.
+  if(src == nullptr || size == 0u)
+  {
+    return {};
+  }
+  return {src, size - 1u};
+}
+
 std::string_view ShaderImpl::GetPreprocessedCode() const
 {
   return {reinterpret_cast<const char*>(mImpl->sourcePreprocessed.data()), mImpl->sourcePreprocessed.size()};
@@ -137,6 +137,13 @@ public:
    */
   [[nodiscard]] bool HasPreprocessedCode() const;
 
+  /**
+   * @brief Returns the source code to compile : the preprocessed code if there is one
+   *
+   * @return the string_view to the source code, without the null terminator, or an empty one if there is no source
+   */
+  [[nodiscard]] std::string_view GetSourceCode() const;
+
   /**
    * @brief Returns GLSL version
    * @return Returns valid GLSL version or 0 if undefined
@@ -0,0 +1,588 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "gles-program-binary-archive.h"
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#if !defined(DALI_PROFILE_WINDOWS)
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Dali::Graphics::GLES
+{
+namespace
+{
+constexpr uint32_t ARCHIVE_MAGIC   = 0x41425044; ///< "DPBA" (DALi Program Binary Archive), little endian
+constexpr uint32_t ARCHIVE_VERSION = 1u;
+constexpr size_t   ENTRY_ALIGNMENT = 8u; ///< Keeps the entry headers aligned in the mapped archive
+constexpr uint32_t MAXIMUM_LOCK_ATTEMPTS = 4u; ///< The archive may be replaced by another process between opening and locking it
+
+struct ArchiveHeader
+{
+  uint32_t magic;
+  uint32_t version;
+  uint64_t driverIdentity;
+};
+
+struct EntryHeader
+{
+  uint64_t key;
+  uint32_t format;
+  uint32_t size;
+  uint32_t checksum;
+  uint32_t reserved;
+};
+
+static_assert(sizeof(ArchiveHeader) == 16u && sizeof(EntryHeader) == 24u, "The archive layout must not depend on the compiler");
+
+/**
+ * @brief FNV-1a hash of the binary, to detect corrupted entries.
+ */
+uint32_t CalculateChecksum(const uint8_t* data, size_t size)
+{
+  uint32_t hash = 2166136261u;
+  for(size_t i = 0u; i < size; ++i)
+  {
+    hash = (hash ^ data[i]) * 16777619u;
+  }
+  return hash;
+}
+
+size_t GetEntrySize(uint32_t binarySize)
+{
+  return (sizeof(EntryHeader) + binarySize + ENTRY_ALIGNMENT - 1u) & ~(ENTRY_ALIGNMENT - 1u);
+}
+
+#if !defined(DALI_PROFILE_WINDOWS)
+/**
+ * @brief Holds a lock on the archive file, shared with the other processes.
+ */
+class ScopedFileLock
+{
+public:
+  /**
+   * @param[in] fileDescriptor The descriptor of the archive. It is referred to, as it changes when the archive is rewritten under the lock.
+   * @param[in] operation LOCK_SH to read the archive, LOCK_EX to write it
+   */
+  ScopedFileLock(const int& fileDescriptor, int operation)
+  : mFileDescriptor(fileDescriptor),
+    mLocked(flock(fileDescriptor, operation) == 0)
+  {
+  }
+
+  ~ScopedFileLock()
+  {
+    if(mLocked)
+    {
+      flock(mFileDescriptor, LOCK_UN);
+    }
+  }
+
+  bool IsLocked() const
+  {
+    return mLocked;
+  }
+
+private:
+  const int& mFileDescriptor;
+  const bool mLocked;
+};
+
+bool WriteAll(int fileDescriptor, const void* data, size_t size, off_t offset)
+{
+  return pwrite(fileDescriptor, data, size, offset) == static_cast<ssize_t>(size);
+}
+#endif
+
+} // namespace
+
+ProgramBinaryArchive::ProgramBinaryArchive(std::string path, uint64_t driverIdentity)
+: mPath(std::move(path)),
+  mDriverIdentity(driverIdentity)
+{
+#if !defined(DALI_PROFILE_WINDOWS)
+  const auto startTime = std::chrono::steady_clock::now();
+
+  mFileDescriptor = open(mPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+  if(mFileDescriptor < 0)
+  {
+    DALI_LOG_ERROR("Can't open the program binary archive %s\n", mPath.c_str());
+    return;
+  }
+
+  RefreshLocked();
+
+  mStatistics.openTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime);
+  DALI_LOG_RELEASE_INFO("Program binary archive %s : %u entries, %zu bytes, opened in %lld us\n", mPath.c_str(), mStatistics.entryCount, mMappedSize, static_cast<long long>(mStatistics.openTime.count()));
+#endif
+}
+
+ProgramBinaryArchive::~ProgramBinaryArchive()
+{
+#if !defined(DALI_PROFILE_WINDOWS)
+  if(mMappedData)
+  {
+    munmap(const_cast<uint8_t*>(mMappedData), mMappedSize);
+  }
+  if(mFileDescriptor >= 0)
+  {
+    close(mFileDescriptor);
+  }
+#endif
+}
+
+const uint8_t* ProgramBinaryArchive::Find(uint64_t key, uint32_t& format, uint32_t& size)
+{
+  if(!IsValid())
+  {
+    return nullptr;
+  }
+
+  auto iter = mIndex.find(key);
+  if((iter == mIndex.end() || IsRejected(key, iter->second)) && mMayHaveGrown && RefreshLocked())
+  {
+    // Appended or replaced since the archive was mapped, by this process or another one.
+    iter = mIndex.find(key);
+  }
+  if(iter == mIndex.end() || IsRejected(key, iter->second))
+  {
+    return nullptr;
+  }
+
+  // The archive is never truncated in place, so the mapping stays readable without the lock.
+  if(CalculateChecksum(mMappedData + iter->second.offset, iter->second.size) != iter->second.checksum)
+  {
+    DALI_LOG_ERROR("Program binary archive %s has a corrupted entry at %zu\n", mPath.c_str(), iter->second.offset);
+
+    // The binary may have been appended again since, by this process or another one.
+    RefreshLocked();
+    if(!ReindexEntry(key))
+    {
+      return nullptr;
+    }
+    iter = mIndex.find(key);
+  }
+
+  const Entry& entry = iter->second;
+  if(IsRejected(key, entry))
+  {
+    return nullptr;
+  }
+  format = entry.format;
+  size   = entry.size;
+  return mMappedData + entry.offset;
+}
+
+bool ProgramBinaryArchive::Append(uint64_t key, uint32_t format, const uint8_t* binary, uint32_t size)
+{
+#if !defined(DALI_PROFILE_WINDOWS)
+  if(!IsValid() || size == 0u)
+  {
+    return false;
+  }
+
+  for(uint32_t attempt = 0u; attempt < MAXIMUM_LOCK_ATTEMPTS; ++attempt)
+  {
+    {
+      ScopedFileLock lock(mFileDescriptor, LOCK_EX);
+      if(!lock.IsLocked())
+      {
+        DALI_LOG_ERROR("Can't lock the program binary archive %s\n", mPath.c_str());
+        return false;
+      }
+      if(!IsReplaced())
+      {
+        return AppendEntry(key, format, binary, size);
+      }
+    }
+    if(!Reopen())
+    {
+      return false;
+    }
+  }
+  return false;
+#else
+  return false;
+#endif
+}
+
+void ProgramBinaryArchive::Invalidate(uint64_t key)
+{
+  auto iter = mIndex.find(key);
+  if(iter != mIndex.end())
+  {
+    // The entry stays in the archive until it is replaced, as the binary may suit the other processes.
+    DALI_LOG_RELEASE_INFO("Program binary archive %s : the binary at %zu is rejected\n", mPath.c_str(), iter->second.offset);
+    mRejectedChecksums[key] = iter->second.checksum;
+  }
+}
+
+void ProgramBinaryArchive::RecordLoad(bool hit, std::chrono::microseconds loadTime)
+{
+  if(hit)
+  {
+    ++mStatistics.hitCount;
+    mStatistics.loadTime += loadTime;
+  }
+  else
+  {
+    ++mStatistics.missCount;
+  }
+}
+
+bool ProgramBinaryArchive::RefreshLocked()
+{
+#if !defined(DALI_PROFILE_WINDOWS)
+  for(uint32_t attempt = 0u; attempt < MAXIMUM_LOCK_ATTEMPTS; ++attempt)
+  {
+    {
+      // The writers hold an exclusive lock, so no entry is indexed while it is written.
+      ScopedFileLock lock(mFileDescriptor, LOCK_SH);
+      if(!lock.IsLocked())
+      {
+        return false;
+      }
+      if(!IsReplaced())
+      {
+        return Refresh();
+      }
+    }
+    if(!Reopen())
+    {
+      return false;
+    }
+  }
+#endif
+  return false;
+}
+
+bool ProgramBinaryArchive::AppendEntry(uint64_t key, uint32_t format, const uint8_t* binary, uint32_t size)
+{
+#if !defined(DALI_PROFILE_WINDOWS)
+  // Index the entries appended by the other processes, so the end of the last complete entry is known.
+  Refresh();
+
+  if(!mHasValidHeader)
+  {
+    // A new archive, or one created by another driver : start it again.
+    const ArchiveHeader header{ARCHIVE_MAGIC, ARCHIVE_VERSION, mDriverIdentity};
+    if(!Rewrite(reinterpret_cast<const uint8_t*>(&header), sizeof(header)))
+    {
+      return false;
+    }
+  }
+  else
+  {
+    const uint32_t checksum = CalculateChecksum(binary, size);
+    auto           iter     = mIndex.find(key);
+    if(iter != mIndex.end() && iter->second.format == format && iter->second.size == size && iter->second.checksum == checksum &&
+       CalculateChecksum(mMappedData + iter->second.offset, size) == checksum)
+    {
+      // Already saved, e.g. by another process.
+      return true;
+    }
+
+    if(mMappedSize > mIndexedSize || NeedsCompaction())
+    {
+      // Drop an entry torn by a crash, and the replaced entries. The entry of the key is replaced below, as the last one is indexed.
+      if(mMappedSize > mIndexedSize)
+      {
+        DALI_LOG_ERROR("Program binary archive %s has a torn entry at %zu. Dropping it\n", mPath.c_str(), mIndexedSize);
+      }
+      if(!Compact())
+      {
+        return false;
+      }
+    }
+  }
+
+  // The readers index the archive under a shared lock, so they never see a part of the entry.
+  const EntryHeader    entryHeader{key, format, size, CalculateChecksum(binary, size), 0u};
+  std::vector<uint8_t> entry(GetEntrySize(size), 0u);
+  memcpy(entry.data(), &entryHeader, sizeof(entryHeader));
+  memcpy(entry.data() + sizeof(entryHeader), binary, size);
+
+  const bool written = WriteAll(mFileDescriptor, entry.data(), entry.size(), static_cast<off_t>(mIndexedSize));
+  if(!written)
+  {
+    DALI_LOG_ERROR("Can't append to the program binary archive %s\n", mPath.c_str());
+  }
+  mMayHaveGrown = true;
+  return written;
+#else
+  return false;
+#endif
+}
+
+bool ProgramBinaryArchive::Compact()
+{
+  std::vector<const std::pair<const uint64_t, Entry>*> entries;
+  entries.reserve(mIndex.size());
+  for(const auto& iter : mIndex)
+  {
+    // The rejected and corrupted binaries are dropped, so they are compiled and appended again.
+    if(!IsRejected(iter.first, iter.second) && CalculateChecksum(mMappedData + iter.second.offset, iter.second.size) == iter.second.checksum)
+    {
+      entries.push_back(&iter);
+    }
+  }
+  std::sort(entries.begin(), entries.end(), [](const auto* lhs, const auto* rhs) { return lhs->second.offset < rhs->second.offset; });
+
+  std::vector<uint8_t> data(sizeof(ArchiveHeader), 0u);
+  const ArchiveHeader  header{ARCHIVE_MAGIC, ARCHIVE_VERSION, mDriverIdentity};
+  memcpy(data.data(), &header, sizeof(header));
+  for(const auto* entry : entries)
+  {
+    const size_t      offset = data.size();
+    const EntryHeader entryHeader{entry->first, entry->second.format, entry->second.size, entry->second.checksum, 0u};
+    data.resize(offset + GetEntrySize(entry->second.size), 0u);
+    memcpy(data.data() + offset, &entryHeader, sizeof(entryHeader));
+    memcpy(data.data() + offset + sizeof(entryHeader), mMappedData + entry->second.offset, entry->second.size);
+  }
+
+  DALI_LOG_RELEASE_INFO("Program binary archive %s : compacted from %zu to %zu bytes\n", mPath.c_str(), mMappedSize, data.size());
+  return Rewrite(data.data(), data.size());
+}
+
+bool ProgramBinaryArchive::NeedsCompaction() const
+{
+  size_t indexedEntriesSize = 0u;
+  for(const auto& iter : mIndex)
+  {
+    indexedEntriesSize += GetEntrySize(iter.second.size);
+  }
+  return mIndexedSize - sizeof(ArchiveHeader) > indexedEntriesSize * 2u;
+}
+
+bool ProgramBinaryArchive::IsRejected(uint64_t key, const Entry& entry) const
+{
+  auto iter = mRejectedChecksums.find(key);
+  return iter != mRejectedChecksums.end() && iter->second == entry.checksum;
+}
+
+bool ProgramBinaryArchive::Rewrite(const uint8_t* data, size_t size)
+{
+#if !defined(DALI_PROFILE_WINDOWS)
+  // The archive is never truncated in place, as the other processes may be reading their mapping of it, which would fault.
+  // A new file is written and renamed over it instead. It is locked before the rename, so no other process writes it before us.
+  const std::string newPath           = mPath + "." + std::to_string(getpid());
+  const int         newFileDescriptor = open(newPath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if(newFileDescriptor < 0)
+  {
+    DALI_LOG_ERROR("Can't create the program binary archive %s\n", newPath.c_str());
+    return false;
+  }
+
+  if(flock(newFileDescriptor, LOCK_EX) != 0 || !WriteAll(newFileDescriptor, data, size, 0) || rename(newPath.c_str(), mPath.c_str()) != 0)
+  {
+    DALI_LOG_ERROR("Can't write the program binary archive %s\n", mPath.c_str());
+    close(newFileDescriptor);
+    unlink(newPath.c_str());
+    return false;
+  }
+
+  // Closing the old file releases its lock. The lock of the new one is released by the caller.
+  close(mFileDescriptor);
+  mFileDescriptor = newFileDescriptor;
+  ResetIndex();
+  Refresh();
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool ProgramBinaryArchive::IsReplaced() const
+{
+#if !defined(DALI_PROFILE_WINDOWS)
+  struct stat pathStat;
+  struct stat fileStat;
+  if(stat(mPath.c_str(), &pathStat) != 0 || fstat(mFileDescriptor, &fileStat) != 0)
+  {
+    return true;
+  }
+  return pathStat.st_dev != fileStat.st_dev || pathStat.st_ino != fileStat.st_ino;
+#else
+  return false;
+#endif
+}
+
+bool ProgramBinaryArchive::Reopen()
+{
+#if !defined(DALI_PROFILE_WINDOWS)
+  const int fileDescriptor = open(mPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+  if(fileDescriptor < 0)
+  {
+    DALI_LOG_ERROR("Can't open the program binary archive %s\n", mPath.c_str());
+    return false;
+  }
+  close(mFileDescriptor);
+  mFileDescriptor = fileDescriptor;
+  ResetIndex();
+  return true;
+#else
+  return false;
+#endif
+}
+
+void ProgramBinaryArchive::ResetIndex()
+{
+#if !defined(DALI_PROFILE_WINDOWS)
+  if(mMappedData)
+  {
+    munmap(const_cast<uint8_t*>(mMappedData), mMappedSize);
+  }
+#endif
+  mMappedData            = nullptr;
+  mMappedSize            = 0u;
+  mIndexedSize           = 0u;
+  mHasValidHeader        = false;
+  mMayHaveGrown          = false;
+  mStatistics.entryCount = 0u;
+  mIndex.clear();
+}
+
+bool ProgramBinaryArchive::Refresh()
+{
+#if !defined(DALI_PROFILE_WINDOWS)
+  mMayHaveGrown = false;
+
+  struct stat fileStat;
+  if(fstat(mFileDescriptor, &fileStat) != 0)
+  {
+    return false;
+  }
+
+  const size_t fileSize = static_cast<size_t>(fileStat.st_size);
+  if(mMappedData && fileSize == mMappedSize)
+  {
+    return false;
+  }
+
+  if(mMappedData)
+  {
+    munmap(const_cast<uint8_t*>(mMappedData), mMappedSize);
+    mMappedData = nullptr;
+    mMappedSize = 0u;
+  }
+
+  if(fileSize >= sizeof(ArchiveHeader))
+  {
+    void* mappedData = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, mFileDescriptor, 0);
+    if(mappedData != MAP_FAILED)
+    {
+      mMappedData = static_cast<const uint8_t*>(mappedData);
+      mMappedSize = fileSize;
+    }
+  }
+
+  // The one-shot validity check of the whole archive : its driver identity.
+  ArchiveHeader header{};
+  if(mMappedData)
+  {
+    memcpy(&header, mMappedData, sizeof(header));
+  }
+  const bool hasValidHeader = header.magic == ARCHIVE_MAGIC && header.version == ARCHIVE_VERSION && header.driverIdentity == mDriverIdentity;
+  if(!hasValidHeader && mMappedData)
+  {
+    DALI_LOG_RELEASE_INFO("Program binary archive %s was created by another driver or version. It will be rewritten\n", mPath.c_str());
+  }
+
+  if(!hasValidHeader || !mHasValidHeader || mMappedSize < mIndexedSize)
+  {
+    // Rewritten or truncated by another process : index it all again.
+    mIndex.clear();
+    mStatistics.entryCount = 0u;
+    mIndexedSize           = sizeof(ArchiveHeader);
+  }
+  mHasValidHeader = hasValidHeader;
+
+  return mHasValidHeader && IndexEntries() > 0u;
+#else
+  return false;
+#endif
+}
+
+uint32_t ProgramBinaryArchive::IndexEntries()
+{
+  uint32_t indexedCount = 0u;
+  size_t   offset       = mIndexedSize;
+  while(offset + sizeof(EntryHeader) <= mMappedSize)
+  {
+    EntryHeader entryHeader;
+    memcpy(&entryHeader, mMappedData + offset, sizeof(entryHeader));
+
+    const size_t entrySize = GetEntrySize(entryHeader.size);
+    if(entryHeader.size == 0u || entrySize > mMappedSize - offset)
+    {
+      // Torn by a crash while it was appended.
+      break;
+    }
+
+    // A binary appended again, after its entry was found corrupted or rejected, supersedes it.
+    if(mIndex.insert_or_assign(entryHeader.key, Entry{offset + sizeof(EntryHeader), entryHeader.format, entryHeader.size, entryHeader.checksum}).second)
+    {
+      ++indexedCount;
+    }
+    offset += entrySize;
+  }
+
+  mIndexedSize = offset;
+  mStatistics.entryCount += indexedCount;
+  return indexedCount;
+}
+
+bool ProgramBinaryArchive::ReindexEntry(uint64_t key)
+{
+  // Index the last entry of the key whose binary matches its checksum, e.g. the one appended after a corrupted one.
+  auto   found  = mIndex.end();
+  size_t offset = sizeof(ArchiveHeader);
+  while(mHasValidHeader && offset + sizeof(EntryHeader) <= mIndexedSize)
+  {
+    EntryHeader entryHeader;
+    memcpy(&entryHeader, mMappedData + offset, sizeof(entryHeader));
+
+    const size_t binaryOffset = offset + sizeof(EntryHeader);
+    if(entryHeader.size > mIndexedSize - binaryOffset)
+    {
+      break;
+    }
+    if(entryHeader.key == key && CalculateChecksum(mMappedData + binaryOffset, entryHeader.size) == entryHeader.checksum)
+    {
+      found = mIndex.insert_or_assign(key, Entry{binaryOffset, entryHeader.format, entryHeader.size, entryHeader.checksum}).first;
+    }
+    offset += GetEntrySize(entryHeader.size);
+  }
+
+  if(found == mIndex.end() && mIndex.erase(key) > 0u)
+  {
+    // Not usable : the next Append() writes it again.
+    --mStatistics.entryCount;
+  }
+  return found != mIndex.end();
+}
+
+} // namespace Dali::Graphics::GLES
@@ -0,0 +1,247 @@
+#ifndef DALI_GRAPHICS_GLES_PROGRAM_BINARY_ARCHIVE_H
+#define DALI_GRAPHICS_GLES_PROGRAM_BINARY_ARCHIVE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace Dali::Graphics::GLES
+{
+/**
+ * @brief A single file holding the program binaries of every program, memory-mapped for reading.
+ *
+ * The file starts with a header holding the identity of the driver which created the binaries.
+ * Then the entries follow, each a small header (key, binary format, size and checksum) and the binary.
+ *
+ * The entries are indexed by key when the archive is opened, in one pass over the entry headers.
+ * If the driver identity doesn't match (e.g. after a driver update), the archive is treated as empty,
+ * and it is rewritten by the first Append(). The checksum of a binary is checked when it is found,
+ * and a corrupted entry is replaced by a later entry of the same key, if any.
+ *
+ * A binary rejected by the driver is invalidated, and the binary of the program compiled instead
+ * replaces it: the last entry of a key is the one indexed. As the archive is only ever appended to,
+ * it is compacted to the indexed entries whenever it is rewritten, and it is rewritten once the
+ * replaced entries take more room than the indexed ones.
+ *
+ * Entries are appended under an exclusive file lock, and indexed under a shared one, so processes
+ * may share an archive. The archive is never truncated in place, as the other processes read their
+ * mapping of it without the lock: when it is rewritten, e.g. to drop an entry torn by a crash,
+ * a new file is renamed over it, and the other processes open it again once they find it replaced.
+ *
+ * All the methods must be called on the render thread.
+ */
+class ProgramBinaryArchive
+{
+public:
+  /**
+   * @brief The counters of the archive, for the startup metrics.
+   */
+  struct Statistics
+  {
+    uint32_t                  entryCount{0u}; ///< The number of entries indexed
+    uint32_t                  hitCount{0u};   ///< The number of programs created from a binary of the archive
+    uint32_t                  missCount{0u};  ///< The number of programs compiled, as the archive had no usable binary
+    std::chrono::microseconds openTime{0};    ///< The time taken to map and index the archive
+    std::chrono::microseconds loadTime{0};    ///< The time taken to create the programs from their binaries
+  };
+
+  /**
+   * @brief Opens the archive, creating it if needed.
+   *
+   * @param[in] path The path of the archive file
+   * @param[in] driverIdentity The hash of the driver and GPU identity. Binaries of another identity are ignored
+   */
+  ProgramBinaryArchive(std::string path, uint64_t driverIdentity);
+
+  /**
+   * @brief Destructor. Unmaps the archive.
+   */
+  ~ProgramBinaryArchive();
+
+  /**
+   * @brief Checks whether the archive file can be used.
+   * @return false if the archive can't be opened or created, in which case nothing is found or appended
+   */
+  bool IsValid() const
+  {
+    return mFileDescriptor >= 0;
+  }
+
+  /**
+   * @brief Finds the binary of a program.
+   *
+   * @param[in] key The hash of the program sources
+   * @param[out] format The binary format, to pass to glProgramBinary
+   * @param[out] size The size of the binary in bytes
+   * @return The binary in the mapped archive, or nullptr if not found. It is valid until the next call to Find() or Append()
+   */
+  const uint8_t* Find(uint64_t key, uint32_t& format, uint32_t& size);
+
+  /**
+   * @brief Appends the binary of a program. It replaces the binary of the same key, if any.
+   *
+   * @param[in] key The hash of the program sources
+   * @param[in] format The binary format, from glGetProgramBinary
+   * @param[in] binary The binary
+   * @param[in] size The size of the binary in bytes
+   * @return true if the binary is written to the archive, or is already there
+   */
+  bool Append(uint64_t key, uint32_t format, const uint8_t* binary, uint32_t size);
+
+  /**
+   * @brief Stops finding the binary of a program, e.g. when the driver rejects it.
+   * It is not found again, until another binary of the same key is appended, which replaces it.
+   *
+   * @param[in] key The hash of the program sources
+   */
+  void Invalidate(uint64_t key);
+
+  /**
+   * @brief Counts a program, created from a binary of the archive or compiled.
+   *
+   * @param[in] hit Whether the program was created from a binary of the archive
+   * @param[in] loadTime The time taken to create the program from the binary, if hit
+   */
+  void RecordLoad(bool hit, std::chrono::microseconds loadTime);
+
+  /**
+   * @brief Retrieves the counters of the archive.
+   */
+  const Statistics& GetStatistics() const
+  {
+    return mStatistics;
+  }
+
+  /**
+   * @brief Retrieves the path of the archive file.
+   */
+  const std::string& GetPath() const
+  {
+    return mPath;
+  }
+
+private:
+  /**
+   * @brief An indexed entry
+   */
+  struct Entry
+  {
+    size_t   offset; ///< The offset of the binary in the file
+    uint32_t format; ///< The binary format
+    uint32_t size;   ///< The size of the binary
+    uint32_t checksum;
+  };
+
+  /**
+   * @brief Refresh() under a shared lock, opening the archive again if another process replaced it.
+   * @return true if some entries were indexed
+   */
+  bool RefreshLocked();
+
+  /**
+   * @brief Maps the archive again if it grew, and indexes the new entries.
+   * @note Must be called under the file lock.
+   * @return true if some entries were indexed
+   */
+  bool Refresh();
+
+  /**
+   * @brief Appends the binary of a program, under the exclusive lock.
+   * @return true if the binary is written to the archive
+   */
+  bool AppendEntry(uint64_t key, uint32_t format, const uint8_t* binary, uint32_t size);
+
+  /**
+   * @brief Rewrites the archive with the indexed entries only, under the exclusive lock.
+   * The replaced, invalidated, corrupted and torn entries are dropped.
+   * @return true if the archive is replaced
+   */
+  bool Compact();
+
+  /**
+   * @brief Checks whether the replaced entries take more room than the indexed ones.
+   */
+  bool NeedsCompaction() const;
+
+  /**
+   * @brief Checks whether the binary of an entry was rejected by the driver.
+   */
+  bool IsRejected(uint64_t key, const Entry& entry) const;
+
+  /**
+   * @brief Replaces the archive by a new file, under the exclusive lock, which is kept on the new file.
+   *
+   * @param[in] data The content of the new file
+   * @param[in] size The size of the content
+   * @return true if the archive is replaced
+   */
+  bool Rewrite(const uint8_t* data, size_t size);
+
+  /**
+   * @brief Checks whether the archive file was replaced by another process since it was opened.
+   */
+  bool IsReplaced() const;
+
+  /**
+   * @brief Opens the archive file again, after it was replaced.
+   * @return false if it can't be opened
+   */
+  bool Reopen();
+
+  /**
+   * @brief Unmaps the archive, and forgets its entries.
+   */
+  void ResetIndex();
+
+  /**
+   * @brief Indexes the last entry of a key whose binary matches its checksum, after the indexed one was found corrupted.
+   * @return true if such an entry is found. Otherwise the key is no longer indexed
+   */
+  bool ReindexEntry(uint64_t key);
+
+  /**
+   * @brief Indexes the entries of the mapped archive from mIndexedSize.
+   * @return The number of entries indexed
+   */
+  uint32_t IndexEntries();
+
+  ProgramBinaryArchive(const ProgramBinaryArchive&)            = delete;
+  ProgramBinaryArchive& operator=(const ProgramBinaryArchive&) = delete;
+
+private:
+  const std::string                      mPath;
+  const uint64_t                         mDriverIdentity;
+  std::unordered_map<uint64_t, Entry>    mIndex;
+  std::unordered_map<uint64_t, uint32_t> mRejectedChecksums; ///< The checksums of the binaries rejected by the driver, by key
+  Statistics                             mStatistics;
+  const uint8_t*                         mMappedData{nullptr}; ///< The mapped archive
+  size_t                                 mMappedSize{0u};
+  size_t                                 mIndexedSize{0u};       ///< The size of the archive up to the end of the last indexed entry
+  int                                    mFileDescriptor{-1};
+  bool                                   mHasValidHeader{false}; ///< Whether the archive was created by the same driver
+  bool                                   mMayHaveGrown{false};   ///< Whether the archive may have grown since it was last mapped
+};
+
+} // namespace Dali::Graphics::GLES
+
+#endif // DALI_GRAPHICS_GLES_PROGRAM_BINARY_ARCHIVE_H
@@ -0,0 +1,409 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "gles-program-precompile-engine.h"
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/thread-settings.h>
+#include <dali/devel-api/threading/thread.h>
+#include <dali/integration-api/debug.h>
+#include <dali/integration-api/gl-abstraction.h>
+#include <dali/integration-api/gl-defines.h>
+#include <algorithm>
+#include <string>
+
+// INTERNAL INCLUDES
+#include <dali/internal/graphics/gles/egl-graphics.h>
+#include "egl-graphics-controller.h"
+#include "gles-graphics-program.h"
+#include "gles-graphics-shader.h"
+
+namespace Dali::Graphics::GLES
+{
+namespace
+{
+constexpr GLenum   COMPLETION_STATUS_KHR       = 0x91B1;      ///< From GL_KHR_parallel_shader_compile
+constexpr GLuint   MAX_SHADER_COMPILER_THREADS = 0xFFFFFFFFu; ///< Lets the driver choose the number of threads
+constexpr uint32_t FRAME_TIME_BUDGET_US        = 2000u;       ///< The time to complete the linked programs at each frame
+
+GLenum GetShaderType(PipelineStage stage)
+{
+  switch(stage)
+  {
+    case PipelineStage::VERTEX_SHADER:
+    {
+      return GL_VERTEX_SHADER;
+    }
+    case PipelineStage::FRAGMENT_SHADER:
+    {
+      return GL_FRAGMENT_SHADER;
+    }
+    default:
+    {
+      return 0u;
+    }
+  }
+}
+
+} // namespace
+
+/**
+ * @brief A program compiled and linked in the background
+ */
+struct ProgramPrecompileEngine::Job
+{
+  enum class State
+  {
+    QUEUED,    ///< Waiting for the thread
+    COMPILING, ///< Being compiled and linked
+    LINKED     ///< Linked, or its link is issued in PARALLEL_SHADER_COMPILE mode
+  };
+
+  /**
+   * @brief A shader of the program
+   */
+  struct Shader
+  {
+    GLenum      type;
+    std::string source;
+    uint32_t    glShader;
+  };
+
+  ProgramImpl*        program;
+  uint32_t            glProgram;
+  std::vector<Shader> shaders;
+  State               state;
+};
+
+/**
+ * @brief The thread compiling the programs in SHARED_CONTEXT_THREAD mode
+ */
+class ProgramPrecompileEngine::Worker : public Dali::Thread
+{
+public:
+  explicit Worker(ProgramPrecompileEngine& engine)
+  : mEngine(engine)
+  {
+  }
+
+protected:
+  void Run() override
+  {
+    SetThreadName("ProgramPrecompileThread");
+    mEngine.RunWorker();
+  }
+
+private:
+  ProgramPrecompileEngine& mEngine;
+};
+
+/**
+ * @brief The EGL context of the thread, shared with the resource context
+ */
+struct ProgramPrecompileEngine::SharedContext
+{
+  Internal::Adaptor::EglImplementation& eglImplementation;
+  EGLContext                            eglContext{EGL_NO_CONTEXT};
+  std::unique_ptr<Worker>               worker{nullptr};
+};
+
+std::unique_ptr<ProgramPrecompileEngine> ProgramPrecompileEngine::New(EglGraphicsController& controller)
+{
+  auto* glImplementation = dynamic_cast<Internal::Adaptor::GlImplementation*>(controller.GetGL());
+  if(glImplementation && glImplementation->IsParallelShaderCompileSupported())
+  {
+    glImplementation->MaxShaderCompilerThreads(MAX_SHADER_COMPILER_THREADS);
+    DALI_LOG_RELEASE_INFO("Precompile programs with GL_KHR_parallel_shader_compile\n");
+    return std::unique_ptr<ProgramPrecompileEngine>(new ProgramPrecompileEngine(controller, Mode::PARALLEL_SHADER_COMPILE));
+  }
+
+  // The thread needs a context without surface, sharing the programs with the resource context.
+  auto* eglGraphics = dynamic_cast<Internal::Adaptor::EglGraphics*>(controller.GetGraphicsInterface());
+  if(eglGraphics && eglGraphics->IsResourceContextSupported() && eglGraphics->GetEglImplementation().IsSurfacelessContextSupported())
+  {
+    auto& eglImplementation = eglGraphics->GetEglImplementation();
+
+    EGLContext eglContext{EGL_NO_CONTEXT};
+    if(eglImplementation.CreateOffscreenContext(eglContext))
+    {
+      DALI_LOG_RELEASE_INFO("Precompile programs on a thread with a shared context\n");
+      std::unique_ptr<ProgramPrecompileEngine> engine(new ProgramPrecompileEngine(controller, Mode::SHARED_CONTEXT_THREAD));
+      engine->mSharedContext.reset(new SharedContext{eglImplementation, eglContext});
+      engine->mSharedContext->worker = std::make_unique<Worker>(*engine);
+      engine->mSharedContext->worker->Start();
+      return engine;
+    }
+  }
+
+  DALI_LOG_RELEASE_INFO("Programs can't be compiled in the background. Precompile them on the render thread\n");
+  return nullptr;
+}
+
+ProgramPrecompileEngine::ProgramPrecompileEngine(EglGraphicsController& controller, Mode mode)
+: mController(controller),
+  mMode(mode),
+  mStartTime(std::chrono::steady_clock::now())
+{
+}
+
+ProgramPrecompileEngine::~ProgramPrecompileEngine()
+{
+  if(mSharedContext)
+  {
+    {
+      ConditionalWait::ScopedLock lock(mConditionalWait);
+      mStopWorker = true;
+      mConditionalWait.Notify(lock);
+    }
+    mSharedContext->worker->Join();
+    mSharedContext->eglImplementation.DestroyContext(mSharedContext->eglContext);
+  }
+
+  // Only at shutdown : the programs not completed yet are left unlinked.
+  auto* gl = mController.GetGL();
+  for(auto&& job : mJobs)
+  {
+    job->program->CancelCreate();
+    for(auto&& shader : job->shaders)
+    {
+      if(gl && shader.glShader)
+      {
+        gl->DeleteShader(shader.glShader);
+      }
+    }
+  }
+
+  const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - mStartTime);
+  DALI_LOG_RELEASE_INFO("Precompiled %u programs in the background in %lld ms, %zu not completed\n", mProgramCount, static_cast<long long>(duration.count()), mJobs.size());
+}
+
+bool ProgramPrecompileEngine::Add(ProgramImpl& program)
+{
+  auto job       = std::make_unique<Job>();
+  job->program   = &program;
+  job->glProgram = program.GetGlProgram();
+  job->state     = Job::State::QUEUED;
+
+  for(const auto& state : *program.GetCreateInfo().shaderState)
+  {
+    const auto* shader = static_cast<const GLES::Shader*>(state.shader)->GetImplementation();
+    const auto  type   = GetShaderType(shader->GetCreateInfo().pipelineStage);
+    const auto  source = shader->GetSourceCode();
+    if(!type || source.empty())
+    {
+      return false;
+    }
+    job->shaders.push_back({type, std::string(source), 0u});
+  }
+
+  if(mMode == Mode::PARALLEL_SHADER_COMPILE)
+  {
+    // Only issued : the driver compiles and links on its own threads.
+    CompileAndLink(*job);
+    job->state = Job::State::LINKED;
+  }
+
+  ConditionalWait::ScopedLock lock(mConditionalWait);
+  mJobs.push_back(std::move(job));
+  ++mProgramCount;
+  mConditionalWait.Notify(lock);
+  return true;
+}
+
+bool ProgramPrecompileEngine::IsLinked(const ProgramImpl& program)
+{
+  ConditionalWait::ScopedLock lock(mConditionalWait);
+
+  auto iter = std::find_if(mJobs.begin(), mJobs.end(), [&program](const std::unique_ptr<Job>& job) { return job->program == &program; });
+  if(iter == mJobs.end() || (*iter)->state != Job::State::LINKED)
+  {
+    return false;
+  }
+
+  if(mMode == Mode::PARALLEL_SHADER_COMPILE)
+  {
+    GLint completed{GL_FALSE};
+    mController.GetGL()->GetProgramiv((*iter)->glProgram, COMPLETION_STATUS_KHR, &completed);
+    return completed == GL_TRUE;
+  }
+  return true;
+}
+
+void ProgramPrecompileEngine::Finish(const ProgramImpl& program)
+{
+  std::unique_ptr<Job> job;
+  {
+    ConditionalWait::ScopedLock lock(mConditionalWait);
+
+    auto findJob = [this, &program]() { return std::find_if(mJobs.begin(), mJobs.end(), [&program](const std::unique_ptr<Job>& job) { return job->program == &program; }); };
+
+    auto iter = findJob();
+    if(iter == mJobs.end())
+    {
+      return;
+    }
+
+    if((*iter)->state == Job::State::QUEUED)
+    {
+      // Needed now : rather than waiting behind the queue, compile it here.
+      job = std::move(*iter);
+      mJobs.erase(iter);
+    }
+    else
+    {
+      while((*iter)->state == Job::State::COMPILING)
+      {
+        mConditionalWait.Wait(lock);
+        iter = findJob();
+      }
+      job = std::move(*iter);
+      mJobs.erase(iter);
+    }
+  }
+
+  auto* gl = mController.GetGL();
+  if(DALI_UNLIKELY(!gl))
+  {
+    return;
+  }
+
+  if(job->state == Job::State::QUEUED)
+  {
+    CompileAndLink(*job);
+  }
+
+  for(auto&& shader : job->shaders)
+  {
+    if(!shader.glShader)
+    {
+      continue;
+    }
+
+    GLint status{GL_FALSE};
+    gl->GetShaderiv(shader.glShader, GL_COMPILE_STATUS, &status);
+    if(status != GL_TRUE)
+    {
+      char    output[4096];
+      GLsizei outputSize{0u};
+      gl->GetShaderInfoLog(shader.glShader, 4096, &outputSize, output);
+      DALI_LOG_ERROR("glCompileShader() failed: \n%s\n", output);
+    }
+
+    // The program keeps its executable.
+    gl->DetachShader(job->glProgram, shader.glShader);
+    gl->DeleteShader(shader.glShader);
+  }
+}
+
+void ProgramPrecompileEngine::ProcessLinkedPrograms()
+{
+  const auto startTime = std::chrono::steady_clock::now();
+
+  std::vector<ProgramImpl*> programs;
+  {
+    ConditionalWait::ScopedLock lock(mConditionalWait);
+    for(auto&& job : mJobs)
+    {
+      if(job->state == Job::State::LINKED)
+      {
+        programs.push_back(job->program);
+      }
+    }
+  }
+
+  for(auto&& program : programs)
+  {
+    if(!IsLinked(*program))
+    {
+      continue;
+    }
+
+    program->FinishCreate();
+    if(std::chrono::steady_clock::now() - startTime > std::chrono::microseconds(FRAME_TIME_BUDGET_US))
+    {
+      break;
+    }
+  }
+}
+
+bool ProgramPrecompileEngine::IsEmpty() const
+{
+  ConditionalWait::ScopedLock lock(mConditionalWait);
+  return mJobs.empty();
+}
+
+void ProgramPrecompileEngine::CompileAndLink(Job& job)
+{
+  auto* gl = mController.GetGL();
+  for(auto&& shader : job.shaders)
+  {
+    const char* source = shader.source.c_str();
+    const GLint size   = static_cast<GLint>(shader.source.size());
+
+    shader.glShader = gl->CreateShader(shader.type);
+    gl->ShaderSource(shader.glShader, 1, &source, &size);
+    gl->CompileShader(shader.glShader);
+    gl->AttachShader(job.glProgram, shader.glShader);
+  }
+  gl->LinkProgram(job.glProgram);
+}
+
+void ProgramPrecompileEngine::RunWorker()
+{
+  auto& eglImplementation = mSharedContext->eglImplementation;
+  eglMakeCurrent(eglImplementation.GetDisplay(), EGL_NO_SURFACE, EGL_NO_SURFACE, mSharedContext->eglContext);
+
+  auto* gl = mController.GetGL();
+  while(true)
+  {
+    Job* job = nullptr;
+    {
+      ConditionalWait::ScopedLock lock(mConditionalWait);
+      while(!mStopWorker && !job)
+      {
+        auto iter = std::find_if(mJobs.begin(), mJobs.end(), [](const std::unique_ptr<Job>& job) { return job->state == Job::State::QUEUED; });
+        if(iter != mJobs.end())
+        {
+          job        = iter->get();
+          job->state = Job::State::COMPILING;
+        }
+        else
+        {
+          mConditionalWait.Wait(lock);
+        }
+      }
+    }
+    if(!job)
+    {
+      break;
+    }
+
+    CompileAndLink(*job);
+
+    // The program is used by the other contexts only once the link is done.
+    gl->Finish();
+
+    ConditionalWait::ScopedLock lock(mConditionalWait);
+    job->state = Job::State::LINKED;
+    mConditionalWait.Notify(lock);
+  }
+
+  eglMakeCurrent(eglImplementation.GetDisplay(), EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+}
+
+} // namespace Dali::Graphics::GLES
@@ -0,0 +1,158 @@
+#ifndef DALI_GRAPHICS_GLES_PROGRAM_PRECOMPILE_ENGINE_H
+#define DALI_GRAPHICS_GLES_PROGRAM_PRECOMPILE_ENGINE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/threading/conditional-wait.h>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Dali::Graphics
+{
+class EglGraphicsController;
+
+namespace GLES
+{
+class ProgramImpl;
+
+/**
+ * @brief Compiles and links the precompiled programs without blocking the render thread.
+ *
+ * With GL_KHR_parallel_shader_compile, the compilation and the link of every program are issued
+ * at once, and the driver does them on its own threads. Their completion is polled with
+ * GL_COMPLETION_STATUS_KHR, which never blocks.
+ *
+ * Without the extension, the programs are compiled and linked one by one on a dedicated thread,
+ * in an EGL context shared with the resource context.
+ *
+ * At each frame the render thread completes the linked programs (link status, reflection, program binary)
+ * within a time budget. A program used before it is linked is completed at once.
+ *
+ * The engine is only used on the render thread, apart from its own thread.
+ */
+class ProgramPrecompileEngine
+{
+public:
+  /**
+   * @brief How the programs are compiled in the background
+   */
+  enum class Mode
+  {
+    PARALLEL_SHADER_COMPILE, ///< By the driver, with GL_KHR_parallel_shader_compile
+    SHARED_CONTEXT_THREAD    ///< On the thread of the engine, in a shared EGL context
+  };
+
+  /**
+   * @brief Creates the engine, if the programs can be compiled in the background.
+   *
+   * @param[in] controller The graphics controller
+   * @return The engine, or nullptr if neither the extension nor a surfaceless shared context is available
+   */
+  static std::unique_ptr<ProgramPrecompileEngine> New(EglGraphicsController& controller);
+
+  /**
+   * @brief Destructor. Stops the thread. The programs which are not completed yet are left unlinked.
+   */
+  ~ProgramPrecompileEngine();
+
+  /**
+   * @brief Retrieves how the programs are compiled.
+   */
+  Mode GetMode() const
+  {
+    return mMode;
+  }
+
+  /**
+   * @brief Starts compiling and linking a program in the background.
+   *
+   * @param[in] program The program, whose GL program is created and whose shaders are preprocessed
+   * @return false if the program has a stage which can't be compiled in the background
+   */
+  bool Add(ProgramImpl& program);
+
+  /**
+   * @brief Checks whether the link of a program is done, without blocking.
+   *
+   * @param[in] program A program added to the engine
+   * @return true if the program can be completed without waiting
+   */
+  bool IsLinked(const ProgramImpl& program);
+
+  /**
+   * @brief Waits for the link of a program, and releases its shaders. The compilation errors are logged.
+   *
+   * @param[in] program A program added to the engine. It is removed from the engine.
+   */
+  void Finish(const ProgramImpl& program);
+
+  /**
+   * @brief Completes the linked programs, for as long as the frame budget allows.
+   */
+  void ProcessLinkedPrograms();
+
+  /**
+   * @brief Checks whether every program added to the engine is completed.
+   */
+  bool IsEmpty() const;
+
+private:
+  struct Job;
+  struct SharedContext;
+  class Worker;
+
+  /**
+   * @brief Constructor
+   * @param[in] controller The graphics controller
+   * @param[in] mode How the programs are compiled
+   */
+  ProgramPrecompileEngine(EglGraphicsController& controller, Mode mode);
+
+  /**
+   * @brief Compiles the shaders of a job, and links its program.
+   * @param[in] job The job
+   */
+  void CompileAndLink(Job& job);
+
+  /**
+   * @brief The loop of the thread of the engine.
+   */
+  void RunWorker();
+
+  ProgramPrecompileEngine(const ProgramPrecompileEngine&)            = delete;
+  ProgramPrecompileEngine& operator=(const ProgramPrecompileEngine&) = delete;
+
+private:
+  EglGraphicsController&                mController;
+  const Mode                            mMode;
+  mutable ConditionalWait               mConditionalWait; ///< Guards the jobs, shared with the thread
+  std::vector<std::unique_ptr<Job>>     mJobs;            ///< The programs not completed yet, in the order they were added
+  std::unique_ptr<SharedContext>        mSharedContext;   ///< The thread and its context, in SHARED_CONTEXT_THREAD mode
+  std::chrono::steady_clock::time_point mStartTime;
+  uint32_t                              mProgramCount{0u}; ///< The number of programs added
+  bool                                  mStopWorker{false};
+};
+
+} // namespace GLES
+
+} // namespace Dali::Graphics
+
+#endif // DALI_GRAPHICS_GLES_PROGRAM_PRECOMPILE_ENGINE_H
@@ -0,0 +1,138 @@
+#ifndef DALI_GRAPHICS_GLES_REUSABLE_QUEUE_H
+#define DALI_GRAPHICS_GLES_REUSABLE_QUEUE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Dali::Graphics
+{
+namespace GLES
+{
+/**
+ * @brief FIFO queue that keeps its storage when it is drained.
+ *
+ * Drop-in replacement of std::queue for the queues the controller fills and drains every frame.
+ * std::queue (std::deque) frees and allocates its blocks as items go through it, whereas this
+ * queue stops allocating once it has grown to the largest number of items it held.
+ */
+template<class T>
+class ReusableQueue
+{
+public:
+  ReusableQueue() = default;
+
+  bool empty() const
+  {
+    return mHead == mItems.size();
+  }
+
+  std::size_t size() const
+  {
+    return mItems.size() - mHead;
+  }
+
+  T& front()
+  {
+    return mItems[mHead];
+  }
+
+  const T& front() const
+  {
+    return mItems[mHead];
+  }
+
+  T& back()
+  {
+    return mItems.back();
+  }
+
+  const T& back() const
+  {
+    return mItems.back();
+  }
+
+  void push(const T& value)
+  {
+    MakeRoom();
+    mItems.push_back(value);
+  }
+
+  void push(T&& value)
+  {
+    MakeRoom();
+    mItems.push_back(std::move(value));
+  }
+
+  template<class... Args>
+  T& emplace(Args&&... args)
+  {
+    MakeRoom();
+    return mItems.emplace_back(std::forward<Args>(args)...);
+  }
+
+  void pop()
+  {
+    mItems[mHead++] = T(); // Release what the item holds now, not when the queue is drained.
+    if(mHead == mItems.size())
+    {
+      // clear() keeps the capacity.
+      mItems.clear();
+      mHead = 0u;
+    }
+  }
+
+  void swap(ReusableQueue& other) noexcept
+  {
+    mItems.swap(other.mItems);
+    std::swap(mHead, other.mHead);
+  }
+
+  /**
+   * @brief Retrieves the number of items the queue can hold without allocating.
+   */
+  std::size_t capacity() const
+  {
+    return mItems.capacity();
+  }
+
+private:
+  /**
+   * @brief Moves the queued items over the popped ones rather than growing the storage.
+   */
+  void MakeRoom()
+  {
+    if(mHead != 0u && mItems.size() == mItems.capacity())
+    {
+      mItems.erase(mItems.begin(), mItems.begin() + mHead);
+      mHead = 0u;
+    }
+  }
+
+private:
+  std::vector<T> mItems;
+  std::size_t    mHead{0u}; ///< Index of the front item in mItems
+};
+
+} // namespace GLES
+} // namespace Dali::Graphics
+
+#endif // DALI_GRAPHICS_GLES_REUSABLE_QUEUE_H
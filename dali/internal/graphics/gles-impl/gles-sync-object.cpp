@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,9 +18,13 @@
 #include <dali/internal/graphics/gles-impl/gles-sync-object.h>
 
 // EXTERNAL HEADERS
+#include <dali/integration-api/debug.h>
+#include <dali/integration-api/gl-defines.h>
+#include <cstring>
 
 // INTERNAL HEADERS
 #include <dali/internal/graphics/gles-impl/egl-graphics-controller.h>
+#include <dali/internal/graphics/gles-impl/gles-graphics-framebuffer.h>
 
 namespace Dali::Graphics::GLES
 {
@@ -45,6 +49,8 @@ void SyncObject::DestroyResource()
     }
     mGlSyncObject = 0;
   }
+
+  ReleaseReadback();
 }
 
 bool SyncObject::InitializeResource()
@@ -70,9 +76,104 @@ bool SyncObject::IsSynced()
   if(DALI_LIKELY(gl) && mGlSyncObject)
   {
     GLenum result = gl->ClientWaitSync(mGlSyncObject, 0, 0ull);
-    return result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+    return (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED) && CompleteReadback();
   }
   return false;
 }
 
+void SyncObject::SetPendingReadback(GLES::Framebuffer& framebuffer, uint32_t packBuffer, uint8_t* destination, uint32_t size)
+{
+  ReleaseReadback();
+
+  auto* gl = mController.GetGL();
+  if(DALI_LIKELY(gl))
+  {
+    mReadbackBuffer      = packBuffer;
+    mReadbackDestination = destination;
+    mReadbackSize        = size;
+    mReadbackFramebuffer = &framebuffer;
+    mReadbackSyncObject  = gl->FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    framebuffer.AddPendingReadback(this);
+
+    // Make sure the read is submitted, so the fence can be signalled without another flush.
+    gl->Flush();
+  }
+}
+
+bool SyncObject::CompleteReadback()
+{
+  if(!mReadbackBuffer)
+  {
+    return true;
+  }
+
+  auto* gl = mController.GetGL();
+  if(DALI_UNLIKELY(!gl))
+  {
+    return false;
+  }
+
+  if(mReadbackSyncObject)
+  {
+    GLenum result = gl->ClientWaitSync(mReadbackSyncObject, 0, 0ull);
+    if(result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED)
+    {
+      return false;
+    }
+  }
+
+  gl->BindBuffer(GL_PIXEL_PACK_BUFFER, mReadbackBuffer);
+  auto* pixels = gl->MapBufferRange(GL_PIXEL_PACK_BUFFER, 0, mReadbackSize, GL_MAP_READ_BIT);
+  if(DALI_LIKELY(pixels))
+  {
+    memcpy(mReadbackDestination, pixels, mReadbackSize);
+    gl->UnmapBuffer(GL_PIXEL_PACK_BUFFER);
+  }
+  else
+  {
+    DALI_LOG_ERROR("Failed to map the pixel pack buffer of a readback\n");
+  }
+  gl->BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+  ReleaseReadback();
+  return true;
+}
+
+void SyncObject::CancelReadback()
+{
+  // The framebuffer has already forgotten this readback.
+  mReadbackFramebuffer = nullptr;
+  ReleaseReadback();
+}
+
+void SyncObject::ReleaseReadback()
+{
+  if(mReadbackFramebuffer)
+  {
+    mReadbackFramebuffer->RemovePendingReadback(this);
+  }
+
+  if((mReadbackBuffer || mReadbackSyncObject) && DALI_LIKELY(!EglGraphicsController::IsShuttingDown()))
+  {
+    auto* gl = mController.GetGL();
+    if(DALI_LIKELY(gl))
+    {
+      if(mReadbackSyncObject)
+      {
+        gl->DeleteSync(mReadbackSyncObject);
+      }
+      if(mReadbackBuffer)
+      {
+        gl->DeleteBuffers(1, &mReadbackBuffer);
+      }
+    }
+  }
+  mReadbackSyncObject  = nullptr;
+  mReadbackBuffer      = 0u;
+  mReadbackDestination = nullptr;
+  mReadbackSize        = 0u;
+  mReadbackFramebuffer = nullptr;
+}
+
 } // namespace Dali::Graphics::GLES
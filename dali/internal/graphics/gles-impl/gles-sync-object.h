@@ -2,7 +2,7 @@
 #define DALI_GRAPHICS_GLES_SYNC_OBJECT_H
 
 /*
- * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -33,6 +33,7 @@ class EglSyncObject;
 
 namespace Dali::Graphics::GLES
 {
+class Framebuffer;
 using SyncObjectResource = Resource<Graphics::SyncObject, Graphics::SyncObjectCreateInfo>;
 
 /**
@@ -78,8 +79,51 @@ public:
    */
   bool IsSynced() override;
 
+  /**
+   * @brief Attaches an asynchronous read of the framebuffer that was rendered before this sync object.
+   *
+   * The pixels are read into a pixel pack buffer without waiting for the GPU. IsSynced() then only
+   * returns true once the read has completed too, after copying the pixels into the destination.
+   * Takes ownership of the pack buffer.
+   *
+   * The destination belongs to the client of the framebuffer, so the read is cancelled if the
+   * framebuffer is discarded before it completes.
+   *
+   * @param[in] framebuffer The framebuffer the pixels are read from
+   * @param[in] packBuffer The GL name of the pixel pack buffer the pixels are read into
+   * @param[in] destination The client memory to copy the pixels to
+   * @param[in] size The size of the pixels in bytes
+   */
+  void SetPendingReadback(GLES::Framebuffer& framebuffer, uint32_t packBuffer, uint8_t* destination, uint32_t size);
+
+  /**
+   * @brief Cancels the pending readback without copying the pixels, e.g. when its framebuffer is discarded.
+   *
+   * IsSynced() then only waits for the render pass again.
+   */
+  void CancelReadback();
+
+private:
+  /**
+   * @brief Copies the pixels of the pending readback to the destination, once the read has completed.
+   *
+   * @return True if there is no readback pending anymore
+   */
+  bool CompleteReadback();
+
+  /**
+   * @brief Deletes the GL objects of the pending readback.
+   */
+  void ReleaseReadback();
+
 private:
   GLsync mGlSyncObject;
+
+  GLsync             mReadbackSyncObject{nullptr}; ///< Signalled when the pixels are in mReadbackBuffer
+  GLuint             mReadbackBuffer{0u};          ///< The pixel pack buffer of the pending readback, or 0
+  uint8_t*           mReadbackDestination{nullptr};
+  uint32_t           mReadbackSize{0u};
+  GLES::Framebuffer* mReadbackFramebuffer{nullptr}; ///< The framebuffer the pixels are read from, which knows about this readback
 };
 
 } // namespace Dali::Graphics::GLES
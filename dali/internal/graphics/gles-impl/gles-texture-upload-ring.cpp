@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "gles-texture-upload-ring.h"
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <dali/integration-api/gl-defines.h>
+
+// INTERNAL INCLUDES
+#include "egl-graphics-controller.h"
+
+namespace Dali::Graphics::GLES
+{
+namespace
+{
+constexpr uint32_t ALLOCATION_ALIGNMENT = 16u; ///< Keeps each upload aligned for any pixel type
+} // namespace
+
+TextureUploadRing::TextureUploadRing(EglGraphicsController& controller)
+: mController(controller)
+{
+}
+
+uint8_t* TextureUploadRing::Allocate(uint32_t size, uint32_t& offset)
+{
+  const uint32_t alignedOffset = (mOffset + ALLOCATION_ALIGNMENT - 1u) & ~(ALLOCATION_ALIGNMENT - 1u);
+  if(size == 0u || alignedOffset > BUFFER_SIZE || size > BUFFER_SIZE - alignedOffset)
+  {
+    return nullptr;
+  }
+
+  auto* gl = mController.GetGL();
+  if(DALI_UNLIKELY(!gl))
+  {
+    return nullptr;
+  }
+
+  if(!mMappedPointer)
+  {
+    uint32_t& buffer = mBuffers[mCurrentIndex];
+    if(buffer == 0u)
+    {
+      gl->GenBuffers(1, &buffer);
+      gl->BindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+      gl->BufferData(GL_PIXEL_UNPACK_BUFFER, BUFFER_SIZE, nullptr, GL_STREAM_DRAW);
+    }
+    else
+    {
+      gl->BindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+    }
+
+    // Invalidating lets the driver hand out fresh memory if the GPU still reads the old contents.
+    mMappedPointer = reinterpret_cast<uint8_t*>(gl->MapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, BUFFER_SIZE, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+
+    // Unbind, so other texture uploads keep reading from client memory.
+    gl->BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    if(DALI_UNLIKELY(!mMappedPointer))
+    {
+      DALI_LOG_ERROR("Failed to map the texture upload buffer\n");
+      return nullptr;
+    }
+  }
+
+  offset  = alignedOffset;
+  mOffset = alignedOffset + size;
+  return mMappedPointer + alignedOffset;
+}
+
+uint32_t TextureUploadRing::Unmap()
+{
+  const uint32_t buffer = mBuffers[mCurrentIndex];
+  if(mMappedPointer)
+  {
+    if(auto* gl = mController.GetGL())
+    {
+      gl->BindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+      gl->UnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+      gl->BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+    mMappedPointer = nullptr;
+  }
+  return (mOffset != 0u) ? buffer : 0u;
+}
+
+void TextureUploadRing::Advance()
+{
+  if(mOffset != 0u)
+  {
+    mCurrentIndex = (mCurrentIndex + 1u) % BUFFER_COUNT;
+    mOffset       = 0u;
+  }
+}
+
+} // namespace Dali::Graphics::GLES
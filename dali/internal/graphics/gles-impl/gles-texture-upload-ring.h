@@ -0,0 +1,101 @@
+#ifndef DALI_GRAPHICS_GLES_TEXTURE_UPLOAD_RING_H
+#define DALI_GRAPHICS_GLES_TEXTURE_UPLOAD_RING_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/gl-abstraction.h>
+#include <array>
+#include <cstdint>
+
+namespace Dali::Graphics
+{
+class EglGraphicsController;
+
+namespace GLES
+{
+/**
+ * @brief Ring of pixel unpack buffers used to stage texture uploads on GLES3.
+ *
+ * UpdateTextures() copies the pixels of a MEMORY upload straight into the mapped buffer,
+ * rather than into a malloc'd copy, and the texture is later uploaded from the buffer.
+ * Each buffer is mapped once per batch of uploads and sub-allocated linearly, then unmapped
+ * when the batch is processed. The next batch uses the next buffer of the ring, so a buffer
+ * the GPU may still read from isn't written to straight away.
+ *
+ * All the methods must be called on the render thread, with a GLES3 context current.
+ */
+class TextureUploadRing
+{
+public:
+  static constexpr uint32_t BUFFER_COUNT = 3u;                 ///< The number of buffers in the ring
+  static constexpr uint32_t BUFFER_SIZE  = 4u * 1024u * 1024u; ///< The size of each buffer in bytes
+
+  /**
+   * @brief Constructor
+   * @param[in] controller The graphics controller
+   */
+  explicit TextureUploadRing(EglGraphicsController& controller);
+
+  /**
+   * @brief Destructor. The buffers are released with the GL context.
+   */
+  ~TextureUploadRing() = default;
+
+  /**
+   * @brief Allocates staging memory for a texture upload in the current buffer.
+   *
+   * @param[in] size The number of bytes
+   * @param[out] offset The offset of the memory in the buffer, to upload from
+   * @return The mapped memory to write the pixels to, or nullptr if the current buffer has no room
+   */
+  uint8_t* Allocate(uint32_t size, uint32_t& offset);
+
+  /**
+   * @brief Unmaps the current buffer, before the texture uploads read from it.
+   *
+   * Allocate() must not be called again until Advance() is called.
+   * @return The GL name of the buffer, or 0 if nothing was allocated since the last call to Advance()
+   */
+  uint32_t Unmap();
+
+  /**
+   * @brief Moves to the next buffer of the ring, once the uploads from the current one are issued.
+   */
+  void Advance();
+
+  /**
+   * @brief Checks whether some memory was allocated from the current buffer.
+   */
+  bool HasPendingUploads() const
+  {
+    return mOffset != 0u;
+  }
+
+private:
+  EglGraphicsController&             mController;
+  std::array<uint32_t, BUFFER_COUNT> mBuffers{};              ///< GL names of the buffers, created on first use
+  uint8_t*                           mMappedPointer{nullptr}; ///< The mapped memory of the current buffer
+  uint32_t                           mCurrentIndex{0u};       ///< Index of the current buffer in mBuffers
+  uint32_t                           mOffset{0u};             ///< The allocated bytes of the current buffer
+};
+
+} // namespace GLES
+} // namespace Dali::Graphics
+
+#endif // DALI_GRAPHICS_GLES_TEXTURE_UPLOAD_RING_H
@@ -525,6 +525,16 @@ void EglGraphics::LogMemoryPools()
     graphicsCapacity);
 }
 
+void EglGraphics::BeginProgramPrecompile()
+{
+  mGraphicsController.BeginProgramPrecompile();
+}
+
+void EglGraphics::EndProgramPrecompile()
+{
+  mGraphicsController.EndProgramPrecompile();
+}
+
 } // namespace Adaptor
 } // namespace Internal
 } // namespace Dali
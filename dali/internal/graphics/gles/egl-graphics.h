@@ -332,6 +332,16 @@ public:
    */
   void LogMemoryPools() override;
 
+  /**
+   * @copydoc Dali::Graphics::GraphicsInterface::BeginProgramPrecompile()
+   */
+  void BeginProgramPrecompile() override;
+
+  /**
+   * @copydoc Dali::Graphics::GraphicsInterface::EndProgramPrecompile()
+   */
+  void EndProgramPrecompile() override;
+
 public:
   // Eliminate copy and assigned operations
   EglGraphics(const EglGraphics& rhs)            = delete;
@@ -39,6 +39,7 @@ namespace Adaptor
 namespace
 {
 static constexpr const char* KHR_BLEND_EQUATION_ADVANCED = "GL_KHR_blend_equation_advanced";
+static constexpr const char* KHR_PARALLEL_SHADER_COMPILE = "GL_KHR_parallel_shader_compile";
 
 #ifndef DALI_PROFILE_UBUNTU
 static constexpr const char* EXT_MULTISAMPLED_RENDER_TO_TEXTURE = "GL_EXT_multisampled_render_to_texture";
@@ -72,6 +73,8 @@ void GlExtensionSupportedCacheList::EnsureGlExtensionSupportedCheck()
     {EXT_MULTISAMPLED_RENDER_TO_TEXTURE, GlExtensionCheckerType::MULTISAMPLED_RENDER_TO_TEXTURE},
 #endif //DALI_PROFILE_UBUNTU
 
+    {KHR_PARALLEL_SHADER_COMPILE,        GlExtensionCheckerType::PARALLEL_SHADER_COMPILE       },
+
     ///< Append additional extension checker type here.
   };
   // clang-format on
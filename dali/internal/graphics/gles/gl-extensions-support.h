@@ -151,6 +151,7 @@ enum GlExtensionCheckerType
 {
   BLEND_EQUATION_ADVANCED = 0,
   MULTISAMPLED_RENDER_TO_TEXTURE,
+  PARALLEL_SHADER_COMPILE,
   ///< Append additional extension checker type here.
   EXTENSION_CHECKER_TYPE_MAX,
 };
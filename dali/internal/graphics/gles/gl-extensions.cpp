@@ -45,6 +45,9 @@ GlExtensions::GlExtensions()
 #ifdef GL_EXT_multisampled_render_to_texture
   mGlRenderbufferStorageMultisampleEXT(nullptr),
   mGlFramebufferTexture2DMultisampleEXT(nullptr),
+#endif
+#ifdef GL_KHR_parallel_shader_compile
+  mGlMaxShaderCompilerThreadsKHR(nullptr),
 #endif
   mInitialized(false)
 {
@@ -184,6 +187,26 @@ void GlExtensions::FramebufferTexture2DMultisampleEXT(GLenum target, GLenum atta
 #endif
 }
 
+bool GlExtensions::MaxShaderCompilerThreadsKHR(GLuint count)
+{
+  // initialize extension on first use as on some hw platforms a context
+  // has to be bound for the extensions to return correct pointer
+  if(DALI_UNLIKELY(!mInitialized))
+  {
+    Initialize();
+  }
+
+#ifdef GL_KHR_parallel_shader_compile
+  if(mGlMaxShaderCompilerThreadsKHR)
+  {
+    mGlMaxShaderCompilerThreadsKHR(count);
+    return true;
+  }
+#endif
+
+  return false;
+}
+
 void GlExtensions::Initialize()
 {
   mInitialized = true;
@@ -205,6 +228,10 @@ void GlExtensions::Initialize()
   mGlRenderbufferStorageMultisampleEXT  = reinterpret_cast<PFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC>(eglGetProcAddress("glRenderbufferStorageMultisampleEXT"));
   mGlFramebufferTexture2DMultisampleEXT = reinterpret_cast<PFNGLFRAMEBUFFERTEXTURE2DMULTISAMPLEEXTPROC>(eglGetProcAddress("glFramebufferTexture2DMultisampleEXT"));
 #endif
+
+#ifdef GL_KHR_parallel_shader_compile
+  mGlMaxShaderCompilerThreadsKHR = reinterpret_cast<PFNGLMAXSHADERCOMPILERTHREADSKHRPROC>(eglGetProcAddress("glMaxShaderCompilerThreadsKHR"));
+#endif
 }
 
 } // namespace Adaptor
@@ -113,6 +113,15 @@ public:
    */
   void FramebufferTexture2DMultisampleEXT(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLsizei samples);
 
+  /**
+   * KHR extension
+   * Specify the number of threads the driver may use to compile shaders and link programs in the background.
+   *
+   * @param[in] count The number of threads. 0 disables the background compilation, 0xFFFFFFFF lets the driver choose.
+   * @return true if the extension is available
+   */
+  bool MaxShaderCompilerThreadsKHR(GLuint count);
+
 private:
   /**
    * Lazy Initialize extensions on first use
@@ -137,6 +146,10 @@ private:
   PFNGLFRAMEBUFFERTEXTURE2DMULTISAMPLEEXTPROC mGlFramebufferTexture2DMultisampleEXT;
 #endif
 
+#ifdef GL_KHR_parallel_shader_compile
+  PFNGLMAXSHADERCOMPILERTHREADSKHRPROC mGlMaxShaderCompilerThreadsKHR;
+#endif
+
   bool mInitialized;
 };
 
@@ -130,6 +130,36 @@ public:
     return mGlExtensionSupportedCacheList.IsSupported(type);
   }
 
+  /**
+   * @brief Checks whether shaders can be compiled and programs linked in the background,
+   * with their completion polled by GL_COMPLETION_STATUS_KHR.
+   */
+  bool IsParallelShaderCompileSupported()
+  {
+    ConditionalWait::ScopedLock lock(mContextCreatedWaitCondition);
+
+    const auto type = GlExtensionCache::GlExtensionCheckerType::PARALLEL_SHADER_COMPILE;
+    if(!mIsContextCreated && !mGlExtensionSupportedCacheList.IsCached(type))
+    {
+      mContextCreatedWaitCondition.Wait(lock);
+    }
+    return mGlExtensionSupportedCacheList.IsSupported(type);
+  }
+
+  /**
+   * @brief Sets the number of threads the driver may use to compile shaders in the background.
+   * @param[in] count The number of threads. 0xFFFFFFFF lets the driver choose
+   * @return true if the extension is available
+   */
+  bool MaxShaderCompilerThreads(GLuint count)
+  {
+    if(mGlExtensionSupportedCacheList.IsSupported(GlExtensionCache::GlExtensionCheckerType::PARALLEL_SHADER_COMPILE))
+    {
+      return mImpl->MaxShaderCompilerThreads(count);
+    }
+    return false;
+  }
+
   bool IsBlendEquationSupported(BlendEquation::Type blendEquation) override
   {
     switch(blendEquation)
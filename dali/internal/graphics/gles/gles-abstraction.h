@@ -243,6 +243,8 @@ public:
   virtual void GetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint* params) = 0;
 
   virtual void BlendBarrier(void) = 0;
+
+  virtual bool MaxShaderCompilerThreads(GLuint count) = 0;
 };
 
 } // namespace Adaptor
@@ -618,6 +618,11 @@ public:
     DALI_LOG_ERROR("BlendBarrier is not supported in OpenGL es 2.0\n");
   }
 
+  bool MaxShaderCompilerThreads(GLuint count) override
+  {
+    return mGlExtensions.MaxShaderCompilerThreadsKHR(count);
+  }
+
 private:
   GlExtensions mGlExtensions;
 };
@@ -577,6 +577,11 @@ public:
     }
   }
 
+  bool MaxShaderCompilerThreads(GLuint count) override
+  {
+    return mGlExtensions.MaxShaderCompilerThreadsKHR(count);
+  }
+
 private:
   GlExtensions mGlExtensions;
 };
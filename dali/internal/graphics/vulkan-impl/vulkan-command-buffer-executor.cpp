@@ -56,8 +56,9 @@ CommandBufferExecutor::CommandBufferExecutor(VulkanGraphicsController& controlle
 
 CommandBufferExecutor::~CommandBufferExecutor() = default;
 
-void CommandBufferExecutor::ProcessCommandBuffer(StoredCommandBuffer* storedCommandBuffer,
-                                                 CommandBufferImpl*   commandBufferImpl)
+void CommandBufferExecutor::ProcessCommandBuffer(const StoredCommandBuffer* storedCommandBuffer,
+                                                 CommandBufferImpl*         commandBufferImpl,
+                                                 bool                       isSecondary)
 {
   auto count    = 0u;
   auto commands = storedCommandBuffer->GetCommands(count);
@@ -73,12 +74,18 @@ void CommandBufferExecutor::ProcessCommandBuffer(StoredCommandBuffer* storedComm
       }
       case Vulkan::CommandType::BEGIN:
       {
-        Begin(commandBufferImpl, cmd.begin.beginInfo);
+        if(!isSecondary)
+        {
+          Begin(commandBufferImpl, cmd.begin.beginInfo);
+        }
         break;
       }
       case Vulkan::CommandType::END:
       {
-        End(commandBufferImpl);
+        if(!isSecondary)
+        {
+          End(commandBufferImpl);
+        }
         break;
       }
       case Vulkan::CommandType::BEGIN_RENDERPASS:
@@ -229,6 +236,19 @@ void CommandBufferExecutor::ProcessCommandBuffer(StoredCommandBuffer* storedComm
         commandBufferImpl->SetColorBlendAdvanced(0, cmd.colorBlend.advanced.srcPremultiplied, cmd.colorBlend.advanced.dstPremultiplied, cmd.colorBlend.advanced.blendOp);
         break;
       }
+      case Vulkan::CommandType::EXECUTE_COMMAND_BUFFERS:
+      {
+        // Secondary command buffers may have been recorded on other threads, but are written here in order.
+        const auto* buffers = cmd.executeCommandBuffers.buffers.Ptr();
+        for(auto j = 0u; j < cmd.executeCommandBuffers.buffersCount; ++j)
+        {
+          if(const auto* secondary = buffers[j]->GetStoredCommandBuffer())
+          {
+            ProcessCommandBuffer(secondary, commandBufferImpl, true);
+          }
+        }
+        break;
+      }
     }
   }
 }
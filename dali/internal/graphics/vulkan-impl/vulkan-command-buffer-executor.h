@@ -41,7 +41,17 @@ public:
   explicit CommandBufferExecutor(VulkanGraphicsController& controller);
   ~CommandBufferExecutor();
 
-  void ProcessCommandBuffer(StoredCommandBuffer* storedCommandBuffer, CommandBufferImpl* commandBufferImpl);
+  /**
+   * @brief Writes the recorded commands to the vulkan command buffer.
+   *
+   * Secondary command buffers executed by the stored commands are played back in place, in order,
+   * into the same vulkan command buffer. Their BEGIN and END commands are skipped.
+   *
+   * @param[in] storedCommandBuffer The recorded commands
+   * @param[in] commandBufferImpl The vulkan command buffer to write to
+   * @param[in] isSecondary True if the commands are played back from a primary command buffer
+   */
+  void ProcessCommandBuffer(const StoredCommandBuffer* storedCommandBuffer, CommandBufferImpl* commandBufferImpl, bool isSecondary = false);
 
   void Begin(CommandBufferImpl* commandBufferImpl, const Graphics::CommandBufferBeginInfo& info);
 
@@ -24,10 +24,12 @@
 #include <dali/internal/graphics/vulkan-impl/vulkan-command-pool-impl.h>
 #include <dali/internal/graphics/vulkan-impl/vulkan-framebuffer-impl.h>
 #include <dali/internal/graphics/vulkan-impl/vulkan-graphics-controller.h>
+#include <dali/internal/graphics/vulkan-impl/vulkan-image-impl.h>
 #include <dali/internal/graphics/vulkan-impl/vulkan-program-impl.h>
 #include <dali/internal/graphics/vulkan-impl/vulkan-render-pass-impl.h>
 #include <dali/internal/graphics/vulkan-impl/vulkan-render-pass.h>
 #include <dali/internal/graphics/vulkan-impl/vulkan-stored-command-buffer.h>
+#include <dali/internal/graphics/vulkan-impl/vulkan-texture.h>
 #include <dali/internal/graphics/vulkan/vulkan-device.h>
 
 #include <dali/integration-api/debug.h>
@@ -110,6 +112,7 @@ void CommandBuffer::Reset()
   mCommandBufferImpl[bufferIndex]->Reset();
 
   mRenderTarget = nullptr;
+  mDeferredTextureDependencies.clear();
 }
 
 void CommandBuffer::Begin(const Graphics::CommandBufferBeginInfo& info)
@@ -202,7 +205,7 @@ void CommandBuffer::BindPipeline(const Graphics::Pipeline& pipeline)
 
 void CommandBuffer::BindTextures(const std::vector<TextureBinding>& textureBindings)
 {
-  mController.CheckTextureDependencies(textureBindings, mRenderTarget);
+  AddTextureDependencies(textureBindings);
   if(mStoredCommandBuffer)
   {
     mStoredCommandBuffer->BindTextures(textureBindings);
@@ -264,6 +267,16 @@ void CommandBuffer::BeginRenderPass(Graphics::RenderPass*          gfxRenderPass
   if(!surface)
   {
     mController.AddTextureDependencies(mRenderTarget);
+
+    // The render pass leaves offscreen colour attachments ready to be sampled, see FramebufferAttachment.
+    for(auto& attachment : mRenderTarget->GetFramebuffer()->GetCreateInfo().colorAttachments)
+    {
+      auto texture = static_cast<Vulkan::Texture*>(attachment.texture);
+      if(texture && texture->GetImage())
+      {
+        texture->GetImage()->SetImageLayout(vk::ImageLayout::eShaderReadOnlyOptimal);
+      }
+    }
   }
 }
 
@@ -293,7 +306,20 @@ void CommandBuffer::ReadPixels(uint8_t* buffer)
 
 void CommandBuffer::ExecuteCommandBuffers(std::vector<const Graphics::CommandBuffer*>&& commandBuffers)
 {
-  DALI_LOG_ERROR("Secondary cmd buffers no longer supported\n");
+  for(auto* commandBuffer : commandBuffers)
+  {
+    AddTextureDependencies(static_cast<const CommandBuffer*>(commandBuffer)->mDeferredTextureDependencies);
+  }
+
+  if(mStoredCommandBuffer)
+  {
+    // The secondary commands are played back into this command buffer when it is processed.
+    mStoredCommandBuffer->ExecuteCommandBuffers(std::move(commandBuffers));
+  }
+  else
+  {
+    DALI_LOG_ERROR("Secondary cmd buffers need a stored command buffer\n");
+  }
 }
 
 void CommandBuffer::Draw(uint32_t vertexCount,
@@ -592,6 +618,25 @@ void CommandBuffer::SetColorBlendAdvanced(uint32_t          attachment,
   }
 }
 
+void CommandBuffer::AddTextureDependencies(const std::vector<TextureBinding>& textureBindings)
+{
+  if(textureBindings.empty())
+  {
+    return;
+  }
+
+  if(mRenderTarget)
+  {
+    mController.CheckTextureDependencies(textureBindings, mRenderTarget);
+  }
+  else
+  {
+    // Secondary command buffers are recorded without a render target. The render target of the
+    // primary command buffer which executes this one depends on the textures instead.
+    mDeferredTextureDependencies.insert(mDeferredTextureDependencies.end(), textureBindings.begin(), textureBindings.end());
+  }
+}
+
 Vulkan::RenderTarget* CommandBuffer::GetRenderTarget() const
 {
   // Gets the render target from the Begin() cmd.
@@ -176,7 +176,14 @@ public:
    * @brief Executes a list of secondary command buffers
    *
    * The secondary command buffers will be executed as a part of a primary
-   * command buffer that calls this function.
+   * command buffer that calls this function. Their stored commands are played
+   * back in order into the primary buffer when it is processed, so secondary
+   * buffers may be recorded on worker threads; they must still be created and
+   * destroyed on the render thread.
+   *
+   * Secondary command buffers are usually recorded without a render target, so
+   * the dependencies of the textures they bind are added to the render target
+   * of this command buffer here.
    *
    * @param[in] commandBuffers List of buffers to execute
    */
@@ -462,11 +469,19 @@ private:
    */
   void AllocateCommandBuffers(bool doubleBuffered);
 
+  /**
+   * Adds dependencies of the render target on the render targets generating the bound textures.
+   * Without a render target, they are deferred until a primary command buffer executes this one.
+   */
+  void AddTextureDependencies(const std::vector<TextureBinding>& textureBindings);
+
   std::unique_ptr<StoredCommandBuffer> mStoredCommandBuffer; ///< Copy of all cmds
 
   std::vector<CommandBufferImpl*> mCommandBufferImpl; ///< There are as many elements as there are swapchain images
   RenderTarget*                   mRenderTarget{nullptr};
 
+  std::vector<TextureBinding> mDeferredTextureDependencies; ///< Textures bound without a render target, e.g. by a secondary command buffer
+
   bool mDoubleBuffered{true};
 };
 
@@ -493,6 +493,26 @@ void DumpCommandBuffer(GraphicsFrameDump& frameDump, const Vulkan::StoredCommand
                 BlendOpString(cmd.colorBlend.advanced.blendOp).c_str());
         break;
       }
+      case Vulkan::CommandType::EXECUTE_COMMAND_BUFFERS:
+      {
+        fprintf(output, "{\"Cmd\":\"EXECUTE_COMMAND_BUFFERS\",\n\"buffers\":[");
+        bool firstBuf{true};
+        for(auto j = 0u; j < cmd.executeCommandBuffers.buffersCount; ++j)
+        {
+          const auto* buf = cmd.executeCommandBuffers.buffers.Ptr()[j]->GetStoredCommandBuffer();
+          if(buf)
+          {
+            if(!firstBuf)
+            {
+              fprintf(output, ", ");
+            }
+            firstBuf = false;
+            DumpCommandBuffer(frameDump, buf);
+          }
+        }
+        fprintf(output, "]\n}");
+        break;
+      }
       case Vulkan::CommandType::BEGIN_RENDERPASS:
       {
         fprintf(output,
@@ -46,6 +46,7 @@
 #include <dali/internal/window-system/common/window-render-surface.h>
 
 #include <algorithm>
+#include <mutex>
 #include <queue>
 #include <unordered_map>
 
@@ -561,6 +562,7 @@ struct VulkanGraphicsController::Impl
   std::unique_ptr<Vulkan::PipelineCacheManager> mPipelineCacheManager{nullptr};
 
   Vulkan::TextureDependencyChecker mDependencyChecker; ///< Dependencies between framebuffers/scene
+  std::mutex                       mDependencyMutex;   ///< Guards mDependencyChecker, as command buffers may be recorded on worker threads
   std::vector<Vulkan::Texture*>    mDeferredTextures;
   DiscardQueues<ResourceBase>      mDiscardQueues;
 
@@ -608,7 +610,10 @@ Integration::GraphicsConfig& VulkanGraphicsController::GetGraphicsConfig()
 
 void VulkanGraphicsController::FrameStart()
 {
-  mImpl->mDependencyChecker.Reset(); // Clean down the dependency graph.
+  {
+    std::scoped_lock<std::mutex> lock(mImpl->mDependencyMutex);
+    mImpl->mDependencyChecker.Reset(); // Clean down the dependency graph.
+  }
   mImpl->mCapacity = 0;
 
   DALI_LOG_INFO(gVulkanFilter, Debug::Verbose, "FrameStart: bufferIndex:%u\n", mImpl->mGraphicsDevice->GetCurrentBufferIndex());
@@ -677,6 +682,9 @@ void VulkanGraphicsController::SubmitCommandBuffers(const SubmitInfo& submitInfo
   // Wait for any pending resource transfers to finish.
   mImpl->mResourceTransfer.WaitOnResourceTransferFutures();
 
+  // Texture copies go first on the queue, so this frame reads the copied textures.
+  mImpl->mResourceTransfer.SubmitTextureCopies();
+
   DALI_LOG_INFO(gVulkanFilter, Debug::Verbose, "SubmitCommandBuffers() bufferIndex:%d\n", mImpl->mGraphicsDevice->GetCurrentBufferIndex());
 
   std::vector<SubmissionData> fboSubmitData;
@@ -807,7 +815,10 @@ bool VulkanGraphicsController::IsDrawOnResumeRequired()
 UniquePtr<Graphics::RenderTarget> VulkanGraphicsController::CreateRenderTarget(const Graphics::RenderTargetCreateInfo& renderTargetCreateInfo, UniquePtr<Graphics::RenderTarget>&& oldRenderTarget)
 {
   auto renderTarget = NewGraphicsObject<Vulkan::RenderTarget>(renderTargetCreateInfo, *this, std::move(oldRenderTarget));
-  mImpl->mDependencyChecker.AddRenderTarget(CastObject<Vulkan::RenderTarget>(renderTarget.get()));
+  {
+    std::scoped_lock<std::mutex> lock(mImpl->mDependencyMutex);
+    mImpl->mDependencyChecker.AddRenderTarget(CastObject<Vulkan::RenderTarget>(renderTarget.get()));
+  }
   return renderTarget;
 }
 
@@ -1270,6 +1281,7 @@ void VulkanGraphicsController::AddTextureDependencies(RenderTarget* renderTarget
   auto framebuffer = renderTarget->GetFramebuffer();
   DALI_ASSERT_DEBUG(framebuffer);
 
+  std::scoped_lock<std::mutex> lock(mImpl->mDependencyMutex);
   for(auto attachment : framebuffer->GetCreateInfo().colorAttachments)
   {
     auto texture = CastObject<Vulkan::Texture>(attachment.texture);
@@ -1290,6 +1302,7 @@ void VulkanGraphicsController::CheckTextureDependencies(
   const std::vector<Graphics::TextureBinding>& textureBindings,
   RenderTarget*                                renderTarget)
 {
+  std::scoped_lock<std::mutex> lock(mImpl->mDependencyMutex);
   for(auto& binding : textureBindings)
   {
     if(binding.texture)
@@ -1302,6 +1315,7 @@ void VulkanGraphicsController::CheckTextureDependencies(
 
 void VulkanGraphicsController::RemoveRenderTarget(RenderTarget* renderTarget)
 {
+  std::scoped_lock<std::mutex> lock(mImpl->mDependencyMutex);
   mImpl->mDependencyChecker.RemoveRenderTarget(renderTarget);
 }
 
@@ -15,6 +15,7 @@
  */
 
 // EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
 #include <dali/public-api/common/dali-utility.h>
 
 // INTERNAL INCLUDES
@@ -194,10 +195,14 @@ void ResourceTransfer::UpdateSerially(
           }
 
           case Dali::Graphics::TextureUpdateSourceInfo::Type::TEXTURE:
-            // Unsupported
+            // Copied below, without the staging buffer
             break;
         }
       }
+      else if(source.sourceType == TextureUpdateSourceInfo::Type::TEXTURE)
+      {
+        CopyTextureSource(info, source);
+      }
     }
   }
 
@@ -374,7 +379,11 @@ void ResourceTransfer::UpdateWithFutures(
     {
       for(auto& update : *pUpdates)
       {
-        update.copyTask(workerIndex);
+        // Only MEMORY and PIXEL_DATA updates copy anything on the CPU.
+        if(update.copyTask)
+        {
+          update.copyTask(workerIndex);
+        }
       }
     };
     copyTasks.emplace_back(task);
@@ -453,8 +462,10 @@ void ResourceTransfer::UpdateWithFutures(
       }
 
       case Dali::Graphics::TextureUpdateSourceInfo::Type::TEXTURE:
-        // Unsupported
+      {
+        CopyTextureSource(info, source);
         break;
+      }
     }
   }
 
@@ -472,6 +483,26 @@ void ResourceTransfer::UpdateWithFutures(
   CreateTransferFutures();
 }
 
+void ResourceTransfer::CopyTextureSource(
+  const Dali::Graphics::TextureUpdateInfo&       info,
+  const Dali::Graphics::TextureUpdateSourceInfo& source)
+{
+  auto srcTexture  = static_cast<Vulkan::Texture*>(source.textureSource.texture);
+  auto destTexture = static_cast<Vulkan::Texture*>(info.dstTexture);
+  if(!srcTexture || srcTexture == destTexture)
+  {
+    DALI_LOG_ERROR("Invalid texture copy source\n");
+    return;
+  }
+
+  const uint32_t srcWidth = Max(srcTexture->GetCreateInfo().size.width, 1u);
+  const Offset2D srcOffset{int32_t(info.srcOffset % srcWidth), int32_t(info.srcOffset / srcWidth)};
+
+  // Recorded once the uploads of the frame are done, see SubmitTextureCopies().
+  std::lock_guard<std::recursive_mutex> lock(mResourceTransferMutex);
+  mTextureCopies.push_back({srcTexture, srcOffset, destTexture, info.srcExtent2D, info.dstOffset2D, info.layer, info.level});
+}
+
 /**
  * Mapping the staging buffer may take some time, so can delegate to a worker thread
  * if necessary.
@@ -623,6 +654,7 @@ void ResourceTransfer::CopyBufferAndTransition(
                                                               subResourceRange));
   }
   commandBuffer->GetImpl()->PipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eFragmentShader, {}, {}, {}, postLayoutBarriers);
+  image.SetImageLayout(vk::ImageLayout::eShaderReadOnlyOptimal);
 
   commandBuffer->End();
   device.GetTransferQueue(0u).Submit({Vulkan::SubmissionData{{}, {}, {commandBuffer->GetImpl()}, {}}}, fence.get());
@@ -630,6 +662,121 @@ void ResourceTransfer::CopyBufferAndTransition(
   fence->Reset();
 }
 
+void ResourceTransfer::CopyImageAndTransition(
+  Vulkan::CommandBuffer&   commandBuffer,
+  Texture&                 srcTexture,
+  Dali::Graphics::Offset2D srcOffset2D,
+  Texture&                 destTexture,
+  Dali::Graphics::Extent2D extent2D,
+  Dali::Graphics::Offset2D textureOffset2D,
+  uint32_t                 layer,
+  uint32_t                 level)
+{
+  if(!srcTexture.GetImageView())
+  {
+    srcTexture.InitializeImageViews();
+  }
+  if(!destTexture.GetImageView())
+  {
+    destTexture.InitializeImageViews();
+  }
+
+  auto& srcImage = *srcTexture.GetImage();
+  auto& dstImage = *destTexture.GetImage();
+
+  auto srcSubResourceRange = vk::ImageSubresourceRange{}
+                               .setBaseMipLevel(0)
+                               .setLevelCount(1)
+                               .setBaseArrayLayer(0)
+                               .setLayerCount(1)
+                               .setAspectMask(srcImage.GetAspectFlags());
+  auto dstSubResourceRange = vk::ImageSubresourceRange{}
+                               .setBaseMipLevel(level)
+                               .setLevelCount(1)
+                               .setBaseArrayLayer(layer)
+                               .setLayerCount(1)
+                               .setAspectMask(dstImage.GetAspectFlags());
+
+  // Either image may have been rendered to, sampled or uploaded to before, as tracked by its layout.
+  std::vector<vk::ImageMemoryBarrier> preLayoutBarriers;
+  preLayoutBarriers.emplace_back(srcImage.CreateMemoryBarrier(srcImage.GetImageLayout(),
+                                                              vk::ImageLayout::eTransferSrcOptimal,
+                                                              srcSubResourceRange));
+  preLayoutBarriers.emplace_back(dstImage.CreateMemoryBarrier(dstImage.GetImageLayout(),
+                                                              vk::ImageLayout::eTransferDstOptimal,
+                                                              dstSubResourceRange));
+  commandBuffer.GetImpl()->PipelineBarrier(vk::PipelineStageFlagBits::eColorAttachmentOutput | vk::PipelineStageFlagBits::eFragmentShader | vk::PipelineStageFlagBits::eTransfer,
+                                           vk::PipelineStageFlagBits::eTransfer,
+                                           {},
+                                           {},
+                                           {},
+                                           preLayoutBarriers);
+
+  auto copyInfo = vk::ImageCopy{}
+                    .setSrcSubresource(vk::ImageSubresourceLayers{}
+                                         .setBaseArrayLayer(0)
+                                         .setLayerCount(1)
+                                         .setAspectMask(vk::ImageAspectFlagBits::eColor)
+                                         .setMipLevel(0))
+                    .setSrcOffset({srcOffset2D.x, srcOffset2D.y, 0})
+                    .setDstSubresource(vk::ImageSubresourceLayers{}
+                                         .setBaseArrayLayer(layer)
+                                         .setLayerCount(1)
+                                         .setAspectMask(vk::ImageAspectFlagBits::eColor)
+                                         .setMipLevel(level))
+                    .setDstOffset({textureOffset2D.x, textureOffset2D.y, 0})
+                    .setExtent({extent2D.width, extent2D.height, 1});
+
+  commandBuffer.GetImpl()->CopyImage(&srcImage,
+                                     vk::ImageLayout::eTransferSrcOptimal,
+                                     &dstImage,
+                                     vk::ImageLayout::eTransferDstOptimal,
+                                     {copyInfo});
+
+  std::vector<vk::ImageMemoryBarrier> postLayoutBarriers;
+  postLayoutBarriers.emplace_back(srcImage.CreateMemoryBarrier(vk::ImageLayout::eTransferSrcOptimal,
+                                                               vk::ImageLayout::eShaderReadOnlyOptimal,
+                                                               srcSubResourceRange));
+  postLayoutBarriers.emplace_back(dstImage.CreateMemoryBarrier(vk::ImageLayout::eTransferDstOptimal,
+                                                               vk::ImageLayout::eShaderReadOnlyOptimal,
+                                                               dstSubResourceRange));
+  commandBuffer.GetImpl()->PipelineBarrier(vk::PipelineStageFlagBits::eTransfer,
+                                           vk::PipelineStageFlagBits::eFragmentShader | vk::PipelineStageFlagBits::eTransfer,
+                                           {},
+                                           {},
+                                           {},
+                                           postLayoutBarriers);
+
+  srcImage.SetImageLayout(vk::ImageLayout::eShaderReadOnlyOptimal);
+  dstImage.SetImageLayout(vk::ImageLayout::eShaderReadOnlyOptimal);
+}
+
+void ResourceTransfer::SubmitTextureCopies()
+{
+  std::lock_guard<std::recursive_mutex> lock(mResourceTransferMutex);
+  if(mTextureCopies.empty())
+  {
+    return;
+  }
+
+  Graphics::CommandBufferCreateInfo createInfo{};
+  createInfo.SetLevel(Graphics::CommandBufferLevel::PRIMARY);
+  auto gfxCommandBuffer = mGraphicsController.CreateImmediateCommandBuffer(createInfo, nullptr);
+  auto commandBuffer    = static_cast<Vulkan::CommandBuffer*>(gfxCommandBuffer.get());
+
+  Graphics::CommandBufferBeginInfo beginInfo{0 | CommandBufferUsageFlagBits::ONE_TIME_SUBMIT};
+  commandBuffer->Begin(beginInfo);
+  for(auto& copy : mTextureCopies)
+  {
+    CopyImageAndTransition(*commandBuffer, *copy.srcTexture, copy.srcOffset, *copy.destTexture, copy.extent, copy.destOffset, copy.layer, copy.level);
+  }
+  commandBuffer->End();
+  mTextureCopies.clear();
+
+  // No fence: the queue runs the copies before the frame, and the command buffer is discarded with the frame.
+  GetDevice().GetGraphicsQueue(0u).Submit({Vulkan::SubmissionData{{}, {}, {commandBuffer->GetImpl()}, {}}}, nullptr);
+}
+
 void ResourceTransfer::CopyBuffer(
   ResourceTransfer&                  resourceTransfer,
   Texture&                           destTexture,
@@ -956,6 +1103,10 @@ void ResourceTransfer::ProcessResourceTransferRequests(bool immediateOnly)
       if(i == highestBatchIndex - 1)
       {
         commandBuffer->GetImpl()->PipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eFragmentShader, {}, {}, {}, postLayoutBarriers);
+        for(auto& item : requestMap)
+        {
+          item.image.SetImageLayout(vk::ImageLayout::eShaderReadOnlyOptimal);
+        }
       }
       commandBuffer->End();
 
@@ -24,6 +24,8 @@
 
 namespace Dali::Graphics::Vulkan
 {
+class CommandBuffer;
+
 class ResourceTransfer
 {
 public:
@@ -47,6 +49,12 @@ public:
    */
   void WaitOnResourceTransferFutures();
 
+  /**
+   * Submits the texture copies recorded since the last call to the graphics queue, without waiting for them.
+   * Called before the command buffers of the frame are submitted to the same queue, so they read the copied textures.
+   */
+  void SubmitTextureCopies();
+
 private:
   Dali::SharedFuture InitializeTextureStagingBuffer(uint32_t size, bool useWorkerThread);
   void               MapTextureStagingBuffer();
@@ -76,6 +84,28 @@ private:
     uint32_t                           level,
     Dali::Graphics::TextureUpdateFlags flags);
 
+  /**
+   * Records the copy of a region of a texture into another texture with vkCmdCopyImage.
+   * Both images are transitioned from their tracked layouts, and are left in eShaderReadOnlyOptimal layout.
+   * @param commandBuffer The command buffer to record into
+   * @param srcTexture The texture to copy from. Its level 0 and layer 0 are read
+   * @param srcOffset2D The origin of the region in the source texture
+   * @param destTexture The texture to copy to
+   * @param extent2D The size of the region
+   * @param textureOffset2D The origin of the region in the destination texture
+   * @param layer The layer of the destination texture
+   * @param level The mipmap level of the destination texture
+   */
+  static void CopyImageAndTransition(
+    Vulkan::CommandBuffer&   commandBuffer,
+    Texture&                 srcTexture,
+    Dali::Graphics::Offset2D srcOffset2D,
+    Texture&                 destTexture,
+    Dali::Graphics::Extent2D extent2D,
+    Dali::Graphics::Offset2D textureOffset2D,
+    uint32_t                 layer,
+    uint32_t                 level);
+
   /**
    * Direct copy memory to memory, used when linear tiling is enabled. This function
    * doesn't check if data is valid and doesn't perform format conversion.
@@ -91,6 +121,13 @@ private:
     const Dali::Graphics::TextureUpdateSourceInfo& sourceInfo,
     bool                                           keepMapped);
 
+  /**
+   * Queues the copy of the region of a TEXTURE source into the destination texture, on the GPU.
+   * info.srcOffset is the index of the first texel of the region in the source texture.
+   */
+  void CopyTextureSource(const Dali::Graphics::TextureUpdateInfo&       info,
+                         const Dali::Graphics::TextureUpdateSourceInfo& source);
+
   void CreateTransferFutures();
   void ScheduleResourceTransfer(ResourceTransferRequest&& transferRequest);
   void ProcessResourceTransferRequests(bool immediateOnly = false);
@@ -118,6 +155,21 @@ private:
   void*                                 mTextureStagingBufferMappedPtr{nullptr};
 
   std::vector<std::shared_ptr<Future<void> > > mTransferFutures;
+
+  /**
+   * A texture copy waiting for SubmitTextureCopies()
+   */
+  struct TextureCopy
+  {
+    Texture*                 srcTexture;
+    Dali::Graphics::Offset2D srcOffset;
+    Texture*                 destTexture;
+    Dali::Graphics::Extent2D extent;
+    Dali::Graphics::Offset2D destOffset;
+    uint32_t                 layer;
+    uint32_t                 level;
+  };
+  std::vector<TextureCopy> mTextureCopies;
 };
 
 } // namespace Dali::Graphics::Vulkan
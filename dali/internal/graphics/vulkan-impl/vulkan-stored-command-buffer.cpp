@@ -419,7 +419,14 @@ void StoredCommandBuffer::ReadPixels(uint8_t* buffer)
 
 void StoredCommandBuffer::ExecuteCommandBuffers(std::vector<const Graphics::CommandBuffer*>&& commandBuffers)
 {
-  DALI_LOG_ERROR("Secondary command buffers no longer supported\n");
+  auto  command    = mCommandPool->AllocateCommand(CommandType::EXECUTE_COMMAND_BUFFERS);
+  auto& cmd        = command->executeCommandBuffers;
+  cmd.buffers      = mCommandPool->Allocate<const CommandBuffer*>(static_cast<uint32_t>(commandBuffers.size()));
+  cmd.buffersCount = static_cast<uint32_t>(commandBuffers.size());
+  for(auto i = 0u; i < cmd.buffersCount; ++i)
+  {
+    cmd.buffers[i] = static_cast<const CommandBuffer*>(commandBuffers[i]);
+  }
 }
 
 void StoredCommandBuffer::Draw(
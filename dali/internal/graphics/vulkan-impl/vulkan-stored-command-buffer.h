@@ -2,7 +2,7 @@
 #define DALI_GRAPHICS_VULKAN_STORED_COMMAND_BUFFER_H
 
 /*
- * Copyright (c) 2025 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -63,6 +63,7 @@ enum class CommandType
   SET_COLOR_BLEND_ENABLE,
   SET_COLOR_BLEND_EQUATION,
   SET_COLOR_BLEND_ADVANCED,
+  EXECUTE_COMMAND_BUFFERS,
   NULL_COMMAND
 };
 
@@ -1455,7 +1455,8 @@ void Texture::SetFormatAndUsage()
   {
     if(mCreateInfo.usageFlags & (0 | TextureUsageFlagBits::COLOR_ATTACHMENT))
     {
-      mUsage  = vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eSampled;
+      // Transfer source, so the texture can be copied into another one, see ResourceTransfer::CopyImageAndTransition().
+      mUsage  = vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eSampled | vk::ImageUsageFlagBits::eTransferSrc;
       mTiling = TextureTiling::OPTIMAL; // force always OPTIMAL tiling
       DALI_LOG_INFO(gVulkanFilter, Debug::Verbose, "ColorAttachment\n");
     }
@@ -1467,7 +1468,7 @@ void Texture::SetFormatAndUsage()
     }
     else if(mCreateInfo.usageFlags & (0 | TextureUsageFlagBits::SAMPLE))
     {
-      mUsage = vk::ImageUsageFlagBits::eSampled | vk::ImageUsageFlagBits::eTransferDst;
+      mUsage = vk::ImageUsageFlagBits::eSampled | vk::ImageUsageFlagBits::eTransferDst | vk::ImageUsageFlagBits::eTransferSrc;
       DALI_LOG_INFO(gVulkanFilter, Debug::Verbose, "Sample\n");
     }
 
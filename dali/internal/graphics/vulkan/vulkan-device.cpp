@@ -993,19 +993,26 @@ Platform Device::GetDefaultPlatform() const
 
 CommandPool* Device::GetCommandPool(std::thread::id threadId)
 {
-  CommandPool* commandPool = nullptr;
   {
     std::lock_guard<std::mutex> lock{mMutex};
-    commandPool = mCommandPools.find(threadId) == mCommandPools.end() ? nullptr : mCommandPools[threadId];
+    auto                        iter = mCommandPools.find(threadId);
+    if(iter != mCommandPools.end())
+    {
+      return iter->second;
+    }
   }
-  if(!commandPool)
+
+  vk::CommandPoolCreateInfo createInfo{};
+  createInfo.setFlags(vk::CommandPoolCreateFlagBits::eResetCommandBuffer);
+  CommandPool* commandPool = CommandPool::New(*this, createInfo);
   {
-    vk::CommandPoolCreateInfo createInfo{};
-    createInfo.setFlags(vk::CommandPoolCreateFlagBits::eResetCommandBuffer);
-    commandPool = CommandPool::New(*this, createInfo);
+    // Another caller may have created the pool of the same thread meanwhile; keep the first one.
+    std::lock_guard<std::mutex> lock{mMutex};
+    auto                        result = mCommandPools.emplace(threadId, commandPool);
+    if(!result.second)
     {
-      std::lock_guard<std::mutex> lock{mMutex};
-      mCommandPools[std::this_thread::get_id()] = commandPool;
+      delete commandPool;
+      commandPool = result.first->second;
     }
   }
   return commandPool;
@@ -310,5 +310,15 @@ void VulkanGraphics::LogMemoryPools()
     graphicsCapacity);
 }
 
+void VulkanGraphics::BeginProgramPrecompile()
+{
+  // Do nothing for now.
+}
+
+void VulkanGraphics::EndProgramPrecompile()
+{
+  // Do nothing for now.
+}
+
 } // Namespace Graphics
 } // Namespace Dali
@@ -232,6 +232,16 @@ public: // Debug APIs
    */
   void LogMemoryPools() override;
 
+  /**
+   * @copydoc Dali::Graphics::GraphicsInterface::BeginProgramPrecompile()
+   */
+  void BeginProgramPrecompile() override;
+
+  /**
+   * @copydoc Dali::Graphics::GraphicsInterface::EndProgramPrecompile()
+   */
+  void EndProgramPrecompile() override;
+
 public:
   /**
    * Returns controller object
@@ -18,6 +18,7 @@
 #include <dali/internal/imaging/common/alpha-mask.h>
 #include <dali/internal/imaging/common/image-operations.h>
 #include <dali/internal/imaging/common/pixel-buffer-impl.h>
+#include <dali/internal/imaging/common/pixel-kernels.h>
 #include <dali/internal/imaging/common/pixel-manipulation.h>
 #include <dali/public-api/adaptor-framework/image-options.h>
 
@@ -29,6 +30,11 @@ namespace Adaptor
 {
 void ApplyMaskToAlphaChannel(PixelBuffer& buffer, const PixelBuffer& mask)
 {
+  if(PixelKernels::ApplyMaskToAlphaChannel(buffer.GetBuffer(), buffer.GetPixelFormat(), buffer.GetStrideBytes(), mask.GetBuffer(), mask.GetPixelFormat(), mask.GetStrideBytes(), buffer.GetWidth(), buffer.GetHeight(), buffer.IsAlphaPreMultiplied()))
+  {
+    return;
+  }
+
   int                 srcAlphaByteOffset = 0;
   int                 srcAlphaMask       = 0;
   Dali::Pixel::Format srcPixelFormat     = mask.GetPixelFormat();
@@ -167,6 +173,11 @@ PixelBufferPtr CreateNewMaskedBuffer(const PixelBuffer& buffer, const PixelBuffe
   unsigned char* oldBuffer       = buffer.GetBuffer();
   unsigned int   destStrideBytes = newPixelBuffer->GetStrideBytes();
 
+  if(PixelKernels::CreateMaskedRGBA8888(oldBuffer, srcColorPixelFormat, srcColorStrideBytes, srcBuffer, srcPixelFormat, srcStrideBytes, destBuffer, destStrideBytes, buffer.GetWidth(), buffer.GetHeight()))
+  {
+    return newPixelBuffer;
+  }
+
   bool hasAlpha = Dali::Pixel::HasAlpha(buffer.GetPixelFormat());
 
   unsigned char destAlpha = 0;
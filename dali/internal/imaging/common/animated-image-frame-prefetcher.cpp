@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/common/animated-image-frame-prefetcher.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/async-task-manager.h>
+#include <dali/integration-api/debug.h>
+#include <algorithm>
+
+// INTERNAL INCLUDES
+#include <dali/internal/imaging/common/animated-image-loading-impl.h>
+#include <dali/internal/system/common/async-task-manager-impl.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+namespace
+{
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gPrefetchLogFilter = Debug::Filter::New(Debug::NoLogging, false, "LOG_ANIMATED_IMAGE_PREFETCH");
+#endif
+
+constexpr uint32_t MAXIMUM_PREFETCH_FRAME_COUNT = 8u; ///< The maximum size of the ring, as each slot holds a whole frame.
+
+void PrefetchTaskCompleted(Dali::AsyncTaskPtr)
+{
+}
+
+/**
+ * @brief Decodes the frame of a slot of the ring on a worker thread.
+ */
+class PrefetchTask : public Dali::AsyncTask
+{
+public:
+  PrefetchTask(AnimatedImageLoadingPtr loading, std::shared_ptr<AnimatedImageFramePrefetcher> prefetcher, uint32_t slotIndex, uint32_t ticket)
+  : Dali::AsyncTask(MakeCallback(&PrefetchTaskCompleted), Dali::AsyncTask::PriorityType::LOW, Dali::AsyncTask::ThreadType::WORKER_THREAD),
+    mLoading(std::move(loading)),
+    mPrefetcher(std::move(prefetcher)),
+    mSlotIndex(slotIndex),
+    mTicket(ticket)
+  {
+  }
+
+  void Process() override
+  {
+    mPrefetcher->ProcessSlot(mSlotIndex, mTicket);
+  }
+
+  Dali::StringView GetTaskName() const override
+  {
+    return "AnimatedImagePrefetchTask";
+  }
+
+private:
+  AnimatedImageLoadingPtr                       mLoading;    ///< Keeps the loading, which decodes the frame, alive.
+  std::shared_ptr<AnimatedImageFramePrefetcher> mPrefetcher; ///< Keeps the prefetcher alive, even once the loading dropped it.
+  const uint32_t                                mSlotIndex;
+  const uint32_t                                mTicket;
+};
+
+} // namespace
+
+AnimatedImageFramePrefetcher::AnimatedImageFramePrefetcher(AnimatedImageLoading& loading, uint32_t prefetchDuration)
+: mLoading(loading),
+  mConditionalWait(),
+  mRing(),
+  mPrefetchDuration(prefetchDuration),
+  mSize(),
+  mSamplingMode(Dali::SamplingMode::BOX_THEN_LINEAR),
+  mNextTicket(0u),
+  mMissedFrameCount(0u),
+  mPrefetchedFrameCount(0u),
+  mIsTaskManagerAvailable(true),
+  mIsCancelled(false)
+{
+}
+
+AnimatedImageFramePrefetcher::~AnimatedImageFramePrefetcher() = default;
+
+Dali::PixelBuffer AnimatedImageFramePrefetcher::LoadFrame(uint32_t frameIndex, ImageDimensions size, Dali::SamplingMode::Type samplingMode)
+{
+  Dali::PixelBuffer pixelBuffer;
+  {
+    ConditionalWait::ScopedLock lock(mConditionalWait);
+    if(size != mSize || samplingMode != mSamplingMode)
+    {
+      // The prefetched frames don't fit the new attributes.
+      for(auto&& slot : mRing)
+      {
+        if(slot.state == SlotState::DECODING)
+        {
+          slot.isStale = true;
+        }
+        else
+        {
+          slot.state = SlotState::EMPTY;
+          slot.pixelBuffer.Reset();
+        }
+      }
+      mSize         = size;
+      mSamplingMode = samplingMode;
+    }
+
+    Slot* slot = FindSlot(frameIndex);
+    if(slot)
+    {
+      const uint32_t ticket = slot->ticket;
+      if(slot->state != SlotState::READY)
+      {
+        MissDeadline(*slot);
+      }
+
+      // Wait for the worker rather than decoding the frame twice.
+      while(slot->state == SlotState::DECODING)
+      {
+        mConditionalWait.Wait(lock);
+      }
+
+      // A queued task is cancelled, and the frame is decoded below.
+      if(slot->ticket == ticket && slot->state != SlotState::EMPTY)
+      {
+        pixelBuffer = std::move(slot->pixelBuffer);
+        slot->pixelBuffer.Reset();
+        slot->state = SlotState::EMPTY;
+        if(pixelBuffer)
+        {
+          ++mPrefetchedFrameCount;
+        }
+      }
+    }
+  }
+
+  if(!pixelBuffer)
+  {
+    pixelBuffer = mLoading.DecodeFrame(frameIndex, size, samplingMode);
+  }
+
+  if(pixelBuffer)
+  {
+    Prefetch(frameIndex, mLoading.GetImageCount());
+  }
+  return pixelBuffer;
+}
+
+uint32_t AnimatedImageFramePrefetcher::GetMissedFrameCount() const
+{
+  ConditionalWait::ScopedLock lock(mConditionalWait);
+  return mMissedFrameCount;
+}
+
+uint32_t AnimatedImageFramePrefetcher::GetPrefetchedFrameCount() const
+{
+  ConditionalWait::ScopedLock lock(mConditionalWait);
+  return mPrefetchedFrameCount;
+}
+
+void AnimatedImageFramePrefetcher::Cancel()
+{
+  ConditionalWait::ScopedLock lock(mConditionalWait);
+  mIsCancelled = true;
+  for(auto&& slot : mRing)
+  {
+    if(slot.state == SlotState::DECODING)
+    {
+      slot.isStale = true;
+    }
+    else
+    {
+      slot.state = SlotState::EMPTY;
+      slot.pixelBuffer.Reset();
+    }
+  }
+}
+
+void AnimatedImageFramePrefetcher::ProcessSlot(uint32_t slotIndex, uint32_t ticket)
+{
+  uint32_t                 frameIndex;
+  ImageDimensions          size;
+  Dali::SamplingMode::Type samplingMode;
+  {
+    ConditionalWait::ScopedLock lock(mConditionalWait);
+    Slot&                       slot = mRing[slotIndex];
+    if(slot.state != SlotState::QUEUED || slot.ticket != ticket)
+    {
+      // The frame is loaded already, or no longer ahead.
+      return;
+    }
+    slot.state   = SlotState::DECODING;
+    frameIndex   = slot.frameIndex;
+    size         = mSize;
+    samplingMode = mSamplingMode;
+  }
+
+  Dali::PixelBuffer pixelBuffer = mLoading.DecodeFrame(frameIndex, size, samplingMode);
+
+  ConditionalWait::ScopedLock lock(mConditionalWait);
+  Slot&                       slot = mRing[slotIndex];
+  if(slot.isStale || !pixelBuffer)
+  {
+    slot.state   = SlotState::EMPTY;
+    slot.isStale = false;
+  }
+  else
+  {
+    slot.pixelBuffer = std::move(pixelBuffer);
+    slot.state       = SlotState::READY;
+    if(Clock::now() > slot.deadline)
+    {
+      MissDeadline(slot);
+    }
+  }
+  mConditionalWait.Notify(lock);
+}
+
+AnimatedImageFramePrefetcher::Slot* AnimatedImageFramePrefetcher::FindSlot(uint32_t frameIndex)
+{
+  auto iter = std::find_if(mRing.begin(), mRing.end(), [frameIndex](const Slot& slot) { return slot.state != SlotState::EMPTY && !slot.isStale && slot.frameIndex == frameIndex; });
+  return (iter != mRing.end()) ? &(*iter) : nullptr;
+}
+
+void AnimatedImageFramePrefetcher::MissDeadline(Slot& slot)
+{
+  if(!slot.missedDeadline)
+  {
+    slot.missedDeadline = true;
+    ++mMissedFrameCount;
+    DALI_LOG_INFO(gPrefetchLogFilter, Debug::General, "Frame %u of %s missed its deadline, missed frames : %u\n", slot.frameIndex, mLoading.GetUrl().c_str(), mMissedFrameCount);
+  }
+}
+
+void AnimatedImageFramePrefetcher::Prefetch(uint32_t frameIndex, uint32_t frameCount)
+{
+  if(frameCount <= 1u)
+  {
+    return;
+  }
+
+  // The intervals are read before locking, as the loading may be busy decoding a frame.
+  uint32_t ringSize;
+  {
+    ConditionalWait::ScopedLock lock(mConditionalWait);
+    ringSize = static_cast<uint32_t>(mRing.size());
+  }
+  if(ringSize == 0u)
+  {
+    const uint32_t frameInterval   = std::max(mLoading.GetFrameInterval(frameIndex), 1u);
+    const uint32_t frameCountAhead = (mPrefetchDuration + frameInterval - 1u) / frameInterval;
+
+    ConditionalWait::ScopedLock lock(mConditionalWait);
+    if(mRing.empty())
+    {
+      mRing.resize(std::clamp(frameCountAhead, 1u, std::min(MAXIMUM_PREFETCH_FRAME_COUNT, frameCount - 1u)));
+      DALI_LOG_INFO(gPrefetchLogFilter, Debug::Concise, "Prefetch %zu frames of %s, frame interval : %u\n", mRing.size(), mLoading.GetUrl().c_str(), frameInterval);
+    }
+    ringSize = static_cast<uint32_t>(mRing.size());
+  }
+
+  std::vector<uint32_t> frameIntervals(ringSize);
+  for(uint32_t i = 0u; i < ringSize; ++i)
+  {
+    frameIntervals[i] = mLoading.GetFrameInterval((frameIndex + i) % frameCount);
+  }
+
+  const auto                deadline = Clock::now();
+  std::vector<AsyncTaskPtr> tasks;
+  {
+    ConditionalWait::ScopedLock lock(mConditionalWait);
+    if(!mIsTaskManagerAvailable || mIsCancelled)
+    {
+      return;
+    }
+
+    // Free the slots of the frames which are no longer ahead, e.g. after a seek.
+    for(auto&& slot : mRing)
+    {
+      const uint32_t distance = (slot.frameIndex + frameCount - frameIndex) % frameCount;
+      if((slot.state == SlotState::QUEUED || slot.state == SlotState::READY) && (distance == 0u || distance > ringSize))
+      {
+        slot.state = SlotState::EMPTY;
+        slot.pixelBuffer.Reset();
+      }
+    }
+
+    auto frameDeadline = deadline;
+    for(uint32_t i = 0u; i < ringSize; ++i)
+    {
+      frameDeadline += std::chrono::milliseconds(frameIntervals[i]);
+
+      const uint32_t aheadIndex = (frameIndex + i + 1u) % frameCount;
+      if(FindSlot(aheadIndex))
+      {
+        continue;
+      }
+
+      auto iter = std::find_if(mRing.begin(), mRing.end(), [](const Slot& slot) { return slot.state == SlotState::EMPTY; });
+      if(iter == mRing.end())
+      {
+        break;
+      }
+
+      iter->frameIndex     = aheadIndex;
+      iter->ticket         = ++mNextTicket;
+      iter->state          = SlotState::QUEUED;
+      iter->deadline       = frameDeadline;
+      iter->isStale        = false;
+      iter->missedDeadline = false;
+      tasks.push_back(new PrefetchTask(AnimatedImageLoadingPtr(&mLoading), shared_from_this(), static_cast<uint32_t>(iter - mRing.begin()), iter->ticket));
+    }
+  }
+
+  for(auto&& task : tasks)
+  {
+    if(!AsyncTaskManager::AddTaskToManager(task))
+    {
+      // No worker threads. The frames are decoded when they are loaded.
+      ConditionalWait::ScopedLock lock(mConditionalWait);
+      mIsTaskManagerAvailable = false;
+      for(auto&& slot : mRing)
+      {
+        if(slot.state == SlotState::QUEUED)
+        {
+          slot.state = SlotState::EMPTY;
+        }
+      }
+      break;
+    }
+  }
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
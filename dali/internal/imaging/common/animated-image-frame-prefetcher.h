@@ -0,0 +1,174 @@
+#ifndef DALI_INTERNAL_ANIMATED_IMAGE_FRAME_PREFETCHER_H
+#define DALI_INTERNAL_ANIMATED_IMAGE_FRAME_PREFETCHER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/threading/conditional-wait.h>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/adaptor-framework/image-options.h>
+#include <dali/public-api/adaptor-framework/pixel-buffer.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+class AnimatedImageLoading;
+
+/**
+ * @brief Decodes the frames following the last loaded one on the AsyncTaskManager worker threads.
+ *
+ * The decoded frames are kept in a fixed-size ring of slots, sized so it covers the prefetch duration
+ * at the frame interval of the image. A slot is given to another frame once its frame is loaded,
+ * or when it is no longer ahead of the loaded frame (e.g. after a seek).
+ *
+ * A frame misses its deadline when it is loaded before its prefetch is done, or when its prefetch
+ * finishes later than the time it is due, i.e. the sum of the intervals of the frames before it.
+ *
+ * The prefetch tasks share the ownership of the prefetcher, and keep the loading alive,
+ * so the loading may drop its prefetcher while they are queued or running.
+ */
+class AnimatedImageFramePrefetcher : public std::enable_shared_from_this<AnimatedImageFramePrefetcher>
+{
+public:
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] loading The loading which decodes the frames. It owns this prefetcher, with the prefetch tasks.
+   * @param[in] prefetchDuration The duration of the frames decoded ahead, in milliseconds.
+   */
+  AnimatedImageFramePrefetcher(AnimatedImageLoading& loading, uint32_t prefetchDuration);
+
+  /**
+   * @brief Destructor.
+   */
+  ~AnimatedImageFramePrefetcher();
+
+  /**
+   * @brief Load a frame, from the ring if it was prefetched, and prefetch the frames following it.
+   *
+   * @param[in] frameIndex The frame index to load.
+   * @param[in] size The width and height to fit the loaded image to.
+   * @param[in] samplingMode The SamplingMode of the resource to load
+   * @return Dali::PixelBuffer The loaded Dali::PixelBuffer. If loading is fail, return empty handle.
+   */
+  Dali::PixelBuffer LoadFrame(uint32_t frameIndex, ImageDimensions size, Dali::SamplingMode::Type samplingMode);
+
+  /**
+   * @brief Retrieve the number of frames which missed their deadline.
+   * @return The number of frames.
+   */
+  uint32_t GetMissedFrameCount() const;
+
+  /**
+   * @brief Retrieve the number of frames loaded from the ring.
+   * @return The number of frames.
+   */
+  uint32_t GetPrefetchedFrameCount() const;
+
+  /**
+   * @brief Stop prefetching, when the loading drops this prefetcher.
+   *
+   * The queued tasks do nothing once they run, and no task is added from now on.
+   */
+  void Cancel();
+
+  /**
+   * @brief Decode the frame of a slot, called by the prefetch task on a worker thread.
+   *
+   * @param[in] slotIndex The index of the slot in the ring.
+   * @param[in] ticket The ticket of the slot when the task was created. Nothing is done if the slot is given to another frame since.
+   */
+  void ProcessSlot(uint32_t slotIndex, uint32_t ticket);
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  enum class SlotState
+  {
+    EMPTY,    ///< Not used.
+    QUEUED,   ///< A task is added to decode the frame.
+    DECODING, ///< The task is decoding the frame.
+    READY,    ///< The frame is decoded.
+  };
+
+  /**
+   * @brief A frame of the ring.
+   */
+  struct Slot
+  {
+    Dali::PixelBuffer pixelBuffer;             ///< The decoded frame, when READY.
+    Clock::time_point deadline;                ///< The time the frame is due.
+    uint32_t          frameIndex{0u};          ///< The frame to decode.
+    uint32_t          ticket{0u};              ///< Changed whenever the slot is given to another frame.
+    SlotState         state{SlotState::EMPTY}; ///< The state of the slot.
+    bool              isStale{false};          ///< Whether the frame is decoded with old attributes, and is dropped once done.
+    bool              missedDeadline{false};   ///< Whether the miss of the deadline is already counted.
+  };
+
+  /**
+   * @brief Find the slot of a frame, among the slots used with the current attributes.
+   * @note Must be called under mConditionalWait.
+   */
+  Slot* FindSlot(uint32_t frameIndex);
+
+  /**
+   * @brief Count a frame which missed its deadline.
+   * @note Must be called under mConditionalWait.
+   */
+  void MissDeadline(Slot& slot);
+
+  /**
+   * @brief Give the slots to the frames following the loaded one, and add the tasks to decode them.
+   *
+   * @param[in] frameIndex The loaded frame.
+   * @param[in] frameCount The number of frames of the image.
+   */
+  void Prefetch(uint32_t frameIndex, uint32_t frameCount);
+
+  AnimatedImageFramePrefetcher(const AnimatedImageFramePrefetcher&)            = delete;
+  AnimatedImageFramePrefetcher& operator=(const AnimatedImageFramePrefetcher&) = delete;
+
+private:
+  AnimatedImageLoading&    mLoading;
+  mutable ConditionalWait  mConditionalWait;       ///< Guards the members below, and is notified when a frame is decoded.
+  std::vector<Slot>        mRing;                  ///< Sized by the first LoadFrame().
+  const uint32_t           mPrefetchDuration;      ///< In milliseconds.
+  ImageDimensions          mSize;                  ///< The attributes of the prefetched frames, from the last LoadFrame().
+  Dali::SamplingMode::Type mSamplingMode;          ///< The attributes of the prefetched frames, from the last LoadFrame().
+  uint32_t                 mNextTicket;            ///< The ticket of the next slot given to a frame.
+  uint32_t                 mMissedFrameCount;      ///< The number of frames which missed their deadline.
+  uint32_t                 mPrefetchedFrameCount;  ///< The number of frames loaded from the ring.
+  bool                     mIsTaskManagerAvailable; ///< False once there is no AsyncTaskManager to add the tasks to.
+  bool                     mIsCancelled;            ///< True once Cancel() is called.
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ANIMATED_IMAGE_FRAME_PREFETCHER_H
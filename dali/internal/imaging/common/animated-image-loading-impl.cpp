@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/common/animated-image-loading-impl.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <cstdlib>
+
+// INTERNAL INCLUDES
+#include <dali/internal/imaging/common/animated-image-frame-prefetcher.h>
+#include <dali/internal/system/common/environment-variables.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+AnimatedImageLoading::AnimatedImageLoading()
+{
+  const char* prefetchDurationString = EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_ANIMATED_IMAGE_PREFETCH_DURATION);
+  SetPrefetchDuration(prefetchDurationString ? static_cast<uint32_t>(std::strtoul(prefetchDurationString, nullptr, 10)) : 0u);
+}
+
+AnimatedImageLoading::~AnimatedImageLoading() = default;
+
+Dali::PixelBuffer AnimatedImageLoading::LoadFrame(uint32_t                 frameIndex,
+                                                  ImageDimensions          size,
+                                                  Dali::SamplingMode::Type samplingMode)
+{
+  return mPrefetcher ? mPrefetcher->LoadFrame(frameIndex, size, samplingMode) : DecodeFrame(frameIndex, size, samplingMode);
+}
+
+void AnimatedImageLoading::SetPrefetchDuration(uint32_t prefetchDuration)
+{
+  // The tasks of the previous prefetcher may still be queued. They keep it alive, and do nothing once cancelled.
+  if(mPrefetcher)
+  {
+    mPrefetcher->Cancel();
+  }
+
+  if(prefetchDuration > 0u)
+  {
+    mPrefetcher = std::make_shared<AnimatedImageFramePrefetcher>(*this, prefetchDuration);
+  }
+  else
+  {
+    mPrefetcher.reset();
+  }
+}
+
+uint32_t AnimatedImageLoading::GetMissedFrameCount() const
+{
+  return mPrefetcher ? mPrefetcher->GetMissedFrameCount() : 0u;
+}
+
+uint32_t AnimatedImageLoading::GetPrefetchedFrameCount() const
+{
+  return mPrefetcher ? mPrefetcher->GetPrefetchedFrameCount() : 0u;
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
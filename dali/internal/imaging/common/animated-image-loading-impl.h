@@ -23,6 +23,7 @@
 #include <dali/public-api/common/intrusive-ptr.h>
 #include <dali/public-api/math/int-pair.h>
 #include <dali/public-api/object/base-object.h>
+#include <memory>
 
 // INTERNAL INCLUDES
 #include <dali/devel-api/adaptor-framework/animated-image-loading.h>
@@ -39,6 +40,7 @@ namespace Internal
 namespace Adaptor
 {
 class AnimatedImageLoading;
+class AnimatedImageFramePrefetcher;
 typedef IntrusivePtr<AnimatedImageLoading> AnimatedImageLoadingPtr;
 
 /**
@@ -56,12 +58,13 @@ public:
   /**
    * @brief Destructor
    */
-  ~AnimatedImageLoading() override = default;
+  ~AnimatedImageLoading() override;
 
   /**
    * @brief Load a frame of the animated image.
    *
    * @note This function will load the entire animated image into memory if not already loaded.
+   * If the prefetch is enabled, the frame may be decoded already, and the frames following it are decoded ahead.
    * @param[in] frameIndex The frame index to load.
    * @param[in] size The width and height to fit the loaded image to.
    * @param[in] samplingMode The SamplingMode of the resource to load
@@ -70,12 +73,42 @@ public:
    */
   Dali::PixelBuffer LoadFrame(uint32_t                 frameIndex,
                               ImageDimensions          size,
-                              Dali::SamplingMode::Type samplingMode)
+                              Dali::SamplingMode::Type samplingMode);
+
+  /**
+   * @brief Decode a frame of the animated image, without the prefetch.
+   *
+   * @param[in] frameIndex The frame index to load.
+   * @param[in] size The width and height to fit the loaded image to.
+   * @param[in] samplingMode The SamplingMode of the resource to load
+   *
+   * @return Dali::PixelBuffer The loaded Dali::PixelBuffer. If loading is fail, return empty handle.
+   */
+  Dali::PixelBuffer DecodeFrame(uint32_t                 frameIndex,
+                                ImageDimensions          size,
+                                Dali::SamplingMode::Type samplingMode)
   {
     Dali::PixelBuffer pixelBuffer = LoadFrame(frameIndex, size);
     return Dali::Internal::Platform::ApplyAttributesToBitmap(pixelBuffer, size, samplingMode);
   }
 
+  /**
+   * @copydoc Dali::AnimatedImageLoading::SetPrefetchDuration()
+   */
+  void SetPrefetchDuration(uint32_t prefetchDuration);
+
+  /**
+   * @copydoc Dali::AnimatedImageLoading::GetMissedFrameCount()
+   */
+  uint32_t GetMissedFrameCount() const;
+
+  /**
+   * @brief Get the number of frames loaded from the prefetched ones.
+   *
+   * @return The number of frames. 0 if the prefetch is disabled.
+   */
+  uint32_t GetPrefetchedFrameCount() const;
+
 public:
   /**
    * @copydoc Dali::AnimatedImageLoading::GetImageSize()
@@ -114,7 +147,10 @@ public:
   virtual bool LoadFramePlanes(uint32_t frameIndex, std::vector<Dali::PixelBuffer>& pixelBuffers, ImageDimensions size) = 0;
 
 protected:
-  AnimatedImageLoading() = default;
+  /**
+   * @brief Constructor. The prefetch duration is DALI_ANIMATED_IMAGE_PREFETCH_DURATION by default.
+   */
+  AnimatedImageLoading();
 
 private:
   // Not movable and not copyable
@@ -133,6 +169,9 @@ private:
    * @return Dali::PixelBuffer The loaded Dali::PixelBuffer. If loading is fail, return empty handle.
    */
   virtual Dali::PixelBuffer LoadFrame(uint32_t frameIndex, ImageDimensions size = ImageDimensions()) = 0;
+
+private:
+  std::shared_ptr<AnimatedImageFramePrefetcher> mPrefetcher; ///< Created if the prefetch is enabled. Shared with its queued tasks.
 };
 
 } // namespace Adaptor
@@ -20,9 +20,12 @@
 #include <dali/public-api/common/dali-utility.h>
 #include <cmath>
 #include <new> ///< for std::bad_alloc
+#include <vector>
 
 // INTERNAL INCLUDES
 #include <dali/internal/imaging/common/gaussian-blur.h>
+#include <dali/internal/imaging/common/image-operations-parallel.h>
+#include <dali/internal/imaging/common/image-operations-simd.h>
 #include <dali/internal/imaging/common/pixel-buffer-impl.h>
 
 namespace Dali
@@ -55,6 +58,222 @@ struct MemoryFinalizer
   T*& mArray;
 };
 
+constexpr uint32_t BOX_BLUR_PASS_COUNT = 3u;    ///< Three box blurs are within a few percent of a Gaussian.
+constexpr uint32_t MAXIMUM_BOX_RADIUS  = 4096u; ///< Keeps the fixed-point box sums within 32 bits.
+constexpr uint32_t BOX_BLUR_SHIFT      = 23u;   ///< The fractional bits of the box width reciprocal.
+
+/**
+ * Calculate the standard deviation of the Gaussian for the given blur radius.
+ */
+inline float CalculateSigma(const float blurRadius)
+{
+  return (blurRadius < Math::MACHINE_EPSILON_1) ? 0.0f : blurRadius * 0.4f + 0.6f; // The same equation used by Android
+}
+
+/**
+ * Calculate which input pixel each window position reads, repeating the image mirrored past its edges.
+ *
+ * Window position i reads the pixel at (i - radius), so output pixel x sees window positions [x, x + windowSize).
+ *
+ * @param[out] windowIndices The input pixel of each window position
+ * @param[in] width The width of the scanline
+ * @param[in] radius The number of window positions before the first pixel
+ * @param[in] windowCount The number of window positions
+ */
+void CalculateWindowIndices(std::vector<uint32_t>& windowIndices, const uint32_t width, const int32_t radius, const uint32_t windowCount)
+{
+  windowIndices.resize(windowCount);
+  for(uint32_t i = 0; i < windowCount; ++i)
+  {
+    int32_t ix = static_cast<int32_t>(i) - radius;
+
+    // Mirror Repeat
+    ix %= (2 * static_cast<int32_t>(width));
+    if(ix < 0)
+    {
+      ix += 2 * static_cast<int32_t>(width);
+    }
+    ix = (ix < static_cast<int32_t>(width)) ? (ix) : (2 * static_cast<int32_t>(width) - ix - 1);
+
+    DALI_ASSERT_DEBUG(ix >= 0 && ix < static_cast<int32_t>(width));
+    windowIndices[i] = static_cast<uint32_t>(ix);
+  }
+}
+
+/**
+ * Convolve one scanline and write it transposed.
+ * @see ImageOperationsSimd::ConvolveTransposeScanline4BPP
+ */
+template<uint32_t BYTES_PER_PIXEL>
+void ConvoluteTransposeScanline(const uint8_t* inScanline, const uint32_t* windowIndices, const float* weights, const uint32_t kernelSize, uint8_t* outPixel, const uint32_t outStrideBytes, const uint32_t width)
+{
+  float channelSum[BYTES_PER_PIXEL];
+  for(uint32_t x = 0; x < width; ++x, outPixel += outStrideBytes)
+  {
+    for(uint32_t i = 0; i < BYTES_PER_PIXEL; ++i)
+    {
+      channelSum[i] = 0.0f;
+    }
+    for(uint32_t column = 0; column < kernelSize; ++column)
+    {
+      const float weight = weights[column];
+      if(fabsf(weight) > Math::MACHINE_EPSILON_1)
+      {
+        const uint8_t* sourcePixel = inScanline + windowIndices[x + column] * BYTES_PER_PIXEL;
+        for(uint32_t i = 0; i < BYTES_PER_PIXEL; ++i)
+        {
+          channelSum[i] += weight * static_cast<float>(sourcePixel[i]);
+        }
+      }
+    }
+
+    for(uint32_t i = 0; i < BYTES_PER_PIXEL; ++i)
+    {
+      outPixel[i] = static_cast<uint8_t>(Min(static_cast<uint32_t>(Max(0, static_cast<int32_t>(channelSum[i] + 0.5f))), 255u));
+    }
+  }
+}
+
+/**
+ * Box blur one scanline and write it transposed.
+ * @see ImageOperationsSimd::BoxBlurTransposeScanline4BPP
+ */
+template<uint32_t BYTES_PER_PIXEL>
+void BoxBlurTransposeScanline(const uint8_t* inScanline, const uint32_t* windowIndices, const uint32_t radius, uint8_t* outPixel, const uint32_t outStrideBytes, const uint32_t width, const uint32_t multiplier)
+{
+  const uint32_t boxWidth = radius * 2u + 1u;
+
+  uint32_t sum[BYTES_PER_PIXEL] = {};
+  for(uint32_t column = 0; column < boxWidth; ++column)
+  {
+    const uint8_t* sourcePixel = inScanline + windowIndices[column] * BYTES_PER_PIXEL;
+    for(uint32_t i = 0; i < BYTES_PER_PIXEL; ++i)
+    {
+      sum[i] += sourcePixel[i];
+    }
+  }
+
+  for(uint32_t x = 0; x < width; ++x, outPixel += outStrideBytes)
+  {
+    const uint8_t* addedPixel   = inScanline + windowIndices[x + boxWidth] * BYTES_PER_PIXEL;
+    const uint8_t* removedPixel = inScanline + windowIndices[x] * BYTES_PER_PIXEL;
+    for(uint32_t i = 0; i < BYTES_PER_PIXEL; ++i)
+    {
+      outPixel[i] = static_cast<uint8_t>(Min((sum[i] * multiplier + (1u << (BOX_BLUR_SHIFT - 1u))) >> BOX_BLUR_SHIFT, 255u));
+
+      // Slide the box one pixel along.
+      sum[i] += addedPixel[i];
+      sum[i] -= removedPixel[i];
+    }
+  }
+}
+
+/**
+ * Box blur a buffer horizontally and write its output buffer transposed.
+ *
+ * The cost per pixel doesn't depend on the radius, as the box sum slides along each scanline.
+ *
+ * @param[in] inBuffer The input buffer with the source image
+ * @param[in] outBuffer The output buffer with the box blur applied and transposed
+ * @param[in] bufferWidth The width of the buffer
+ * @param[in] bufferHeight The height of the buffer
+ * @param[in] inBufferStrideBytes The stride byte of input buffer
+ * @param[in] outBufferStrideBytes The stride byte of output buffer
+ * @param[in] bytesPerPixel The bytes per pixels of both buffers
+ * @param[in] radius The radius of the box
+ *
+ * @return @e false if the blur fails (invalid pixel format or memory issues).
+ */
+bool BoxBlurAndTranspose(uint8_t*       inBuffer,
+                         uint8_t*       outBuffer,
+                         const uint32_t bufferWidth,
+                         const uint32_t bufferHeight,
+                         const uint32_t inBufferStrideBytes,
+                         const uint32_t outBufferStrideBytes,
+                         const uint32_t bytesPerPixel,
+                         const uint32_t radius)
+{
+  const uint32_t boxWidth   = radius * 2u + 1u;
+  const uint32_t multiplier = ((1u << BOX_BLUR_SHIFT) + boxWidth / 2u) / boxWidth;
+
+  try
+  {
+    std::vector<uint32_t> windowIndices;
+    CalculateWindowIndices(windowIndices, bufferWidth, static_cast<int32_t>(radius), bufferWidth + boxWidth);
+
+    Platform::ImageOperationsParallel::ForEachBand(bufferHeight, bufferWidth, [&](uint32_t beginY, uint32_t endY) {
+      for(uint32_t y = beginY; y < endY; ++y)
+      {
+        const uint8_t* inScanline = inBuffer + y * inBufferStrideBytes;
+        uint8_t*       outPixel   = outBuffer + y * bytesPerPixel;
+        switch(bytesPerPixel)
+        {
+          case 1:
+          {
+            BoxBlurTransposeScanline<1>(inScanline, windowIndices.data(), radius, outPixel, outBufferStrideBytes, bufferWidth, multiplier);
+            break;
+          }
+          case 2:
+          {
+            BoxBlurTransposeScanline<2>(inScanline, windowIndices.data(), radius, outPixel, outBufferStrideBytes, bufferWidth, multiplier);
+            break;
+          }
+          case 3:
+          {
+            BoxBlurTransposeScanline<3>(inScanline, windowIndices.data(), radius, outPixel, outBufferStrideBytes, bufferWidth, multiplier);
+            break;
+          }
+          default:
+          {
+            if(Platform::ImageOperationsSimd::BoxBlurTransposeScanline4BPP(inScanline, windowIndices.data(), radius, outPixel, outBufferStrideBytes, bufferWidth, multiplier) == 0u)
+            {
+              BoxBlurTransposeScanline<4>(inScanline, windowIndices.data(), radius, outPixel, outBufferStrideBytes, bufferWidth, multiplier);
+            }
+            break;
+          }
+        }
+      }
+    });
+  }
+  catch(const std::bad_alloc& e)
+  {
+    DALI_LOG_ERROR("Could not allocate temporary memory. (%u byte) e.what() : %s\n", static_cast<uint32_t>((bufferWidth + boxWidth) * sizeof(uint32_t)), e.what());
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Calculate the radii of the box blurs which together approximate a Gaussian.
+ *
+ * The box widths are odd and chosen so that the sum of their variances matches the variance of the Gaussian.
+ * (W. Jarosz, "Fast Image Convolutions", and P. Kovesi, "Fast Almost-Gaussian Filtering")
+ *
+ * @param[in] sigma The standard deviation of the Gaussian
+ * @param[out] radii The radius of each box blur pass
+ */
+void CalculateBoxBlurRadii(const float sigma, uint32_t (&radii)[BOX_BLUR_PASS_COUNT])
+{
+  const float variance   = 12.0f * sigma * sigma;
+  const float passCount  = static_cast<float>(BOX_BLUR_PASS_COUNT);
+  int32_t     lowerWidth = static_cast<int32_t>(std::floor(std::sqrt(variance / passCount + 1.0f)));
+  if(lowerWidth % 2 == 0)
+  {
+    --lowerWidth;
+  }
+  lowerWidth = Max(lowerWidth, 1);
+
+  const float   lower      = static_cast<float>(lowerWidth);
+  const int32_t lowerCount = static_cast<int32_t>(std::round((variance - passCount * lower * lower - 4.0f * passCount * lower - 3.0f * passCount) / (-4.0f * lower - 4.0f)));
+
+  for(uint32_t pass = 0; pass < BOX_BLUR_PASS_COUNT; ++pass)
+  {
+    const int32_t width = (static_cast<int32_t>(pass) < lowerCount) ? lowerWidth : lowerWidth + 2;
+    radii[pass]         = Min(static_cast<uint32_t>(width - 1) / 2u, MAXIMUM_BOX_RADIUS);
+  }
+}
+
 /**
  * Perform a one dimension Gaussian blur convolution and write its output buffer transposed.
  *
@@ -96,20 +315,18 @@ bool ConvoluteAndTranspose(uint8_t*       inBuffer,
 
   uint32_t rows = static_cast<uint32_t>(radius) * 2u + 1u;
 
-  const float sigma        = (blurRadius < Math::MACHINE_EPSILON_1) ? 0.0f : blurRadius * 0.4f + 0.6f; // The same equation used by Android
+  const float sigma        = CalculateSigma(blurRadius);
   const float sigma22      = 2.0f * sigma * sigma;
   const float sqrtSigmaPi2 = std::sqrt(2.0f * Math::PI) * sigma;
 
   float normalizeFactor = 0.0f;
 
   float* weightMatrix = nullptr;
-  float* channelSum   = nullptr;
 
   try
   {
     // Automatically delete memory array
     MemoryFinalizer weightMatrixFinalizer(weightMatrix);
-    MemoryFinalizer channelSumFinalizer(channelSum);
 
     if(DALI_UNLIKELY(radius <= 0 || sigma22 < Math::MACHINE_EPSILON_1 || sqrtSigmaPi2 < Math::MACHINE_EPSILON_1))
     {
@@ -148,58 +365,55 @@ bool ConvoluteAndTranspose(uint8_t*       inBuffer,
       for(uint32_t i = 0; i < rows; i++)
       {
         weightMatrix[i] /= normalizeFactor;
+
+        // Negligible weights are skipped, so the vectorized loops which don't skip them must see zero.
+        if(fabsf(weightMatrix[i]) <= Math::MACHINE_EPSILON_1)
+        {
+          weightMatrix[i] = 0.0f;
+        }
       }
     }
 
-    channelSum = new float[inBytesPerPixel];
-
     // Perform the convolution and transposition using the weights
     const int32_t columns  = static_cast<int32_t>(rows);
     const int32_t columns2 = columns / 2; // == radius
-    for(uint32_t y = 0; y < bufferHeight; y++)
-    {
-      uint32_t       targetPixelByte = y * outBytesPerPixel;
-      const uint32_t ioffset         = y * inBufferStrideBytes;
-      for(uint32_t x = 0; x < bufferWidth; x++)
+
+    std::vector<uint32_t> windowIndices;
+    CalculateWindowIndices(windowIndices, bufferWidth, columns2, bufferWidth + rows - 1u);
+
+    Platform::ImageOperationsParallel::ForEachBand(bufferHeight, bufferWidth * rows, [&](uint32_t beginY, uint32_t endY) {
+      for(uint32_t y = beginY; y < endY; y++)
       {
-        for(uint32_t i = 0; i < inBytesPerPixel; ++i)
+        const uint8_t* inScanline = inBuffer + y * inBufferStrideBytes;
+        uint8_t*       outPixel   = outBuffer + y * outBytesPerPixel;
+        switch(inBytesPerPixel)
         {
-          channelSum[i] = 0.0f;
-        }
-        const int32_t weightColumnOffset = columns2;
-        for(int32_t column = -columns2; column <= columns2; column++)
-        {
-          const float weight = weightMatrix[static_cast<uint32_t>(weightColumnOffset + column)];
-          if(fabsf(weight) > Math::MACHINE_EPSILON_1)
+          case 1:
           {
-            int32_t ix = static_cast<int32_t>(x) + column;
-
-            // Mirror Repeat
-            ix %= (2 * static_cast<int32_t>(bufferWidth));
-            if(ix < 0)
-            {
-              ix += 2 * static_cast<int32_t>(bufferWidth);
-            }
-            ix = (ix < static_cast<int32_t>(bufferWidth)) ? (ix) : (2 * static_cast<int32_t>(bufferWidth) - ix - 1);
-
-            DALI_ASSERT_DEBUG(ix >= 0 && ix < static_cast<int32_t>(bufferWidth));
-
-            const uint32_t sourcePixelByte = ioffset + (static_cast<uint32_t>(ix) * inBytesPerPixel);
-            for(uint32_t i = 0; i < inBytesPerPixel; ++i)
+            ConvoluteTransposeScanline<1>(inScanline, windowIndices.data(), weightMatrix, rows, outPixel, outBufferStrideBytes, bufferWidth);
+            break;
+          }
+          case 2:
+          {
+            ConvoluteTransposeScanline<2>(inScanline, windowIndices.data(), weightMatrix, rows, outPixel, outBufferStrideBytes, bufferWidth);
+            break;
+          }
+          case 3:
+          {
+            ConvoluteTransposeScanline<3>(inScanline, windowIndices.data(), weightMatrix, rows, outPixel, outBufferStrideBytes, bufferWidth);
+            break;
+          }
+          default:
+          {
+            if(Platform::ImageOperationsSimd::ConvolveTransposeScanline4BPP(inScanline, windowIndices.data(), weightMatrix, rows, outPixel, outBufferStrideBytes, bufferWidth) == 0u)
             {
-              channelSum[i] += weight * static_cast<float>(inBuffer[sourcePixelByte + i]);
+              ConvoluteTransposeScanline<4>(inScanline, windowIndices.data(), weightMatrix, rows, outPixel, outBufferStrideBytes, bufferWidth);
             }
+            break;
           }
         }
-
-        for(uint32_t i = 0; i < inBytesPerPixel; ++i)
-        {
-          outBuffer[targetPixelByte + i] = static_cast<uint8_t>(Min(static_cast<uint32_t>(Max(0, static_cast<int32_t>(channelSum[i] + 0.5f))), 255u));
-        }
-
-        targetPixelByte += outBufferStrideBytes;
       }
-    }
+    });
   }
   catch(Dali::DaliException& e)
   {
@@ -208,7 +422,7 @@ bool ConvoluteAndTranspose(uint8_t*       inBuffer,
   }
   catch(const std::bad_alloc& e)
   {
-    DALI_LOG_ERROR("Could not allocate temporary memory. (%u byte) e.what() : %s\n", (inBytesPerPixel + rows), e.what());
+    DALI_LOG_ERROR("Could not allocate temporary memory. (%u byte) e.what() : %s\n", static_cast<uint32_t>(rows * sizeof(float) + (bufferWidth + rows) * sizeof(uint32_t)), e.what());
     return false;
   }
 
@@ -216,7 +430,7 @@ bool ConvoluteAndTranspose(uint8_t*       inBuffer,
 }
 } // namespace
 
-bool PerformGaussianBlur(PixelBuffer& buffer, const float blurRadius)
+bool PerformGaussianBlur(PixelBuffer& buffer, const float blurRadius, const Dali::DevelPixelBuffer::GaussianBlurMode mode)
 {
   if(DALI_UNLIKELY(blurRadius < 0.0f))
   {
@@ -247,6 +461,25 @@ bool PerformGaussianBlur(PixelBuffer& buffer, const float blurRadius)
   // On leaving scope, softShadowImageBuffer will get destroyed.
   PixelBufferPtr softShadowImageBuffer = PixelBuffer::New(bufferHeight, bufferWidth, bufferPixelFormat);
 
+  if(mode == Dali::DevelPixelBuffer::GaussianBlurMode::FAST)
+  {
+    // Each pair of passes blurs horizontally then vertically with the same box, transposing twice.
+    uint32_t radii[BOX_BLUR_PASS_COUNT];
+    CalculateBoxBlurRadii(CalculateSigma(blurRadius), radii);
+    for(const uint32_t radius : radii)
+    {
+      if(DALI_UNLIKELY(!BoxBlurAndTranspose(buffer.GetBuffer(), softShadowImageBuffer->GetBuffer(), bufferWidth, bufferHeight, bufferStrideBytes, softShadowImageBuffer->GetStrideBytes(), bytesPerPixel, radius)))
+      {
+        return false;
+      }
+      if(DALI_UNLIKELY(!BoxBlurAndTranspose(softShadowImageBuffer->GetBuffer(), buffer.GetBuffer(), bufferHeight, bufferWidth, softShadowImageBuffer->GetStrideBytes(), bufferStrideBytes, bytesPerPixel, radius)))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
   // We perform the blur first but write its output image buffer transposed, so that we
   // can just do it in two passes. The first pass blurs horizontally and transposes, the
   // second pass does the same, but as the image is now transposed, it's really doing a
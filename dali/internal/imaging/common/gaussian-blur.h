@@ -17,6 +17,8 @@
  * limitations under the License.
  */
 
+// INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/pixel-buffer-devel.h>
 #include <dali/internal/imaging/common/pixel-buffer-impl.h>
 
 namespace Dali
@@ -33,12 +35,16 @@ namespace Adaptor
  *
  * @note The pixel format of the buffer must be RGBA8888
  *
+ * In FAST mode the Gaussian is approximated by three box blurs, whose cost per pixel
+ * doesn't grow with the radius.
+ *
  * @param[in] buffer The buffer to apply the Gaussian blur to
  * @param[in] blurRadius The radius for Gaussian blur
+ * @param[in] mode Whether to convolve with the exact Gaussian or approximate it
  *
  * @return @e false if the gaussian blur fails (invalid pixel format or memory issues).
  */
-bool PerformGaussianBlur(PixelBuffer& buffer, const float blurRadius);
+bool PerformGaussianBlur(PixelBuffer& buffer, const float blurRadius, const Dali::DevelPixelBuffer::GaussianBlurMode mode);
 
 } //namespace Adaptor
 
@@ -27,12 +27,19 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <climits>
+#include <cstdlib>
 #include <cstring>
 #include <memory>
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#endif
 
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
 #include <dali/devel-api/threading/mutex.h>
 #include <dali/integration-api/debug.h>
 #include <dali/internal/imaging/common/file-download.h>
+#include <dali/internal/system/common/environment-variables.h>
 #include <dali/internal/system/common/file-reader.h>
 #include <dali/internal/system/common/system-error-print.h>
 #include <dali/public-api/images/pixel-data.h>
@@ -69,6 +76,8 @@ constexpr size_t MAXIMUM_DOWNLOAD_IMAGE_SIZE = 50 * 1024 * 1024;
 
 constexpr int LOCAL_CACHED_COLOR_GENERATE_THRESHOLD = 64; ///< Generate color map optimize only if colorCount * threshold < width * height, So we don't loop if image is small
 
+constexpr std::size_t STREAMING_WORKING_FRAME_COUNT = 3u; ///< The current, previous and last preserved frames, needed to decode the next frame.
+
 #if GIFLIB_MAJOR < 5
 const int DISPOSE_BACKGROUND = 2; /* Set area too background color */
 const int DISPOSE_PREVIOUS   = 3; /* Restore to previous content */
@@ -133,6 +142,7 @@ struct GifAnimationData
   }
 
   std::vector<ImageFrame> frames;
+  std::vector<int>        frameOffsets; ///< The position in the file of the image record of each frame, by frame index - 1.
   int                     frameCount;
   int                     loopCount;
   int                     currentFrame;
@@ -169,7 +179,9 @@ struct LoaderInfo
     : fileName(nullptr),
       globalMap(nullptr),
       length(0),
-      isLocalResource(true)
+      isLocalResource(true),
+      useMemoryMap(false),
+      isMapped(false)
     {
     }
 
@@ -177,7 +189,16 @@ struct LoaderInfo
     {
       if(globalMap)
       {
-        free(globalMap);
+#if !defined(_WIN32)
+        if(isMapped)
+        {
+          munmap(globalMap, static_cast<size_t>(length));
+        }
+        else
+#endif
+        {
+          free(globalMap);
+        }
         globalMap = nullptr;
       }
     }
@@ -186,6 +207,7 @@ struct LoaderInfo
 
   private:
     bool LoadLocalFile();
+    bool MapLocalFile();
     bool LoadRemoteFile();
 
   public:
@@ -193,6 +215,8 @@ struct LoaderInfo
     unsigned char* globalMap;       /**< A pointer to the entire contents of the file */
     long long      length;          /**< The length of the file in bytes. */
     bool           isLocalResource; /**< The flag whether the file is a local resource */
+    bool           useMemoryMap;    /**< Whether a local file is memory mapped rather than read */
+    bool           isMapped;        /**< Whether globalMap is memory mapped */
   };
 
   struct FileInfo
@@ -214,6 +238,8 @@ struct LoaderInfo
   std::unique_ptr<GifAccessorBase> gifAccessor{nullptr};
   int                              imageNumber{0};
   FileInfo                         fileInfo;
+  std::size_t                      maxFrameMemory{0u};  ///< The memory of the decoded frames in the streaming mode, in bytes. 0 if not streaming.
+  int                              keyFrameInterval{0}; ///< The interval of the frames kept in the streaming mode. 0 if none.
 };
 
 struct ImageProperties
@@ -290,7 +316,8 @@ bool LoaderInfo::FileData::LoadFile()
   bool success = false;
   if(isLocalResource)
   {
-    success = LoadLocalFile();
+    // The pages of a mapped file are only read when a frame needs them, and can be dropped by the system.
+    success = (useMemoryMap && MapLocalFile()) || LoadLocalFile();
   }
   else
   {
@@ -351,6 +378,41 @@ bool LoaderInfo::FileData::LoadLocalFile()
   return true;
 }
 
+bool LoaderInfo::FileData::MapLocalFile()
+{
+#if !defined(_WIN32)
+  int fd = open(fileName, O_RDONLY | O_CLOEXEC);
+  if(DALI_UNLIKELY(fd < 0))
+  {
+    // It may be a resource which FileReader can read, e.g. an asset. Read it instead.
+    return false;
+  }
+
+  bool        success = false;
+  struct stat fileStat;
+  if(DALI_LIKELY(fstat(fd, &fileStat) == 0 && fileStat.st_size > 0 && fileStat.st_size <= INT_MAX))
+  {
+    void* address = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    if(DALI_LIKELY(address != MAP_FAILED))
+    {
+      globalMap = static_cast<unsigned char*>(address);
+      length    = static_cast<long long>(fileStat.st_size);
+      isMapped  = true;
+      success   = true;
+    }
+    else
+    {
+      DALI_LOG_ERROR("mmap is failed. size : %lld\n", static_cast<long long>(fileStat.st_size));
+      DALI_PRINT_SYSTEM_ERROR_LOG();
+    }
+  }
+  close(fd);
+  return success;
+#else
+  return false;
+#endif
+}
+
 bool LoaderInfo::FileData::LoadRemoteFile()
 {
   // remote file
@@ -486,6 +548,59 @@ ImageFrame* FindFrame(const GifAnimationData& animated, int index)
   return nullptr;
 }
 
+/**
+ * @brief Find the frame which the canvas is restored to, when the frame before the given one is disposed to previous.
+ *
+ * @param[in] animated A structure containing GIF animation data
+ * @param[in] index Frame index to be drawn
+ * @return A pointer to the ImageFrame, or nullptr if there is none.
+ */
+ImageFrame* FindLastPreservedFrame(const GifAnimationData& animated, int index)
+{
+  ImageFrame* lastPreservedFrame = nullptr;
+  int         prevIndex          = 2;
+  do
+  {
+    lastPreservedFrame = FindFrame(animated, index - prevIndex);
+    prevIndex++;
+  } while(lastPreservedFrame && lastPreservedFrame->info.dispose == DISPOSE_PREVIOUS);
+  return lastPreservedFrame;
+}
+
+/**
+ * @brief Whether the decoding can resume after the given frame, i.e. the frames the next one is drawn on are kept.
+ *
+ * @param[in] animated A structure containing GIF animation data
+ * @param[in] index Frame index to resume after
+ * @return The true or false whether the next frame can be decoded.
+ */
+bool CanResumeAfter(const GifAnimationData& animated, int index)
+{
+  const ImageFrame* frame = FindFrame(animated, index);
+  if(!frame || !frame->data)
+  {
+    return false;
+  }
+  if(frame->info.dispose != DISPOSE_PREVIOUS)
+  {
+    return true;
+  }
+  const ImageFrame* lastPreservedFrame = FindLastPreservedFrame(animated, index + 1);
+  return lastPreservedFrame && lastPreservedFrame->data;
+}
+
+/**
+ * @brief Whether the streaming mode keeps the decoded data of a frame, so the frames after it can be decoded from it.
+ *
+ * @param[in] frame The frame
+ * @param[in] keyFrameInterval The interval of the key frames, or 0 if there is none
+ * @return The true or false whether the frame is a key frame.
+ */
+bool IsKeyFrame(const ImageFrame& frame, int keyFrameInterval)
+{
+  return (keyFrameInterval > 0) && ((frame.index - 1) % keyFrameInterval == 0) && (frame.info.dispose != DISPOSE_PREVIOUS);
+}
+
 /**
  * @brief Fill in an image with a specific rgba color value.
  *
@@ -666,6 +781,29 @@ void FlushFrames(GifAnimationData& animated, int width, int height, ImageFrame*
   DALI_LOG_INFO(gGifLoadingLogFilter, Debug::Concise, "FlushFrames() END \n");
 }
 
+/**
+ * @brief Flush out rgba frame images in the streaming mode. Only the key frames, and the current,
+ * previous and lastPreservedFrame frames (needed to decode the next frame) are kept.
+ *
+ * @param[in] animated A structure containing GIF animation data
+ * @param[in] keyFrameInterval The interval of the key frames, or 0 if there is none
+ * @param[in] thisframe The current frame
+ * @param[in] prevframe The previous frame
+ * @param[in] lastPreservedFrame The last preserved frame
+ */
+void FlushStreamingFrames(GifAnimationData& animated, int keyFrameInterval, ImageFrame* thisframe, ImageFrame* prevframe, ImageFrame* lastPreservedFrame)
+{
+  for(auto&& frame : animated.frames)
+  {
+    if((frame.data != nullptr) && (&frame != thisframe) && (&frame != prevframe) && (&frame != lastPreservedFrame) &&
+       !IsKeyFrame(frame, keyFrameInterval))
+    {
+      delete[] frame.data;
+      frame.data = nullptr;
+    }
+  }
+}
+
 /**
  * @brief allocate frame and frame info and append to list and store fields.
  *
@@ -1022,8 +1160,11 @@ void WalkThroughGifRecordsWhileReadingHeader(
   int&                   loopCount,
   bool&                  success)
 {
+  const LoaderInfo::FileInfo* fileInfo = reinterpret_cast<LoaderInfo::FileInfo*>(gifAccessor.gif->UserData);
   do
   {
+    // The decoding of a frame can start from its image record, as the extensions are only read here.
+    const int recordPosition = fileInfo->position;
     if(DGifGetRecordType(gifAccessor.gif, &rec) == GIF_ERROR)
     {
       // if we have a gif that ends part way through a sequence
@@ -1046,6 +1187,8 @@ void WalkThroughGifRecordsWhileReadingHeader(
       int          img_code;
       GifByteType* img;
 
+      animated.frameOffsets.push_back(recordPosition);
+
       // get image desc
       if(DALI_UNLIKELY(DGifGetImageDesc(gifAccessor.gif) == GIF_ERROR))
       {
@@ -1223,6 +1366,17 @@ bool ReadHeader(LoaderInfo&      loaderInfo,
 
           animated.currentFrame = 1;
 
+          // keep as many key frames as the memory of the streaming mode allows, beside the frames needed to decode.
+          if(loaderInfo.maxFrameMemory > 0u && animated.animated)
+          {
+            const std::size_t frameSize     = static_cast<std::size_t>(prop.w) * prop.h * sizeof(uint32_t);
+            const std::size_t maxFrames     = (frameSize > 0u) ? loaderInfo.maxFrameMemory / frameSize : 0u;
+            const std::size_t keyFrameCount = (maxFrames > STREAMING_WORKING_FRAME_COUNT) ? maxFrames - STREAMING_WORKING_FRAME_COUNT : 0u;
+
+            loaderInfo.keyFrameInterval = (keyFrameCount > 0u) ? static_cast<int>((static_cast<std::size_t>(animated.frameCount) + keyFrameCount - 1u) / keyFrameCount) : 0;
+            DALI_LOG_INFO(gGifLoadingLogFilter, Debug::Concise, "Streaming mode, frame size : %zu, key frame interval : %d\n", frameSize, loaderInfo.keyFrameInterval);
+          }
+
           // cache global color map
           ColorMapObject* colorMap = gifAccessor.gif->SColorMap;
           if(colorMap)
@@ -1362,18 +1516,13 @@ bool WalkThroughGifRecords(
           }
           else if(frameInfo->dispose == DISPOSE_PREVIOUS) // GIF_DISPOSE_RESTORE
           {
-            int prevIndex = 2;
-            do
+            // Find last preserved frame.
+            lastPreservedFrame = FindLastPreservedFrame(animated, imageNumber);
+            if(DALI_UNLIKELY(!lastPreservedFrame))
             {
-              // Find last preserved frame.
-              lastPreservedFrame = FindFrame(animated, imageNumber - prevIndex);
-              if(DALI_UNLIKELY(!lastPreservedFrame))
-              {
-                DALI_LOG_ERROR("LOAD_ERROR_LAST_PRESERVED_FRAME_NOT_FOUND");
-                return false;
-              }
-              prevIndex++;
-            } while(lastPreservedFrame && lastPreservedFrame->info.dispose == DISPOSE_PREVIOUS);
+              DALI_LOG_ERROR("LOAD_ERROR_LAST_PRESERVED_FRAME_NOT_FOUND");
+              return false;
+            }
 
             if(lastPreservedFrame)
             {
@@ -1412,7 +1561,14 @@ bool WalkThroughGifRecords(
         // mark as loaded and done
         thisFrame->loaded = true;
 
-        FlushFrames(animated, prop.w, prop.h, thisFrame, previousFrame, lastPreservedFrame);
+        if(loaderInfo.maxFrameMemory > 0u)
+        {
+          FlushStreamingFrames(animated, loaderInfo.keyFrameInterval, thisFrame, previousFrame, lastPreservedFrame);
+        }
+        else
+        {
+          FlushFrames(animated, prop.w, prop.h, thisFrame, previousFrame, lastPreservedFrame);
+        }
       }
       // if we have a frame BUT the image is not animated. different
       // path
@@ -1512,10 +1668,27 @@ bool ReadNextFrame(LoaderInfo& loaderInfo, ImageProperties& prop, //  use for w
   }
   else if(!(frame->loaded) || !(frame->data))
   {
+    // In the streaming mode, resume from the closest frame kept before the requested one.
+    // If the decoder isn't right after it, reopen it at the image record of the next frame.
+    int resumeIndex = -1;
+    if(loaderInfo.maxFrameMemory > 0u && animated.animated)
+    {
+      resumeIndex = index - 1;
+      while(resumeIndex > 0 && !CanResumeAfter(animated, resumeIndex))
+      {
+        resumeIndex--;
+      }
+
+      if(loaderInfo.gifAccessor && loaderInfo.imageNumber != resumeIndex + 1)
+      {
+        loaderInfo.gifAccessor.reset();
+        loaderInfo.imageNumber = 0;
+      }
+    }
     // if we want to go backwards, we likely need/want to re-decode from the
     // start as we have nothing to build on. If there is a gif, imageNumber
     // has been set already.
-    if(loaderInfo.gifAccessor && loaderInfo.imageNumber > 0)
+    else if(loaderInfo.gifAccessor && loaderInfo.imageNumber > 0)
     {
       if((index > 0) && (index < loaderInfo.imageNumber) && (animated.animated))
       {
@@ -1543,6 +1716,12 @@ bool ReadNextFrame(LoaderInfo& loaderInfo, ImageProperties& prop, //  use for w
       }
       loaderInfo.gifAccessor = std::move(gifAccessor);
       loaderInfo.imageNumber = 1;
+
+      if(resumeIndex > 0 && static_cast<std::size_t>(resumeIndex) < animated.frameOffsets.size())
+      {
+        loaderInfo.fileInfo.position = animated.frameOffsets[resumeIndex];
+        loaderInfo.imageNumber       = resumeIndex + 1;
+      }
     }
 
     // our current position is the previous frame we decoded from the file
@@ -1589,6 +1768,11 @@ public:
     loaderInfo.gifAccessor              = nullptr;
     loaderInfo.fileData.fileName        = mUrl.c_str();
     loaderInfo.fileData.isLocalResource = isLocalResource;
+
+    // The streaming mode maps the file, and bounds the memory of the decoded frames.
+    const char* frameMemoryString    = EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_GIF_STREAMING_FRAME_MEMORY);
+    loaderInfo.maxFrameMemory        = frameMemoryString ? std::strtoul(frameMemoryString, nullptr, 10) * 1024u : 0u;
+    loaderInfo.fileData.useMemoryMap = (loaderInfo.maxFrameMemory > 0u);
   }
 
   bool LoadGifInformation()
@@ -41,6 +41,9 @@ namespace Adaptor
  * Note, once the GIF has loaded, the undecoded data will reside in memory until this object
  * is released. (This is to speed up frame loads, which would otherwise have to re-acquire the
  * data from disk)
+ * With DALI_GIF_STREAMING_FRAME_MEMORY set, a local file is memory mapped instead, and the decoded
+ * frames are bounded to that memory: only evenly spaced key frames are kept, and a frame is decoded
+ * again from the closest key frame before it.
  */
 class GifLoading : public Internal::Adaptor::AnimatedImageLoading
 {
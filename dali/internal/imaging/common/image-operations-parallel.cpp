@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/common/image-operations-parallel.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/async-task-manager.h>
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/devel-api/threading/conditional-wait.h>
+#include <dali/integration-api/debug.h>
+#include <dali/integration-api/trace.h>
+#include <dali/public-api/math/math-utils.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/async-task-manager-impl.h>
+#include <dali/internal/system/common/environment-variables.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+namespace ImageOperationsParallel
+{
+namespace
+{
+constexpr uint32_t MAXIMUM_BAND_COUNT      = 16u;         ///< Same as the maximum size of the async task thread pool.
+constexpr uint32_t MINIMUM_PIXELS_PER_BAND = 128u * 1024u; ///< Smaller bands cost more to schedule than to process.
+
+DALI_INIT_TRACE_FILTER(gTraceFilter, DALI_TRACE_IMAGE_PERFORMANCE_MARKER, false);
+
+uint32_t GetInitialMaximumBandCount()
+{
+  const char* bandCountString = EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_IMAGE_OPERATIONS_PARALLEL_BANDS);
+  const auto  bandCount       = bandCountString ? std::strtoul(bandCountString, nullptr, 10) : 0;
+  return static_cast<uint32_t>(Clamp<unsigned long>(bandCount, 1u, MAXIMUM_BAND_COUNT));
+}
+
+std::atomic<uint32_t>& MaximumBandCount()
+{
+  static std::atomic<uint32_t> maximumBandCount(GetInitialMaximumBandCount());
+  return maximumBandCount;
+}
+
+/**
+ * @brief The bands of one operation, shared between the calling thread and the helper tasks.
+ */
+class BandJob
+{
+public:
+  BandJob(const BandFunction& function, uint32_t count, uint32_t bandCount)
+  : mFunction(function),
+    mCount(count),
+    mBandSize((count + bandCount - 1u) / bandCount),
+    mBandCount(bandCount),
+    mNextBand(0u),
+    mCompletedBandCount(0u)
+  {
+  }
+
+  /**
+   * @brief Claim and process the next unprocessed band.
+   * @return False if every band was already claimed.
+   */
+  bool ProcessNextBand()
+  {
+    const uint32_t band = mNextBand.fetch_add(1u, std::memory_order_relaxed);
+    if(band >= mBandCount)
+    {
+      return false;
+    }
+
+    // The function stays valid while any claimed band is unfinished, as the caller waits for them all.
+    const uint32_t begin = band * mBandSize;
+    const uint32_t end   = std::min(begin + mBandSize, mCount);
+    if(begin < end)
+    {
+      mFunction(begin, end);
+    }
+
+    ConditionalWait::ScopedLock lock(mConditionalWait);
+    if(++mCompletedBandCount == mBandCount)
+    {
+      mConditionalWait.Notify(lock);
+    }
+    return true;
+  }
+
+  /**
+   * @brief Wait until every band is processed.
+   */
+  void WaitForCompletion()
+  {
+    ConditionalWait::ScopedLock lock(mConditionalWait);
+    while(mCompletedBandCount < mBandCount)
+    {
+      mConditionalWait.Wait(lock);
+    }
+  }
+
+private:
+  const BandFunction&   mFunction;
+  const uint32_t        mCount;
+  const uint32_t        mBandSize;
+  const uint32_t        mBandCount;
+  std::atomic<uint32_t> mNextBand;
+  ConditionalWait       mConditionalWait;
+  uint32_t              mCompletedBandCount; ///< Must be used under mConditionalWait.
+};
+
+void BandTaskCompleted(Dali::AsyncTaskPtr)
+{
+}
+
+/**
+ * @brief Helps the calling thread by processing bands on a worker thread.
+ */
+class BandTask : public Dali::AsyncTask
+{
+public:
+  BandTask(std::shared_ptr<BandJob> job)
+  : Dali::AsyncTask(MakeCallback(&BandTaskCompleted), Dali::AsyncTask::PriorityType::HIGH, Dali::AsyncTask::ThreadType::WORKER_THREAD),
+    mJob(std::move(job))
+  {
+  }
+
+  void Process() override
+  {
+    while(mJob->ProcessNextBand())
+    {
+    }
+  }
+
+  Dali::StringView GetTaskName() const override
+  {
+    return "ImageOperationsBandTask";
+  }
+
+private:
+  std::shared_ptr<BandJob> mJob;
+};
+
+} // namespace
+
+uint32_t GetMaximumBandCount()
+{
+  return MaximumBandCount().load(std::memory_order_relaxed);
+}
+
+void SetMaximumBandCount(uint32_t bandCount)
+{
+  MaximumBandCount().store(Clamp(bandCount, 1u, MAXIMUM_BAND_COUNT), std::memory_order_relaxed);
+}
+
+uint32_t CalculateBandCount(uint32_t count, uint32_t pixelsPerRow)
+{
+  const uint32_t maximumBandCount = GetMaximumBandCount();
+  if(maximumBandCount <= 1u || count <= 1u || pixelsPerRow == 0u)
+  {
+    return 1u;
+  }
+
+  const uint64_t totalPixels = static_cast<uint64_t>(count) * pixelsPerRow;
+  const uint64_t bandCount   = std::min<uint64_t>(totalPixels / MINIMUM_PIXELS_PER_BAND, std::min(maximumBandCount, count));
+  return std::max(static_cast<uint32_t>(bandCount), 1u);
+}
+
+void ForEachBand(uint32_t count, uint32_t pixelsPerRow, const BandFunction& function)
+{
+  const uint32_t bandCount = CalculateBandCount(count, pixelsPerRow);
+  if(bandCount <= 1u)
+  {
+    function(0u, count);
+    return;
+  }
+
+  DALI_TRACE_SCOPE(gTraceFilter, "DALI_IMAGE_OPERATIONS_PARALLEL_BANDS");
+
+  auto job = std::make_shared<BandJob>(function, count, bandCount);
+
+  // The calling thread takes one share of the work itself.
+  for(uint32_t i = 1u; i < bandCount; ++i)
+  {
+    if(!Adaptor::AsyncTaskManager::AddTaskToManager(new BandTask(job)))
+    {
+      // No worker threads. Process every band on this thread.
+      break;
+    }
+  }
+
+  while(job->ProcessNextBand())
+  {
+  }
+  job->WaitForCompletion();
+}
+
+} // namespace ImageOperationsParallel
+
+} // namespace Platform
+
+} // namespace Internal
+
+} // namespace Dali
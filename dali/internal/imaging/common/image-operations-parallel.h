@@ -0,0 +1,87 @@
+#ifndef DALI_INTERNAL_PLATFORM_IMAGE_OPERATIONS_PARALLEL_H
+#define DALI_INTERNAL_PLATFORM_IMAGE_OPERATIONS_PARALLEL_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <functional>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+/**
+ * @brief Splits large image operations into bands which run on the AsyncTaskManager worker threads.
+ *
+ * The calling thread processes bands too, and only returns once every band is done.
+ * So it is safe to call from a worker thread even when every other worker is busy.
+ *
+ * The mode is off by default. Set DALI_IMAGE_OPERATIONS_PARALLEL_BANDS to the maximum
+ * number of bands (e.g. the number of cores) to enable it.
+ */
+namespace ImageOperationsParallel
+{
+/**
+ * @brief The function processing the rows (or columns) in the range [begin, end).
+ */
+using BandFunction = std::function<void(uint32_t begin, uint32_t end)>;
+
+/**
+ * @brief Retrieve the maximum number of bands an operation is split into.
+ * @return The maximum number of bands. 1 means operations run on the calling thread only.
+ */
+uint32_t GetMaximumBandCount();
+
+/**
+ * @brief Change the maximum number of bands an operation is split into.
+ * @param[in] bandCount The maximum number of bands. 0 or 1 disables the parallel mode.
+ */
+void SetMaximumBandCount(uint32_t bandCount);
+
+/**
+ * @brief Calculate how many bands an operation would be split into.
+ *
+ * Bands are kept large enough that the cost of a task outweighs the cost of scheduling it.
+ *
+ * @param[in] count The number of rows (or columns) to process.
+ * @param[in] pixelsPerRow The number of pixels in each row (or column).
+ * @return The number of bands. 1 if the operation should run on the calling thread only.
+ */
+uint32_t CalculateBandCount(uint32_t count, uint32_t pixelsPerRow);
+
+/**
+ * @brief Run the function over [0, count), split into bands.
+ *
+ * @param[in] count The number of rows (or columns) to process.
+ * @param[in] pixelsPerRow The number of pixels in each row (or column).
+ * @param[in] function The function to run for each band. Bands never overlap.
+ */
+void ForEachBand(uint32_t count, uint32_t pixelsPerRow, const BandFunction& function);
+
+} // namespace ImageOperationsParallel
+
+} // namespace Platform
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_PLATFORM_IMAGE_OPERATIONS_PARALLEL_H
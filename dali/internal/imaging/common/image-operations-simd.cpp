@@ -0,0 +1,875 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/common/image-operations-simd.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/integration-api/debug.h>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DALI_IMAGE_OPERATIONS_SIMD_X86
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define DALI_IMAGE_OPERATIONS_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/environment-variables.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+namespace ImageOperationsSimd
+{
+namespace
+{
+InstructionSet DetectInstructionSet()
+{
+#if defined(DALI_IMAGE_OPERATIONS_SIMD_X86)
+  __builtin_cpu_init();
+  if(__builtin_cpu_supports("avx2"))
+  {
+    return InstructionSet::AVX2;
+  }
+  if(__builtin_cpu_supports("sse4.1"))
+  {
+    return InstructionSet::SSE41;
+  }
+  return InstructionSet::NONE;
+#elif defined(DALI_IMAGE_OPERATIONS_SIMD_NEON)
+  return InstructionSet::NEON;
+#else
+  return InstructionSet::NONE;
+#endif
+}
+
+InstructionSet GetInitialInstructionSet()
+{
+  const char* disableSimd = EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_DISABLE_IMAGE_OPERATIONS_SIMD);
+  if(disableSimd && std::atoi(disableSimd) != 0)
+  {
+    return InstructionSet::NONE;
+  }
+  const InstructionSet instructionSet = GetSupportedInstructionSet();
+  DALI_LOG_RELEASE_INFO("Image operations use %s kernels\n", GetInstructionSetName(instructionSet));
+  return instructionSet;
+}
+
+std::atomic<InstructionSet>& ActiveInstructionSet()
+{
+  static std::atomic<InstructionSet> activeInstructionSet(GetInitialInstructionSet());
+  return activeInstructionSet;
+}
+
+#if defined(DALI_IMAGE_OPERATIONS_SIMD_X86)
+
+/**
+ * @brief Average bytes, rounding down like the scalar ((a ^ b) >> 1) + (a & b).
+ * pavgb rounds up, so subtract the lost low bit again.
+ */
+__attribute__((target("sse4.1"))) inline __m128i FloorAverageSse(__m128i a, __m128i b)
+{
+  return _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), _mm_set1_epi8(1)));
+}
+
+/** @copydoc FloorAverageSse */
+__attribute__((target("avx2"))) inline __m256i FloorAverageAvx2(__m256i a, __m256i b)
+{
+  return _mm256_sub_epi8(_mm256_avg_epu8(a, b), _mm256_and_si256(_mm256_xor_si256(a, b), _mm256_set1_epi8(1)));
+}
+
+__attribute__((target("sse4.1"))) uint32_t HalveScanlineRGBA8888Sse(uint8_t* pixels, uint32_t firstOutputPixel, uint32_t outputPixelCount)
+{
+  uint32_t outPixel = firstOutputPixel;
+  for(; outPixel + 4u <= outputPixelCount; outPixel += 4u)
+  {
+    // Both loads complete before the store, and the store never passes the next unread input.
+    const __m128 first  = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + outPixel * 8u)));
+    const __m128 second = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + outPixel * 8u + 16u)));
+    const __m128i even  = _mm_castps_si128(_mm_shuffle_ps(first, second, _MM_SHUFFLE(2, 0, 2, 0)));
+    const __m128i odd   = _mm_castps_si128(_mm_shuffle_ps(first, second, _MM_SHUFFLE(3, 1, 3, 1)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + outPixel * 4u), FloorAverageSse(even, odd));
+  }
+  return outPixel;
+}
+
+__attribute__((target("avx2"))) uint32_t HalveScanlineRGBA8888Avx2(uint8_t* pixels, uint32_t outputPixelCount)
+{
+  uint32_t outPixel = 0;
+  for(; outPixel + 8u <= outputPixelCount; outPixel += 8u)
+  {
+    const __m256 first  = _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pixels + outPixel * 8u)));
+    const __m256 second = _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pixels + outPixel * 8u + 32u)));
+    const __m256i even  = _mm256_castps_si256(_mm256_shuffle_ps(first, second, _MM_SHUFFLE(2, 0, 2, 0)));
+    const __m256i odd   = _mm256_castps_si256(_mm256_shuffle_ps(first, second, _MM_SHUFFLE(3, 1, 3, 1)));
+
+    // The in-lane shuffle leaves the pixel pairs ordered 0,2,1,3 across the register.
+    const __m256i averaged = _mm256_permute4x64_epi64(FloorAverageAvx2(even, odd), _MM_SHUFFLE(3, 1, 2, 0));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(pixels + outPixel * 4u), averaged);
+  }
+  return HalveScanlineRGBA8888Sse(pixels, outPixel, outputPixelCount);
+}
+
+__attribute__((target("sse4.1"))) uint32_t AverageScanlinesSse(const uint8_t* scanline1, const uint8_t* scanline2, uint8_t* outputScanline, uint32_t componentCount)
+{
+  uint32_t component = 0;
+  for(; component + 16u <= componentCount; component += 16u)
+  {
+    const __m128i c1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(scanline1 + component));
+    const __m128i c2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(scanline2 + component));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(outputScanline + component), FloorAverageSse(c1, c2));
+  }
+  return component;
+}
+
+__attribute__((target("avx2"))) uint32_t AverageScanlinesAvx2(const uint8_t* scanline1, const uint8_t* scanline2, uint8_t* outputScanline, uint32_t componentCount)
+{
+  uint32_t component = 0;
+  for(; component + 32u <= componentCount; component += 32u)
+  {
+    const __m256i c1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(scanline1 + component));
+    const __m256i c2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(scanline2 + component));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(outputScanline + component), FloorAverageAvx2(c1, c2));
+  }
+  return component + AverageScanlinesSse(scanline1 + component, scanline2 + component, outputScanline + component, componentCount - component);
+}
+
+__attribute__((target("sse4.1"))) uint32_t LinearSampleScanline4BPPSse(const uint8_t* inScanline1, const uint8_t* inScanline2, uint32_t inputWidth, uint32_t inputYWeight, uint8_t* outScanline, uint32_t desiredWidth, uint32_t deltaX)
+{
+  const uint32_t* const in1 = reinterpret_cast<const uint32_t*>(inScanline1);
+  const uint32_t* const in2 = reinterpret_cast<const uint32_t*>(inScanline2);
+  uint32_t* const       out = reinterpret_cast<uint32_t*>(outScanline);
+
+  const __m128i topWeight    = _mm_set1_epi32(static_cast<int32_t>(65535u - inputYWeight));
+  const __m128i bottomWeight = _mm_set1_epi32(static_cast<int32_t>(inputYWeight));
+  const __m128i roundingBias = _mm_set1_epi64x(1ll << 31);
+
+  uint32_t inX = 0;
+  for(uint32_t outX = 0; outX < desiredWidth; ++outX)
+  {
+    const uint32_t integerX1 = inX >> 16u;
+    const uint32_t integerX2 = integerX1 + 1 >= inputWidth ? integerX1 : integerX1 + 1;
+
+    const __m128i leftWeight  = _mm_set1_epi32(static_cast<int32_t>(65535u - (inX & 65535u)));
+    const __m128i rightWeight = _mm_set1_epi32(static_cast<int32_t>(inX & 65535u));
+
+    const __m128i tl = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(static_cast<int32_t>(in1[integerX1])));
+    const __m128i tr = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(static_cast<int32_t>(in1[integerX2])));
+    const __m128i bl = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(static_cast<int32_t>(in2[integerX1])));
+    const __m128i br = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(static_cast<int32_t>(in2[integerX2])));
+
+    // Horizontal blends are 16.16 fixed-point and fit in 32 bits.
+    const __m128i top    = _mm_add_epi32(_mm_mullo_epi32(tl, leftWeight), _mm_mullo_epi32(tr, rightWeight));
+    const __m128i bottom = _mm_add_epi32(_mm_mullo_epi32(bl, leftWeight), _mm_mullo_epi32(br, rightWeight));
+
+    // The vertical blend needs 16.32 fixed-point, so blend even and odd components separately in 64 bit lanes.
+    const __m128i even = _mm_add_epi64(_mm_add_epi64(_mm_mul_epu32(top, topWeight), _mm_mul_epu32(bottom, bottomWeight)), roundingBias);
+    const __m128i odd  = _mm_add_epi64(_mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(top, 32), topWeight), _mm_mul_epu32(_mm_srli_epi64(bottom, 32), bottomWeight)), roundingBias);
+
+    // The rounded integer results are the upper halves of the 64 bit lanes.
+    const __m128i rounded = _mm_blend_epi16(_mm_srli_epi64(even, 32), odd, 0xCC);
+    const __m128i packed  = _mm_packus_epi16(_mm_packus_epi32(rounded, rounded), rounded);
+    out[outX]             = static_cast<uint32_t>(_mm_cvtsi128_si32(packed));
+
+    inX += deltaX;
+  }
+  return desiredWidth;
+}
+
+__attribute__((target("avx2"))) uint32_t PointSampleScanline4BPPAvx2(const uint8_t* inScanline, uint8_t* outScanline, uint32_t desiredWidth, uint32_t deltaX)
+{
+  const int* const in = reinterpret_cast<const int*>(inScanline);
+
+  // Lane k tracks the fixed-point coordinate of output pixel outX + k, offset by a half for rounding.
+  const __m256i step = _mm256_set1_epi32(static_cast<int32_t>(deltaX * 8u));
+  __m256i       inX  = _mm256_add_epi32(_mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(static_cast<int32_t>(deltaX))),
+                                 _mm256_set1_epi32(1 << 15));
+
+  uint32_t outX = 0;
+  for(; outX + 8u <= desiredWidth; outX += 8u)
+  {
+    const __m256i integerX = _mm256_srli_epi32(inX, 16);
+    const __m256i pixels   = _mm256_i32gather_epi32(in, integerX, 4);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(outScanline + outX * 4u), pixels);
+    inX = _mm256_add_epi32(inX, step);
+  }
+  return outX;
+}
+
+/**
+ * @brief Load one 4 byte pixel as four 32 bit lanes.
+ */
+__attribute__((target("sse4.1"))) inline __m128i LoadPixelSse(const uint8_t* pixel)
+{
+  int32_t value;
+  memcpy(&value, pixel, sizeof(value));
+  return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(value));
+}
+
+/**
+ * @brief Store four 32 bit lanes as one 4 byte pixel, saturating each lane to [0, 255].
+ */
+__attribute__((target("sse4.1"))) inline void StorePixelSse(uint8_t* pixel, __m128i lanes)
+{
+  const __m128i words = _mm_packus_epi32(lanes, lanes);
+  const int32_t value = _mm_cvtsi128_si32(_mm_packus_epi16(words, words));
+  memcpy(pixel, &value, sizeof(value));
+}
+
+__attribute__((target("sse4.1"))) uint32_t BoxBlurTransposeScanline4BPPSse(const uint8_t* inScanline, const uint32_t* windowIndices, uint32_t radius, uint8_t* outPixel, uint32_t outStrideBytes, uint32_t width, uint32_t multiplier)
+{
+  const uint32_t boxWidth = radius * 2u + 1u;
+
+  __m128i sum = _mm_setzero_si128();
+  for(uint32_t i = 0; i < boxWidth; ++i)
+  {
+    sum = _mm_add_epi32(sum, LoadPixelSse(inScanline + windowIndices[i] * 4u));
+  }
+
+  const __m128i factor       = _mm_set1_epi32(static_cast<int32_t>(multiplier));
+  const __m128i roundingBias = _mm_set1_epi32(1 << 22);
+  for(uint32_t x = 0; x < width; ++x, outPixel += outStrideBytes)
+  {
+    StorePixelSse(outPixel, _mm_srli_epi32(_mm_add_epi32(_mm_mullo_epi32(sum, factor), roundingBias), 23));
+
+    // Slide the box one pixel along.
+    sum = _mm_add_epi32(sum, LoadPixelSse(inScanline + windowIndices[x + boxWidth] * 4u));
+    sum = _mm_sub_epi32(sum, LoadPixelSse(inScanline + windowIndices[x] * 4u));
+  }
+  return width;
+}
+
+__attribute__((target("sse4.1"))) uint32_t ConvolveTransposeScanline4BPPSse(const uint8_t* inScanline, const uint32_t* windowIndices, const float* weights, uint32_t kernelSize, uint8_t* outPixel, uint32_t outStrideBytes, uint32_t width)
+{
+  const __m128 half = _mm_set1_ps(0.5f);
+  for(uint32_t x = 0; x < width; ++x, outPixel += outStrideBytes)
+  {
+    // Same order of operations as the scalar code, without fused multiply-adds, so the sums match exactly.
+    __m128 sum = _mm_setzero_ps();
+    for(uint32_t i = 0; i < kernelSize; ++i)
+    {
+      const __m128 pixel = _mm_cvtepi32_ps(LoadPixelSse(inScanline + windowIndices[x + i] * 4u));
+      sum                = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weights[i]), pixel));
+    }
+    StorePixelSse(outPixel, _mm_cvttps_epi32(_mm_add_ps(sum, half)));
+  }
+  return width;
+}
+
+/**
+ * @brief Multiply 16 bit lanes holding products of two bytes by 1/255, exactly like MultiplyAndNormalizeColor():
+ * ((xy << 15) + (xy << 7) + xy) >> 23 is xy * 32897 >> 23, i.e. the high half of xy * 32897 shifted right by 7.
+ */
+__attribute__((target("sse4.1"))) inline __m128i NormalizeProductsSse(__m128i products)
+{
+  return _mm_srli_epi16(_mm_mulhi_epu16(products, _mm_set1_epi16(static_cast<int16_t>(32897))), 7);
+}
+
+/** @copydoc NormalizeProductsSse */
+__attribute__((target("avx2"))) inline __m256i NormalizeProductsAvx2(__m256i products)
+{
+  return _mm256_srli_epi16(_mm256_mulhi_epu16(products, _mm256_set1_epi16(static_cast<int16_t>(32897))), 7);
+}
+
+/**
+ * @brief Multiply the bytes of two registers, normalized.
+ */
+__attribute__((target("sse4.1"))) inline __m128i MultiplyBytesSse(__m128i a, __m128i b)
+{
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i low  = NormalizeProductsSse(_mm_mullo_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero)));
+  const __m128i high = NormalizeProductsSse(_mm_mullo_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero)));
+  return _mm_packus_epi16(low, high);
+}
+
+/** @copydoc MultiplyBytesSse */
+__attribute__((target("avx2"))) inline __m256i MultiplyBytesAvx2(__m256i a, __m256i b)
+{
+  // The unpacks and the pack both work within 128 bit lanes, so the bytes stay in place.
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i low  = NormalizeProductsAvx2(_mm256_mullo_epi16(_mm256_unpacklo_epi8(a, zero), _mm256_unpacklo_epi8(b, zero)));
+  const __m256i high = NormalizeProductsAvx2(_mm256_mullo_epi16(_mm256_unpackhi_epi8(a, zero), _mm256_unpackhi_epi8(b, zero)));
+  return _mm256_packus_epi16(low, high);
+}
+
+__attribute__((target("sse4.1"))) uint32_t MultiplyColorByAlphaScanline4BPPSse(uint8_t* pixels, uint32_t firstPixel, uint32_t pixelCount)
+{
+  const __m128i alphaShuffle = _mm_setr_epi8(3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15);
+  const __m128i alphaBytes   = _mm_set1_epi32(static_cast<int32_t>(0xFF000000u));
+
+  uint32_t pixel = firstPixel;
+  for(; pixel + 4u <= pixelCount; pixel += 4u)
+  {
+    const __m128i values     = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + pixel * 4u));
+    const __m128i multiplied = MultiplyBytesSse(values, _mm_shuffle_epi8(values, alphaShuffle));
+
+    // Keep the alpha itself.
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + pixel * 4u), _mm_blendv_epi8(multiplied, values, alphaBytes));
+  }
+  return pixel;
+}
+
+__attribute__((target("avx2"))) uint32_t MultiplyColorByAlphaScanline4BPPAvx2(uint8_t* pixels, uint32_t pixelCount)
+{
+  const __m256i alphaShuffle = _mm256_setr_epi8(3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15, 3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15);
+  const __m256i alphaBytes   = _mm256_set1_epi32(static_cast<int32_t>(0xFF000000u));
+
+  uint32_t pixel = 0;
+  for(; pixel + 8u <= pixelCount; pixel += 8u)
+  {
+    const __m256i values     = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pixels + pixel * 4u));
+    const __m256i multiplied = MultiplyBytesAvx2(values, _mm256_shuffle_epi8(values, alphaShuffle));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(pixels + pixel * 4u), _mm256_blendv_epi8(multiplied, values, alphaBytes));
+  }
+  return MultiplyColorByAlphaScanline4BPPSse(pixels, pixel, pixelCount);
+}
+
+/**
+ * @brief Load the mask bytes of 4 pixels, each repeated for the 4 bytes of its pixel.
+ */
+__attribute__((target("sse4.1"))) inline __m128i LoadMaskSse(const uint8_t* mask)
+{
+  int32_t value;
+  memcpy(&value, mask, sizeof(value));
+  return _mm_shuffle_epi8(_mm_cvtsi32_si128(value), _mm_setr_epi8(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3));
+}
+
+/**
+ * @brief Load the mask bytes of 8 pixels, each repeated for the 4 bytes of its pixel.
+ */
+__attribute__((target("avx2"))) inline __m256i LoadMaskAvx2(const uint8_t* mask)
+{
+  const __m256i values = _mm256_broadcastsi128_si256(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(mask)));
+  return _mm256_shuffle_epi8(values, _mm256_setr_epi8(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7));
+}
+
+__attribute__((target("sse4.1"))) uint32_t MultiplyAlphaByMaskScanline4BPPSse(uint8_t* pixels, const uint8_t* mask, uint32_t firstPixel, uint32_t pixelCount)
+{
+  const __m128i alphaBytes = _mm_set1_epi32(static_cast<int32_t>(0xFF000000u));
+
+  uint32_t pixel = firstPixel;
+  for(; pixel + 4u <= pixelCount; pixel += 4u)
+  {
+    const __m128i values     = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + pixel * 4u));
+    const __m128i multiplied = MultiplyBytesSse(values, LoadMaskSse(mask + pixel));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + pixel * 4u), _mm_blendv_epi8(values, multiplied, alphaBytes));
+  }
+  return pixel;
+}
+
+__attribute__((target("avx2"))) uint32_t MultiplyAlphaByMaskScanline4BPPAvx2(uint8_t* pixels, const uint8_t* mask, uint32_t pixelCount)
+{
+  const __m256i alphaBytes = _mm256_set1_epi32(static_cast<int32_t>(0xFF000000u));
+
+  uint32_t pixel = 0;
+  for(; pixel + 8u <= pixelCount; pixel += 8u)
+  {
+    const __m256i values     = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pixels + pixel * 4u));
+    const __m256i multiplied = MultiplyBytesAvx2(values, LoadMaskAvx2(mask + pixel));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(pixels + pixel * 4u), _mm256_blendv_epi8(values, multiplied, alphaBytes));
+  }
+  return MultiplyAlphaByMaskScanline4BPPSse(pixels, mask, pixel, pixelCount);
+}
+
+__attribute__((target("sse4.1"))) uint32_t MultiplyPixelsByMaskScanline4BPPSse(uint8_t* pixels, const uint8_t* mask, uint32_t firstPixel, uint32_t pixelCount)
+{
+  uint32_t pixel = firstPixel;
+  for(; pixel + 4u <= pixelCount; pixel += 4u)
+  {
+    const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + pixel * 4u));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + pixel * 4u), MultiplyBytesSse(values, LoadMaskSse(mask + pixel)));
+  }
+  return pixel;
+}
+
+__attribute__((target("avx2"))) uint32_t MultiplyPixelsByMaskScanline4BPPAvx2(uint8_t* pixels, const uint8_t* mask, uint32_t pixelCount)
+{
+  uint32_t pixel = 0;
+  for(; pixel + 8u <= pixelCount; pixel += 8u)
+  {
+    const __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pixels + pixel * 4u));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(pixels + pixel * 4u), MultiplyBytesAvx2(values, LoadMaskAvx2(mask + pixel)));
+  }
+  return MultiplyPixelsByMaskScanline4BPPSse(pixels, mask, pixel, pixelCount);
+}
+
+#elif defined(DALI_IMAGE_OPERATIONS_SIMD_NEON)
+
+uint32_t HalveScanlineRGBA8888Neon(uint8_t* pixels, uint32_t outputPixelCount)
+{
+  uint32_t* const alignedPixels = reinterpret_cast<uint32_t*>(pixels);
+
+  uint32_t outPixel = 0;
+  for(; outPixel + 4u <= outputPixelCount; outPixel += 4u)
+  {
+    // De-interleave even and odd pixels, then halving-add rounds down like the scalar code.
+    const uint32x4x2_t pairs = vld2q_u32(alignedPixels + outPixel * 2u);
+    vst1q_u32(alignedPixels + outPixel, vreinterpretq_u32_u8(vhaddq_u8(vreinterpretq_u8_u32(pairs.val[0]), vreinterpretq_u8_u32(pairs.val[1]))));
+  }
+  return outPixel;
+}
+
+uint32_t AverageScanlinesNeon(const uint8_t* scanline1, const uint8_t* scanline2, uint8_t* outputScanline, uint32_t componentCount)
+{
+  uint32_t component = 0;
+  for(; component + 16u <= componentCount; component += 16u)
+  {
+    vst1q_u8(outputScanline + component, vhaddq_u8(vld1q_u8(scanline1 + component), vld1q_u8(scanline2 + component)));
+  }
+  return component;
+}
+
+uint32_t LinearSampleScanline4BPPNeon(const uint8_t* inScanline1, const uint8_t* inScanline2, uint32_t inputWidth, uint32_t inputYWeight, uint8_t* outScanline, uint32_t desiredWidth, uint32_t deltaX)
+{
+  const uint32_t* const in1 = reinterpret_cast<const uint32_t*>(inScanline1);
+  const uint32_t* const in2 = reinterpret_cast<const uint32_t*>(inScanline2);
+  uint32_t* const       out = reinterpret_cast<uint32_t*>(outScanline);
+
+  const uint32_t   topWeight    = 65535u - inputYWeight;
+  const uint32_t   bottomWeight = inputYWeight;
+  const uint64x2_t roundingBias = vdupq_n_u64(1ull << 31);
+
+  uint32_t inX = 0;
+  for(uint32_t outX = 0; outX < desiredWidth; ++outX)
+  {
+    const uint32_t integerX1 = inX >> 16u;
+    const uint32_t integerX2 = integerX1 + 1 >= inputWidth ? integerX1 : integerX1 + 1;
+
+    const uint32_t rightWeight = inX & 65535u;
+    const uint32_t leftWeight  = 65535u - rightWeight;
+
+    const uint32x4_t tl = vmovl_u16(vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(in1[integerX1])))));
+    const uint32x4_t tr = vmovl_u16(vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(in1[integerX2])))));
+    const uint32x4_t bl = vmovl_u16(vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(in2[integerX1])))));
+    const uint32x4_t br = vmovl_u16(vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(in2[integerX2])))));
+
+    // Horizontal blends are 16.16 fixed-point and fit in 32 bits.
+    const uint32x4_t top    = vmlaq_n_u32(vmulq_n_u32(tl, leftWeight), tr, rightWeight);
+    const uint32x4_t bottom = vmlaq_n_u32(vmulq_n_u32(bl, leftWeight), br, rightWeight);
+
+    // The vertical blend needs 16.32 fixed-point.
+    const uint64x2_t low  = vaddq_u64(vmlal_n_u32(vmull_n_u32(vget_low_u32(top), topWeight), vget_low_u32(bottom), bottomWeight), roundingBias);
+    const uint64x2_t high = vaddq_u64(vmlal_n_u32(vmull_n_u32(vget_high_u32(top), topWeight), vget_high_u32(bottom), bottomWeight), roundingBias);
+
+    const uint32x4_t rounded = vcombine_u32(vshrn_n_u64(low, 32), vshrn_n_u64(high, 32));
+    const uint8x8_t  packed  = vmovn_u16(vcombine_u16(vmovn_u32(rounded), vdup_n_u16(0)));
+    out[outX]                = vget_lane_u32(vreinterpret_u32_u8(packed), 0);
+
+    inX += deltaX;
+  }
+  return desiredWidth;
+}
+
+/**
+ * @brief Load one 4 byte pixel as four 32 bit lanes.
+ */
+inline uint32x4_t LoadPixelNeon(const uint8_t* pixel)
+{
+  uint32_t value;
+  memcpy(&value, pixel, sizeof(value));
+  return vmovl_u16(vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(value)))));
+}
+
+/**
+ * @brief Store four 16 bit lanes as one 4 byte pixel, saturating each lane to [0, 255].
+ */
+inline void StorePixelNeon(uint8_t* pixel, uint16x4_t lanes)
+{
+  const uint32_t value = vget_lane_u32(vreinterpret_u32_u8(vqmovn_u16(vcombine_u16(lanes, lanes))), 0);
+  memcpy(pixel, &value, sizeof(value));
+}
+
+uint32_t BoxBlurTransposeScanline4BPPNeon(const uint8_t* inScanline, const uint32_t* windowIndices, uint32_t radius, uint8_t* outPixel, uint32_t outStrideBytes, uint32_t width, uint32_t multiplier)
+{
+  const uint32_t boxWidth = radius * 2u + 1u;
+
+  uint32x4_t sum = vdupq_n_u32(0u);
+  for(uint32_t i = 0; i < boxWidth; ++i)
+  {
+    sum = vaddq_u32(sum, LoadPixelNeon(inScanline + windowIndices[i] * 4u));
+  }
+
+  const uint32x4_t roundingBias = vdupq_n_u32(1u << 22);
+  for(uint32_t x = 0; x < width; ++x, outPixel += outStrideBytes)
+  {
+    StorePixelNeon(outPixel, vqmovn_u32(vshrq_n_u32(vmlaq_n_u32(roundingBias, sum, multiplier), 23)));
+
+    // Slide the box one pixel along.
+    sum = vaddq_u32(sum, LoadPixelNeon(inScanline + windowIndices[x + boxWidth] * 4u));
+    sum = vsubq_u32(sum, LoadPixelNeon(inScanline + windowIndices[x] * 4u));
+  }
+  return width;
+}
+
+uint32_t ConvolveTransposeScanline4BPPNeon(const uint8_t* inScanline, const uint32_t* windowIndices, const float* weights, uint32_t kernelSize, uint8_t* outPixel, uint32_t outStrideBytes, uint32_t width)
+{
+  const float32x4_t half = vdupq_n_f32(0.5f);
+  for(uint32_t x = 0; x < width; ++x, outPixel += outStrideBytes)
+  {
+    // Multiply and add separately, like the scalar code.
+    float32x4_t sum = vdupq_n_f32(0.0f);
+    for(uint32_t i = 0; i < kernelSize; ++i)
+    {
+      const float32x4_t pixel = vcvtq_f32_u32(LoadPixelNeon(inScanline + windowIndices[x + i] * 4u));
+      sum                     = vaddq_f32(sum, vmulq_n_f32(pixel, weights[i]));
+    }
+    StorePixelNeon(outPixel, vqmovun_s32(vcvtq_s32_f32(vaddq_f32(sum, half))));
+  }
+  return width;
+}
+
+/**
+ * @brief Multiply the bytes of two registers, normalized exactly like MultiplyAndNormalizeColor().
+ */
+inline uint8x8_t MultiplyBytesNeon(uint8x8_t a, uint8x8_t b)
+{
+  // xy * 32897 >> 23, as the high half of the 32 bit product shifted right by 7.
+  const uint16x8_t products = vmull_u8(a, b);
+  const uint16x4_t low      = vshrn_n_u32(vmull_n_u16(vget_low_u16(products), 32897u), 16);
+  const uint16x4_t high     = vshrn_n_u32(vmull_n_u16(vget_high_u16(products), 32897u), 16);
+  return vshrn_n_u16(vcombine_u16(low, high), 7);
+}
+
+uint32_t MultiplyColorByAlphaScanline4BPPNeon(uint8_t* pixels, uint32_t pixelCount)
+{
+  uint32_t pixel = 0;
+  for(; pixel + 8u <= pixelCount; pixel += 8u)
+  {
+    uint8x8x4_t values = vld4_u8(pixels + pixel * 4u);
+    values.val[0]      = MultiplyBytesNeon(values.val[0], values.val[3]);
+    values.val[1]      = MultiplyBytesNeon(values.val[1], values.val[3]);
+    values.val[2]      = MultiplyBytesNeon(values.val[2], values.val[3]);
+    vst4_u8(pixels + pixel * 4u, values);
+  }
+  return pixel;
+}
+
+uint32_t MultiplyAlphaByMaskScanline4BPPNeon(uint8_t* pixels, const uint8_t* mask, uint32_t pixelCount)
+{
+  uint32_t pixel = 0;
+  for(; pixel + 8u <= pixelCount; pixel += 8u)
+  {
+    uint8x8x4_t values = vld4_u8(pixels + pixel * 4u);
+    values.val[3]      = MultiplyBytesNeon(values.val[3], vld1_u8(mask + pixel));
+    vst4_u8(pixels + pixel * 4u, values);
+  }
+  return pixel;
+}
+
+uint32_t MultiplyPixelsByMaskScanline4BPPNeon(uint8_t* pixels, const uint8_t* mask, uint32_t pixelCount)
+{
+  uint32_t pixel = 0;
+  for(; pixel + 8u <= pixelCount; pixel += 8u)
+  {
+    const uint8x8_t maskValues = vld1_u8(mask + pixel);
+    uint8x8x4_t     values     = vld4_u8(pixels + pixel * 4u);
+    values.val[0]              = MultiplyBytesNeon(values.val[0], maskValues);
+    values.val[1]              = MultiplyBytesNeon(values.val[1], maskValues);
+    values.val[2]              = MultiplyBytesNeon(values.val[2], maskValues);
+    values.val[3]              = MultiplyBytesNeon(values.val[3], maskValues);
+    vst4_u8(pixels + pixel * 4u, values);
+  }
+  return pixel;
+}
+
+#endif
+
+} // namespace
+
+InstructionSet GetSupportedInstructionSet()
+{
+  static const InstructionSet supportedInstructionSet = DetectInstructionSet();
+  return supportedInstructionSet;
+}
+
+InstructionSet GetInstructionSet()
+{
+  return ActiveInstructionSet().load(std::memory_order_relaxed);
+}
+
+void SetInstructionSet(InstructionSet instructionSet)
+{
+  const InstructionSet supported = GetSupportedInstructionSet();
+  if(instructionSet != InstructionSet::NONE)
+  {
+    const bool isSupported = (instructionSet == supported) ||
+                             (instructionSet == InstructionSet::SSE41 && supported == InstructionSet::AVX2);
+    if(!isSupported)
+    {
+      instructionSet = supported;
+    }
+  }
+  ActiveInstructionSet().store(instructionSet, std::memory_order_relaxed);
+}
+
+const char* GetInstructionSetName(InstructionSet instructionSet)
+{
+  switch(instructionSet)
+  {
+    case InstructionSet::SSE41:
+    {
+      return "SSE4.1";
+    }
+    case InstructionSet::AVX2:
+    {
+      return "AVX2";
+    }
+    case InstructionSet::NEON:
+    {
+      return "NEON";
+    }
+    case InstructionSet::NONE:
+    default:
+    {
+      return "scalar";
+    }
+  }
+}
+
+uint32_t HalveScanlineRGBA8888(uint8_t* pixels, uint32_t outputPixelCount)
+{
+  switch(GetInstructionSet())
+  {
+#if defined(DALI_IMAGE_OPERATIONS_SIMD_X86)
+    case InstructionSet::AVX2:
+    {
+      return HalveScanlineRGBA8888Avx2(pixels, outputPixelCount);
+    }
+    case InstructionSet::SSE41:
+    {
+      return HalveScanlineRGBA8888Sse(pixels, 0u, outputPixelCount);
+    }
+#elif defined(DALI_IMAGE_OPERATIONS_SIMD_NEON)
+    case InstructionSet::NEON:
+    {
+      return HalveScanlineRGBA8888Neon(pixels, outputPixelCount);
+    }
+#endif
+    default:
+    {
+      return 0u;
+    }
+  }
+}
+
+uint32_t AverageScanlines(const uint8_t* scanline1, const uint8_t* scanline2, uint8_t* outputScanline, uint32_t componentCount)
+{
+  switch(GetInstructionSet())
+  {
+#if defined(DALI_IMAGE_OPERATIONS_SIMD_X86)
+    case InstructionSet::AVX2:
+    {
+      return AverageScanlinesAvx2(scanline1, scanline2, outputScanline, componentCount);
+    }
+    case InstructionSet::SSE41:
+    {
+      return AverageScanlinesSse(scanline1, scanline2, outputScanline, componentCount);
+    }
+#elif defined(DALI_IMAGE_OPERATIONS_SIMD_NEON)
+    case InstructionSet::NEON:
+    {
+      return AverageScanlinesNeon(scanline1, scanline2, outputScanline, componentCount);
+    }
+#endif
+    default:
+    {
+      return 0u;
+    }
+  }
+}
+
+uint32_t LinearSampleScanline4BPP(const uint8_t* inScanline1, const uint8_t* inScanline2, uint32_t inputWidth, uint32_t inputYWeight, uint8_t* outScanline, uint32_t desiredWidth, uint32_t deltaX)
+{
+  switch(GetInstructionSet())
+  {
+#if defined(DALI_IMAGE_OPERATIONS_SIMD_X86)
+    case InstructionSet::AVX2:
+    case InstructionSet::SSE41:
+    {
+      return LinearSampleScanline4BPPSse(inScanline1, inScanline2, inputWidth, inputYWeight, outScanline, desiredWidth, deltaX);
+    }
+#elif defined(DALI_IMAGE_OPERATIONS_SIMD_NEON)
+    case InstructionSet::NEON:
+    {
+      return LinearSampleScanline4BPPNeon(inScanline1, inScanline2, inputWidth, inputYWeight, outScanline, desiredWidth, deltaX);
+    }
+#endif
+    default:
+    {
+      return 0u;
+    }
+  }
+}
+
+uint32_t PointSampleScanline4BPP(const uint8_t* inScanline, uint8_t* outScanline, uint32_t desiredWidth, uint32_t deltaX)
+{
+  switch(GetInstructionSet())
+  {
+#if defined(DALI_IMAGE_OPERATIONS_SIMD_X86)
+    case InstructionSet::AVX2:
+    {
+      return PointSampleScanline4BPPAvx2(inScanline, outScanline, desiredWidth, deltaX);
+    }
+#endif
+    default:
+    {
+      // Without a gather instruction the scalar loop is as fast.
+      return 0u;
+    }
+  }
+}
+
+uint32_t BoxBlurTransposeScanline4BPP(const uint8_t* inScanline, const uint32_t* windowIndices, uint32_t radius, uint8_t* outPixel, uint32_t outStrideBytes, uint32_t width, uint32_t multiplier)
+{
+  switch(GetInstructionSet())
+  {
+#if defined(DALI_IMAGE_OPERATIONS_SIMD_X86)
+    case InstructionSet::AVX2:
+    case InstructionSet::SSE41:
+    {
+      return BoxBlurTransposeScanline4BPPSse(inScanline, windowIndices, radius, outPixel, outStrideBytes, width, multiplier);
+    }
+#elif defined(DALI_IMAGE_OPERATIONS_SIMD_NEON)
+    case InstructionSet::NEON:
+    {
+      return BoxBlurTransposeScanline4BPPNeon(inScanline, windowIndices, radius, outPixel, outStrideBytes, width, multiplier);
+    }
+#endif
+    default:
+    {
+      return 0u;
+    }
+  }
+}
+
+uint32_t ConvolveTransposeScanline4BPP(const uint8_t* inScanline, const uint32_t* windowIndices, const float* weights, uint32_t kernelSize, uint8_t* outPixel, uint32_t outStrideBytes, uint32_t width)
+{
+  switch(GetInstructionSet())
+  {
+#if defined(DALI_IMAGE_OPERATIONS_SIMD_X86)
+    case InstructionSet::AVX2:
+    case InstructionSet::SSE41:
+    {
+      return ConvolveTransposeScanline4BPPSse(inScanline, windowIndices, weights, kernelSize, outPixel, outStrideBytes, width);
+    }
+#elif defined(DALI_IMAGE_OPERATIONS_SIMD_NEON)
+    case InstructionSet::NEON:
+    {
+      return ConvolveTransposeScanline4BPPNeon(inScanline, windowIndices, weights, kernelSize, outPixel, outStrideBytes, width);
+    }
+#endif
+    default:
+    {
+      return 0u;
+    }
+  }
+}
+
+uint32_t MultiplyColorByAlphaScanline4BPP(uint8_t* pixels, uint32_t pixelCount)
+{
+  switch(GetInstructionSet())
+  {
+#if defined(DALI_IMAGE_OPERATIONS_SIMD_X86)
+    case InstructionSet::AVX2:
+    {
+      return MultiplyColorByAlphaScanline4BPPAvx2(pixels, pixelCount);
+    }
+    case InstructionSet::SSE41:
+    {
+      return MultiplyColorByAlphaScanline4BPPSse(pixels, 0u, pixelCount);
+    }
+#elif defined(DALI_IMAGE_OPERATIONS_SIMD_NEON)
+    case InstructionSet::NEON:
+    {
+      return MultiplyColorByAlphaScanline4BPPNeon(pixels, pixelCount);
+    }
+#endif
+    default:
+    {
+      return 0u;
+    }
+  }
+}
+
+uint32_t MultiplyAlphaByMaskScanline4BPP(uint8_t* pixels, const uint8_t* mask, uint32_t pixelCount)
+{
+  switch(GetInstructionSet())
+  {
+#if defined(DALI_IMAGE_OPERATIONS_SIMD_X86)
+    case InstructionSet::AVX2:
+    {
+      return MultiplyAlphaByMaskScanline4BPPAvx2(pixels, mask, pixelCount);
+    }
+    case InstructionSet::SSE41:
+    {
+      return MultiplyAlphaByMaskScanline4BPPSse(pixels, mask, 0u, pixelCount);
+    }
+#elif defined(DALI_IMAGE_OPERATIONS_SIMD_NEON)
+    case InstructionSet::NEON:
+    {
+      return MultiplyAlphaByMaskScanline4BPPNeon(pixels, mask, pixelCount);
+    }
+#endif
+    default:
+    {
+      return 0u;
+    }
+  }
+}
+
+uint32_t MultiplyPixelsByMaskScanline4BPP(uint8_t* pixels, const uint8_t* mask, uint32_t pixelCount)
+{
+  switch(GetInstructionSet())
+  {
+#if defined(DALI_IMAGE_OPERATIONS_SIMD_X86)
+    case InstructionSet::AVX2:
+    {
+      return MultiplyPixelsByMaskScanline4BPPAvx2(pixels, mask, pixelCount);
+    }
+    case InstructionSet::SSE41:
+    {
+      return MultiplyPixelsByMaskScanline4BPPSse(pixels, mask, 0u, pixelCount);
+    }
+#elif defined(DALI_IMAGE_OPERATIONS_SIMD_NEON)
+    case InstructionSet::NEON:
+    {
+      return MultiplyPixelsByMaskScanline4BPPNeon(pixels, mask, pixelCount);
+    }
+#endif
+    default:
+    {
+      return 0u;
+    }
+  }
+}
+
+} // namespace ImageOperationsSimd
+
+} // namespace Platform
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,201 @@
+#ifndef DALI_INTERNAL_PLATFORM_IMAGE_OPERATIONS_SIMD_H
+#define DALI_INTERNAL_PLATFORM_IMAGE_OPERATIONS_SIMD_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+/**
+ * @brief Vectorized scanline kernels used by the image operations.
+ *
+ * Each kernel processes as much of its input as the active instruction set allows
+ * and returns how much it processed, so the caller can finish the remainder with its
+ * scalar code. All kernels produce exactly the same output as the scalar versions in
+ * image-operations.cpp, gaussian-blur.cpp and pixel-kernels.cpp. The floating-point convolution
+ * multiplies and adds in the same order on both sides, and its files are built with -ffp-contract=off,
+ * so the compiler never fuses the multiply-adds of one side only. The other kernels only use integer arithmetic.
+ *
+ * On x86 the instruction set is selected at runtime from the CPU features, on ARM NEON
+ * is used when the compiler targets it. Set DALI_DISABLE_IMAGE_OPERATIONS_SIMD=1 to
+ * force the scalar code.
+ */
+namespace ImageOperationsSimd
+{
+/**
+ * @brief The instruction sets the kernels can be dispatched to.
+ */
+enum class InstructionSet
+{
+  NONE,  ///< Scalar only. Every kernel returns 0.
+  SSE41, ///< x86 SSE4.1
+  AVX2,  ///< x86 AVX2
+  NEON,  ///< ARM NEON
+};
+
+/**
+ * @brief Retrieve the best instruction set supported by this CPU and build.
+ * @return The best supported instruction set.
+ */
+InstructionSet GetSupportedInstructionSet();
+
+/**
+ * @brief Retrieve the instruction set currently used by the kernels.
+ * @return The active instruction set.
+ */
+InstructionSet GetInstructionSet();
+
+/**
+ * @brief Change the instruction set used by the kernels.
+ *
+ * Requests for an unsupported instruction set fall back to the supported one.
+ * Intended for tests and benchmarks comparing against the scalar path.
+ * @param[in] instructionSet The instruction set to use.
+ */
+void SetInstructionSet(InstructionSet instructionSet);
+
+/**
+ * @brief Get a printable name of an instruction set.
+ * @param[in] instructionSet The instruction set.
+ * @return The name of the instruction set.
+ */
+const char* GetInstructionSetName(InstructionSet instructionSet);
+
+/**
+ * @brief Average horizontal pairs of RGBA8888 pixels in place.
+ *
+ * @param[in,out] pixels The scanline. Output pixel i is the average of input pixels 2i and 2i+1.
+ * @param[in] outputPixelCount The number of output pixels wanted.
+ * @return The number of output pixels written, starting from the first one.
+ */
+uint32_t HalveScanlineRGBA8888(uint8_t* pixels, uint32_t outputPixelCount);
+
+/**
+ * @brief Average corresponding byte components of two scanlines.
+ *
+ * @param[in] scanline1 The first scanline.
+ * @param[in] scanline2 The second scanline.
+ * @param[out] outputScanline The destination. It may alias scanline1 or lie before it.
+ * @param[in] componentCount The number of bytes to average.
+ * @return The number of leading components written.
+ */
+uint32_t AverageScanlines(const uint8_t* scanline1, const uint8_t* scanline2, uint8_t* outputScanline, uint32_t componentCount);
+
+/**
+ * @brief Bilinear sample one output scanline of 4 byte pixels.
+ *
+ * @param[in] inScanline1 The upper input scanline.
+ * @param[in] inScanline2 The lower input scanline.
+ * @param[in] inputWidth The width of the input scanlines in pixels.
+ * @param[in] inputYWeight The 0.16 fixed-point vertical blending factor.
+ * @param[out] outScanline The output scanline.
+ * @param[in] desiredWidth The width of the output scanline in pixels.
+ * @param[in] deltaX The 16.16 fixed-point step through the input per output pixel.
+ * @return The number of leading output pixels written.
+ */
+uint32_t LinearSampleScanline4BPP(const uint8_t* inScanline1, const uint8_t* inScanline2, uint32_t inputWidth, uint32_t inputYWeight, uint8_t* outScanline, uint32_t desiredWidth, uint32_t deltaX);
+
+/**
+ * @brief Point sample one output scanline of 4 byte pixels.
+ *
+ * @param[in] inScanline The input scanline.
+ * @param[out] outScanline The output scanline.
+ * @param[in] desiredWidth The width of the output scanline in pixels.
+ * @param[in] deltaX The 16.16 fixed-point step through the input per output pixel.
+ * @return The number of leading output pixels written.
+ */
+uint32_t PointSampleScanline4BPP(const uint8_t* inScanline, uint8_t* outScanline, uint32_t desiredWidth, uint32_t deltaX);
+
+/**
+ * @brief Box blur one scanline of 4 byte pixels and write it transposed.
+ *
+ * Output pixel x is the average of the input pixels at window positions [x, x + 2 * radius].
+ *
+ * @param[in] inScanline The input scanline.
+ * @param[in] windowIndices The input pixel of each of the width + 2 * radius + 1 window positions.
+ * @param[in] radius The radius of the box.
+ * @param[out] outPixel The first output pixel. Each following output pixel is outStrideBytes further on.
+ * @param[in] outStrideBytes The distance between two output pixels in bytes.
+ * @param[in] width The number of output pixels.
+ * @param[in] multiplier The 9.23 fixed-point reciprocal of the box width.
+ * @return The number of output pixels written, either 0 or width.
+ */
+uint32_t BoxBlurTransposeScanline4BPP(const uint8_t* inScanline, const uint32_t* windowIndices, uint32_t radius, uint8_t* outPixel, uint32_t outStrideBytes, uint32_t width, uint32_t multiplier);
+
+/**
+ * @brief Convolve one scanline of 4 byte pixels with a kernel and write it transposed.
+ *
+ * Output pixel x is the sum of the input pixels at window positions [x, x + kernelSize) multiplied by the weights.
+ *
+ * @param[in] inScanline The input scanline.
+ * @param[in] windowIndices The input pixel of each of the width + kernelSize - 1 window positions.
+ * @param[in] weights The weights of the kernel.
+ * @param[in] kernelSize The number of weights.
+ * @param[out] outPixel The first output pixel. Each following output pixel is outStrideBytes further on.
+ * @param[in] outStrideBytes The distance between two output pixels in bytes.
+ * @param[in] width The number of output pixels.
+ * @return The number of leading output pixels written.
+ */
+uint32_t ConvolveTransposeScanline4BPP(const uint8_t* inScanline, const uint32_t* windowIndices, const float* weights, uint32_t kernelSize, uint8_t* outPixel, uint32_t outStrideBytes, uint32_t width);
+
+/**
+ * @brief Multiply the first three components of 4 byte pixels by their fourth, i.e. premultiply RGBA8888 or BGRA8888.
+ *
+ * Each product is normalized like Platform::MultiplyAndNormalizeColor().
+ *
+ * @param[in,out] pixels The scanline.
+ * @param[in] pixelCount The number of pixels.
+ * @return The number of leading pixels processed.
+ */
+uint32_t MultiplyColorByAlphaScanline4BPP(uint8_t* pixels, uint32_t pixelCount);
+
+/**
+ * @brief Multiply the fourth component of 4 byte pixels, i.e. the alpha of RGBA8888 or BGRA8888, by a one byte mask.
+ *
+ * @param[in,out] pixels The scanline.
+ * @param[in] mask The mask, one byte per pixel.
+ * @param[in] pixelCount The number of pixels.
+ * @return The number of leading pixels processed.
+ */
+uint32_t MultiplyAlphaByMaskScanline4BPP(uint8_t* pixels, const uint8_t* mask, uint32_t pixelCount);
+
+/**
+ * @brief Multiply every component of 4 byte pixels by a one byte mask, i.e. mask premultiplied RGBA8888 or BGRA8888.
+ *
+ * @param[in,out] pixels The scanline.
+ * @param[in] mask The mask, one byte per pixel.
+ * @param[in] pixelCount The number of pixels.
+ * @return The number of leading pixels processed.
+ */
+uint32_t MultiplyPixelsByMaskScanline4BPP(uint8_t* pixels, const uint8_t* mask, uint32_t pixelCount);
+
+} // namespace ImageOperationsSimd
+
+} // namespace Platform
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_PLATFORM_IMAGE_OPERATIONS_SIMD_H
@@ -33,6 +33,8 @@
 #include <memory>
 
 // INTERNAL INCLUDES
+#include <dali/internal/imaging/common/image-operations-parallel.h>
+#include <dali/internal/imaging/common/image-operations-simd.h>
 
 namespace Dali
 {
@@ -1218,6 +1220,29 @@ void DownscaleInPlacePow2Generic(uint8_t* const   pixels,
 
     const uint32_t lastScanlinePair = scaledHeight - 1;
 
+    if(ImageOperationsParallel::CalculateBandCount(scaledHeight, lastWidth * 2u) > 1u)
+    {
+      // The output of a pair overlaps the input of earlier pairs, so each band averages
+      // its pairs onto the first scanline of the pair, then they are packed in order.
+      ImageOperationsParallel::ForEachBand(scaledHeight, lastWidth * 2u, [&](uint32_t begin, uint32_t end) {
+        for(uint32_t y = begin; y < end; ++y)
+        {
+          HalveScanlineInPlace(&pixels[y * 2 * lastStrideBytes], lastWidth);
+          HalveScanlineInPlace(&pixels[(y * 2 + 1) * lastStrideBytes], lastWidth);
+          AverageScanlines(
+            &pixels[y * 2 * lastStrideBytes],
+            &pixels[(y * 2 + 1) * lastStrideBytes],
+            &pixels[y * 2 * lastStrideBytes],
+            scaledWidth);
+        }
+      });
+      for(uint32_t y = 1; y <= lastScanlinePair; ++y)
+      {
+        memmove(&pixels[y * strideBytes], &pixels[y * 2 * lastStrideBytes], strideBytes);
+      }
+      continue;
+    }
+
     // Scale pairs of scanlines until any spare one at the end is dropped:
     for(uint32_t y = 0; y <= lastScanlinePair; ++y)
     {
@@ -1293,7 +1318,10 @@ void HalveScanlineInPlaceRGBA8888(uint8_t* const pixels, const uint32_t width)
 
   const uint32_t lastPair = EvenDown(width - 2);
 
-  for(uint32_t pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel)
+  // Let the vectorized kernel do as many pairs as it can, and finish the tail here.
+  const uint32_t simdPixels = ImageOperationsSimd::HalveScanlineRGBA8888(pixels, width >> 1u);
+
+  for(uint32_t pixel = simdPixels << 1u, outPixel = simdPixels; pixel <= lastPair; pixel += 2, ++outPixel)
   {
     const uint32_t averaged = AveragePixelRGBA8888(alignedPixels[pixel], alignedPixels[pixel + 1]);
     alignedPixels[outPixel] = averaged;
@@ -1376,7 +1404,7 @@ namespace
  * @note Only possible if each scanline pointer's address aligned
  * It will give performance benifit.
  */
-inline void AverageScanlinesWithMultipleComponents(
+inline void AverageScanlinesWithMultipleComponentsScalar(
   const uint8_t* const scanline1,
   const uint8_t* const __restrict__ scanline2,
   uint8_t* const outputScanline,
@@ -1460,6 +1488,23 @@ inline void AverageScanlinesWithMultipleComponents(
   }
 }
 
+/**
+ * @copydoc AverageScanlinesWithMultipleComponentsScalar
+ * @note The vectorized kernel handles the bulk of the scanline when the CPU supports it.
+ */
+inline void AverageScanlinesWithMultipleComponents(
+  const uint8_t* const scanline1,
+  const uint8_t* const __restrict__ scanline2,
+  uint8_t* const outputScanline,
+  const uint32_t totalComponentCount)
+{
+  const uint32_t simdComponents = ImageOperationsSimd::AverageScanlines(scanline1, scanline2, outputScanline, totalComponentCount);
+  if(simdComponents < totalComponentCount)
+  {
+    AverageScanlinesWithMultipleComponentsScalar(scanline1 + simdComponents, scanline2 + simdComponents, outputScanline + simdComponents, totalComponentCount - simdComponents);
+  }
+}
+
 } // namespace
 
 void AverageScanlines1(const uint8_t* const scanline1,
@@ -1709,14 +1754,24 @@ void DownscaleInPlacePow2SingleBytePerPixel(uint8_t*         pixels,
 
 namespace
 {
+/**
+ * @brief Check whether two buffers share any bytes.
+ */
+inline bool BuffersOverlap(const uint8_t* buffer1, size_t size1, const uint8_t* buffer2, size_t size2)
+{
+  return buffer1 < buffer2 + size2 && buffer2 < buffer1 + size1;
+}
+
 /**
  * @brief Point sample an image to a new resolution (like GL_NEAREST).
  *
  * Template is used purely as a type-safe code generator in this one
  * compilation unit. Generated code is inlined into type-specific wrapper
  * functions below which are exported to rest of module.
+ * SAMPLE_SCANLINE is an optional vectorized kernel which samples the start of each scanline.
  */
-template<typename PIXEL>
+template<typename PIXEL,
+         uint32_t (*SAMPLE_SCANLINE)(const uint8_t* inScanline, uint8_t* outScanline, uint32_t desiredWidth, uint32_t deltaX) = nullptr>
 inline void PointSampleAddressablePixels(const uint8_t* inPixels,
                                          uint32_t       inputWidth,
                                          uint32_t       inputHeight,
@@ -1740,30 +1795,48 @@ inline void PointSampleAddressablePixels(const uint8_t* inPixels,
   const uint32_t deltaX     = (inputWidth << 16u) / desiredWidth;
   const uint32_t deltaY     = (inputHeight << 16u) / desiredHeight;
 
-  uint32_t inY = 0;
-  for(uint32_t outY = 0; outY < desiredHeight; ++outY)
-  {
-    // Round fixed point y coordinate to nearest integer:
-    const uint32_t     integerY    = (inY + (1u << 15u)) >> 16u;
-    const PIXEL* const inAligned   = reinterpret_cast<const PIXEL*>(inPixels + inputStrideBytes * integerY);
-    const PIXEL* const inScanline  = &inAligned[0];
-    PIXEL* const       outScanline = &outAligned[desiredWidth * outY];
-
-    DALI_ASSERT_DEBUG(integerY < inputHeight);
-    DALI_ASSERT_DEBUG(reinterpret_cast<const uint8_t*>(inScanline) < (inPixels + inputStrideBytes * inputHeight));
-    DALI_ASSERT_DEBUG(reinterpret_cast<uint8_t*>(outScanline) < (outPixels + desiredWidth * desiredHeight * sizeof(PIXEL)));
-
-    uint32_t inX = 0;
-    for(uint32_t outX = 0; outX < desiredWidth; ++outX)
+  const auto sampleRows = [&](uint32_t beginY, uint32_t endY) {
+    uint32_t inY = beginY * deltaY;
+    for(uint32_t outY = beginY; outY < endY; ++outY)
     {
-      // Round the fixed-point x coordinate to an integer:
-      const uint32_t     integerX       = (inX + (1u << 15u)) >> 16u;
-      const PIXEL* const inPixelAddress = &inScanline[integerX];
-      const PIXEL        pixel          = *inPixelAddress;
-      outScanline[outX]                 = pixel;
-      inX += deltaX;
+      // Round fixed point y coordinate to nearest integer:
+      const uint32_t     integerY    = (inY + (1u << 15u)) >> 16u;
+      const PIXEL* const inAligned   = reinterpret_cast<const PIXEL*>(inPixels + inputStrideBytes * integerY);
+      const PIXEL* const inScanline  = &inAligned[0];
+      PIXEL* const       outScanline = &outAligned[desiredWidth * outY];
+
+      DALI_ASSERT_DEBUG(integerY < inputHeight);
+      DALI_ASSERT_DEBUG(reinterpret_cast<const uint8_t*>(inScanline) < (inPixels + inputStrideBytes * inputHeight));
+      DALI_ASSERT_DEBUG(reinterpret_cast<uint8_t*>(outScanline) < (outPixels + desiredWidth * desiredHeight * sizeof(PIXEL)));
+
+      uint32_t outX = 0;
+      if constexpr(SAMPLE_SCANLINE != nullptr)
+      {
+        outX = SAMPLE_SCANLINE(reinterpret_cast<const uint8_t*>(inScanline), reinterpret_cast<uint8_t*>(outScanline), desiredWidth, deltaX);
+      }
+
+      uint32_t inX = outX * deltaX;
+      for(; outX < desiredWidth; ++outX)
+      {
+        // Round the fixed-point x coordinate to an integer:
+        const uint32_t     integerX       = (inX + (1u << 15u)) >> 16u;
+        const PIXEL* const inPixelAddress = &inScanline[integerX];
+        const PIXEL        pixel          = *inPixelAddress;
+        outScanline[outX]                 = pixel;
+        inX += deltaX;
+      }
+      inY += deltaY;
     }
-    inY += deltaY;
+  };
+
+  if(BuffersOverlap(inPixels, inputStrideBytes * inputHeight, outPixels, desiredWidth * desiredHeight * sizeof(PIXEL)))
+  {
+    // In place downscaling relies on the scanlines being written in order.
+    sampleRows(0u, desiredHeight);
+  }
+  else
+  {
+    ImageOperationsParallel::ForEachBand(desiredHeight, desiredWidth, sampleRows);
   }
 }
 
@@ -1778,7 +1851,7 @@ void PointSample4BPP(const uint8_t* inPixels,
                      uint32_t       desiredWidth,
                      uint32_t       desiredHeight)
 {
-  PointSampleAddressablePixels<uint32_t>(inPixels, inputWidth, inputHeight, inputStrideBytes, outPixels, desiredWidth, desiredHeight);
+  PointSampleAddressablePixels<uint32_t, ImageOperationsSimd::PointSampleScanline4BPP>(inPixels, inputWidth, inputHeight, inputStrideBytes, outPixels, desiredWidth, desiredHeight);
 }
 
 // RGB565, LA88
@@ -1829,36 +1902,48 @@ void PointSample3BPP(const uint8_t* inPixels,
   // Step through output image in whole integer pixel steps while tracking the
   // corresponding locations in the input image using 16.16 fixed-point
   // coordinates:
-  uint32_t inY = 0; //< 16.16 fixed-point input image y-coord.
-  for(uint32_t outY = 0; outY < desiredHeight; ++outY)
-  {
-    const uint32_t       integerY    = (inY + (1u << 15u)) >> 16u;
-    const uint8_t* const inScanline  = &inPixels[inputStrideBytes * integerY];
-    uint8_t* const       outScanline = &outPixels[desiredWidth * outY * BYTES_PER_PIXEL];
-    uint32_t             inX         = 0; //< 16.16 fixed-point input image x-coord.
-
-    for(uint32_t outX = 0; outX < desiredWidth * BYTES_PER_PIXEL; outX += BYTES_PER_PIXEL)
+  const auto sampleRows = [&](uint32_t beginY, uint32_t endY) {
+    uint32_t inY = beginY * deltaY; //< 16.16 fixed-point input image y-coord.
+    for(uint32_t outY = beginY; outY < endY; ++outY)
     {
-      // Round the fixed-point input coordinate to the address of the input pixel to sample:
-      const uint32_t       integerX       = (inX + (1u << 15u)) >> 16u;
-      const uint8_t* const inPixelAddress = &inScanline[integerX * BYTES_PER_PIXEL];
+      const uint32_t       integerY    = (inY + (1u << 15u)) >> 16u;
+      const uint8_t* const inScanline  = &inPixels[inputStrideBytes * integerY];
+      uint8_t* const       outScanline = &outPixels[desiredWidth * outY * BYTES_PER_PIXEL];
+      uint32_t             inX         = 0; //< 16.16 fixed-point input image x-coord.
 
-      // Issue loads for all pixel color components up-front:
-      const uint32_t c0 = inPixelAddress[0];
-      const uint32_t c1 = inPixelAddress[1];
-      const uint32_t c2 = inPixelAddress[2];
-      ///@ToDo: Optimise - Benchmark one 32bit load that will be unaligned 2/3 of the time + 3 rotate and masks, versus these three aligned byte loads, versus using an RGB packed, aligned(1) struct and letting compiler pick a strategy.
-
-      // Output the pixel components:
-      outScanline[outX]     = static_cast<uint8_t>(c0);
-      outScanline[outX + 1] = static_cast<uint8_t>(c1);
-      outScanline[outX + 2] = static_cast<uint8_t>(c2);
+      for(uint32_t outX = 0; outX < desiredWidth * BYTES_PER_PIXEL; outX += BYTES_PER_PIXEL)
+      {
+        // Round the fixed-point input coordinate to the address of the input pixel to sample:
+        const uint32_t       integerX       = (inX + (1u << 15u)) >> 16u;
+        const uint8_t* const inPixelAddress = &inScanline[integerX * BYTES_PER_PIXEL];
+
+        // Issue loads for all pixel color components up-front:
+        const uint32_t c0 = inPixelAddress[0];
+        const uint32_t c1 = inPixelAddress[1];
+        const uint32_t c2 = inPixelAddress[2];
+        ///@ToDo: Optimise - Benchmark one 32bit load that will be unaligned 2/3 of the time + 3 rotate and masks, versus these three aligned byte loads, versus using an RGB packed, aligned(1) struct and letting compiler pick a strategy.
+
+        // Output the pixel components:
+        outScanline[outX]     = static_cast<uint8_t>(c0);
+        outScanline[outX + 1] = static_cast<uint8_t>(c1);
+        outScanline[outX + 2] = static_cast<uint8_t>(c2);
+
+        // Increment the fixed-point input coordinate:
+        inX += deltaX;
+      }
 
-      // Increment the fixed-point input coordinate:
-      inX += deltaX;
+      inY += deltaY;
     }
+  };
 
-    inY += deltaY;
+  if(BuffersOverlap(inPixels, inputStrideBytes * inputHeight, outPixels, desiredWidth * desiredHeight * BYTES_PER_PIXEL))
+  {
+    // In place downscaling relies on the scanlines being written in order.
+    sampleRows(0u, desiredHeight);
+  }
+  else
+  {
+    ImageOperationsParallel::ForEachBand(desiredHeight, desiredWidth, sampleRows);
   }
 }
 
@@ -1960,11 +2045,13 @@ inline Pixel4Bytes BilinearFilter4Bytes(Pixel4Bytes tl, Pixel4Bytes tr, Pixel4By
  * @brief Generic version of bilinear sampling image resize function.
  * @note Limited to one compilation unit and exposed through type-specific
  * wrapper functions below.
+ * SAMPLE_SCANLINE is an optional vectorized kernel which samples the start of each scanline.
  */
 template<
   typename PIXEL,
   PIXEL (*BilinearFilter)(PIXEL tl, PIXEL tr, PIXEL bl, PIXEL br, uint32_t fractBlendHorizontal, uint32_t fractBlendVertical),
-  bool DEBUG_ASSERT_ALIGNMENT>
+  bool DEBUG_ASSERT_ALIGNMENT,
+  uint32_t (*SAMPLE_SCANLINE)(const uint8_t* inScanline1, const uint8_t* inScanline2, uint32_t inputWidth, uint32_t inputYWeight, uint8_t* outScanline, uint32_t desiredWidth, uint32_t deltaX) = nullptr>
 inline void LinearSampleGeneric(const uint8_t* __restrict__ inPixels,
                                 ImageDimensions inputDimensions,
                                 uint32_t        inputStrideBytes,
@@ -1993,44 +2080,52 @@ inline void LinearSampleGeneric(const uint8_t* __restrict__ inPixels,
   const uint32_t deltaX     = (inputWidth << 16u) / desiredWidth;
   const uint32_t deltaY     = (inputHeight << 16u) / desiredHeight;
 
-  uint32_t inY = 0;
-  for(uint32_t outY = 0; outY < desiredHeight; ++outY)
-  {
-    PIXEL* const outScanline = &outAligned[desiredWidth * outY];
-
-    // Find the two scanlines to blend and the weight to blend with:
-    const uint32_t integerY1    = inY >> 16u;
-    const uint32_t integerY2    = integerY1 + 1 >= inputHeight ? integerY1 : integerY1 + 1;
-    const uint32_t inputYWeight = inY & 65535u;
+  ImageOperationsParallel::ForEachBand(desiredHeight, desiredWidth, [&](uint32_t beginY, uint32_t endY) {
+    uint32_t inY = beginY * deltaY;
+    for(uint32_t outY = beginY; outY < endY; ++outY)
+    {
+      PIXEL* const outScanline = &outAligned[desiredWidth * outY];
 
-    DALI_ASSERT_DEBUG(integerY1 < inputHeight);
-    DALI_ASSERT_DEBUG(integerY2 < inputHeight);
+      // Find the two scanlines to blend and the weight to blend with:
+      const uint32_t integerY1    = inY >> 16u;
+      const uint32_t integerY2    = integerY1 + 1 >= inputHeight ? integerY1 : integerY1 + 1;
+      const uint32_t inputYWeight = inY & 65535u;
 
-    const PIXEL* const inScanline1 = reinterpret_cast<const PIXEL*>(inPixels + inputStrideBytes * integerY1);
-    const PIXEL* const inScanline2 = reinterpret_cast<const PIXEL*>(inPixels + inputStrideBytes * integerY2);
+      DALI_ASSERT_DEBUG(integerY1 < inputHeight);
+      DALI_ASSERT_DEBUG(integerY2 < inputHeight);
 
-    uint32_t inX = 0;
-    for(uint32_t outX = 0; outX < desiredWidth; ++outX)
-    {
-      // Work out the two pixel scanline offsets for this cluster of four samples:
-      const uint32_t integerX1 = inX >> 16u;
-      const uint32_t integerX2 = integerX1 + 1 >= inputWidth ? integerX1 : integerX1 + 1;
+      const PIXEL* const inScanline1 = reinterpret_cast<const PIXEL*>(inPixels + inputStrideBytes * integerY1);
+      const PIXEL* const inScanline2 = reinterpret_cast<const PIXEL*>(inPixels + inputStrideBytes * integerY2);
 
-      // Execute the loads:
-      const PIXEL pixel1 = inScanline1[integerX1];
-      const PIXEL pixel2 = inScanline2[integerX1];
-      const PIXEL pixel3 = inScanline1[integerX2];
-      const PIXEL pixel4 = inScanline2[integerX2];
-      ///@ToDo Optimise - for 1 and 2  and 4 byte types to execute a single 2, 4, or 8 byte load per pair (caveat clamping) and let half of them be unaligned.
-
-      // Weighted bilinear filter:
-      const uint32_t inputXWeight = inX & 65535u;
-      outScanline[outX]           = BilinearFilter(pixel1, pixel3, pixel2, pixel4, inputXWeight, inputYWeight);
+      uint32_t outX = 0;
+      if constexpr(SAMPLE_SCANLINE != nullptr)
+      {
+        outX = SAMPLE_SCANLINE(reinterpret_cast<const uint8_t*>(inScanline1), reinterpret_cast<const uint8_t*>(inScanline2), inputWidth, inputYWeight, reinterpret_cast<uint8_t*>(outScanline), desiredWidth, deltaX);
+      }
 
-      inX += deltaX;
+      uint32_t inX = outX * deltaX;
+      for(; outX < desiredWidth; ++outX)
+      {
+        // Work out the two pixel scanline offsets for this cluster of four samples:
+        const uint32_t integerX1 = inX >> 16u;
+        const uint32_t integerX2 = integerX1 + 1 >= inputWidth ? integerX1 : integerX1 + 1;
+
+        // Execute the loads:
+        const PIXEL pixel1 = inScanline1[integerX1];
+        const PIXEL pixel2 = inScanline2[integerX1];
+        const PIXEL pixel3 = inScanline1[integerX2];
+        const PIXEL pixel4 = inScanline2[integerX2];
+        ///@ToDo Optimise - for 1 and 2  and 4 byte types to execute a single 2, 4, or 8 byte load per pair (caveat clamping) and let half of them be unaligned.
+
+        // Weighted bilinear filter:
+        const uint32_t inputXWeight = inX & 65535u;
+        outScanline[outX]           = BilinearFilter(pixel1, pixel3, pixel2, pixel4, inputXWeight, inputYWeight);
+
+        inX += deltaX;
+      }
+      inY += deltaY;
     }
-    inY += deltaY;
-  }
+  });
 }
 
 } // namespace
@@ -2079,7 +2174,7 @@ void LinearSample4BPP(const uint8_t* __restrict__ inPixels,
                       uint8_t* __restrict__ outPixels,
                       ImageDimensions desiredDimensions)
 {
-  LinearSampleGeneric<Pixel4Bytes, BilinearFilter4Bytes, true>(inPixels, inputDimensions, inputStrideBytes, outPixels, desiredDimensions);
+  LinearSampleGeneric<Pixel4Bytes, BilinearFilter4Bytes, true, ImageOperationsSimd::LinearSampleScanline4BPP>(inPixels, inputDimensions, inputStrideBytes, outPixels, desiredDimensions);
 }
 
 // Dispatch to a format-appropriate linear sampling function:
@@ -2217,90 +2312,96 @@ void Resample(const uint8_t* __restrict__ inPixels,
 
   const int srcPitch = inputStrideBytes;
   const int dstPitch = dstWidth * numChannels;
-  int       dstY     = 0;
 
-  for(int srcY = 0; srcY < srcHeight; ++srcY)
-  {
-    const uint8_t* pSrc = &inPixels[srcY * srcPitch];
+  // Each channel has its own resampler, so large images resample groups of channels in parallel.
+  ImageOperationsParallel::ForEachBand(numChannels, srcWidth * srcHeight, [&](uint32_t beginChannel, uint32_t endChannel) {
+    const int firstChannel = static_cast<int>(beginChannel);
+    const int lastChannel  = static_cast<int>(endChannel);
+    int       dstY         = 0;
 
-    for(int x = 0; x < srcWidth; ++x)
+    for(int srcY = 0; srcY < srcHeight; ++srcY)
     {
-      for(int c = 0; c < numChannels; ++c)
+      const uint8_t* pSrc = &inPixels[srcY * srcPitch];
+
+      for(int x = 0; x < srcWidth; ++x, pSrc += numChannels)
       {
-        if(c == ALPHA_CHANNEL && hasAlpha)
-        {
-          samples[c][x] = *pSrc++ * ONE_DIV_255;
-        }
-        else
+        for(int c = firstChannel; c < lastChannel; ++c)
         {
-          samples[c][x] = srgbToLinear[*pSrc++];
+          if(c == ALPHA_CHANNEL && hasAlpha)
+          {
+            samples[c][x] = pSrc[c] * ONE_DIV_255;
+          }
+          else
+          {
+            samples[c][x] = srgbToLinear[pSrc[c]];
+          }
         }
       }
-    }
-
-    for(int c = 0; c < numChannels; ++c)
-    {
-      if(!resamplers[c]->put_line(&samples[c][0]))
-      {
-        DALI_ASSERT_DEBUG(!"Out of memory");
-      }
-    }
 
-    for(;;)
-    {
-      int compIndex;
-      for(compIndex = 0; compIndex < numChannels; ++compIndex)
+      for(int c = firstChannel; c < lastChannel; ++c)
       {
-        const float* pOutputSamples = resamplers[compIndex]->get_line();
-        if(!pOutputSamples)
+        if(!resamplers[c]->put_line(&samples[c][0]))
         {
-          break;
+          DALI_ASSERT_DEBUG(!"Out of memory");
         }
+      }
 
-        const bool isAlphaChannel = (compIndex == ALPHA_CHANNEL && hasAlpha);
-        DALI_ASSERT_DEBUG(dstY < dstHeight);
-        uint8_t* pDst = &outPixels[dstY * dstPitch + compIndex];
-
-        for(int x = 0; x < dstWidth; ++x)
+      for(;;)
+      {
+        int compIndex;
+        for(compIndex = firstChannel; compIndex < lastChannel; ++compIndex)
         {
-          if(isAlphaChannel)
+          const float* pOutputSamples = resamplers[compIndex]->get_line();
+          if(!pOutputSamples)
           {
-            int c = static_cast<int>(255.0f * pOutputSamples[x] + 0.5f);
-            if(c < 0)
-            {
-              c = 0;
-            }
-            else if(c > MAX_UNSIGNED_CHAR)
-            {
-              c = MAX_UNSIGNED_CHAR;
-            }
-            *pDst = static_cast<uint8_t>(c);
+            break;
           }
-          else
+
+          const bool isAlphaChannel = (compIndex == ALPHA_CHANNEL && hasAlpha);
+          DALI_ASSERT_DEBUG(dstY < dstHeight);
+          uint8_t* pDst = &outPixels[dstY * dstPitch + compIndex];
+
+          for(int x = 0; x < dstWidth; ++x)
           {
-            int j = static_cast<int>(LINEAR_TO_SRGB_TABLE_SIZE * pOutputSamples[x] + 0.5f);
-            if(j < 0)
+            if(isAlphaChannel)
             {
-              j = 0;
+              int c = static_cast<int>(255.0f * pOutputSamples[x] + 0.5f);
+              if(c < 0)
+              {
+                c = 0;
+              }
+              else if(c > MAX_UNSIGNED_CHAR)
+              {
+                c = MAX_UNSIGNED_CHAR;
+              }
+              *pDst = static_cast<uint8_t>(c);
             }
-            else if(j >= LINEAR_TO_SRGB_TABLE_SIZE)
+            else
             {
-              j = LINEAR_TO_SRGB_TABLE_SIZE - 1;
+              int j = static_cast<int>(LINEAR_TO_SRGB_TABLE_SIZE * pOutputSamples[x] + 0.5f);
+              if(j < 0)
+              {
+                j = 0;
+              }
+              else if(j >= LINEAR_TO_SRGB_TABLE_SIZE)
+              {
+                j = LINEAR_TO_SRGB_TABLE_SIZE - 1;
+              }
+              *pDst = linearToSrgb[j];
             }
-            *pDst = linearToSrgb[j];
-          }
 
-          pDst += numChannels;
+            pDst += numChannels;
+          }
+        }
+        if(compIndex < lastChannel)
+        {
+          break;
         }
-      }
-      if(compIndex < numChannels)
-      {
-        break;
-      }
 
-      ++dstY;
+        ++dstY;
+      }
     }
-  }
+  });
 
   // Delete the resamplers.
   for(int i = 0; i < numChannels; ++i)
@@ -2517,13 +2618,16 @@ void RotateByShear(const uint8_t* const pixelsIn,
     return;
   }
 
-  for(uint32_t y = 0u; y < heightOut; ++y)
-  {
-    const float shear = angleTangent * ((angleTangent >= 0.f) ? (0.5f + static_cast<float>(y)) : (0.5f + static_cast<float>(y) - static_cast<float>(heightOut)));
+  // Each skew only writes its own scanline (or column) so the skews are split into bands.
+  ImageOperationsParallel::ForEachBand(heightOut, widthOut, [&](uint32_t beginY, uint32_t endY) {
+    for(uint32_t y = beginY; y < endY; ++y)
+    {
+      const float shear = angleTangent * ((angleTangent >= 0.f) ? (0.5f + static_cast<float>(y)) : (0.5f + static_cast<float>(y) - static_cast<float>(heightOut)));
 
-    const int intShear = static_cast<int>(floor(shear));
-    HorizontalSkew(firstHorizontalSkewPixelsIn, widthIn, strideBytes, pixelSize, pixelsOut, widthOut, y, intShear, shear - static_cast<float>(intShear));
-  }
+      const int intShear = static_cast<int>(floor(shear));
+      HorizontalSkew(firstHorizontalSkewPixelsIn, widthIn, strideBytes, pixelSize, pixelsOut, widthOut, y, intShear, shear - static_cast<float>(intShear));
+    }
+  });
 
   // Reset the 'pixel in' pointer with the output of the 'First Horizontal Skew' and free the memory allocated by the 'Fast Rotations'.
   tmpPixelsInPtr.reset(pixelsOut);
@@ -2558,12 +2662,20 @@ void RotateByShear(const uint8_t* const pixelsIn,
   // Variable skew offset
   float offset = angleSinus * ((angleSinus > 0.f) ? (static_cast<float>(widthIn) - 1.0f) : -(static_cast<float>(widthIn) - static_cast<float>(widthOut)));
 
-  uint32_t column = 0u;
-  for(column = 0u; column < widthOut; ++column, offset -= angleSinus)
+  // The offsets are accumulated in order first, so the result doesn't depend on the number of bands.
+  std::vector<float> offsets(widthOut);
+  for(uint32_t column = 0u; column < widthOut; ++column, offset -= angleSinus)
   {
-    const int32_t shear = static_cast<int32_t>(floor(offset));
-    VerticalSkew(tmpPixelsInPtr.get(), tmpWidthIn, tmpHeightIn, tmpWidthIn * pixelSize, pixelSize, pixelsOut, widthOut, heightOut, column, shear, offset - static_cast<float>(shear));
+    offsets[column] = offset;
   }
+
+  ImageOperationsParallel::ForEachBand(widthOut, heightOut, [&](uint32_t beginColumn, uint32_t endColumn) {
+    for(uint32_t column = beginColumn; column < endColumn; ++column)
+    {
+      const int32_t shear = static_cast<int32_t>(floor(offsets[column]));
+      VerticalSkew(tmpPixelsInPtr.get(), tmpWidthIn, tmpHeightIn, tmpWidthIn * pixelSize, pixelSize, pixelsOut, widthOut, heightOut, column, shear, offsets[column] - static_cast<float>(shear));
+    }
+  });
   // Reset the 'pixel in' pointer with the output of the 'Vertical Skew' and free the memory allocated by the 'First Horizontal Skew'.
   // Reset the input/output
   tmpPixelsInPtr.reset(pixelsOut);
@@ -2595,12 +2707,20 @@ void RotateByShear(const uint8_t* const pixelsIn,
 
   offset = (angleSinus >= 0.f) ? -angleSinus * angleTangent * (static_cast<float>(widthIn) - 1.0f) : angleTangent * ((static_cast<float>(widthIn) - 1.0f) * -angleSinus + (1.f - static_cast<float>(heightOut)));
 
+  offsets.resize(heightOut);
   for(uint32_t y = 0u; y < heightOut; ++y, offset += angleTangent)
   {
-    const int32_t shear = static_cast<int32_t>(floor(offset));
-    HorizontalSkew(tmpPixelsInPtr.get(), tmpWidthIn, tmpWidthIn * pixelSize, pixelSize, pixelsOut, widthOut, y, shear, offset - static_cast<float>(shear));
+    offsets[y] = offset;
   }
 
+  ImageOperationsParallel::ForEachBand(heightOut, widthOut, [&](uint32_t beginY, uint32_t endY) {
+    for(uint32_t y = beginY; y < endY; ++y)
+    {
+      const int32_t shear = static_cast<int32_t>(floor(offsets[y]));
+      HorizontalSkew(tmpPixelsInPtr.get(), tmpWidthIn, tmpWidthIn * pixelSize, pixelSize, pixelsOut, widthOut, y, shear, offsets[y] - static_cast<float>(shear));
+    }
+  });
+
   // The deleter of the tmpPixelsInPtr unique pointer is called freeing the memory allocated by the 'Vertical Skew'.
   // @note Allocated memory by the last 'Horizontal Skew' has to be freed by the caller to this function.
 }
@@ -2645,13 +2765,15 @@ void HorizontalShear(const uint8_t* const pixelsIn,
     return;
   }
 
-  for(uint32_t y = 0u; y < heightOut; ++y)
-  {
-    const float shear = radians * ((radians >= 0.f) ? (0.5f + static_cast<float>(y)) : (0.5f + static_cast<float>(y) - static_cast<float>(heightOut)));
+  ImageOperationsParallel::ForEachBand(heightOut, widthOut, [&](uint32_t beginY, uint32_t endY) {
+    for(uint32_t y = beginY; y < endY; ++y)
+    {
+      const float shear = radians * ((radians >= 0.f) ? (0.5f + static_cast<float>(y)) : (0.5f + static_cast<float>(y) - static_cast<float>(heightOut)));
 
-    const int32_t intShear = static_cast<int32_t>(floor(shear));
-    HorizontalSkew(pixelsIn, widthIn, strideBytesIn, pixelSize, pixelsOut, widthOut, y, intShear, shear - static_cast<float>(intShear));
-  }
+      const int32_t intShear = static_cast<int32_t>(floor(shear));
+      HorizontalSkew(pixelsIn, widthIn, strideBytesIn, pixelSize, pixelsOut, widthOut, y, intShear, shear - static_cast<float>(intShear));
+    }
+  });
 }
 
 } /* namespace Platform */
@@ -30,6 +30,7 @@
 #include <dali/internal/imaging/common/alpha-mask.h>
 #include <dali/internal/imaging/common/gaussian-blur.h>
 #include <dali/internal/imaging/common/image-operations.h>
+#include <dali/internal/imaging/common/pixel-kernels.h>
 #include <dali/internal/imaging/common/pixel-manipulation.h>
 
 namespace Dali
@@ -715,10 +716,10 @@ PixelBufferPtr PixelBuffer::NewResize(const PixelBuffer& inBuffer, ImageDimensio
   return outBuffer;
 }
 
-bool PixelBuffer::ApplyGaussianBlur(const float blurRadius)
+bool PixelBuffer::ApplyGaussianBlur(const float blurRadius, const Dali::DevelPixelBuffer::GaussianBlurMode mode)
 {
   DALI_TRACE_BEGIN_WITH_MESSAGE_GENERATOR(gTraceFilter, "DALI_PIXEL_BUFFER_APPLY_GAUSSIAN_BLUR", [&](std::ostringstream& oss)
-  { oss << "[" << mWidth << "x" << mHeight << " format " << mPixelFormat << " blurRadius:" << blurRadius << "]"; });
+  { oss << "[" << mWidth << "x" << mHeight << " format " << mPixelFormat << " blurRadius:" << blurRadius << " fast:" << (mode == Dali::DevelPixelBuffer::GaussianBlurMode::FAST) << "]"; });
   // Check first if ApplyGaussianBlur() can perform the operation in the current pixel buffer.
 
   bool validPixelFormat = false;
@@ -752,7 +753,7 @@ bool PixelBuffer::ApplyGaussianBlur(const float blurRadius)
   {
     if(mWidth > 0 && mHeight > 0)
     {
-      applied = PerformGaussianBlur(*this, blurRadius);
+      applied = PerformGaussianBlur(*this, blurRadius, mode);
     }
     else
     {
@@ -789,43 +790,47 @@ void PixelBuffer::MultiplyColorByAlpha()
       const uint32_t strideBytes = mStrideBytes;
       const uint32_t widthBytes  = mWidth * bytesPerPixel;
 
-      // Collect all valid channel list before lookup whole buffer
-      std::vector<Channel> validChannelList;
-      for(const Channel& channel : {Adaptor::RED, Adaptor::GREEN, Adaptor::BLUE, Adaptor::LUMINANCE})
+      // The formats with one byte per channel use the specialised kernels.
+      if(!PixelKernels::MultiplyColorByAlpha(pixel, mPixelFormat, mWidth, mHeight, strideBytes))
       {
-        if(HasChannel(mPixelFormat, channel))
+        // Collect all valid channel list before lookup whole buffer
+        std::vector<Channel> validChannelList;
+        for(const Channel& channel : {Adaptor::RED, Adaptor::GREEN, Adaptor::BLUE, Adaptor::LUMINANCE})
         {
-          validChannelList.emplace_back(channel);
+          if(HasChannel(mPixelFormat, channel))
+          {
+            validChannelList.emplace_back(channel);
+          }
         }
-      }
 
-      if(DALI_LIKELY(!validChannelList.empty()))
-      {
-        for(uint32_t y = 0; y < mHeight; y++)
+        if(DALI_LIKELY(!validChannelList.empty()))
         {
-          for(uint32_t x = 0; x < widthBytes; x += bytesPerPixel)
+          for(uint32_t y = 0; y < mHeight; y++)
           {
-            uint32_t alpha = ReadChannel(&pixel[x], mPixelFormat, Adaptor::ALPHA);
-            if(alpha < 255)
+            for(uint32_t x = 0; x < widthBytes; x += bytesPerPixel)
             {
-              // If alpha is 255, we don't need to change color. Skip current pixel
-              // But if alpha is not 255, we should change color.
-              if(alpha > 0)
+              uint32_t alpha = ReadChannel(&pixel[x], mPixelFormat, Adaptor::ALPHA);
+              if(alpha < 255)
               {
-                for(const Channel& channel : validChannelList)
+                // If alpha is 255, we don't need to change color. Skip current pixel
+                // But if alpha is not 255, we should change color.
+                if(alpha > 0)
                 {
-                  auto color = ReadChannel(&pixel[x], mPixelFormat, channel);
-                  WriteChannel(&pixel[x], mPixelFormat, channel, Platform::MultiplyAndNormalizeColor(color, alpha));
+                  for(const Channel& channel : validChannelList)
+                  {
+                    auto color = ReadChannel(&pixel[x], mPixelFormat, channel);
+                    WriteChannel(&pixel[x], mPixelFormat, channel, Platform::MultiplyAndNormalizeColor(color, alpha));
+                  }
+                }
+                else
+                {
+                  // If alpha is 0, just set all pixel as zero.
+                  memset(&pixel[x], 0, bytesPerPixel);
                 }
-              }
-              else
-              {
-                // If alpha is 0, just set all pixel as zero.
-                memset(&pixel[x], 0, bytesPerPixel);
               }
             }
+            pixel += strideBytes;
           }
-          pixel += strideBytes;
         }
       }
 
@@ -19,6 +19,7 @@
  */
 
 // INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/pixel-buffer-devel.h>
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/adaptor-framework/pixel-buffer.h>
 #include <dali/public-api/images/pixel-data.h>
@@ -193,10 +194,11 @@ public:
    * @brief Apply a Gaussian blur to the current buffer with the given radius.
    *
    * @param[in] blurRadius The radius for Gaussian blur
+   * @param[in] mode Whether to convolve with the exact Gaussian or approximate it with box blurs
    *
    * @return @e false if the gaussian blur fails (invalid pixel format or memory issues).
    */
-  bool ApplyGaussianBlur(const float blurRadius);
+  bool ApplyGaussianBlur(const float blurRadius, const Dali::DevelPixelBuffer::GaussianBlurMode mode);
 
   /**
    * Crops this buffer to the given crop rectangle. Assumes the crop rectangle
@@ -0,0 +1,385 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/common/pixel-kernels.h>
+
+// EXTERNAL INCLUDES
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/internal/imaging/common/image-operations-simd.h>
+#include <dali/internal/imaging/common/image-operations.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+namespace PixelKernels
+{
+namespace
+{
+/**
+ * @brief The layout of a pixel format with one byte per channel.
+ *
+ * Each offset is the byte of the channel in the pixel, or -1 if the format has no such channel.
+ */
+template<uint32_t BytesPerPixel, int LuminanceOffset, int RedOffset, int GreenOffset, int BlueOffset, int AlphaOffset>
+struct ByteFormat
+{
+  static constexpr uint32_t BYTES_PER_PIXEL = BytesPerPixel;
+  static constexpr int      LUMINANCE       = LuminanceOffset;
+  static constexpr int      RED             = RedOffset;
+  static constexpr int      GREEN           = GreenOffset;
+  static constexpr int      BLUE            = BlueOffset;
+  static constexpr int      ALPHA           = AlphaOffset;
+
+  /// Whether the rows can use the 4 bytes per pixel ImageOperationsSimd kernels, which expect the alpha in the last byte.
+  static constexpr bool IS_SIMD_FRIENDLY = (BytesPerPixel == 4u && AlphaOffset == 3);
+};
+
+template<Pixel::Format Format>
+struct FormatTraits;
+
+// clang-format off
+//                                                      | bpp | LUMINANCE | RED | GREEN | BLUE | ALPHA |
+template<> struct FormatTraits<Pixel::A8>       : ByteFormat<1u,        -1 ,  -1 ,    -1 ,   -1 ,     0> {};
+template<> struct FormatTraits<Pixel::L8>       : ByteFormat<1u,         0 ,  -1 ,    -1 ,   -1 ,    -1> {};
+template<> struct FormatTraits<Pixel::LA88>     : ByteFormat<2u,         0 ,  -1 ,    -1 ,   -1 ,     1> {};
+template<> struct FormatTraits<Pixel::RGB888>   : ByteFormat<3u,        -1 ,   0 ,     1 ,    2 ,    -1> {};
+template<> struct FormatTraits<Pixel::RGB8888>  : ByteFormat<4u,        -1 ,   0 ,     1 ,    2 ,    -1> {};
+template<> struct FormatTraits<Pixel::BGR8888>  : ByteFormat<4u,        -1 ,   2 ,     1 ,    0 ,    -1> {};
+template<> struct FormatTraits<Pixel::RGBA8888> : ByteFormat<4u,        -1 ,   0 ,     1 ,    2 ,     3> {};
+template<> struct FormatTraits<Pixel::BGRA8888> : ByteFormat<4u,        -1 ,   2 ,     1 ,    0 ,     3> {};
+// clang-format on
+
+/**
+ * @brief Call the function with the FormatTraits of the format.
+ * @return false if the format has no FormatTraits
+ */
+template<typename Function>
+bool VisitFormat(Pixel::Format format, Function&& function)
+{
+  switch(format)
+  {
+    case Pixel::A8:
+    {
+      function(FormatTraits<Pixel::A8>());
+      return true;
+    }
+    case Pixel::L8:
+    {
+      function(FormatTraits<Pixel::L8>());
+      return true;
+    }
+    case Pixel::LA88:
+    {
+      function(FormatTraits<Pixel::LA88>());
+      return true;
+    }
+    case Pixel::RGB888:
+    {
+      function(FormatTraits<Pixel::RGB888>());
+      return true;
+    }
+    case Pixel::RGB8888:
+    {
+      function(FormatTraits<Pixel::RGB8888>());
+      return true;
+    }
+    case Pixel::BGR8888:
+    {
+      function(FormatTraits<Pixel::BGR8888>());
+      return true;
+    }
+    case Pixel::RGBA8888:
+    {
+      function(FormatTraits<Pixel::RGBA8888>());
+      return true;
+    }
+    case Pixel::BGRA8888:
+    {
+      function(FormatTraits<Pixel::BGRA8888>());
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+}
+
+/**
+ * @brief Call the function with the FormatTraits of a mask format, i.e. a format with an alpha channel, or L8.
+ * @return false if the format can't be used as a mask here
+ */
+template<typename Function>
+bool VisitMaskFormat(Pixel::Format format, Function&& function)
+{
+  switch(format)
+  {
+    case Pixel::A8:
+    case Pixel::L8:
+    case Pixel::LA88:
+    case Pixel::RGBA8888:
+    case Pixel::BGRA8888:
+    {
+      return VisitFormat(format, std::forward<Function>(function));
+    }
+    default:
+    {
+      return false;
+    }
+  }
+}
+
+/**
+ * @brief Retrieve the alpha of a row of the mask, one byte per pixel.
+ *
+ * @param[in] mask The row of the mask
+ * @param[in] width The number of pixels
+ * @param[in] scratch The buffer to gather the alpha into, when the mask has more than one byte per pixel
+ * @return The alpha of each pixel
+ */
+template<typename MaskFormat>
+const uint8_t* GetMaskRow(const uint8_t* mask, uint32_t width, std::vector<uint8_t>& scratch)
+{
+  if constexpr(MaskFormat::BYTES_PER_PIXEL == 1u)
+  {
+    // The A8 alpha, or the L8 luminance.
+    return mask;
+  }
+  else
+  {
+    for(uint32_t x = 0u; x < width; ++x)
+    {
+      scratch[x] = mask[x * MaskFormat::BYTES_PER_PIXEL + MaskFormat::ALPHA];
+    }
+    return scratch.data();
+  }
+}
+
+/**
+ * @brief Multiply the luminance and color channels of a pixel by a value.
+ */
+template<typename Format>
+inline void MultiplyColorChannels(uint8_t* pixel, uint8_t value)
+{
+  if constexpr(Format::LUMINANCE >= 0)
+  {
+    pixel[Format::LUMINANCE] = Platform::MultiplyAndNormalizeColor(pixel[Format::LUMINANCE], value);
+  }
+  if constexpr(Format::RED >= 0)
+  {
+    pixel[Format::RED] = Platform::MultiplyAndNormalizeColor(pixel[Format::RED], value);
+  }
+  if constexpr(Format::GREEN >= 0)
+  {
+    pixel[Format::GREEN] = Platform::MultiplyAndNormalizeColor(pixel[Format::GREEN], value);
+  }
+  if constexpr(Format::BLUE >= 0)
+  {
+    pixel[Format::BLUE] = Platform::MultiplyAndNormalizeColor(pixel[Format::BLUE], value);
+  }
+}
+
+template<typename Format>
+void MultiplyColorByAlphaRow(uint8_t* pixels, uint32_t width)
+{
+  if constexpr(Format::ALPHA >= 0)
+  {
+    uint32_t x = 0u;
+    if constexpr(Format::IS_SIMD_FRIENDLY)
+    {
+      x = Platform::ImageOperationsSimd::MultiplyColorByAlphaScanline4BPP(pixels, width);
+    }
+
+    for(; x < width; ++x)
+    {
+      uint8_t*      pixel = pixels + x * Format::BYTES_PER_PIXEL;
+      const uint8_t alpha = pixel[Format::ALPHA];
+      if(alpha < 255u)
+      {
+        if(alpha > 0u)
+        {
+          MultiplyColorChannels<Format>(pixel, alpha);
+        }
+        else
+        {
+          // If alpha is 0, just set all pixel as zero.
+          memset(pixel, 0, Format::BYTES_PER_PIXEL);
+        }
+      }
+    }
+  }
+}
+
+template<typename Format>
+void MultiplyPixelsByMaskRow(uint8_t* pixels, const uint8_t* mask, uint32_t width)
+{
+  uint32_t x = 0u;
+  if constexpr(Format::IS_SIMD_FRIENDLY)
+  {
+    x = Platform::ImageOperationsSimd::MultiplyPixelsByMaskScanline4BPP(pixels, mask, width);
+  }
+
+  for(; x < width; ++x)
+  {
+    uint8_t*      pixel = pixels + x * Format::BYTES_PER_PIXEL;
+    const uint8_t alpha = mask[x];
+    if(alpha < 255u)
+    {
+      if(alpha > 0u)
+      {
+        MultiplyColorChannels<Format>(pixel, alpha);
+        if constexpr(Format::ALPHA >= 0)
+        {
+          pixel[Format::ALPHA] = Platform::MultiplyAndNormalizeColor(pixel[Format::ALPHA], alpha);
+        }
+      }
+      else
+      {
+        memset(pixel, 0, Format::BYTES_PER_PIXEL);
+      }
+    }
+  }
+}
+
+template<typename Format>
+void MultiplyAlphaByMaskRow(uint8_t* pixels, const uint8_t* mask, uint32_t width)
+{
+  if constexpr(Format::ALPHA >= 0)
+  {
+    uint32_t x = 0u;
+    if constexpr(Format::IS_SIMD_FRIENDLY)
+    {
+      x = Platform::ImageOperationsSimd::MultiplyAlphaByMaskScanline4BPP(pixels, mask, width);
+    }
+
+    for(; x < width; ++x)
+    {
+      uint8_t* pixel       = pixels + x * Format::BYTES_PER_PIXEL;
+      pixel[Format::ALPHA] = Platform::MultiplyAndNormalizeColor(mask[x], pixel[Format::ALPHA]);
+    }
+  }
+}
+
+template<typename ColorFormat>
+void CreateMaskedRGBA8888Row(const uint8_t* color, const uint8_t* mask, uint8_t* destination, uint32_t width)
+{
+  using DestinationFormat = FormatTraits<Pixel::RGBA8888>;
+
+  if constexpr(std::is_same_v<ColorFormat, DestinationFormat>)
+  {
+    memcpy(destination, color, width * DestinationFormat::BYTES_PER_PIXEL);
+    MultiplyAlphaByMaskRow<DestinationFormat>(destination, mask, width);
+  }
+  else
+  {
+    for(uint32_t x = 0u; x < width; ++x)
+    {
+      const uint8_t* source = color + x * ColorFormat::BYTES_PER_PIXEL;
+      uint8_t*       pixel  = destination + x * DestinationFormat::BYTES_PER_PIXEL;
+
+      // The missing channels are black, as ReadChannel() returns 0 for them.
+      pixel[DestinationFormat::RED]   = (ColorFormat::RED >= 0) ? source[ColorFormat::RED] : 0u;
+      pixel[DestinationFormat::GREEN] = (ColorFormat::GREEN >= 0) ? source[ColorFormat::GREEN] : 0u;
+      pixel[DestinationFormat::BLUE]  = (ColorFormat::BLUE >= 0) ? source[ColorFormat::BLUE] : 0u;
+      if constexpr(ColorFormat::ALPHA >= 0)
+      {
+        pixel[DestinationFormat::ALPHA] = Platform::MultiplyAndNormalizeColor(mask[x], source[ColorFormat::ALPHA]);
+      }
+      else
+      {
+        pixel[DestinationFormat::ALPHA] = mask[x];
+      }
+    }
+  }
+}
+
+} // namespace
+
+bool MultiplyColorByAlpha(uint8_t* pixels, Pixel::Format format, uint32_t width, uint32_t height, uint32_t strideBytes)
+{
+  return VisitFormat(format, [&](auto formatTraits) {
+    using Format = decltype(formatTraits);
+    for(uint32_t y = 0u; y < height; ++y)
+    {
+      MultiplyColorByAlphaRow<Format>(pixels + y * strideBytes, width);
+    }
+  });
+}
+
+bool ApplyMaskToAlphaChannel(uint8_t* pixels, Pixel::Format format, uint32_t strideBytes, const uint8_t* mask, Pixel::Format maskFormat, uint32_t maskStrideBytes, uint32_t width, uint32_t height, bool isAlphaPreMultiplied)
+{
+  bool applied = false;
+  VisitMaskFormat(maskFormat, [&](auto maskFormatTraits) {
+    applied = VisitFormat(format, [&](auto formatTraits) {
+      using MaskFormat = decltype(maskFormatTraits);
+      using Format     = decltype(formatTraits);
+
+      std::vector<uint8_t> scratch(MaskFormat::BYTES_PER_PIXEL == 1u ? 0u : width);
+      for(uint32_t y = 0u; y < height; ++y)
+      {
+        uint8_t*       row     = pixels + y * strideBytes;
+        const uint8_t* maskRow = GetMaskRow<MaskFormat>(mask + y * maskStrideBytes, width, scratch);
+
+        // If the image is premultiplied, the other channels of the image need to multiply by the mask too.
+        if(isAlphaPreMultiplied)
+        {
+          MultiplyPixelsByMaskRow<Format>(row, maskRow, width);
+        }
+        else
+        {
+          MultiplyAlphaByMaskRow<Format>(row, maskRow, width);
+        }
+      }
+    });
+  });
+  return applied;
+}
+
+bool CreateMaskedRGBA8888(const uint8_t* color, Pixel::Format colorFormat, uint32_t colorStrideBytes, const uint8_t* mask, Pixel::Format maskFormat, uint32_t maskStrideBytes, uint8_t* destination, uint32_t destinationStrideBytes, uint32_t width, uint32_t height)
+{
+  bool created = false;
+  VisitMaskFormat(maskFormat, [&](auto maskFormatTraits) {
+    created = VisitFormat(colorFormat, [&](auto colorFormatTraits) {
+      using MaskFormat  = decltype(maskFormatTraits);
+      using ColorFormat = decltype(colorFormatTraits);
+
+      std::vector<uint8_t> scratch(MaskFormat::BYTES_PER_PIXEL == 1u ? 0u : width);
+      for(uint32_t y = 0u; y < height; ++y)
+      {
+        const uint8_t* maskRow = GetMaskRow<MaskFormat>(mask + y * maskStrideBytes, width, scratch);
+        CreateMaskedRGBA8888Row<ColorFormat>(color + y * colorStrideBytes, maskRow, destination + y * destinationStrideBytes, width);
+      }
+    });
+  });
+  return created;
+}
+
+} // namespace PixelKernels
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,98 @@
+#ifndef DALI_INTERNAL_ADAPTOR_PIXEL_KERNELS_H
+#define DALI_INTERNAL_ADAPTOR_PIXEL_KERNELS_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/images/pixel.h>
+#include <cstdint>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+/**
+ * @brief Per-pixel kernels for alpha premultiplication and masking, specialised at compile time
+ * for each pixel format with one byte per channel.
+ *
+ * The kernels give the same result as the generic loops reading and writing each channel through
+ * ReadChannel() and WriteChannel(). RGBA8888 and BGRA8888 rows use the ImageOperationsSimd kernels.
+ *
+ * Each function returns false, without touching the pixels, when a format has no kernel
+ * (e.g. the packed 16 bit formats). The caller then falls back to the generic loop.
+ */
+namespace PixelKernels
+{
+/**
+ * @brief Multiply the color channels of each pixel by its alpha.
+ *
+ * @param[in,out] pixels The pixels to premultiply
+ * @param[in] format The pixel format of the pixels
+ * @param[in] width The width of the pixels
+ * @param[in] height The height of the pixels
+ * @param[in] strideBytes The number of bytes between two rows
+ * @return true if the format has a kernel, and the pixels are premultiplied
+ */
+bool MultiplyColorByAlpha(uint8_t* pixels, Pixel::Format format, uint32_t width, uint32_t height, uint32_t strideBytes);
+
+/**
+ * @brief Apply the alpha of a mask to the pixels.
+ *
+ * If the pixels are premultiplied, each channel is multiplied by the mask. Otherwise only the alpha channel is.
+ *
+ * @param[in,out] pixels The pixels to mask
+ * @param[in] format The pixel format of the pixels
+ * @param[in] strideBytes The number of bytes between two rows of the pixels
+ * @param[in] mask The mask, of the same size as the pixels. Its alpha is the L8 value if it has no alpha channel.
+ * @param[in] maskFormat The pixel format of the mask
+ * @param[in] maskStrideBytes The number of bytes between two rows of the mask
+ * @param[in] width The width of the pixels
+ * @param[in] height The height of the pixels
+ * @param[in] isAlphaPreMultiplied Whether the pixels are premultiplied
+ * @return true if both formats have a kernel, and the mask is applied
+ */
+bool ApplyMaskToAlphaChannel(uint8_t* pixels, Pixel::Format format, uint32_t strideBytes, const uint8_t* mask, Pixel::Format maskFormat, uint32_t maskStrideBytes, uint32_t width, uint32_t height, bool isAlphaPreMultiplied);
+
+/**
+ * @brief Write RGBA8888 pixels, with the color of the color pixels and their alpha multiplied by the mask.
+ *
+ * @param[in] color The color pixels
+ * @param[in] colorFormat The pixel format of the color pixels
+ * @param[in] colorStrideBytes The number of bytes between two rows of the color pixels
+ * @param[in] mask The mask, of the same size as the color pixels. Its alpha is the L8 value if it has no alpha channel.
+ * @param[in] maskFormat The pixel format of the mask
+ * @param[in] maskStrideBytes The number of bytes between two rows of the mask
+ * @param[out] destination The RGBA8888 pixels to write
+ * @param[in] destinationStrideBytes The number of bytes between two rows of the destination
+ * @param[in] width The width of the pixels
+ * @param[in] height The height of the pixels
+ * @return true if both formats have a kernel, and the destination is written
+ */
+bool CreateMaskedRGBA8888(const uint8_t* color, Pixel::Format colorFormat, uint32_t colorStrideBytes, const uint8_t* mask, Pixel::Format maskFormat, uint32_t maskStrideBytes, uint8_t* destination, uint32_t destinationStrideBytes, uint32_t width, uint32_t height);
+
+} // namespace PixelKernels
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ADAPTOR_PIXEL_KERNELS_H
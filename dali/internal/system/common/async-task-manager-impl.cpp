@@ -28,6 +28,7 @@
 
 #include <algorithm> // for std::find
 #include <mutex>
+#include <optional>
 
 // INTERNAL INCLUDES
 #include <dali/internal/system/common/environment-variables.h>
@@ -49,6 +50,12 @@ constexpr auto DEFAULT_NUMBER_OF_ASYNC_THREADS = size_t{8u};
 // The number of threads for low priority task.
 constexpr auto DEFAULT_NUMBER_OF_LOW_PRIORITY_THREADS = size_t{6u};
 
+// Bits of AsyncTask::mDependencyState.
+constexpr uint32_t DEPENDENCY_PROCESSED      = 1u << 31;                 ///< The task was processed, so new successors don't wait for it.
+constexpr uint32_t DEPENDENCY_HAS_SUCCESSORS = 1u << 30;                 ///< Some tasks wait for this task, so its mSuccessors must be checked.
+constexpr uint32_t DEPENDENCY_CANCELED       = 1u << 29;                 ///< The task was removed, so its successors must never be released.
+constexpr uint32_t DEPENDENCY_PENDING_MASK   = DEPENDENCY_CANCELED - 1u; ///< The number of unprocessed predecessors.
+
 size_t GetNumberOfThreads(size_t defaultValue)
 {
   auto           numberString          = EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_ASYNC_MANAGER_THREAD_POOL_SIZE);
@@ -66,6 +73,12 @@ size_t GetNumberOfLowPriorityThreads(size_t defaultValue, size_t maxValue)
   return (numberOfThreads > 0 && numberOfThreads <= maxValue) ? numberOfThreads : Min(defaultValue, maxValue);
 }
 
+bool IsWorkStealingEnabled()
+{
+  auto enabledString = EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_ASYNC_MANAGER_WORK_STEALING);
+  return enabledString ? std::strtoul(enabledString, nullptr, 10) != 0 : false;
+}
+
 #if defined(DEBUG_ENABLED)
 Debug::Filter* gAsyncTasksManagerLogFilter = Debug::Filter::New(Debug::NoLogging, false, "LOG_ASYNC_TASK_MANAGER");
 
@@ -93,8 +106,8 @@ const char* GetTaskName(AsyncTaskPtr task)
 AsyncTaskThread::AsyncTaskThread(AsyncTaskManager& asyncTaskManager)
 : mConditionalWait(),
   mAsyncTaskManager(asyncTaskManager),
-  mLogFactory(Dali::Adaptor::Get().GetLogFactory()),
-  mTraceFactory(Dali::Adaptor::Get().GetTraceFactory()),
+  mLogFactory(Dali::Adaptor::IsAvailable() ? &Dali::Adaptor::Get().GetLogFactory() : nullptr),
+  mTraceFactory(Dali::Adaptor::IsAvailable() ? &Dali::Adaptor::Get().GetTraceFactory() : nullptr),
   mDestroyThread(false),
   mIsThreadStarted(false),
   mIsThreadIdle(true)
@@ -150,12 +163,20 @@ void AsyncTaskThread::Run()
 #else
   SetThreadName("AsyncTaskThread");
 #endif
-  mLogFactory.InstallLogFunction();
-  mTraceFactory.InstallTraceFunction();
+  if(mLogFactory)
+  {
+    mLogFactory->InstallLogFunction();
+  }
+  if(mTraceFactory)
+  {
+    mTraceFactory->InstallTraceFunction();
+  }
+  mAsyncTaskManager.RegisterWorkerThread();
 
+  AsyncTaskPtr continuation; ///< A successor of the last task, which already runs on this thread.
   while(!mDestroyThread)
   {
-    AsyncTaskPtr task = mAsyncTaskManager.PopNextTaskToProcess();
+    AsyncTaskPtr task = continuation ? std::move(continuation) : mAsyncTaskManager.PopNextTaskToProcess();
     if(!task)
     {
       ConditionalWait::ScopedLock lock(mConditionalWait);
@@ -174,7 +195,7 @@ void AsyncTaskThread::Run()
       DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::General, "Thread[%u] Complete task [%p][%s]\n", threadId, task.Get(), GetTaskName(task));
       if(!mDestroyThread)
       {
-        mAsyncTaskManager.CompleteTask(std::move(task));
+        continuation = mAsyncTaskManager.CompleteTask(std::move(task));
       }
     }
   }
@@ -608,6 +629,7 @@ namespace
 {
 std::mutex                                 gStaticAsyncTaskManagerMutex; ///< Mutex for AsyncTaskManager
 Dali::Internal::Adaptor::AsyncTaskManager* gAsyncTaskManager = nullptr;  ///< Must be used under gStaticAsyncTaskManagerMutex
+std::mutex                                 gAsyncTaskDependencyMutex;    ///< Mutex for AsyncTask::mSuccessors of every task
 } // namespace
 
 Dali::AsyncTaskManager AsyncTaskManager::Get()
@@ -649,6 +671,98 @@ void AsyncTaskManager::NotifyManagerToTaskReady(AsyncTaskPtr task)
   }
 }
 
+/// Main + Worker thread called
+bool AsyncTaskManager::AddTaskToManager(AsyncTaskPtr task)
+{
+  std::unique_lock<std::mutex> lock(gStaticAsyncTaskManagerMutex);
+  if(gAsyncTaskManager)
+  {
+    gAsyncTaskManager->AddTask(task);
+    return true;
+  }
+  DALI_LOG_DEBUG_INFO("Skip AddTaskToManager\n");
+  return false;
+}
+
+/// Main + Worker thread called
+void AsyncTaskManager::AddTaskDependency(AsyncTaskPtr task, AsyncTaskPtr predecessor)
+{
+  if(!task || !predecessor || task == predecessor)
+  {
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(gAsyncTaskDependencyMutex);
+
+  // Set the flag first, so that either MarkTaskProcessed() sees it and waits for this lock to take the successors,
+  // or we see the predecessor was already processed.
+  const uint32_t predecessorState = predecessor->mDependencyState.fetch_or(DEPENDENCY_HAS_SUCCESSORS, std::memory_order_acq_rel);
+  if(predecessorState & DEPENDENCY_PROCESSED)
+  {
+    DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "AddTaskDependency [%p][%s] predecessor [%p][%s] already processed\n", task.Get(), GetTaskName(task), predecessor.Get(), GetTaskName(predecessor));
+    return;
+  }
+
+  DALI_ASSERT_ALWAYS(((task->mDependencyState.load(std::memory_order_relaxed) & DEPENDENCY_PENDING_MASK) < DEPENDENCY_PENDING_MASK) && "Too many predecessors");
+  task->mDependencyState.fetch_add(1u, std::memory_order_acq_rel);
+  predecessor->mSuccessors.push_back(task);
+
+  DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "AddTaskDependency [%p][%s] waits for [%p][%s]\n", task.Get(), GetTaskName(task), predecessor.Get(), GetTaskName(predecessor));
+}
+
+/// Main + Worker thread called
+bool AsyncTaskManager::HasPendingDependencies(const AsyncTask& task)
+{
+  return (task.mDependencyState.load(std::memory_order_acquire) & DEPENDENCY_PENDING_MASK) != 0u;
+}
+
+/// Main + Worker thread called
+std::vector<AsyncTaskPtr> AsyncTaskManager::MarkTaskProcessed(AsyncTaskPtr task)
+{
+  std::vector<AsyncTaskPtr> readySuccessors;
+  if(task && (task->mDependencyState.fetch_or(DEPENDENCY_PROCESSED, std::memory_order_acq_rel) & DEPENDENCY_HAS_SUCCESSORS))
+  {
+    std::vector<AsyncTaskPtr> successors;
+    {
+      // Check the cancel under the lock DetachSuccessors() takes them with, so they are either all released here or all removed there.
+      std::unique_lock<std::mutex> lock(gAsyncTaskDependencyMutex);
+      if(task->mDependencyState.load(std::memory_order_acquire) & DEPENDENCY_CANCELED)
+      {
+        DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "MarkTaskProcessed [%p][%s] was removed. Keep its successors\n", task.Get(), GetTaskName(task));
+        return readySuccessors;
+      }
+      successors.swap(task->mSuccessors);
+    }
+
+    for(auto& successor : successors)
+    {
+      // The last predecessor to finish releases the successor.
+      if((successor->mDependencyState.fetch_sub(1u, std::memory_order_acq_rel) & DEPENDENCY_PENDING_MASK) == 1u)
+      {
+        readySuccessors.push_back(std::move(successor));
+      }
+    }
+  }
+  return readySuccessors;
+}
+
+/// Main + Worker thread called
+std::vector<AsyncTaskPtr> AsyncTaskManager::DetachSuccessors(AsyncTaskPtr task)
+{
+  std::vector<AsyncTaskPtr> successors;
+  if(task && (task->mDependencyState.fetch_or(DEPENDENCY_CANCELED, std::memory_order_acq_rel) & DEPENDENCY_HAS_SUCCESSORS))
+  {
+    std::unique_lock<std::mutex> lock(gAsyncTaskDependencyMutex);
+    successors.swap(task->mSuccessors);
+  }
+  return successors;
+}
+
+bool AsyncTaskManager::IsTaskReady(AsyncTaskPtr& task)
+{
+  return !HasPendingDependencies(*task) && task->IsReady();
+}
+
 AsyncTaskManager::AsyncTaskManager()
 : mTasks(GetNumberOfThreads(DEFAULT_NUMBER_OF_ASYNC_THREADS), [&]()
          { return TaskHelper(*this); }),
@@ -657,9 +771,12 @@ AsyncTaskManager::AsyncTaskManager()
   mTrigger(new EventThreadCallback(MakeCallback(this, &AsyncTaskManager::TasksCompleted))),
   mTasksCompletedImpl(new TasksCompletedImpl(mTrigger.get())),
   mCacheImpl(new CacheImpl(*this)),
+  mWorkStealingQueue(IsWorkStealingEnabled() ? new WorkStealingTaskQueue(static_cast<uint32_t>(mTasks.GetElementCount())) : nullptr),
+  mRunningTaskCount(0u),
+  mEventThreadId(std::this_thread::get_id()),
   mProcessorRegistered(false)
 {
-  DALI_LOG_DEBUG_INFO("AsyncTaskManager Trigger Id(%d)\n", mTrigger->GetId());
+  DALI_LOG_DEBUG_INFO("AsyncTaskManager Trigger Id(%d), work stealing(%d)\n", mTrigger->GetId(), !!mWorkStealingQueue);
 
   std::unique_lock<std::mutex> lock(gStaticAsyncTaskManagerMutex);
   gAsyncTaskManager = this;
@@ -689,6 +806,7 @@ AsyncTaskManager::~AsyncTaskManager()
   mCacheImpl.reset();
 
   // Remove tasks after CacheImpl removed
+  mWorkStealingQueue.reset();
   mWaitingTasks.clear();
   mRunningTasks.clear();
   mCompletedTasks.clear();
@@ -698,12 +816,46 @@ AsyncTaskManager::~AsyncTaskManager()
 void AsyncTaskManager::AddTask(AsyncTaskPtr task)
 {
   if(task)
+  {
+    // Added again after it was removed, so its new successors are released as usual.
+    task->mDependencyState.fetch_and(~DEPENDENCY_CANCELED, std::memory_order_acq_rel);
+  }
+
+  if(task && mWorkStealingQueue)
+  {
+    // Ready tasks go straight to a worker deque, without the waiting tasks mutex.
+    // Check again under the mutex before keeping the task as not ready, since NotifyToTaskReady() holds it too.
+    bool isReady = IsTaskReady(task);
+    if(DALI_UNLIKELY(!isReady))
+    {
+      Mutex::ScopedLock lock(mWaitingTasksMutex);
+
+      isReady = IsTaskReady(task);
+      if(!isReady)
+      {
+        DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "AddTask [%p][%s], IsReady(0)\n", task.Get(), GetTaskName(task));
+        auto notReadyIter = mNotReadyTasks.insert(mNotReadyTasks.end(), task);
+        CacheImpl::InsertTaskCache(mCacheImpl->mNotReadyTasksCache, task, notReadyIter);
+        return;
+      }
+    }
+
+    DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "AddTask [%p][%s], IsReady(1)\n", task.Get(), GetTaskName(task));
+    mWorkStealingQueue->Push(task);
+
+    // Finish all Running threads are working
+    if(mRunningTaskCount.load(std::memory_order_acquire) >= mTasks.GetElementCount())
+    {
+      return;
+    }
+  }
+  else if(task)
   {
     // Lock while adding task to the queue
     Mutex::ScopedLock lock(mWaitingTasksMutex);
 
     // Keep this value as stack memory, for thread safety
-    const bool isReady = task->IsReady();
+    const bool isReady = IsTaskReady(task);
     DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "AddTask [%p][%s], IsReady(%d)\n", task.Get(), GetTaskName(task), isReady);
 
     if(DALI_LIKELY(isReady))
@@ -755,7 +907,11 @@ void AsyncTaskManager::AddTask(AsyncTaskPtr task)
   }
 
   // Register Process (Since mTrigger execute too late timing if event thread running a lots of events.)
-  RegisterProcessor();
+  // The tasks added by the other threads, e.g. the bands of an image operation, wake the event thread by mTrigger when they complete.
+  if(std::this_thread::get_id() == mEventThreadId)
+  {
+    RegisterProcessor();
+  }
 
   return;
 }
@@ -805,7 +961,12 @@ void AsyncTaskManager::RemoveTask(AsyncTaskPtr task)
         CacheImpl::EraseAllTaskCache(mCacheImpl->mNotReadyTasksCache, task);
       }
 
-      if(!mWaitingTasks.empty())
+      if(mWorkStealingQueue)
+      {
+        removedCount += mWorkStealingQueue->Remove(task.Get());
+      }
+
+      if(!mWaitingTasks.empty() || (mWorkStealingQueue && !mWorkStealingQueue->IsEmpty()))
       {
         needCheckUnregisterProcessor = false;
       }
@@ -873,6 +1034,12 @@ void AsyncTaskManager::RemoveTask(AsyncTaskPtr task)
     {
       UnregisterProcessor();
     }
+
+    // The tasks waiting for this task would wait forever. Remove them too.
+    for(auto& successor : DetachSuccessors(task))
+    {
+      RemoveTask(successor);
+    }
   }
 }
 
@@ -881,6 +1048,13 @@ void AsyncTaskManager::NotifyToTaskReady(AsyncTaskPtr task)
 {
   if(task)
   {
+    if(HasPendingDependencies(*task))
+    {
+      // The last predecessor will notify again when it has been processed.
+      DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "NotifyToTaskReady [%p][%s] waits for predecessors. Ignore\n", task.Get(), GetTaskName(task));
+      return;
+    }
+
     // Lock while adding task to the queue
     Mutex::ScopedLock lock(mWaitingTasksMutex);
     DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "NotifyToTaskReady [%p][%s]\n", task.Get(), GetTaskName(task));
@@ -898,6 +1072,11 @@ void AsyncTaskManager::NotifyToTaskReady(AsyncTaskPtr task)
       CacheImpl::EraseAllTaskCache(mCacheImpl->mNotReadyTasksCache, task);
 
       // push back into waiting queue.
+      while(removedCount > 0u && mWorkStealingQueue)
+      {
+        --removedCount;
+        mWorkStealingQueue->Push(task);
+      }
       while(removedCount > 0u)
       {
         --removedCount;
@@ -945,10 +1124,29 @@ Dali::AsyncTaskManager::TasksCompletedId AsyncTaskManager::SetCompletedCallback(
 
   DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "SetCompletedCallback id : %u, mask : %d\n", tasksCompletedId, static_cast<int32_t>(mask));
 
+  auto appendTaskTrace = [&](const AsyncTaskPtr& task)
+  {
+    auto checkMask = (task->GetCallbackInvocationThread() == Dali::AsyncTask::ThreadType::MAIN_THREAD ? Dali::AsyncTaskManager::CompletedCallbackTraceMask::THREAD_MASK_MAIN : Dali::AsyncTaskManager::CompletedCallbackTraceMask::THREAD_MASK_WORKER) |
+                     (task->GetPriorityType() == Dali::AsyncTask::PriorityType::HIGH ? Dali::AsyncTaskManager::CompletedCallbackTraceMask::PRIORITY_MASK_HIGH : Dali::AsyncTaskManager::CompletedCallbackTraceMask::PRIORITY_MASK_LOW);
+
+    if((checkMask & mask) == checkMask)
+    {
+      ++addedTaskCount;
+      mTasksCompletedImpl->AppendTaskTrace(tasksCompletedId, task);
+    }
+  };
+
   // Please be careful the order of mutex, to avoid dead lock.
   {
     Mutex::ScopedLock lockWait(mWaitingTasksMutex);
     {
+      // Keep the work stealing queue locked too, so no task can move from it to the running tasks meanwhile.
+      std::optional<WorkStealingTaskQueue::ScopedLock> lockQueue;
+      if(mWorkStealingQueue)
+      {
+        lockQueue.emplace(*mWorkStealingQueue);
+      }
+
       Mutex::ScopedLock lockRunning(mRunningTasksMutex); // We can lock this mutex under mWaitingTasksMutex.
       {
         Mutex::ScopedLock lockComplete(mCompletedTasksMutex); // We can lock this mutex under mWaitingTasksMutex and mRunningTasksMutex.
@@ -956,27 +1154,18 @@ Dali::AsyncTaskManager::TasksCompletedId AsyncTaskManager::SetCompletedCallback(
         // Collect all tasks from waiting tasks
         for(auto& task : mWaitingTasks)
         {
-          auto checkMask = (task->GetCallbackInvocationThread() == Dali::AsyncTask::ThreadType::MAIN_THREAD ? Dali::AsyncTaskManager::CompletedCallbackTraceMask::THREAD_MASK_MAIN : Dali::AsyncTaskManager::CompletedCallbackTraceMask::THREAD_MASK_WORKER) |
-                           (task->GetPriorityType() == Dali::AsyncTask::PriorityType::HIGH ? Dali::AsyncTaskManager::CompletedCallbackTraceMask::PRIORITY_MASK_HIGH : Dali::AsyncTaskManager::CompletedCallbackTraceMask::PRIORITY_MASK_LOW);
+          appendTaskTrace(task);
+        }
 
-          if((checkMask & mask) == checkMask)
-          {
-            ++addedTaskCount;
-            mTasksCompletedImpl->AppendTaskTrace(tasksCompletedId, task);
-          }
+        if(mWorkStealingQueue)
+        {
+          mWorkStealingQueue->ForEachLocked(appendTaskTrace);
         }
 
         // Collect all tasks from not ready waiting tasks
         for(auto& task : mNotReadyTasks)
         {
-          auto checkMask = (task->GetCallbackInvocationThread() == Dali::AsyncTask::ThreadType::MAIN_THREAD ? Dali::AsyncTaskManager::CompletedCallbackTraceMask::THREAD_MASK_MAIN : Dali::AsyncTaskManager::CompletedCallbackTraceMask::THREAD_MASK_WORKER) |
-                           (task->GetPriorityType() == Dali::AsyncTask::PriorityType::HIGH ? Dali::AsyncTaskManager::CompletedCallbackTraceMask::PRIORITY_MASK_HIGH : Dali::AsyncTaskManager::CompletedCallbackTraceMask::PRIORITY_MASK_LOW);
-
-          if((checkMask & mask) == checkMask)
-          {
-            ++addedTaskCount;
-            mTasksCompletedImpl->AppendTaskTrace(tasksCompletedId, task);
-          }
+          appendTaskTrace(task);
         }
 
         // Collect all tasks from running tasks
@@ -985,15 +1174,7 @@ Dali::AsyncTaskManager::TasksCompletedId AsyncTaskManager::SetCompletedCallback(
           // Trace only if it is running now.
           if(taskPair.second == RunningTaskState::RUNNING)
           {
-            auto& task      = taskPair.first;
-            auto  checkMask = (task->GetCallbackInvocationThread() == Dali::AsyncTask::ThreadType::MAIN_THREAD ? Dali::AsyncTaskManager::CompletedCallbackTraceMask::THREAD_MASK_MAIN : Dali::AsyncTaskManager::CompletedCallbackTraceMask::THREAD_MASK_WORKER) |
-                             (task->GetPriorityType() == Dali::AsyncTask::PriorityType::HIGH ? Dali::AsyncTaskManager::CompletedCallbackTraceMask::PRIORITY_MASK_HIGH : Dali::AsyncTaskManager::CompletedCallbackTraceMask::PRIORITY_MASK_LOW);
-
-            if((checkMask & mask) == checkMask)
-            {
-              ++addedTaskCount;
-              mTasksCompletedImpl->AppendTaskTrace(tasksCompletedId, task);
-            }
+            appendTaskTrace(taskPair.first);
           }
         }
 
@@ -1007,15 +1188,7 @@ Dali::AsyncTaskManager::TasksCompletedId AsyncTaskManager::SetCompletedCallback(
           //        So, we don't need to trace for SKIP_CALLBACK cases.
           if(taskPair.second == CompletedTaskState::REQUIRE_CALLBACK)
           {
-            auto& task      = taskPair.first;
-            auto  checkMask = (task->GetCallbackInvocationThread() == Dali::AsyncTask::ThreadType::MAIN_THREAD ? Dali::AsyncTaskManager::CompletedCallbackTraceMask::THREAD_MASK_MAIN : Dali::AsyncTaskManager::CompletedCallbackTraceMask::THREAD_MASK_WORKER) |
-                             (task->GetPriorityType() == Dali::AsyncTask::PriorityType::HIGH ? Dali::AsyncTaskManager::CompletedCallbackTraceMask::PRIORITY_MASK_HIGH : Dali::AsyncTaskManager::CompletedCallbackTraceMask::PRIORITY_MASK_LOW);
-
-            if((checkMask & mask) == checkMask)
-            {
-              ++addedTaskCount;
-              mTasksCompletedImpl->AppendTaskTrace(tasksCompletedId, task);
-            }
+            appendTaskTrace(taskPair.first);
           }
         }
       }
@@ -1092,7 +1265,7 @@ void AsyncTaskManager::UnregisterProcessor()
     // Please be careful the order of mutex, to avoid dead lock.
     // TODO : Should we lock all mutex rightnow?
     Mutex::ScopedLock lockWait(mWaitingTasksMutex);
-    if(mWaitingTasks.empty())
+    if(mWaitingTasks.empty() && (!mWorkStealingQueue || mWorkStealingQueue->IsEmpty()))
     {
       Mutex::ScopedLock lockRunning(mRunningTasksMutex); // We can lock this mutex under mWaitingTasksMutex.
       if(mRunningTasks.empty())
@@ -1145,9 +1318,58 @@ void AsyncTaskManager::Process(bool postProcessor)
   TasksCompleted();
 }
 
+/// Worker thread called
+void AsyncTaskManager::RegisterWorkerThread()
+{
+  if(mWorkStealingQueue)
+  {
+    mWorkStealingQueue->RegisterCurrentThread();
+  }
+}
+
 /// Worker thread called
 AsyncTaskPtr AsyncTaskManager::PopNextTaskToProcess()
 {
+  if(mWorkStealingQueue)
+  {
+    // Called with the deque of the task locked, so the task is always in either the queue or the running tasks.
+    auto decide = [this](const AsyncTaskPtr& task)
+    {
+      const auto priorityType = task->GetPriorityType();
+
+      Mutex::ScopedLock lock(mRunningTasksMutex);
+      if(priorityType == AsyncTask::PriorityType::LOW && mAvaliableLowPriorityTaskCounts == 0u)
+      {
+        // There are no avaliabe threads for low priority tasks now.
+        return WorkStealingTaskQueue::Decision::SKIP_PRIORITY;
+      }
+
+      auto mapIter = mCacheImpl->mRunningTasksCache.find(task.Get());
+      if(mapIter != mCacheImpl->mRunningTasksCache.end() && !mapIter->second.empty())
+      {
+        // Some other thread running this tasks now. Ignore it.
+        DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "Some other thread running this task [%p][%s]\n", task.Get(), GetTaskName(task));
+        return WorkStealingTaskQueue::Decision::SKIP;
+      }
+
+      DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "Waiting -> Running [%p][%s]\n", task.Get(), GetTaskName(task));
+
+      auto runningIter = mRunningTasks.insert(mRunningTasks.end(), std::make_pair(task, RunningTaskState::RUNNING));
+      CacheImpl::InsertTaskCache(mCacheImpl->mRunningTasksCache, task, runningIter);
+      mRunningTaskCount.fetch_add(1u, std::memory_order_release);
+
+      if(priorityType == AsyncTask::PriorityType::LOW)
+      {
+        --mAvaliableLowPriorityTaskCounts;
+      }
+      return WorkStealingTaskQueue::Decision::TAKE;
+    };
+
+    AsyncTaskPtr nextTask = mWorkStealingQueue->Pop(decide);
+    DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::General, "Pickup process [%p][%s]\n", nextTask.Get(), GetTaskName(nextTask));
+    return nextTask;
+  }
+
   // Lock while popping task out from the queue
   Mutex::ScopedLock lock(mWaitingTasksMutex);
 
@@ -1212,6 +1434,7 @@ AsyncTaskPtr AsyncTaskManager::PopNextTaskToProcess()
 
           auto runningIter = mRunningTasks.insert(mRunningTasks.end(), std::make_pair(nextTask, RunningTaskState::RUNNING));
           CacheImpl::InsertTaskCache(mCacheImpl->mRunningTasksCache, nextTask, runningIter);
+          mRunningTaskCount.fetch_add(1u, std::memory_order_release);
 
           CacheImpl::EraseTaskCache(mCacheImpl->mWaitingTasksCache, nextTask, iter);
           mWaitingTasks.erase(iter);
@@ -1244,8 +1467,9 @@ AsyncTaskPtr AsyncTaskManager::PopNextTaskToProcess()
 }
 
 /// Worker thread called
-void AsyncTaskManager::CompleteTask(AsyncTaskPtr&& task)
+AsyncTaskPtr AsyncTaskManager::CompleteTask(AsyncTaskPtr&& task)
 {
+  AsyncTaskPtr continuation;
   if(task)
   {
     bool needTrigger = false;
@@ -1297,6 +1521,9 @@ void AsyncTaskManager::CompleteTask(AsyncTaskPtr&& task)
       }
     }
 
+    // Release the tasks waiting for this task, now that it has been processed.
+    std::vector<AsyncTaskPtr> readySuccessors = MarkTaskProcessed(task);
+
     // Lock while adding task to the queue
     {
       bool notify = false;
@@ -1341,6 +1568,7 @@ void AsyncTaskManager::CompleteTask(AsyncTaskPtr&& task)
 
           CacheImpl::EraseTaskCache(mCacheImpl->mRunningTasksCache, task, iter);
           mRunningTasks.erase(iter);
+          mRunningTaskCount.fetch_sub(1u, std::memory_order_release);
 
           if(!needTrigger)
           {
@@ -1359,7 +1587,74 @@ void AsyncTaskManager::CompleteTask(AsyncTaskPtr&& task)
       DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "Trigger main thread\n");
       mTrigger->Trigger();
     }
+
+    // Process the first successor on this thread straight away, without waking another thread. Queue the others.
+    for(auto& successor : readySuccessors)
+    {
+      if(!continuation && TakeContinuation(successor))
+      {
+        continuation = successor;
+      }
+      if(successor->IsReady())
+      {
+        NotifyToTaskReady(successor);
+      }
+    }
+  }
+  return continuation;
+}
+
+/// Worker thread called
+bool AsyncTaskManager::TakeContinuation(AsyncTaskPtr& task)
+{
+  if(!task->IsReady())
+  {
+    // Wait for NotifyToTaskReady() as usual.
+    return false;
+  }
+
+  Mutex::ScopedLock lock(mWaitingTasksMutex);
+
+  auto mapIter = mCacheImpl->mNotReadyTasksCache.find(task.Get());
+  if(mapIter == mCacheImpl->mNotReadyTasksCache.end())
+  {
+    // Not added to the manager, or removed.
+    return false;
+  }
+
+  {
+    Mutex::ScopedLock lock(mRunningTasksMutex); // We can lock this mutex under mWaitingTasksMutex.
+
+    const auto priorityType = task->GetPriorityType();
+    if(priorityType == AsyncTask::PriorityType::LOW && mAvaliableLowPriorityTaskCounts == 0u)
+    {
+      return false;
+    }
+
+    auto runningMapIter = mCacheImpl->mRunningTasksCache.find(task.Get());
+    if(runningMapIter != mCacheImpl->mRunningTasksCache.end() && !runningMapIter->second.empty())
+    {
+      // Some other thread running this tasks now.
+      return false;
+    }
+
+    DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "NotReady -> Running [%p][%s]\n", task.Get(), GetTaskName(task));
+
+    auto runningIter = mRunningTasks.insert(mRunningTasks.end(), std::make_pair(task, RunningTaskState::RUNNING));
+    CacheImpl::InsertTaskCache(mCacheImpl->mRunningTasksCache, task, runningIter);
+    mRunningTaskCount.fetch_add(1u, std::memory_order_release);
+
+    if(priorityType == AsyncTask::PriorityType::LOW)
+    {
+      --mAvaliableLowPriorityTaskCounts;
+    }
   }
+
+  // Only take one entry, if the task was added more than once.
+  auto notReadyIter = mapIter->second.front();
+  CacheImpl::EraseTaskCache(mCacheImpl->mNotReadyTasksCache, task, notReadyIter);
+  mNotReadyTasks.erase(notReadyIter);
+  return true;
 }
 
 // AsyncTaskManager::TaskHelper
@@ -28,10 +28,13 @@
 #include <dali/integration-api/adaptor-framework/trace-factory-interface.h>
 #include <dali/integration-api/processor-interface.h>
 #include <dali/public-api/object/base-object.h>
+#include <atomic>
 #include <memory>
+#include <thread>
 
 // INTERNAL INCLUDES
 #include <dali/devel-api/adaptor-framework/async-task-manager.h>
+#include <dali/internal/system/common/async-task-work-stealing-queue.h>
 
 namespace Dali
 {
@@ -79,8 +82,8 @@ private:
 private:
   ConditionalWait                    mConditionalWait;
   AsyncTaskManager&                  mAsyncTaskManager;
-  const Dali::LogFactoryInterface&   mLogFactory;   ///< The log factory
-  const Dali::TraceFactoryInterface& mTraceFactory; ///< The trace factory
+  const Dali::LogFactoryInterface*   mLogFactory;   ///< The log factory, or nullptr if there is no adaptor
+  const Dali::TraceFactoryInterface* mTraceFactory; ///< The trace factory, or nullptr if there is no adaptor
   bool                               mDestroyThread;
   bool                               mIsThreadStarted;
   bool                               mIsThreadIdle;
@@ -106,6 +109,49 @@ public:
    */
   static void NotifyManagerToTaskReady(AsyncTaskPtr task);
 
+  /**
+   * @brief Add the task to the singleton, called by any thread.
+   * Unlike Get(), this doesn't need the singleton service, so worker threads can use it.
+   *
+   * @param[in] task The task pointer.
+   * @return True if the task was added, false if there is no AsyncTaskManager.
+   */
+  static bool AddTaskToManager(AsyncTaskPtr task);
+
+  /**
+   * @brief Make the task wait until the predecessor has been processed, called by any thread.
+   *
+   * @param[in] task The task which waits.
+   * @param[in] predecessor The task which must be processed first. Ignored if it was already processed.
+   */
+  static void AddTaskDependency(AsyncTaskPtr task, AsyncTaskPtr predecessor);
+
+  /**
+   * @brief Check whether the task still waits for some of its predecessors.
+   *
+   * @param[in] task The task.
+   * @return True if some predecessors have not been processed yet.
+   */
+  static bool HasPendingDependencies(const AsyncTask& task);
+
+  /**
+   * @brief Mark the task as processed, and release the tasks waiting for it.
+   *
+   * @param[in] task The processed task.
+   * @return The successors which no longer wait for any predecessor.
+   */
+  static std::vector<AsyncTaskPtr> MarkTaskProcessed(AsyncTaskPtr task);
+
+  /**
+   * @brief Take the tasks waiting for the removed task, without releasing them.
+   * MarkTaskProcessed() never releases the successors of the task afterwards, even if it is still running,
+   * until the task is added again.
+   *
+   * @param[in] task The removed task.
+   * @return The successors of the task, or nothing if MarkTaskProcessed() already released them.
+   */
+  static std::vector<AsyncTaskPtr> DetachSuccessors(AsyncTaskPtr task);
+
   /**
    * Constructor.
    */
@@ -164,6 +210,11 @@ public:
   void TasksCompleted();
 
 public: // Worker thread called method
+  /**
+   * Register the calling thread as a worker, called once by each worker thread when it starts.
+   */
+  void RegisterWorkerThread();
+
   /**
    * Pop the next task out from the queue.
    *
@@ -176,8 +227,9 @@ public: // Worker thread called method
    * @note After this function, task is invalidate.
    *
    * @param[in] task The task added to the queue.
+   * @return A successor of the task which is now running, and which the calling worker should process next. Or nullptr.
    */
-  void CompleteTask(AsyncTaskPtr&& task);
+  AsyncTaskPtr CompleteTask(AsyncTaskPtr&& task);
 
 protected: // Implementation of Processor
   /**
@@ -194,6 +246,19 @@ protected: // Implementation of Processor
   }
 
 private:
+  /**
+   * @brief Check whether the task can be processed, i.e. it is ready and doesn't wait for any predecessor.
+   */
+  static bool IsTaskReady(AsyncTaskPtr& task);
+
+  /**
+   * @brief Move a not ready task straight to the running tasks, so that the calling worker processes it next.
+   *
+   * @param[in] task The task whose predecessors have all been processed.
+   * @return True if the task is now running. False if it is not in the not ready tasks, or cannot run now.
+   */
+  bool TakeContinuation(AsyncTaskPtr& task);
+
   /**
    * @brief Helper class to keep the relation between AsyncTaskThread and corresponding container
    */
@@ -293,7 +358,13 @@ private:
   struct CacheImpl;
   std::unique_ptr<CacheImpl> mCacheImpl; ///< Cache interface for AsyncTaskManager.
 
-  bool mProcessorRegistered : 1;
+  std::unique_ptr<WorkStealingTaskQueue> mWorkStealingQueue; ///< The waiting tasks if the work-stealing scheduler is enabled, used instead of mWaitingTasks. Otherwise nullptr.
+                                                             ///< Lock order is mWaitingTasksMutex, then the queue, then mRunningTasksMutex.
+  std::atomic<uint32_t> mRunningTaskCount;                   ///< The size of mRunningTasks, which can be read without mRunningTasksMutex.
+
+  const std::thread::id mEventThreadId; ///< The thread which created the manager. The processor is registered and unregistered on it only.
+
+  bool mProcessorRegistered : 1; ///< Read and written on the event thread only.
 };
 
 } // namespace Adaptor
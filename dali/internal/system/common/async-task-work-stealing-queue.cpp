@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/async-task-work-stealing-queue.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+namespace
+{
+constexpr uint32_t INITIAL_RING_CAPACITY = 16u;
+
+thread_local const WorkStealingTaskQueue* gCurrentQueue       = nullptr; ///< The queue the calling thread is a worker of.
+thread_local uint32_t                     gCurrentWorkerIndex = 0u;      ///< The worker index of the calling thread in gCurrentQueue.
+
+} // unnamed namespace
+
+// WorkStealingTaskQueue::TaskRing
+
+void WorkStealingTaskQueue::TaskRing::PushBack(AsyncTaskPtr&& task)
+{
+  if(mCount == mTasks.size())
+  {
+    Grow();
+  }
+  mTasks[(mHead + mCount) & (static_cast<uint32_t>(mTasks.size()) - 1u)] = std::move(task);
+  ++mCount;
+}
+
+AsyncTaskPtr WorkStealingTaskQueue::TaskRing::PopAt(uint32_t index)
+{
+  // Shift the tasks in front of it back by one, so the order of the others is kept.
+  AsyncTaskPtr task = std::move(At(index));
+  for(; index > 0u; --index)
+  {
+    At(index) = std::move(At(index - 1u));
+  }
+  mHead = (mHead + 1u) & (static_cast<uint32_t>(mTasks.size()) - 1u);
+  --mCount;
+  return task;
+}
+
+uint32_t WorkStealingTaskQueue::TaskRing::RemoveAll(const AsyncTask* task)
+{
+  // Compact the remaining tasks in order.
+  const uint32_t mask = static_cast<uint32_t>(mTasks.size()) - 1u;
+  uint32_t       kept = 0u;
+  for(uint32_t i = 0u; i < mCount; ++i)
+  {
+    AsyncTaskPtr& source = mTasks[(mHead + i) & mask];
+    if(source.Get() == task)
+    {
+      source.Reset();
+    }
+    else
+    {
+      if(kept != i)
+      {
+        mTasks[(mHead + kept) & mask] = std::move(source);
+      }
+      ++kept;
+    }
+  }
+
+  const uint32_t removedCount = mCount - kept;
+  mCount                      = kept;
+  return removedCount;
+}
+
+void WorkStealingTaskQueue::TaskRing::Grow()
+{
+  std::vector<AsyncTaskPtr> tasks(std::max<size_t>(mTasks.size() * 2u, INITIAL_RING_CAPACITY));
+  for(uint32_t i = 0u; i < mCount; ++i)
+  {
+    tasks[i] = std::move(mTasks[(mHead + i) & (static_cast<uint32_t>(mTasks.size()) - 1u)]);
+  }
+  mTasks.swap(tasks);
+  mHead = 0u;
+}
+
+// WorkStealingTaskQueue::ScopedLock
+
+WorkStealingTaskQueue::ScopedLock::ScopedLock(WorkStealingTaskQueue& queue)
+: mQueue(queue)
+{
+  // Always lock in index order, so two ScopedLocks can't dead lock.
+  for(uint32_t i = 0u; i < mQueue.mWorkerCount; ++i)
+  {
+    mQueue.mDeques[i].mMutex.lock();
+  }
+}
+
+WorkStealingTaskQueue::ScopedLock::~ScopedLock()
+{
+  for(uint32_t i = mQueue.mWorkerCount; i > 0u; --i)
+  {
+    mQueue.mDeques[i - 1u].mMutex.unlock();
+  }
+}
+
+// WorkStealingTaskQueue
+
+WorkStealingTaskQueue::WorkStealingTaskQueue(uint32_t workerCount)
+: mWorkerCount(std::max(workerCount, 1u)),
+  mDeques(new WorkerDeque[mWorkerCount]),
+  mNextPushIndex(0u),
+  mNextWorkerIndex(0u)
+{
+  for(uint32_t priority = 0u; priority < PRIORITY_COUNT; ++priority)
+  {
+    mCount[priority].store(0u, std::memory_order_relaxed);
+    for(uint32_t i = 0u; i < mWorkerCount; ++i)
+    {
+      mDeques[i].mCount[priority].store(0u, std::memory_order_relaxed);
+    }
+  }
+}
+
+WorkStealingTaskQueue::~WorkStealingTaskQueue() = default;
+
+uint32_t WorkStealingTaskQueue::RegisterCurrentThread()
+{
+  const uint32_t workerIndex = mNextWorkerIndex.fetch_add(1u, std::memory_order_relaxed);
+  if(workerIndex < mWorkerCount)
+  {
+    gCurrentQueue       = this;
+    gCurrentWorkerIndex = workerIndex;
+    return workerIndex;
+  }
+  return mWorkerCount;
+}
+
+uint32_t WorkStealingTaskQueue::GetCurrentWorkerIndex() const
+{
+  return (gCurrentQueue == this) ? gCurrentWorkerIndex : mWorkerCount;
+}
+
+void WorkStealingTaskQueue::Push(AsyncTaskPtr task)
+{
+  if(!task)
+  {
+    return;
+  }
+
+  uint32_t dequeIndex = GetCurrentWorkerIndex();
+  if(dequeIndex >= mWorkerCount)
+  {
+    dequeIndex = mNextPushIndex.fetch_add(1u, std::memory_order_relaxed) % mWorkerCount;
+  }
+
+  const uint32_t priority = static_cast<uint32_t>(task->GetPriorityType());
+  WorkerDeque&   deque    = mDeques[dequeIndex];
+  {
+    std::scoped_lock<std::mutex> lock(deque.mMutex);
+    deque.mTasks[priority].PushBack(std::move(task));
+
+    // Publish the counts under the lock, so a thief that sees them can find the task.
+    deque.mCount[priority].fetch_add(1u, std::memory_order_release);
+    mCount[priority].fetch_add(1u, std::memory_order_release);
+  }
+}
+
+AsyncTaskPtr WorkStealingTaskQueue::Pop(const DecideFunction& decide)
+{
+  uint32_t firstIndex = GetCurrentWorkerIndex();
+  if(firstIndex >= mWorkerCount)
+  {
+    firstIndex = 0u;
+  }
+
+  // HIGH priority tasks first, from our own deque and then stealing from the others.
+  for(uint32_t priority = 0u; priority < PRIORITY_COUNT; ++priority)
+  {
+    if(mCount[priority].load(std::memory_order_acquire) == 0u)
+    {
+      continue;
+    }
+
+    bool skipPriority = false;
+    for(uint32_t i = 0u; i < mWorkerCount && !skipPriority; ++i)
+    {
+      WorkerDeque& deque = mDeques[(firstIndex + i) % mWorkerCount];
+      if(deque.mCount[priority].load(std::memory_order_acquire) == 0u)
+      {
+        continue;
+      }
+
+      if(AsyncTaskPtr task = PopFrom(deque, priority, decide, skipPriority))
+      {
+        return task;
+      }
+    }
+  }
+  return AsyncTaskPtr();
+}
+
+AsyncTaskPtr WorkStealingTaskQueue::PopFrom(WorkerDeque& deque, uint32_t priority, const DecideFunction& decide, bool& skipPriority)
+{
+  std::scoped_lock<std::mutex> lock(deque.mMutex);
+
+  TaskRing& ring = deque.mTasks[priority];
+
+  // Scan past the tasks which can't be taken now, so they don't block the ones behind them.
+  for(uint32_t index = 0u; index < ring.GetCount(); ++index)
+  {
+    switch(decide(ring[index]))
+    {
+      case Decision::TAKE:
+      {
+        deque.mCount[priority].fetch_sub(1u, std::memory_order_relaxed);
+        mCount[priority].fetch_sub(1u, std::memory_order_relaxed);
+        return ring.PopAt(index);
+      }
+      case Decision::SKIP_PRIORITY:
+      {
+        skipPriority = true;
+        return AsyncTaskPtr();
+      }
+      case Decision::SKIP:
+      {
+        break;
+      }
+    }
+  }
+  return AsyncTaskPtr();
+}
+
+uint32_t WorkStealingTaskQueue::Remove(const AsyncTask* task)
+{
+  uint32_t removedCount = 0u;
+  for(uint32_t i = 0u; i < mWorkerCount; ++i)
+  {
+    WorkerDeque&                 deque = mDeques[i];
+    std::scoped_lock<std::mutex> lock(deque.mMutex);
+    for(uint32_t priority = 0u; priority < PRIORITY_COUNT; ++priority)
+    {
+      if(const uint32_t count = deque.mTasks[priority].RemoveAll(task))
+      {
+        deque.mCount[priority].fetch_sub(count, std::memory_order_relaxed);
+        mCount[priority].fetch_sub(count, std::memory_order_relaxed);
+        removedCount += count;
+      }
+    }
+  }
+  return removedCount;
+}
+
+void WorkStealingTaskQueue::ForEachLocked(const std::function<void(const AsyncTaskPtr& task)>& function) const
+{
+  for(uint32_t i = 0u; i < mWorkerCount; ++i)
+  {
+    for(const auto& ring : mDeques[i].mTasks)
+    {
+      for(uint32_t index = 0u; index < ring.GetCount(); ++index)
+      {
+        function(ring[index]);
+      }
+    }
+  }
+}
+
+uint32_t WorkStealingTaskQueue::GetCount() const
+{
+  uint32_t count = 0u;
+  for(const auto& priorityCount : mCount)
+  {
+    count += priorityCount.load(std::memory_order_acquire);
+  }
+  return count;
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,223 @@
+#ifndef DALI_INTERNAL_ADAPTOR_ASYNC_TASK_WORK_STEALING_QUEUE_H
+#define DALI_INTERNAL_ADAPTOR_ASYNC_TASK_WORK_STEALING_QUEUE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/common/vector-wrapper.h>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/async-task-manager.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+/**
+ * @brief The queue of waiting tasks used by the work-stealing scheduler of AsyncTaskManager.
+ *
+ * Each worker thread owns one deque per priority, each behind its own small lock.
+ * Tasks added by a worker go to its own deque. Tasks added by any other thread are spread round robin.
+ * A worker takes tasks from its own deque first, and steals from the other deques when it runs dry.
+ * HIGH priority tasks are always taken before LOW priority ones.
+ *
+ * Deques are ring buffers of task pointers, so adding a task doesn't allocate once they have grown.
+ * Tasks are taken in FIFO order from each deque, but not globally. A task which can't be taken now
+ * doesn't block the tasks behind it.
+ */
+class WorkStealingTaskQueue
+{
+public:
+  /**
+   * @brief What to do with the task at the front of a deque.
+   */
+  enum class Decision
+  {
+    TAKE,          ///< Take the task out of the queue.
+    SKIP,          ///< Leave the task, and try the next one.
+    SKIP_PRIORITY, ///< Leave the task, and every other task of the same priority.
+  };
+
+  /**
+   * @brief Called with the deque locked, to decide whether a worker can take the task.
+   * @note The task is still in the queue while this is called, so it is safe to register it elsewhere
+   * (e.g. as running) without anyone seeing it in neither place.
+   */
+  using DecideFunction = std::function<Decision(const AsyncTaskPtr& task)>;
+
+  /**
+   * @brief Keeps every deque locked, so the queued tasks can't change.
+   */
+  class ScopedLock
+  {
+  public:
+    ScopedLock(WorkStealingTaskQueue& queue);
+    ~ScopedLock();
+
+    ScopedLock(const ScopedLock&)            = delete;
+    ScopedLock& operator=(const ScopedLock&) = delete;
+
+  private:
+    WorkStealingTaskQueue& mQueue;
+  };
+
+public:
+  /**
+   * @brief Constructor.
+   * @param[in] workerCount The number of worker threads taking tasks from this queue.
+   */
+  explicit WorkStealingTaskQueue(uint32_t workerCount);
+
+  /**
+   * @brief Destructor. Releases every queued task.
+   */
+  ~WorkStealingTaskQueue();
+
+  /**
+   * @brief Make the calling thread one of the workers of this queue, called once by each worker thread.
+   * @return The index of the worker, or the worker count if every worker is already registered.
+   */
+  uint32_t RegisterCurrentThread();
+
+  /**
+   * @brief Retrieve the worker index of the calling thread.
+   * @return The index of the worker, or the worker count if the calling thread isn't a worker of this queue.
+   */
+  uint32_t GetCurrentWorkerIndex() const;
+
+  /**
+   * @brief Add the task to the queue, called by any thread.
+   * @param[in] task The task to add. The same task may be added more than once.
+   */
+  void Push(AsyncTaskPtr task);
+
+  /**
+   * @brief Take the next task for the calling thread.
+   *
+   * @param[in] decide Decides whether each candidate task can be taken.
+   * @return The task, or nullptr if there is no task to take.
+   */
+  AsyncTaskPtr Pop(const DecideFunction& decide);
+
+  /**
+   * @brief Remove every queued entry of the task.
+   * @param[in] task The task to remove.
+   * @return The number of entries removed.
+   */
+  uint32_t Remove(const AsyncTask* task);
+
+  /**
+   * @brief Visit every queued task.
+   * @pre The queue is locked with ScopedLock.
+   * @param[in] function The function called for each queued task.
+   */
+  void ForEachLocked(const std::function<void(const AsyncTaskPtr& task)>& function) const;
+
+  /**
+   * @brief Retrieve the number of queued tasks.
+   * @return The number of queued tasks.
+   */
+  uint32_t GetCount() const;
+
+  /**
+   * @brief Check whether there is no queued task.
+   * @return True if there is no queued task.
+   */
+  bool IsEmpty() const
+  {
+    return GetCount() == 0u;
+  }
+
+private:
+  /**
+   * @brief FIFO ring buffer of tasks. Only grows, so steady state pushes never allocate.
+   */
+  class TaskRing
+  {
+  public:
+    void         PushBack(AsyncTaskPtr&& task);
+    AsyncTaskPtr PopAt(uint32_t index);
+    uint32_t     RemoveAll(const AsyncTask* task);
+
+    uint32_t GetCount() const
+    {
+      return mCount;
+    }
+
+    const AsyncTaskPtr& operator[](uint32_t index) const
+    {
+      return mTasks[(mHead + index) & (static_cast<uint32_t>(mTasks.size()) - 1u)];
+    }
+
+  private:
+    AsyncTaskPtr& At(uint32_t index)
+    {
+      return mTasks[(mHead + index) & (static_cast<uint32_t>(mTasks.size()) - 1u)];
+    }
+
+    void Grow();
+
+  private:
+    std::vector<AsyncTaskPtr> mTasks; ///< Size is zero or a power of two.
+    uint32_t                  mHead{0u};
+    uint32_t                  mCount{0u};
+  };
+
+  static constexpr uint32_t PRIORITY_COUNT = static_cast<uint32_t>(AsyncTask::PriorityType::PRIORITY_COUNT);
+
+  /**
+   * @brief The deques of a worker. Aligned so that workers don't share cache lines.
+   */
+  struct alignas(64) WorkerDeque
+  {
+    std::mutex            mMutex;
+    TaskRing              mTasks[PRIORITY_COUNT]; ///< Must be used under mMutex.
+    std::atomic<uint32_t> mCount[PRIORITY_COUNT]; ///< Copy of the ring counts, so thieves can skip empty deques without locking.
+  };
+
+  /**
+   * @brief Try to take a task of the given priority from one deque.
+   * @return The task, or nullptr.
+   */
+  AsyncTaskPtr PopFrom(WorkerDeque& deque, uint32_t priority, const DecideFunction& decide, bool& skipPriority);
+
+private:
+  WorkStealingTaskQueue(const WorkStealingTaskQueue&)            = delete;
+  WorkStealingTaskQueue& operator=(const WorkStealingTaskQueue&) = delete;
+
+private:
+  const uint32_t                 mWorkerCount;
+  std::unique_ptr<WorkerDeque[]> mDeques;
+  std::atomic<uint32_t>          mCount[PRIORITY_COUNT]; ///< The number of queued tasks of each priority.
+  std::atomic<uint32_t>          mNextPushIndex;         ///< Round robin deque for tasks added by non-worker threads.
+  std::atomic<uint32_t>          mNextWorkerIndex;       ///< The index given to the next registered worker.
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ADAPTOR_ASYNC_TASK_WORK_STEALING_QUEUE_H
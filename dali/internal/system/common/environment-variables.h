@@ -163,6 +163,30 @@ namespace Adaptor
 
 #define DALI_ENV_ENABLE_IMAGE_LOADER_PLUGIN "DALI_ENABLE_IMAGE_LOADER_PLUGIN"
 
+// Use the scalar image operation kernels even if the CPU supports SIMD.
+#define DALI_ENV_DISABLE_IMAGE_OPERATIONS_SIMD "DALI_DISABLE_IMAGE_OPERATIONS_SIMD"
+
+// Maximum number of bands a large image operation is split into on the async task workers. Unset or 1 disables it.
+#define DALI_ENV_IMAGE_OPERATIONS_PARALLEL_BANDS "DALI_IMAGE_OPERATIONS_PARALLEL_BANDS"
+
+// Memory in kilobytes the decoded frames of an animated GIF may use. It maps the file and keeps key frames to seek. Unset or 0 disables it.
+#define DALI_ENV_GIF_STREAMING_FRAME_MEMORY "DALI_GIF_STREAMING_FRAME_MEMORY"
+
+// Duration in milliseconds of the animated image frames decoded ahead on the async task workers. Unset or 0 disables it.
+#define DALI_ENV_ANIMATED_IMAGE_PREFETCH_DURATION "DALI_ANIMATED_IMAGE_PREFETCH_DURATION"
+
+// Memory in kilobytes of the rasterized vector images cached by the process. Unset is 4096, 0 disables it.
+#define DALI_ENV_VECTOR_IMAGE_CACHE_SIZE "DALI_VECTOR_IMAGE_CACHE_SIZE"
+
+// Directory keeping the rasterized vector images across launches. Unset keeps them in memory only.
+#define DALI_ENV_VECTOR_IMAGE_CACHE_PATH "DALI_VECTOR_IMAGE_CACHE_PATH"
+
+// Disk space in kilobytes of the rasterized vector images in DALI_VECTOR_IMAGE_CACHE_PATH. Unset is 16384, 0 keeps them in memory only.
+#define DALI_ENV_VECTOR_IMAGE_CACHE_DISK_SIZE "DALI_VECTOR_IMAGE_CACHE_DISK_SIZE"
+
+// Set to 1 to rasterize and upload only the region of the canvas covered by the changed drawables.
+#define DALI_ENV_CANVAS_RENDERER_PARTIAL_RASTERIZE "DALI_CANVAS_RENDERER_PARTIAL_RASTERIZE"
+
 // Threshold time in miliseconds when we want to print the egl performance as a warning.
 #define DALI_ENV_EGL_PERFORMANCE_LOG_THRESHOLD_TIME "DALI_EGL_PERFORMANCE_LOG_THRESHOLD_TIME"
 
@@ -172,6 +196,9 @@ namespace Adaptor
 
 #define DALI_ENV_ASYNC_MANAGER_LOW_PRIORITY_THREAD_POOL_SIZE "DALI_ASYNC_MANAGER_LOW_PRIORITY_THREAD_POOL_SIZE"
 
+// Use per worker deques with work stealing for the async task manager, instead of a single waiting queue.
+#define DALI_ENV_ASYNC_MANAGER_WORK_STEALING "DALI_ASYNC_MANAGER_WORK_STEALING"
+
 // Face size Cache
 #define DALI_ENV_MAX_NUMBER_OF_FACE_SIZE_CACHE "DALI_FACE_SIZE_CACHE_MAX"
 
@@ -185,6 +212,19 @@ namespace Adaptor
 // Description Cache
 #define DALI_ENV_MAX_NUMBER_OF_DESCRIPTION_CACHE "DALI_DESCRIPTION_CACHE_MAX"
 
+// Shaped run Cache. 0 disables it.
+#define DALI_ENV_MAX_NUMBER_OF_SHAPED_RUN_CACHE "DALI_SHAPED_RUN_CACHE_MAX"
+
+// File of the fontconfig query cache. Empty disables it.
+#define DALI_ENV_FONT_CONFIG_CACHE_PATH "DALI_FONT_CONFIG_CACHE_PATH"
+
+// Glyph cache shared by the processes. Size in megabytes, 0 disables it.
+#define DALI_ENV_SHARED_GLYPH_CACHE_SIZE "DALI_SHARED_GLYPH_CACHE_SIZE"
+#define DALI_ENV_SHARED_GLYPH_CACHE_PATH "DALI_SHARED_GLYPH_CACHE_PATH"
+
+// Number of threads rasterizing glyphs for FontClient::CreateBitmaps(). 0 rasterizes them on the calling thread.
+#define DALI_ENV_GLYPH_RASTERIZER_THREAD_COUNT "DALI_GLYPH_RASTERIZER_THREAD_COUNT"
+
 // File download plugin configuration
 #define DALI_ENV_FILE_DOWNLOAD_PLUGIN_NAME "DALI_FILE_DOWNLOAD_PLUGIN_NAME"
 #define DALI_ENV_USE_CAPI_DOWNLOAD_PROVIDER_API "DALI_USE_CAPI_DOWNLOAD_PROVIDER_API"
@@ -196,6 +236,16 @@ namespace Adaptor
 
 #define DALI_ENV_SHADER_USE_PROGRAM_BINARY "DALI_SHADER_USE_PROGRAM_BINARY"
 
+// Set to 0 to store one file per program binary, instead of a single memory-mapped archive
+#define DALI_ENV_SHADER_USE_PROGRAM_BINARY_ARCHIVE "DALI_SHADER_USE_PROGRAM_BINARY_ARCHIVE"
+
+// Set to 0 to precompile the shaders one by one on the render thread, instead of in the background
+#define DALI_ENV_SHADER_PARALLEL_PRECOMPILE "DALI_SHADER_PARALLEL_PRECOMPILE"
+
+#define DALI_ENV_SHADER_USE_UNIFORM_BLOCKS "DALI_SHADER_USE_UNIFORM_BLOCKS"
+
+#define DALI_ENV_DISABLE_COMMAND_BUFFER_OPTIMIZATION "DALI_DISABLE_COMMAND_BUFFER_OPTIMIZATION"
+
 // Queue benchmark instrumentation
 #define DALI_ENV_QUEUE_BENCHMARK "DALI_QUEUE_BENCHMARK"
 
@@ -19,6 +19,7 @@
 #include <dali/internal/text/text-abstraction/font-client-impl.h>
 
 // EXTERNAL INCLUDES
+#include <atomic>
 #include <condition_variable>
 #include <locale>
 #include <mutex>
@@ -76,6 +77,16 @@ static std::string gLocaleFull; // The current locale identifier. (e.g., "en_US"
 
 std::mutex gPreCreatedFontClientMutex; ///< Mutex for FontThread and gPreCreatedFontClient.
 
+std::atomic<uint32_t> gNextFontCacheId{0u}; ///< The next id returned by NewFontCacheId()
+
+/**
+ * @brief Creates an id which no font cache of the process had before.
+ */
+uint32_t NewFontCacheId()
+{
+  return gNextFontCacheId.fetch_add(1u, std::memory_order_relaxed);
+}
+
 static FontThread              gPreCacheThread{}; ///< Must be changed under gPreCreatedFontClientMutex
 static FontThread              gPreLoadThread{};  ///< Must be changed under gPreCreatedFontClientMutex
 static std::mutex              gMutex;
@@ -100,7 +111,8 @@ FontClient::FontClient()
 : mPlugin(nullptr),
   mFontFileManager(),
   mDpiHorizontal(0),
-  mDpiVertical(0)
+  mDpiVertical(0),
+  mFontCacheId(NewFontCacheId())
 {
   // FontFileManager::Get() must be called from the main thread.
   mFontFileManager = TextAbstraction::FontFileManager::Get();
@@ -420,6 +432,7 @@ void FontClient::ClearCache()
   if(mPlugin)
   {
     mPlugin->ClearCache();
+    mFontCacheId = NewFontCacheId();
   }
 }
 
@@ -428,6 +441,7 @@ void FontClient::ClearCacheOnLocaleChanged()
   if(mPlugin)
   {
     mPlugin->ClearCacheOnLocaleChanged();
+    mFontCacheId = NewFontCacheId();
   }
 }
 
@@ -440,6 +454,7 @@ void FontClient::SetDpi(unsigned int horizontalDpi, unsigned int verticalDpi)
   if(mPlugin)
   {
     mPlugin->SetDpi(horizontalDpi, verticalDpi);
+    mFontCacheId = NewFontCacheId();
   }
 }
 
@@ -674,6 +689,20 @@ PixelData FontClient::CreateBitmap(FontId fontId, GlyphIndex glyphIndex, int out
   return mPlugin->CreateBitmap(fontId, glyphIndex, outlineWidth);
 }
 
+void FontClient::CreateBitmaps(const std::vector<Dali::TextAbstraction::FontClient::BitmapRequest>& requests, std::vector<Dali::TextAbstraction::GlyphBufferData>& data)
+{
+  CreatePlugin();
+
+  mPlugin->CreateBitmaps(requests, data);
+}
+
+bool FontClient::CreateDistanceFieldBitmap(FontId fontId, GlyphIndex glyphIndex, Dali::TextAbstraction::GlyphBufferData& data, GlyphInfo& glyphInfo)
+{
+  CreatePlugin();
+
+  return mPlugin->CreateDistanceFieldBitmap(fontId, glyphIndex, data, glyphInfo);
+}
+
 void FontClient::CreateVectorBlob(FontId fontId, GlyphIndex glyphIndex, VectorBlob*& blob, unsigned int& blobLength, unsigned int& nominalWidth, unsigned int& nominalHeight)
 {
   CreatePlugin();
@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_TEXT_ABSTRACTION_FONT_CLIENT_IMPL_H
 
 /*
- * Copyright (c) 2025 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -283,6 +283,16 @@ public: // API for Dali::TextAbstraction::FontClient used.
    */
   PixelData CreateBitmap(FontId fontId, GlyphIndex glyphIndex, int outlineWidth);
 
+  /**
+   * @copydoc Dali::TextAbstraction::FontClient::CreateBitmaps()
+   */
+  void CreateBitmaps(const std::vector<Dali::TextAbstraction::FontClient::BitmapRequest>& requests, std::vector<Dali::TextAbstraction::GlyphBufferData>& data);
+
+  /**
+   * @copydoc Dali::TextAbstraction::FontClient::CreateDistanceFieldBitmap()
+   */
+  bool CreateDistanceFieldBitmap(FontId fontId, GlyphIndex glyphIndex, Dali::TextAbstraction::GlyphBufferData& data, GlyphInfo& glyphInfo);
+
   /**
    * @copydoc Dali::TextAbstraction::FontClient::CreateVectorBlob()
    */
@@ -401,6 +411,18 @@ public: // API for Dali::TextAbstraction::Internal::FontClient used.
    */
   HarfBuzzFontHandle GetHarfBuzzFont(FontId fontId);
 
+  /**
+   * @brief Retrieves the id of the current font cache.
+   *
+   * It changes whenever the font ids of this font client may start to refer to other fonts,
+   * and is unique among all the font clients of the process, so it can key caches shared by them.
+   * @return The id of the current font cache.
+   */
+  uint32_t GetFontCacheId() const
+  {
+    return mFontCacheId;
+  }
+
   /**
    * @brief This is used to pre-cache fonts in order to improve the runtime performance of the application.
    *
@@ -450,6 +472,8 @@ private:
   unsigned int mDpiHorizontal;
   unsigned int mDpiVertical;
 
+  uint32_t mFontCacheId; ///< Changed when the font cache is cleared, see GetFontCacheId()
+
   // Signal emitted when custom font directory is added
   CustomFontAddedSignalType mCustomFontAddedSignal;
 }; // class FontClient
@@ -60,6 +60,15 @@ struct BitmapFontCacheItem : public FontCacheItemInterface
    */
   void CreateBitmap(GlyphIndex glyphIndex, Dali::TextAbstraction::GlyphBufferData& data, int outlineWidth, bool isItalicRequired, bool isBoldRequired) const override;
 
+  /**
+   * @copydoc FontCacheItemInterface::CreateDistanceFieldBitmap()
+   */
+  bool CreateDistanceFieldBitmap(GlyphIndex glyphIndex, Dali::TextAbstraction::GlyphBufferData& data, GlyphInfo& glyphInfo) const override
+  {
+    // Bitmap fonts have no outline to compute the distance from.
+    return false;
+  }
+
   /**
    * @copydoc FontCacheItemInterface::IsColorGlyph()
    */
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali/internal/text/text-abstraction/plugin/distance-field-glyph-generator.h>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/text-abstraction/font-client.h>
+#include <dali/integration-api/debug.h>
+
+#ifdef ENABLE_VECTOR_BASED_TEXT_RENDERING
+#include <third-party/glyphy/glyphy.h>
+#include <third-party/glyphy/glyphy-freetype.h>
+#endif
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#if defined(DEBUG_ENABLED)
+extern Dali::Integration::Log::Filter* gFontClientLogFilter;
+#endif
+
+namespace Dali::TextAbstraction::Internal
+{
+#ifdef ENABLE_VECTOR_BASED_TEXT_RENDERING
+namespace
+{
+constexpr double ARC_TOLERANCE_PER_EM = 1.0 / 2048.0; ///< The maximum error of the arcs, as used by the VectorFontCache.
+constexpr double OUTLINE_VALUE        = 128.0;        ///< The value of the field on the outline.
+
+glyphy_bool_t AccumulateEndpoint(glyphy_arc_endpoint_t* endpoint, std::vector<glyphy_arc_endpoint_t>* endpoints)
+{
+  endpoints->push_back(*endpoint);
+  return true;
+}
+
+} // namespace
+
+DistanceFieldGlyphGenerator::DistanceFieldGlyphGenerator()
+: mAccumulator(glyphy_arc_accumulator_create())
+{
+}
+
+DistanceFieldGlyphGenerator::~DistanceFieldGlyphGenerator()
+{
+  glyphy_arc_accumulator_destroy(mAccumulator);
+}
+
+bool DistanceFieldGlyphGenerator::IsSupported()
+{
+  return true;
+}
+
+bool DistanceFieldGlyphGenerator::Generate(FT_Face freeTypeFace, GlyphIndex index, DistanceFieldGlyph& glyph)
+{
+  // Load the outline in font units, as the field doesn't depend on the point size.
+  FT_Error error = FT_Load_Glyph(freeTypeFace, index, FT_LOAD_NO_BITMAP | FT_LOAD_NO_HINTING | FT_LOAD_NO_AUTOHINT | FT_LOAD_NO_SCALE | FT_LOAD_LINEAR_DESIGN | FT_LOAD_IGNORE_TRANSFORM);
+  if(DALI_UNLIKELY(FT_Err_Ok != error || freeTypeFace->glyph->format != FT_GLYPH_FORMAT_OUTLINE))
+  {
+    DALI_LOG_INFO(gFontClientLogFilter, Debug::General, "FontClient::Plugin::DistanceFieldGlyphGenerator::Generate. No outline for glyph : %u, error : %d\n", index, error);
+    return false;
+  }
+
+  const double unitsPerEm = static_cast<double>(freeTypeFace->units_per_EM);
+  glyph.mAdvance          = static_cast<float>(static_cast<double>(freeTypeFace->glyph->metrics.horiAdvance) / unitsPerEm);
+
+  std::vector<glyphy_arc_endpoint_t> endpoints;
+  glyphy_arc_accumulator_reset(mAccumulator);
+  glyphy_arc_accumulator_set_tolerance(mAccumulator, unitsPerEm * ARC_TOLERANCE_PER_EM);
+  glyphy_arc_accumulator_set_callback(mAccumulator, reinterpret_cast<glyphy_arc_endpoint_accumulator_callback_t>(AccumulateEndpoint), &endpoints);
+
+  if(DALI_UNLIKELY(FT_Err_Ok != glyphy_freetype_outline_decompose(&freeTypeFace->glyph->outline, mAccumulator)))
+  {
+    DALI_LOG_ERROR("glyphy_freetype_outline_decompose failed\n");
+    return false;
+  }
+
+  if(endpoints.empty())
+  {
+    // Nothing to draw, e.g. a space.
+    return true;
+  }
+
+  const unsigned int numberOfEndpoints = static_cast<unsigned int>(endpoints.size());
+  glyphy_outline_winding_from_even_odd(endpoints.data(), numberOfEndpoints, false);
+
+  glyphy_extents_t extents;
+  glyphy_arc_list_extents(endpoints.data(), numberOfEndpoints, &extents);
+  if(glyphy_extents_is_empty(&extents))
+  {
+    return true;
+  }
+
+  // The field covers the extents of the glyph, in whole pixels, and the spread around them.
+  const double pixelsPerEm   = static_cast<double>(FontClient::DISTANCE_FIELD_PIXELS_PER_EM);
+  const double spread        = static_cast<double>(FontClient::DISTANCE_FIELD_SPREAD);
+  const double pixelsPerUnit = pixelsPerEm / unitsPerEm;
+
+  const double left   = std::floor(extents.min_x * pixelsPerUnit) - spread;
+  const double bottom = std::floor(extents.min_y * pixelsPerUnit) - spread;
+  const double right  = std::ceil(extents.max_x * pixelsPerUnit) + spread;
+  const double top    = std::ceil(extents.max_y * pixelsPerUnit) + spread;
+
+  const uint32_t width  = static_cast<uint32_t>(right - left);
+  const uint32_t height = static_cast<uint32_t>(top - bottom);
+
+  uint8_t* buffer = static_cast<uint8_t*>(malloc(static_cast<std::size_t>(width) * height));
+  if(DALI_UNLIKELY(!buffer))
+  {
+    DALI_LOG_ERROR("malloc is failed. request malloc size : %u x %u\n", width, height);
+    return false;
+  }
+
+  // Sample the distance at the centre of the pixels, from the top row. glyphy's distance is negative inside.
+  const double valuePerPixel = (OUTLINE_VALUE - 1.0) / spread;
+  uint8_t*     value         = buffer;
+  for(uint32_t row = 0u; row < height; ++row)
+  {
+    glyphy_point_t point;
+    point.y = (top - static_cast<double>(row) - 0.5) / pixelsPerUnit;
+    for(uint32_t column = 0u; column < width; ++column)
+    {
+      point.x = (left + static_cast<double>(column) + 0.5) / pixelsPerUnit;
+
+      const double distance = glyphy_sdf_from_arc_list(endpoints.data(), numberOfEndpoints, &point, nullptr) * pixelsPerUnit;
+      *value++              = static_cast<uint8_t>(std::clamp(std::round(OUTLINE_VALUE - distance * valuePerPixel), 0.0, 255.0));
+    }
+  }
+
+  glyph.mBuffer.buffer          = buffer;
+  glyph.mBuffer.width           = width;
+  glyph.mBuffer.height          = height;
+  glyph.mBuffer.format          = Pixel::L8;
+  glyph.mBuffer.compressionType = TextAbstraction::GlyphBufferData::CompressionType::NO_COMPRESSION;
+  glyph.mBuffer.isBufferOwned   = true;
+
+  glyph.mWidth    = static_cast<float>(width / pixelsPerEm);
+  glyph.mHeight   = static_cast<float>(height / pixelsPerEm);
+  glyph.mXBearing = static_cast<float>(left / pixelsPerEm);
+  glyph.mYBearing = static_cast<float>(top / pixelsPerEm);
+
+  return true;
+}
+
+#else // ENABLE_VECTOR_BASED_TEXT_RENDERING
+
+DistanceFieldGlyphGenerator::DistanceFieldGlyphGenerator()
+: mAccumulator(nullptr)
+{
+}
+
+DistanceFieldGlyphGenerator::~DistanceFieldGlyphGenerator() = default;
+
+bool DistanceFieldGlyphGenerator::IsSupported()
+{
+  return false;
+}
+
+bool DistanceFieldGlyphGenerator::Generate(FT_Face freeTypeFace, GlyphIndex index, DistanceFieldGlyph& glyph)
+{
+  return false;
+}
+
+#endif // ENABLE_VECTOR_BASED_TEXT_RENDERING
+
+} // namespace Dali::TextAbstraction::Internal
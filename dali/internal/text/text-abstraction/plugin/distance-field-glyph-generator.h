@@ -0,0 +1,92 @@
+#ifndef DALI_TEXT_ABSTRACTION_INTERNAL_DISTANCE_FIELD_GLYPH_GENERATOR_H
+#define DALI_TEXT_ABSTRACTION_INTERNAL_DISTANCE_FIELD_GLYPH_GENERATOR_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/text-abstraction/glyph-buffer-data.h>
+#include <dali/devel-api/text-abstraction/text-abstraction-definitions.h>
+
+// EXTERNAL INCLUDES
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+struct glyphy_arc_accumulator_t;
+
+namespace Dali::TextAbstraction::Internal
+{
+/**
+ * @brief Signed distance field of a glyph, for any point size.
+ */
+struct DistanceFieldGlyph
+{
+  TextAbstraction::GlyphBufferData mBuffer; ///< The field in L8. Owns its buffer. Empty if the glyph has no outline.
+
+  float mWidth{0.f};    ///< The width of the field, in ems.
+  float mHeight{0.f};   ///< The height of the field, in ems.
+  float mXBearing{0.f}; ///< The distance from the cursor position to the left of the field, in ems.
+  float mYBearing{0.f}; ///< The distance from the baseline to the top of the field, in ems.
+  float mAdvance{0.f};  ///< The advance of the glyph, in ems.
+};
+
+/**
+ * @brief Generates the distance fields of glyphs from their outlines, with glyphy.
+ *
+ * The outline is approximated by arcs, and the distance to the arcs is sampled at
+ * FontClient::DISTANCE_FIELD_PIXELS_PER_EM. It's only available if the glyphy code is built,
+ * i.e. with the vector based text rendering.
+ */
+class DistanceFieldGlyphGenerator
+{
+public:
+  /**
+   * @brief Constructor.
+   */
+  DistanceFieldGlyphGenerator();
+
+  /**
+   * @brief Destructor.
+   */
+  ~DistanceFieldGlyphGenerator();
+
+  /**
+   * @brief Whether the distance fields can be generated in this build.
+   */
+  static bool IsSupported();
+
+  /**
+   * @brief Generates the distance field of a glyph.
+   * @note The glyph is loaded unscaled in the glyph slot of the face.
+   *
+   * @param[in] freeTypeFace The freetype face handle, with its variations set.
+   * @param[in] index Index of glyph in this face.
+   * @param[out] glyph The distance field.
+   * @return True if the field is generated, empty if the outline is. False if the glyph isn't an outline, or something failed.
+   */
+  bool Generate(FT_Face freeTypeFace, GlyphIndex index, DistanceFieldGlyph& glyph);
+
+private:
+  DistanceFieldGlyphGenerator(const DistanceFieldGlyphGenerator&)            = delete;
+  DistanceFieldGlyphGenerator& operator=(const DistanceFieldGlyphGenerator&) = delete;
+
+private:
+  glyphy_arc_accumulator_t* mAccumulator; ///< Reused for every glyph.
+};
+
+} // namespace Dali::TextAbstraction::Internal
+
+#endif // DALI_TEXT_ABSTRACTION_INTERNAL_DISTANCE_FIELD_GLYPH_GENERATOR_H
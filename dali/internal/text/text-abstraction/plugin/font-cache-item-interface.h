@@ -2,7 +2,7 @@
 #define DALI_TEST_ABSTRACTION_INTERNAL_FONT_CACHE_ITEM_INTERFACE_H
 
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -57,6 +57,16 @@ struct FontCacheItemInterface
    */
   virtual void CreateBitmap(GlyphIndex glyphIndex, Dali::TextAbstraction::GlyphBufferData& data, int outlineWidth, bool isItalicRequired, bool isBoldRequired) const = 0;
 
+  /**
+   * Create a signed distance field for the given glyph
+   *
+   * @param[in] glyphIndex The index of the glyph
+   * @param[out] data The distance field of the glyph
+   * @param[out] glyphInfo The size and bearing of the field, and the advance of the glyph, in ems
+   * @return true if the distance field is created
+   */
+  virtual bool CreateDistanceFieldBitmap(GlyphIndex glyphIndex, Dali::TextAbstraction::GlyphBufferData& data, GlyphInfo& glyphInfo) const = 0;
+
   /**
    * Return true if the glyph is colored
    *
@@ -312,6 +312,8 @@ FontClient::Plugin::CacheHandler::CacheHandler()
   mFontFaceManager(new FontFaceManager(GetMaxNumberOfFaceSizeCache())),
   mGlyphCacheManager(new GlyphCacheManager(GetMaxNumberOfGlyphCache())),
   mColorGlyphColrRasterizer(new ColorGlyphColrRasterizer()),
+  mDiskCache(new FontConfigDiskCache()),
+  mGlyphBatchRasterizer(new GlyphBatchRasterizer()),
   mLatestFoundFontDescription(),
   mLatestFoundFontDescriptionId(0u),
   mLatestFoundCacheKey(0, 0, 0u),
@@ -333,6 +335,9 @@ FontClient::Plugin::CacheHandler::~CacheHandler()
 
 void FontClient::Plugin::CacheHandler::ClearCache()
 {
+  // release the faces of the workers before the FontIds are given to other fonts.
+  mGlyphBatchRasterizer->ClearCache();
+
   // delete cached glyph informations before clear mFontFaceCache.
   mGlyphCacheManager->ClearCache();
 
@@ -380,6 +385,9 @@ void FontClient::Plugin::CacheHandler::ClearCache()
 
 void FontClient::Plugin::CacheHandler::ClearCacheOnLocaleChanged()
 {
+  // release the faces of the workers before the FontIds are given to other fonts.
+  mGlyphBatchRasterizer->ClearCache();
+
   // delete cached glyph informations before clear mFontFaceCache.
   mGlyphCacheManager->ClearCache();
 
@@ -517,6 +525,12 @@ void FontClient::Plugin::CacheHandler::InitSystemFonts()
 {
   if(mSystemFonts.empty())
   {
+    if(mDiskCache->FindFontList(FontConfigDiskCache::RecordType::SYSTEM_FONTS, FontDescription(), mSystemFonts, nullptr))
+    {
+      DALI_LOG_INFO(gFontClientLogFilter, Debug::General, "  number of system fonts from disk cache : %zu\n", mSystemFonts.size());
+      return;
+    }
+
     FcFontSet* fontSet = GetFcFontSet(mFontConfig); // Creates a FcFontSet that needs to be destroyed by calling FcFontSetDestroy.
 
     if(fontSet)
@@ -557,6 +571,8 @@ void FontClient::Plugin::CacheHandler::InitSystemFonts()
 
       // Destroys the font set created.
       FcFontSetDestroy(fontSet);
+
+      mDiskCache->CacheFontList(FontConfigDiskCache::RecordType::SYSTEM_FONTS, FontDescription(), mSystemFonts, nullptr);
     }
   }
 }
@@ -570,7 +586,7 @@ void FontClient::Plugin::CacheHandler::InitDefaultFonts()
     fontDescription.width  = DefaultFontWidth();
     fontDescription.weight = DefaultFontWeight();
     fontDescription.slant  = DefaultFontSlant();
-    SetFontList(mFontConfig, fontDescription, mDefaultFonts, mDefaultFontCharacterSets);
+    GetFontList(fontDescription, mDefaultFonts, mDefaultFontCharacterSets);
   }
 }
 
@@ -604,6 +620,9 @@ void FontClient::Plugin::CacheHandler::InitDefaultFontDescription()
       DALI_LOG_ERROR("Can't init font config library\n");
     }
 
+    // The results of the previous launches are valid as long as the config and the font directories are not changed.
+    mDiskCache->Load(mFontConfig, mCustomFontDirectories);
+
     FcPattern* matchPattern = FcPatternCreate(); // Creates a pattern that needs to be destroyed by calling FcPatternDestroy.
 
     if(nullptr != matchPattern)
@@ -612,7 +631,15 @@ void FontClient::Plugin::CacheHandler::InitDefaultFontDescription()
       FcDefaultSubstitute(matchPattern);
 
       FcCharSet* characterSet = nullptr;
-      bool       matched      = MatchFontDescriptionToPattern(mFontConfig, matchPattern, mDefaultFontDescription, &characterSet);
+      bool       matched      = mDiskCache->FindFont(FontConfigDiskCache::RecordType::DEFAULT_FONT, FontDescription(), mDefaultFontDescription, characterSet);
+      if(!matched)
+      {
+        matched = MatchFontDescriptionToPattern(mFontConfig, matchPattern, mDefaultFontDescription, &characterSet);
+        if(matched)
+        {
+          mDiskCache->CacheFont(FontConfigDiskCache::RecordType::DEFAULT_FONT, FontDescription(), mDefaultFontDescription, characterSet);
+        }
+      }
 
       // Caching the default font description
       if(matched)
@@ -711,14 +738,23 @@ void FontClient::Plugin::CacheHandler::ValidateFont(const FontDescription& fontD
 
   DALI_TRACE_SCOPE(gTraceFilter, "DALI_TEXT_VALIDATE_FONT");
 
-  // Create a font pattern.
-  FcPattern* fontFamilyPattern = CreateFontFamilyPattern(mFontConfig, fontDescription);
-
   FontDescription description;
 
   FcCharSet* characterSet = nullptr;
-  bool       matched      = MatchFontDescriptionToPattern(mFontConfig, fontFamilyPattern, description, &characterSet);
-  FcPatternDestroy(fontFamilyPattern);
+  bool       matched      = mDiskCache->FindFont(FontConfigDiskCache::RecordType::VALIDATED_FONT, fontDescription, description, characterSet);
+  if(!matched)
+  {
+    // Create a font pattern.
+    FcPattern* fontFamilyPattern = CreateFontFamilyPattern(mFontConfig, fontDescription);
+
+    matched = MatchFontDescriptionToPattern(mFontConfig, fontFamilyPattern, description, &characterSet);
+    FcPatternDestroy(fontFamilyPattern);
+
+    if(matched && (nullptr != characterSet))
+    {
+      mDiskCache->CacheFont(FontConfigDiskCache::RecordType::VALIDATED_FONT, fontDescription, description, characterSet);
+    }
+  }
 
   if(matched && (nullptr != characterSet))
   {
@@ -815,7 +851,7 @@ void FontClient::Plugin::CacheHandler::CacheFallbackFontList(FontDescription&&
   fontList         = new FontList;
   characterSetList = new CharacterSetList;
 
-  SetFontList(mFontConfig, fontDescription, *fontList, *characterSetList);
+  GetFontList(fontDescription, *fontList, *characterSetList);
 #ifdef __APPLE__
   FontDescription appleColorEmoji;
   appleColorEmoji.family = "Apple Color Emoji";
@@ -824,7 +860,7 @@ void FontClient::Plugin::CacheHandler::CacheFallbackFontList(FontDescription&&
   appleColorEmoji.slant  = fontDescription.slant;
   FontList         emojiFontList;
   CharacterSetList emojiCharSetList;
-  SetFontList(mFontConfig, appleColorEmoji, emojiFontList, emojiCharSetList);
+  GetFontList(appleColorEmoji, emojiFontList, emojiCharSetList);
 
   std::move(fontList->begin(), fontList->end(), std::back_inserter(emojiFontList));
   emojiCharSetList.Insert(emojiCharSetList.End(), characterSetList->Begin(), characterSetList->End());
@@ -836,6 +872,18 @@ void FontClient::Plugin::CacheHandler::CacheFallbackFontList(FontDescription&&
   mFallbackCache.emplace_back(CacheHandler::FallbackCacheItem(std::move(fontDescription), fontList, characterSetList));
 }
 
+void FontClient::Plugin::CacheHandler::GetFontList(const FontDescription& fontDescription, FontList& fontList, CharacterSetList& characterSetList)
+{
+  if(mDiskCache->FindFontList(FontConfigDiskCache::RecordType::FONT_LIST, fontDescription, fontList, &characterSetList))
+  {
+    DALI_LOG_INFO(gFontClientLogFilter, Debug::General, "  font list of [%s] found in disk cache : %zu fonts\n", fontDescription.family.c_str(), fontList.size());
+    return;
+  }
+
+  SetFontList(mFontConfig, fontDescription, fontList, characterSetList);
+  mDiskCache->CacheFontList(FontConfigDiskCache::RecordType::FONT_LIST, fontDescription, fontList, &characterSetList);
+}
+
 // Font / FontFace
 
 bool FontClient::Plugin::CacheHandler::FindFontByPath(const FontPath& path,
@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_TEXT_ABSTRACTION_FONT_CLIENT_PLUGIN_CACHE_HANDLER_H
 
 /*
- * Copyright (c) 2025 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,9 +20,11 @@
 
 // INTERNAL INCLUDES
 #include <dali/internal/text/text-abstraction/plugin/font-client-plugin-impl.h>
+#include <dali/internal/text/text-abstraction/plugin/font-config-disk-cache.h>
 #include <dali/internal/text/text-abstraction/plugin/font-face-glyph-cache-manager.h>
 #include <dali/internal/text/text-abstraction/plugin/color-glyph/color-glyph-colr-rasterizer.h>
 #include <dali/internal/text/text-abstraction/plugin/font-face-manager.h>
+#include <dali/internal/text/text-abstraction/plugin/glyph-batch-rasterizer.h>
 
 namespace Dali::TextAbstraction::Internal
 {
@@ -250,6 +252,18 @@ public: // Find & Cache
                              FontList*&         fontList,
                              CharacterSetList*& characterSetList);
 
+private:
+  /**
+   * @brief Retrieves the fonts which are a close match for a font description, from the disk cache or from fontconfig.
+   *
+   * @param[in] fontDescription A font description.
+   * @param[out] fontList A list of the fonts which are a close match for fontDescription.
+   * @param[out] characterSetList A list of character sets which are a close match for fontDescription.
+   */
+  void GetFontList(const FontDescription& fontDescription, FontList& fontList, CharacterSetList& characterSetList);
+
+public:
+
   // Font / FontFace
 
   /**
@@ -486,6 +500,8 @@ public:                                    // Cache container list
   std::unique_ptr<FontFaceManager>          mFontFaceManager;       ///< The freetype font face manager. It will cache font face.
   std::unique_ptr<GlyphCacheManager>        mGlyphCacheManager;     ///< The glyph cache manager. It will cache this face's glyphs.
   std::unique_ptr<ColorGlyphColrRasterizer> mColorGlyphColrRasterizer; ///< COLRv1 paint bounds/rasterization helper.
+  std::unique_ptr<FontConfigDiskCache>      mDiskCache;                ///< Results of the fontconfig queries of previous launches.
+  std::unique_ptr<GlyphBatchRasterizer>     mGlyphBatchRasterizer;     ///< Worker threads of CreateBitmaps(), with their own faces.
 
 private:                                         // Member value
   FontDescription   mLatestFoundFontDescription; ///< Latest found font description and id in FindValidatedFont()
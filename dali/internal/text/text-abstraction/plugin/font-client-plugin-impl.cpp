@@ -1001,6 +1001,65 @@ PixelData FontClient::Plugin::CreateBitmap(FontId fontId, GlyphIndex glyphIndex,
                         PixelData::FREE);
 }
 
+void FontClient::Plugin::CreateBitmaps(const std::vector<Dali::TextAbstraction::FontClient::BitmapRequest>& requests, std::vector<Dali::TextAbstraction::GlyphBufferData>& data) const
+{
+  DALI_TRACE_SCOPE(gTraceFilter, "DALI_TEXT_CREATE_BITMAPS");
+
+  data.clear();
+  data.resize(requests.size());
+
+  // Split the glyphs rendered by the workers from the others.
+  std::vector<GlyphBatchRasterizer::Job> jobs;
+  std::vector<std::size_t>               localIndices;
+  jobs.reserve(requests.size());
+
+  for(std::size_t index = 0u; index < requests.size(); ++index)
+  {
+    const auto&              request           = requests[index];
+    const FontFaceCacheItem* fontFaceCacheItem = nullptr;
+    if(mCacheHandler->IsFontIdCacheItemExist(request.fontId - 1u))
+    {
+      const auto& fontIdCacheItem = mCacheHandler->FindFontIdCacheItem(request.fontId - 1u);
+      if(fontIdCacheItem.type == FontDescription::FACE_FONT)
+      {
+        fontFaceCacheItem = &mCacheHandler->FindFontFaceCacheItem(fontIdCacheItem.index);
+      }
+    }
+
+    if(fontFaceCacheItem && GlyphBatchRasterizer::IsParallelizable(*fontFaceCacheItem))
+    {
+      jobs.push_back({fontFaceCacheItem, &request, &data[index]});
+    }
+    else
+    {
+      localIndices.push_back(index);
+    }
+  }
+
+  auto& glyphBatchRasterizer = *mCacheHandler->mGlyphBatchRasterizer;
+  glyphBatchRasterizer.Start(std::move(jobs), mFontFileManager, mDpiHorizontal, mDpiVertical);
+
+  // The others use the caches of the FontClient, so they are rendered here while the workers run.
+  for(const auto index : localIndices)
+  {
+    const auto& request = requests[index];
+    CreateBitmap(request.fontId, request.glyphIndex, request.isItalicRequired, request.isBoldRequired, data[index], request.outlineWidth);
+    GlyphBatchRasterizer::MakeOwnedBitmap(data[index]);
+  }
+
+  glyphBatchRasterizer.Finish();
+}
+
+bool FontClient::Plugin::CreateDistanceFieldBitmap(FontId fontId, GlyphIndex glyphIndex, Dali::TextAbstraction::GlyphBufferData& data, GlyphInfo& glyphInfo) const
+{
+  const FontCacheItemInterface* fontCacheItem = GetCachedFontItem(fontId);
+  if(fontCacheItem != nullptr)
+  {
+    return fontCacheItem->CreateDistanceFieldBitmap(glyphIndex, data, glyphInfo);
+  }
+  return false;
+}
+
 void FontClient::Plugin::CreateVectorBlob(FontId fontId, GlyphIndex glyphIndex, VectorBlob*& blob, unsigned int& blobLength, unsigned int& nominalWidth, unsigned int& nominalHeight) const
 {
   blob       = nullptr;
@@ -1110,7 +1169,11 @@ bool FontClient::Plugin::AddCustomFontDirectory(const FontPath& path)
   {
     return false;
   }
-  return FcConfigAppFontAddDir(mCacheHandler->mFontConfig, reinterpret_cast<const FcChar8*>(path.c_str()));
+  const bool added = FcConfigAppFontAddDir(mCacheHandler->mFontConfig, reinterpret_cast<const FcChar8*>(path.c_str()));
+
+  // The fonts found by fontconfig may change, so the disk cache of the new set of directories is used from now.
+  mCacheHandler->mDiskCache->Load(mCacheHandler->mFontConfig, mCacheHandler->mCustomFontDirectories);
+  return added;
 }
 
 const FontPathList& FontClient::Plugin::GetCustomFontDirectories()
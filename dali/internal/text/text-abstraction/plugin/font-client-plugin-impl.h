@@ -250,6 +250,16 @@ public: // Dali::TextAbstraction::FontClient
    */
   PixelData CreateBitmap(FontId fontId, GlyphIndex glyphIndex, int outlineWidth) const;
 
+  /**
+   * @copydoc Dali::TextAbstraction::FontClient::CreateBitmaps()
+   */
+  void CreateBitmaps(const std::vector<Dali::TextAbstraction::FontClient::BitmapRequest>& requests, std::vector<Dali::TextAbstraction::GlyphBufferData>& data) const;
+
+  /**
+   * @copydoc Dali::TextAbstraction::FontClient::CreateDistanceFieldBitmap()
+   */
+  bool CreateDistanceFieldBitmap(FontId fontId, GlyphIndex glyphIndex, Dali::TextAbstraction::GlyphBufferData& data, GlyphInfo& glyphInfo) const;
+
   /**
    * @copydoc Dali::TextAbstraction::FontClient::CreateVectorBlob()
    */
@@ -0,0 +1,667 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/text/text-abstraction/plugin/font-config-disk-cache.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <clocale>
+#include <cstdio>
+#include <cstring>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/internal/system/common/environment-variables.h>
+
+#if defined(DEBUG_ENABLED)
+extern Dali::Integration::Log::Filter* gFontClientLogFilter;
+#endif
+
+namespace Dali::TextAbstraction::Internal
+{
+namespace
+{
+constexpr uint32_t FILE_MAGIC   = 0x43434644u; ///< "DFCC"
+constexpr uint32_t FILE_VERSION = 1u;          ///< Change it when the layout of the records changes.
+
+const char* const CACHE_DIRECTORY_NAME = "/dali";
+const char* const CACHE_FILE_NAME      = "/dali-font-config.cache";
+
+constexpr uint32_t NULL_CHARACTER_SET = 0xFFFFFFFFu; ///< Page count written for a font without character set.
+
+/**
+ * @brief The header of the file. Followed by the records, each one as key size, key, data size and data.
+ */
+struct FileHeader
+{
+  uint32_t magic;
+  uint32_t version;
+  uint64_t stamp;
+  uint32_t numberOfRecords;
+  uint32_t reserved;
+};
+
+uint64_t HashBytes(uint64_t hash, const void* data, std::size_t size)
+{
+  // FNV-1a
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+  for(std::size_t index = 0u; index < size; ++index)
+  {
+    hash = (hash ^ bytes[index]) * 1099511628211ull;
+  }
+  return hash;
+}
+
+/**
+ * @brief Hashes a path with the size and modification times of the file or directory it names.
+ */
+uint64_t HashPath(uint64_t hash, const char* path)
+{
+  hash = HashBytes(hash, path, strlen(path) + 1u);
+
+  struct stat status;
+  if(stat(path, &status) == 0)
+  {
+    const int64_t values[] = {static_cast<int64_t>(status.st_mtime), static_cast<int64_t>(status.st_ctime), static_cast<int64_t>(status.st_size), static_cast<int64_t>(status.st_ino)};
+    hash                   = HashBytes(hash, values, sizeof(values));
+  }
+  return hash;
+}
+
+uint64_t HashStringList(uint64_t hash, FcStrList* list)
+{
+  if(list)
+  {
+    while(FcChar8* path = FcStrListNext(list))
+    {
+      hash = HashPath(hash, reinterpret_cast<const char*>(path));
+    }
+    FcStrListDone(list);
+  }
+  return hash;
+}
+
+/**
+ * @brief Computes the stamp of a font config, which changes when the fonts it finds may change.
+ */
+uint64_t ComputeStamp(FcConfig* fontConfig, const FontPathList& customFontDirectories)
+{
+  uint64_t hash = 14695981039346656037ull;
+  hash          = HashBytes(hash, &FILE_VERSION, sizeof(FILE_VERSION));
+
+  // The locale is added to the patterns given to fontconfig.
+  const char* locale = setlocale(LC_MESSAGES, nullptr);
+  if(locale)
+  {
+    hash = HashBytes(hash, locale, strlen(locale) + 1u);
+  }
+
+  hash = HashStringList(hash, FcConfigGetConfigFiles(fontConfig));
+  hash = HashStringList(hash, FcConfigGetFontDirs(fontConfig));
+  for(const auto& path : customFontDirectories)
+  {
+    hash = HashPath(hash, path.c_str());
+  }
+  return hash;
+}
+
+std::string GetCacheFilePath()
+{
+  const char* path = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_FONT_CONFIG_CACHE_PATH);
+  if(path)
+  {
+    return std::string(path);
+  }
+
+  std::string directory;
+  if(const char* cacheHome = Dali::EnvironmentVariable::GetEnvironmentVariable("XDG_CACHE_HOME"))
+  {
+    directory = cacheHome;
+  }
+  else if(const char* home = Dali::EnvironmentVariable::GetEnvironmentVariable("HOME"))
+  {
+    directory = std::string(home) + "/.cache";
+  }
+  else
+  {
+    return std::string();
+  }
+
+  directory += CACHE_DIRECTORY_NAME;
+  mkdir(directory.c_str(), 0700); // Fails if it exists already.
+
+  return directory + CACHE_FILE_NAME;
+}
+
+/**
+ * @brief Appends values to the data of a record.
+ */
+struct RecordWriter
+{
+  template<typename T>
+  void Write(T value)
+  {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+    data.insert(data.end(), bytes, bytes + sizeof(T));
+  }
+
+  void WriteString(const std::string& string)
+  {
+    Write(static_cast<uint32_t>(string.size()));
+    data.insert(data.end(), string.begin(), string.end());
+  }
+
+  void WriteDescription(const FontDescription& description)
+  {
+    WriteString(description.path);
+    WriteString(description.family);
+    Write(static_cast<uint8_t>(description.width));
+    Write(static_cast<uint8_t>(description.weight));
+    Write(static_cast<uint8_t>(description.slant));
+    Write(static_cast<uint8_t>(description.type));
+  }
+
+  void WriteCharacterSet(const FcCharSet* characterSet)
+  {
+    if(nullptr == characterSet)
+    {
+      Write(NULL_CHARACTER_SET);
+      return;
+    }
+
+    // The page count is written once the pages have been.
+    const std::size_t countPosition = data.size();
+    Write(0u);
+
+    uint32_t numberOfPages = 0u;
+    FcChar32 map[FC_CHARSET_MAP_SIZE];
+    FcChar32 next;
+    for(FcChar32 base = FcCharSetFirstPage(characterSet, map, &next); base != FC_CHARSET_DONE; base = FcCharSetNextPage(characterSet, map, &next))
+    {
+      Write(static_cast<uint32_t>(base));
+      for(uint32_t index = 0u; index < FC_CHARSET_MAP_SIZE; ++index)
+      {
+        Write(static_cast<uint32_t>(map[index]));
+      }
+      ++numberOfPages;
+    }
+    memcpy(data.data() + countPosition, &numberOfPages, sizeof(numberOfPages));
+  }
+
+  std::vector<uint8_t> data;
+};
+
+/**
+ * @brief Reads values from the data of a record. Reading past its end fails, it doesn't crash.
+ */
+struct RecordReader
+{
+  RecordReader(const uint8_t* data, std::size_t size)
+  : current(data),
+    end(data + size)
+  {
+  }
+
+  template<typename T>
+  bool Read(T& value)
+  {
+    if(static_cast<std::size_t>(end - current) < sizeof(T))
+    {
+      current = end;
+      return false;
+    }
+    memcpy(&value, current, sizeof(T));
+    current += sizeof(T);
+    return true;
+  }
+
+  bool ReadString(std::string& string)
+  {
+    uint32_t size = 0u;
+    if(!Read(size) || static_cast<std::size_t>(end - current) < size)
+    {
+      return false;
+    }
+    string.assign(reinterpret_cast<const char*>(current), size);
+    current += size;
+    return true;
+  }
+
+  bool ReadDescription(FontDescription& description)
+  {
+    uint8_t width, weight, slant, type;
+    if(!(ReadString(description.path) && ReadString(description.family) && Read(width) && Read(weight) && Read(slant) && Read(type)))
+    {
+      return false;
+    }
+    description.width  = static_cast<FontWidth::Type>(width);
+    description.weight = static_cast<FontWeight::Type>(weight);
+    description.slant  = static_cast<FontSlant::Type>(slant);
+    description.type   = static_cast<FontDescription::Type>(type);
+    return true;
+  }
+
+  bool ReadCharacterSet(FcCharSet*& characterSet)
+  {
+    characterSet = nullptr;
+
+    uint32_t numberOfPages = 0u;
+    if(!Read(numberOfPages))
+    {
+      return false;
+    }
+    if(numberOfPages == NULL_CHARACTER_SET)
+    {
+      return true;
+    }
+
+    characterSet = FcCharSetCreate();
+    for(uint32_t page = 0u; page < numberOfPages; ++page)
+    {
+      uint32_t base;
+      uint32_t map[FC_CHARSET_MAP_SIZE];
+      if(!Read(base) || !Read(map))
+      {
+        FcCharSetDestroy(characterSet);
+        characterSet = nullptr;
+        return false;
+      }
+
+      for(uint32_t index = 0u; index < FC_CHARSET_MAP_SIZE; ++index)
+      {
+        for(uint32_t bits = map[index]; bits != 0u; bits &= bits - 1u)
+        {
+          FcCharSetAddChar(characterSet, base + index * 32u + static_cast<uint32_t>(__builtin_ctz(bits)));
+        }
+      }
+    }
+    return true;
+  }
+
+  const uint8_t* current;
+  const uint8_t* end;
+};
+
+/**
+ * @brief Makes the key of a record. The path of the description isn't used by the fontconfig queries.
+ */
+std::string MakeKey(FontConfigDiskCache::RecordType type, const FontDescription& description)
+{
+  std::string key;
+  key.reserve(description.family.size() + 5u);
+  key.push_back(static_cast<char>(type));
+  key.push_back(static_cast<char>(description.width));
+  key.push_back(static_cast<char>(description.weight));
+  key.push_back(static_cast<char>(description.slant));
+  key.append(description.family);
+  return key;
+}
+
+/**
+ * @brief Makes the key of the record of the character set of a font.
+ */
+std::string MakeCharacterSetKey(const FontDescription& font)
+{
+  std::string key = MakeKey(FontConfigDiskCache::RecordType::CHARACTER_SET, font);
+  key.push_back('\0');
+  key.append(font.path);
+  return key;
+}
+
+bool WriteAll(int fileDescriptor, const void* data, std::size_t size)
+{
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+  while(size > 0u)
+  {
+    const ssize_t written = write(fileDescriptor, bytes, size);
+    if(written <= 0)
+    {
+      return false;
+    }
+    bytes += written;
+    size -= static_cast<std::size_t>(written);
+  }
+  return true;
+}
+
+bool WriteRecord(int fileDescriptor, const std::string& key, const uint8_t* data, std::size_t size)
+{
+  const uint32_t keySize  = static_cast<uint32_t>(key.size());
+  const uint32_t dataSize = static_cast<uint32_t>(size);
+  return WriteAll(fileDescriptor, &keySize, sizeof(keySize)) &&
+         WriteAll(fileDescriptor, key.data(), key.size()) &&
+         WriteAll(fileDescriptor, &dataSize, sizeof(dataSize)) &&
+         WriteAll(fileDescriptor, data, size);
+}
+
+} // namespace
+
+FontConfigDiskCache::FontConfigDiskCache()
+: mFilePath(GetCacheFilePath()),
+  mStamp(0u),
+  mMappedAddress(nullptr),
+  mMappedSize(0u),
+  mMappedRecords(),
+  mNewRecords(),
+  mCharacterSets(),
+  mUnsaved(false)
+{
+}
+
+FontConfigDiskCache::~FontConfigDiskCache()
+{
+  Save();
+  Unload();
+}
+
+void FontConfigDiskCache::Load(FcConfig* fontConfig, const FontPathList& customFontDirectories)
+{
+  if(!IsEnabled())
+  {
+    return;
+  }
+
+  Save();
+  Unload();
+
+  mStamp = ComputeStamp(fontConfig, customFontDirectories);
+
+  const int fileDescriptor = open(mFilePath.c_str(), O_RDONLY | O_CLOEXEC);
+  if(fileDescriptor < 0)
+  {
+    DALI_LOG_INFO(gFontClientLogFilter, Debug::General, "FontConfigDiskCache::Load. No cache file [%s]\n", mFilePath.c_str());
+    return;
+  }
+
+  struct stat status;
+  if(fstat(fileDescriptor, &status) == 0 && static_cast<std::size_t>(status.st_size) >= sizeof(FileHeader))
+  {
+    void* address = mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    if(address != MAP_FAILED)
+    {
+      mMappedAddress = address;
+      mMappedSize    = status.st_size;
+    }
+  }
+  close(fileDescriptor);
+
+  if(nullptr == mMappedAddress)
+  {
+    return;
+  }
+
+  FileHeader header;
+  memcpy(&header, mMappedAddress, sizeof(header));
+  if(header.magic != FILE_MAGIC || header.version != FILE_VERSION || header.stamp != mStamp)
+  {
+    DALI_LOG_INFO(gFontClientLogFilter, Debug::General, "FontConfigDiskCache::Load. Cache file [%s] is out of date\n", mFilePath.c_str());
+    Unload();
+    return;
+  }
+
+  // Only the keys are read. The records are decoded when they are found.
+  RecordReader reader(reinterpret_cast<const uint8_t*>(mMappedAddress) + sizeof(FileHeader), mMappedSize - sizeof(FileHeader));
+  mMappedRecords.reserve(header.numberOfRecords);
+  for(uint32_t index = 0u; index < header.numberOfRecords; ++index)
+  {
+    std::string key;
+    uint32_t    dataSize = 0u;
+    if(!reader.ReadString(key) || !reader.Read(dataSize) || static_cast<std::size_t>(reader.end - reader.current) < dataSize)
+    {
+      DALI_LOG_INFO(gFontClientLogFilter, Debug::General, "FontConfigDiskCache::Load. Cache file [%s] is truncated\n", mFilePath.c_str());
+      Unload();
+      return;
+    }
+    mMappedRecords.emplace(std::move(key), RecordData{reader.current, dataSize});
+    reader.current += dataSize;
+  }
+
+  DALI_LOG_INFO(gFontClientLogFilter, Debug::General, "FontConfigDiskCache::Load. %u records in [%s]\n", header.numberOfRecords, mFilePath.c_str());
+}
+
+void FontConfigDiskCache::Save()
+{
+  if(!mUnsaved)
+  {
+    return;
+  }
+  mUnsaved = false;
+
+  // Write a new file and rename it, so the mapped file and the readers of other processes are not disturbed.
+  std::string temporaryPath = mFilePath + ".XXXXXX";
+  const int   fileDescriptor = mkstemp(&temporaryPath[0]);
+  if(fileDescriptor < 0)
+  {
+    DALI_LOG_INFO(gFontClientLogFilter, Debug::General, "FontConfigDiskCache::Save. Can't create [%s]\n", temporaryPath.c_str());
+    return;
+  }
+
+  FileHeader header{FILE_MAGIC, FILE_VERSION, mStamp, 0u, 0u};
+  for(const auto& [key, record] : mMappedRecords)
+  {
+    header.numberOfRecords += mNewRecords.count(key) == 0u ? 1u : 0u;
+  }
+  header.numberOfRecords += static_cast<uint32_t>(mNewRecords.size());
+
+  bool succeeded = WriteAll(fileDescriptor, &header, sizeof(header));
+  for(const auto& [key, record] : mMappedRecords)
+  {
+    if(succeeded && mNewRecords.count(key) == 0u)
+    {
+      succeeded = WriteRecord(fileDescriptor, key, record.data, record.size);
+    }
+  }
+  for(const auto& [key, data] : mNewRecords)
+  {
+    if(succeeded)
+    {
+      succeeded = WriteRecord(fileDescriptor, key, data.data(), data.size());
+    }
+  }
+  close(fileDescriptor);
+
+  if(!succeeded || rename(temporaryPath.c_str(), mFilePath.c_str()) != 0)
+  {
+    DALI_LOG_INFO(gFontClientLogFilter, Debug::General, "FontConfigDiskCache::Save. Can't write [%s]\n", mFilePath.c_str());
+    unlink(temporaryPath.c_str());
+    return;
+  }
+
+  DALI_LOG_INFO(gFontClientLogFilter, Debug::General, "FontConfigDiskCache::Save. %u records in [%s]\n", header.numberOfRecords, mFilePath.c_str());
+}
+
+bool FontConfigDiskCache::FindFont(RecordType type, const FontDescription& request, FontDescription& font, FcCharSet*& characterSet) const
+{
+  RecordData record;
+  if(!FindRecord(MakeKey(type, request), record))
+  {
+    return false;
+  }
+
+  RecordReader reader(record.data, record.size);
+  if(!reader.ReadDescription(font))
+  {
+    return false;
+  }
+  characterSet = FindCharacterSet(font);
+  return nullptr != characterSet;
+}
+
+void FontConfigDiskCache::CacheFont(RecordType type, const FontDescription& request, const FontDescription& font, const FcCharSet* characterSet)
+{
+  if(!IsEnabled())
+  {
+    return;
+  }
+
+  RecordWriter writer;
+  writer.WriteDescription(font);
+  AddRecord(MakeKey(type, request), std::move(writer.data));
+
+  CacheCharacterSet(font, characterSet);
+}
+
+bool FontConfigDiskCache::FindFontList(RecordType type, const FontDescription& request, FontList& fontList, CharacterSetList* characterSetList) const
+{
+  RecordData record;
+  if(!FindRecord(MakeKey(type, request), record))
+  {
+    return false;
+  }
+
+  RecordReader reader(record.data, record.size);
+  uint32_t     numberOfFonts = 0u;
+  if(!reader.Read(numberOfFonts))
+  {
+    return false;
+  }
+
+  FontList fonts(numberOfFonts);
+  for(auto& font : fonts)
+  {
+    if(!reader.ReadDescription(font))
+    {
+      return false;
+    }
+  }
+
+  if(characterSetList)
+  {
+    characterSetList->Reserve(characterSetList->Count() + numberOfFonts);
+    for(const auto& font : fonts)
+    {
+      characterSetList->PushBack(FindCharacterSet(font));
+    }
+  }
+  fontList = std::move(fonts);
+  return true;
+}
+
+void FontConfigDiskCache::CacheFontList(RecordType type, const FontDescription& request, const FontList& fontList, const CharacterSetList* characterSetList)
+{
+  if(!IsEnabled())
+  {
+    return;
+  }
+
+  RecordWriter writer;
+  writer.Write(static_cast<uint32_t>(fontList.size()));
+  for(const auto& font : fontList)
+  {
+    writer.WriteDescription(font);
+  }
+  AddRecord(MakeKey(type, request), std::move(writer.data));
+
+  if(characterSetList && characterSetList->Count() == fontList.size())
+  {
+    for(std::size_t index = 0u; index < fontList.size(); ++index)
+    {
+      CacheCharacterSet(fontList[index], (*characterSetList)[index]);
+    }
+  }
+}
+
+bool FontConfigDiskCache::FindRecord(const std::string& key, RecordData& record) const
+{
+  auto newIter = mNewRecords.find(key);
+  if(newIter != mNewRecords.end())
+  {
+    record = RecordData{newIter->second.data(), newIter->second.size()};
+    return true;
+  }
+
+  auto mappedIter = mMappedRecords.find(key);
+  if(mappedIter != mMappedRecords.end())
+  {
+    record = mappedIter->second;
+    return true;
+  }
+  return false;
+}
+
+void FontConfigDiskCache::AddRecord(std::string&& key, std::vector<uint8_t>&& data)
+{
+  mNewRecords[std::move(key)] = std::move(data);
+  mUnsaved                    = true;
+}
+
+void FontConfigDiskCache::CacheCharacterSet(const FontDescription& font, const FcCharSet* characterSet)
+{
+  std::string key = MakeCharacterSetKey(font);
+
+  RecordData record;
+  if(FindRecord(key, record))
+  {
+    return;
+  }
+
+  RecordWriter writer;
+  writer.WriteCharacterSet(characterSet);
+  AddRecord(std::move(key), std::move(writer.data));
+}
+
+FcCharSet* FontConfigDiskCache::FindCharacterSet(const FontDescription& font) const
+{
+  std::string key = MakeCharacterSetKey(font);
+
+  auto iter = mCharacterSets.find(key);
+  if(iter == mCharacterSets.end())
+  {
+    FcCharSet* characterSet = nullptr;
+
+    RecordData record;
+    if(FindRecord(key, record))
+    {
+      RecordReader reader(record.data, record.size);
+      reader.ReadCharacterSet(characterSet);
+    }
+    iter = mCharacterSets.emplace(std::move(key), characterSet).first;
+  }
+
+  // Increase the reference counter for the caller.
+  return iter->second ? FcCharSetCopy(iter->second) : nullptr;
+}
+
+void FontConfigDiskCache::Unload()
+{
+  for(auto& [key, characterSet] : mCharacterSets)
+  {
+    if(characterSet)
+    {
+      FcCharSetDestroy(characterSet);
+    }
+  }
+  mCharacterSets.clear();
+
+  mMappedRecords.clear();
+  mNewRecords.clear();
+  mUnsaved = false;
+
+  if(mMappedAddress)
+  {
+    munmap(mMappedAddress, mMappedSize);
+    mMappedAddress = nullptr;
+    mMappedSize    = 0u;
+  }
+}
+
+} // namespace Dali::TextAbstraction::Internal
@@ -0,0 +1,196 @@
+#ifndef DALI_INTERNAL_TEXT_ABSTRACTION_FONT_CONFIG_DISK_CACHE_H
+#define DALI_INTERNAL_TEXT_ABSTRACTION_FONT_CONFIG_DISK_CACHE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <fontconfig/fontconfig.h>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/text-abstraction/font-list.h>
+#include <dali/internal/text/text-abstraction/plugin/font-client-plugin-impl.h>
+
+namespace Dali::TextAbstraction::Internal
+{
+/**
+ * @brief Keeps the results of the fontconfig queries done by the FontClient in a file,
+ * so the next launch of the application can skip them.
+ *
+ * The file is memory mapped when the font config is loaded, and the records in it are
+ * only decoded when they are looked up. New results are kept in memory, and are written
+ * with the mapped records to a new file by Save(), which replaces the old one.
+ *
+ * The file is stamped with the modification times of the fontconfig configuration files
+ * and of the font directories, and with the locale. A file with another stamp is ignored,
+ * and replaced by the next Save().
+ *
+ * The path of the file is set by DALI_FONT_CONFIG_CACHE_PATH. An empty value disables the cache.
+ * Otherwise it's dali-font-config.cache in $XDG_CACHE_HOME/dali, or in $HOME/.cache/dali.
+ */
+class FontConfigDiskCache
+{
+public:
+  /**
+   * @brief The fontconfig query a record holds the result of.
+   */
+  enum class RecordType : uint8_t
+  {
+    DEFAULT_FONT,   ///< The font matched to the default pattern. FcFontMatch
+    VALIDATED_FONT, ///< The font matched to a font description. FcFontMatch
+    SYSTEM_FONTS,   ///< The fonts installed. FcFontList
+    FONT_LIST,      ///< The fonts sorted by how close they are to a font description. FcFontSort
+    CHARACTER_SET   ///< The character set of a font, shared by the records of the fonts above.
+  };
+
+  /**
+   * @brief Constructor. Resolves the path of the file.
+   */
+  FontConfigDiskCache();
+
+  /**
+   * @brief Destructor. Saves the new records.
+   */
+  ~FontConfigDiskCache();
+
+  /**
+   * @brief Whether the cache has a file to use.
+   */
+  bool IsEnabled() const
+  {
+    return !mFilePath.empty();
+  }
+
+  /**
+   * @brief Maps the file, if it has been written for the given font config.
+   *
+   * Saves and drops the records of the previous font config first.
+   *
+   * @param[in] fontConfig The font config loaded.
+   * @param[in] customFontDirectories The font directories added by the application.
+   */
+  void Load(FcConfig* fontConfig, const FontPathList& customFontDirectories);
+
+  /**
+   * @brief Writes the mapped and new records to the file, if there are new records.
+   */
+  void Save();
+
+  /**
+   * @brief Finds the font matched to a font description.
+   *
+   * @param[in] type DEFAULT_FONT or VALIDATED_FONT.
+   * @param[in] request The font description given to fontconfig. Its path is ignored.
+   * @param[out] font The font matched.
+   * @param[out] characterSet The character set of the font. Needs to be destroyed by calling FcCharSetDestroy.
+   * @return @e true if the font and its character set are found.
+   */
+  bool FindFont(RecordType type, const FontDescription& request, FontDescription& font, FcCharSet*& characterSet) const;
+
+  /**
+   * @brief Caches the font matched to a font description.
+   *
+   * @param[in] type DEFAULT_FONT or VALIDATED_FONT.
+   * @param[in] request The font description given to fontconfig. Its path is ignored.
+   * @param[in] font The font matched.
+   * @param[in] characterSet The character set of the font.
+   */
+  void CacheFont(RecordType type, const FontDescription& request, const FontDescription& font, const FcCharSet* characterSet);
+
+  /**
+   * @brief Finds a list of fonts.
+   *
+   * @param[in] type SYSTEM_FONTS or FONT_LIST.
+   * @param[in] request The font description given to fontconfig. Its path is ignored.
+   * @param[out] fontList The fonts.
+   * @param[out] characterSetList The character sets of the fonts, or @e nullptr if they are not needed.
+   * Need to be destroyed by calling FcCharSetDestroy.
+   * @return @e true if the list is found.
+   */
+  bool FindFontList(RecordType type, const FontDescription& request, FontList& fontList, CharacterSetList* characterSetList) const;
+
+  /**
+   * @brief Caches a list of fonts.
+   *
+   * @param[in] type SYSTEM_FONTS or FONT_LIST.
+   * @param[in] request The font description given to fontconfig. Its path is ignored.
+   * @param[in] fontList The fonts.
+   * @param[in] characterSetList The character sets of the fonts, or @e nullptr.
+   */
+  void CacheFontList(RecordType type, const FontDescription& request, const FontList& fontList, const CharacterSetList* characterSetList);
+
+private:
+  /**
+   * @brief The bytes of a record, out of its key.
+   */
+  struct RecordData
+  {
+    const uint8_t* data;
+    std::size_t    size;
+  };
+
+  /**
+   * @brief Finds the bytes of a record, new or mapped.
+   */
+  bool FindRecord(const std::string& key, RecordData& record) const;
+
+  /**
+   * @brief Adds a record, to be saved.
+   */
+  void AddRecord(std::string&& key, std::vector<uint8_t>&& data);
+
+  /**
+   * @brief Caches the character set of a font in its own record, if it isn't yet.
+   */
+  void CacheCharacterSet(const FontDescription& font, const FcCharSet* characterSet);
+
+  /**
+   * @brief Finds the character set of a font.
+   * @return The character set, which needs to be destroyed by calling FcCharSetDestroy, or nullptr.
+   */
+  FcCharSet* FindCharacterSet(const FontDescription& font) const;
+
+  /**
+   * @brief Unmaps the file and drops all the records.
+   */
+  void Unload();
+
+  FontConfigDiskCache(const FontConfigDiskCache&)            = delete;
+  FontConfigDiskCache& operator=(const FontConfigDiskCache&) = delete;
+
+private:
+  std::string mFilePath; ///< Empty if the cache is disabled.
+  uint64_t    mStamp;    ///< The stamp of the font config loaded.
+
+  void*       mMappedAddress; ///< The file mapped, or nullptr.
+  std::size_t mMappedSize;
+
+  std::unordered_map<std::string, RecordData>           mMappedRecords; ///< Records in the mapped file, by key.
+  std::unordered_map<std::string, std::vector<uint8_t>> mNewRecords;    ///< Records added since the font config was loaded, by key.
+
+  mutable std::unordered_map<std::string, FcCharSet*> mCharacterSets; ///< Character sets decoded, by key. Fonts are in many lists.
+
+  bool mUnsaved; ///< Whether there are records to save.
+};
+
+} // namespace Dali::TextAbstraction::Internal
+
+#endif // DALI_INTERNAL_TEXT_ABSTRACTION_FONT_CONFIG_DISK_CACHE_H
@@ -22,6 +22,7 @@
 #include <dali/internal/system/common/environment-variables.h>
 #include <dali/internal/text/text-abstraction/plugin/font-client-utils.h>
 #include <dali/internal/text/text-abstraction/plugin/font-face-cache-item.h>
+#include <dali/internal/text/text-abstraction/plugin/shared-glyph-cache.h>
 #include <dali/internal/text/text-abstraction/plugin/color-glyph/color-glyph-colr-rasterizer.h>
 
 #if defined(DEBUG_ENABLED)
@@ -141,6 +142,7 @@ FontFaceCacheItem::FontFaceCacheItem(const FT_Library&                  freeType
   mColorFontInfo(colorFontInfo),
   mColorFontRenderability(colorFontRenderability),
   mVariationsHash(variationsHash),
+  mSharedFontKey(0u),
   mFreeTypeCoords(freeTypeCoords),
   mHarfBuzzVariations(harfBuzzVariations)
 {
@@ -182,6 +184,7 @@ FontFaceCacheItem::FontFaceCacheItem(const FT_Library&  freeTypeLibrary,
   mColorFontInfo(colorFontInfo),
   mColorFontRenderability(colorFontRenderability),
   mVariationsHash(0u),
+  mSharedFontKey(0u),
   mFreeTypeCoords(),
   mHarfBuzzVariations()
 {
@@ -212,6 +215,7 @@ FontFaceCacheItem::FontFaceCacheItem(FontFaceCacheItem&& rhs) noexcept
   mColorFontInfo      = rhs.mColorFontInfo;
   mColorFontRenderability = rhs.mColorFontRenderability;
   mVariationsHash     = rhs.mVariationsHash;
+  mSharedFontKey      = rhs.mSharedFontKey;
   mFreeTypeCoords     = std::move(rhs.mFreeTypeCoords);
   mHarfBuzzVariations = std::move(rhs.mHarfBuzzVariations);
 
@@ -650,6 +654,27 @@ void FontFaceCacheItem::CreateBitmap(
 
       const bool ableUseCachedRenderedGlyph = EnableCacheRenderedGlyph() && !isOutlineGlyph && !isShearRequired;
 
+      SharedGlyphCache&     sharedGlyphCache   = SharedGlyphCache::Get();
+      const bool            ableUseSharedGlyph = ableUseCachedRenderedGlyph && sharedGlyphCache.IsEnabled();
+      SharedGlyphCache::Key sharedGlyphKey;
+      if(ableUseSharedGlyph)
+      {
+        if(mSharedFontKey == 0u)
+        {
+          mSharedFontKey = SharedGlyphCache::GetFontKey(mPath, mFaceIndex);
+        }
+        sharedGlyphKey.fontKey            = mSharedFontKey;
+        sharedGlyphKey.variationsHash     = mVariationsHash;
+        sharedGlyphKey.requestedPointSize = mRequestedPointSize;
+        if(mFontFaceManager)
+        {
+          mFontFaceManager->GetDpi(sharedGlyphKey.horizontalDpi, sharedGlyphKey.verticalDpi);
+        }
+        sharedGlyphKey.index              = glyphIndex;
+        sharedGlyphKey.flag               = loadFlag;
+        sharedGlyphKey.isBoldRequired     = isBoldRequired;
+      }
+
       // If we cache rendered glyph, and if we can use it, use cached thing first.
       if(ableUseCachedRenderedGlyph && glyphData.mRenderedBuffer)
       {
@@ -660,6 +685,10 @@ void FontFaceCacheItem::CreateBitmap(
         data.compressionType = glyphData.mRenderedBuffer->compressionType;
         data.isBufferOwned   = false;
       }
+      else if(ableUseSharedGlyph && sharedGlyphCache.Find(sharedGlyphKey, data))
+      {
+        // Rendered by this or another process before.
+      }
       else
       {
         // Copy new glyph, and keep original cached glyph.
@@ -678,7 +707,20 @@ void FontFaceCacheItem::CreateBitmap(
 
           // If we can cache this bitmapGlyph, store it.
           // Note : We will call this API once per each glyph.
-          if(ableUseCachedRenderedGlyph)
+          // Keep the glyph in the shared cache only, so the processes don't each hold a copy.
+          bool isSharedGlyphCached = false;
+          if(ableUseSharedGlyph && !sharedGlyphCache.IsFull())
+          {
+            TextAbstraction::GlyphBufferData compressedData;
+            const std::size_t                compressedSize = GlyphCacheManager::CompressRenderedGlyphBuffer(bitmapGlyph->bitmap, GetRenderedGlyphCompressPolicy(), compressedData);
+            isSharedGlyphCached                             = sharedGlyphCache.Add(sharedGlyphKey, compressedData, compressedSize, data);
+          }
+
+          if(isSharedGlyphCached)
+          {
+            // data points to the shared glyph.
+          }
+          else if(ableUseCachedRenderedGlyph)
           {
             mGlyphCacheManager->CacheRenderedGlyphBuffer(mFreeTypeFace, mRequestedPointSize, glyphIndex, loadFlag, isBoldRequired, mVariationsHash, bitmapGlyph->bitmap, GetRenderedGlyphCompressPolicy());
 
@@ -729,6 +771,45 @@ void FontFaceCacheItem::CreateBitmap(
   }
 }
 
+bool FontFaceCacheItem::CreateDistanceFieldBitmap(GlyphIndex glyphIndex, Dali::TextAbstraction::GlyphBufferData& data, GlyphInfo& glyphInfo) const
+{
+  if(mIsFixedSizeBitmap)
+  {
+    // Fixed size bitmaps have no outline.
+    return false;
+  }
+
+  // The variations of the face are set with the size.
+  FT_Error error = mFontFaceManager->ActivateFace(mFreeTypeFace, mRequestedPointSize, mVariationsHash, mFreeTypeCoords);
+  if(DALI_UNLIKELY(error != FT_Err_Ok))
+  {
+    DALI_LOG_INFO(gFontClientLogFilter, Debug::General, "FontClient::Plugin::CreateDistanceFieldBitmap. ActivateFace fail\n");
+  }
+
+  GlyphCacheManager::DistanceFieldGlyphPtr distanceFieldGlyphPtr;
+  if(!mGlyphCacheManager->GetDistanceFieldGlyphFromIndex(mFreeTypeFace, glyphIndex, mVariationsHash, distanceFieldGlyphPtr))
+  {
+    return false;
+  }
+
+  const DistanceFieldGlyph& distanceFieldGlyph = *distanceFieldGlyphPtr.get();
+
+  data.buffer          = distanceFieldGlyph.mBuffer.buffer;
+  data.width           = distanceFieldGlyph.mBuffer.width;
+  data.height          = distanceFieldGlyph.mBuffer.height;
+  data.format          = Pixel::L8;
+  data.compressionType = TextAbstraction::GlyphBufferData::CompressionType::NO_COMPRESSION;
+  data.isBufferOwned   = false;
+
+  glyphInfo.width    = distanceFieldGlyph.mWidth;
+  glyphInfo.height   = distanceFieldGlyph.mHeight;
+  glyphInfo.xBearing = distanceFieldGlyph.mXBearing;
+  glyphInfo.yBearing = distanceFieldGlyph.mYBearing;
+  glyphInfo.advance  = distanceFieldGlyph.mAdvance;
+
+  return true;
+}
+
 bool FontFaceCacheItem::IsColorGlyph(GlyphIndex glyphIndex) const
 {
   // Policy: IsColorGlyph() returns true only when this glyph can actually
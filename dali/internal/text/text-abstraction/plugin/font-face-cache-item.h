@@ -2,7 +2,7 @@
 #define DALI_TEXT_ABSTRACTION_INTERNAL_FONT_FACE_CACHE_ITEM_H
 
 /*
- * Copyright (c) 2025 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -139,6 +139,11 @@ struct FontFaceCacheItem : public FontCacheItemInterface
    */
   void CreateBitmap(GlyphIndex glyphIndex, Dali::TextAbstraction::GlyphBufferData& data, int outlineWidth, bool isItalicRequired, bool isBoldRequired) const override;
 
+  /**
+   * @copydoc FontCacheItemInterface::CreateDistanceFieldBitmap()
+   */
+  bool CreateDistanceFieldBitmap(GlyphIndex glyphIndex, Dali::TextAbstraction::GlyphBufferData& data, GlyphInfo& glyphInfo) const override;
+
   /**
    * @copydoc FontCacheItemInterface::IsColorGlyph()
    */
@@ -232,6 +237,7 @@ public:
   FontFaceManager::ColorFontInfo           mColorFontInfo;          ///< Detected SFNT color table flags.
   FontFaceManager::ColorFontRenderability  mColorFontRenderability; ///< Current-build color renderability classification.
   std::size_t                 mVariationsHash;        ///< The hash of the variations to use key.
+  mutable uint64_t            mSharedFontKey;         ///< The key of the font in the SharedGlyphCache. 0 until the cache is used.
   std::vector<FT_Fixed>       mFreeTypeCoords;        ///< The FreeType coordinates for the variations.
   std::vector<hb_variation_t> mHarfBuzzVariations;    ///< The HarfBuzz variations data.
 };
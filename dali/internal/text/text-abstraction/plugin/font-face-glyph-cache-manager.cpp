@@ -39,7 +39,9 @@ constexpr uint32_t THRESHOLD_WIDTH_FOR_RLE4_COMPRESSION = 8; // The smallest wid
 
 GlyphCacheManager::GlyphCacheManager(std::size_t maxNumberOfGlyphCache)
 : mGlyphCacheMaxSize(maxNumberOfGlyphCache),
-  mLRUGlyphCache(mGlyphCacheMaxSize)
+  mLRUGlyphCache(mGlyphCacheMaxSize),
+  mLRUDistanceFieldGlyphCache(mGlyphCacheMaxSize),
+  mDistanceFieldGlyphGenerator()
 {
   DALI_LOG_INFO(gFontClientLogFilter, Debug::Verbose, "FontClient::Plugin::GlyphCacheManager Create with maximum size : %d\n", static_cast<int>(mGlyphCacheMaxSize));
 }
@@ -103,6 +105,49 @@ bool GlyphCacheManager::GetGlyphCacheDataFromIndex(
   }
 }
 
+bool GlyphCacheManager::GetDistanceFieldGlyphFromIndex(
+  const FT_Face          freeTypeFace,
+  const GlyphIndex       index,
+  const std::size_t      variationsHash,
+  DistanceFieldGlyphPtr& distanceFieldGlyphPtr)
+{
+  if(!DistanceFieldGlyphGenerator::IsSupported())
+  {
+    return false;
+  }
+
+  const GlyphCacheKey key  = GlyphCacheKey(freeTypeFace, 0u, index, 0, false, variationsHash);
+  auto                iter = mLRUDistanceFieldGlyphCache.Find(key);
+
+  if(iter != mLRUDistanceFieldGlyphCache.End())
+  {
+    distanceFieldGlyphPtr = mLRUDistanceFieldGlyphCache.GetElement(iter);
+    return true;
+  }
+
+  if(!mDistanceFieldGlyphGenerator)
+  {
+    mDistanceFieldGlyphGenerator.reset(new DistanceFieldGlyphGenerator());
+  }
+
+  distanceFieldGlyphPtr = std::make_shared<DistanceFieldGlyph>();
+  if(!mDistanceFieldGlyphGenerator->Generate(freeTypeFace, index, *distanceFieldGlyphPtr.get()))
+  {
+    distanceFieldGlyphPtr.reset();
+    return false;
+  }
+
+  // If cache size is full, remove oldest distance field.
+  if(mLRUDistanceFieldGlyphCache.IsFull())
+  {
+    mLRUDistanceFieldGlyphCache.Pop();
+  }
+  mLRUDistanceFieldGlyphCache.Push(key, distanceFieldGlyphPtr);
+
+  DALI_LOG_INFO(gFontClientLogFilter, Debug::Verbose, "FontClient::Plugin::GlyphCacheManager::GetDistanceFieldGlyphFromIndex. Create cache for face : %p, index : %u, size : %u x %u\n", freeTypeFace, index, distanceFieldGlyphPtr->mBuffer.width, distanceFieldGlyphPtr->mBuffer.height);
+  return true;
+}
+
 void GlyphCacheManager::ResizeBitmapGlyph(
   const FT_Face         freeTypeFace,
   const PointSize26Dot6 requestedPointSize,
@@ -250,74 +295,81 @@ void GlyphCacheManager::CacheRenderedGlyphBuffer(
         return;
       }
 
-      TextAbstraction::GlyphBufferData& renderBuffer = *glyphData.mRenderedBuffer;
+      if(DALI_UNLIKELY(CompressRenderedGlyphBuffer(srcBitmap, policy, *glyphData.mRenderedBuffer) == 0u))
+      {
+        delete glyphData.mRenderedBuffer;
+        glyphData.mRenderedBuffer = nullptr;
+      }
+    }
+  }
+}
 
-      // Set basic informations.
-      renderBuffer.width  = srcBitmap.width;
-      renderBuffer.height = srcBitmap.rows;
+std::size_t GlyphCacheManager::CompressRenderedGlyphBuffer(
+  const FT_Bitmap&                  srcBitmap,
+  const CompressionPolicyType       policy,
+  TextAbstraction::GlyphBufferData& renderBuffer)
+{
+  if(srcBitmap.width * srcBitmap.rows <= 0)
+  {
+    return 0u;
+  }
 
-      switch(srcBitmap.pixel_mode)
-      {
-        case FT_PIXEL_MODE_GRAY:
-        {
-          renderBuffer.format = Pixel::L8;
+  // Set basic informations.
+  renderBuffer.width  = srcBitmap.width;
+  renderBuffer.height = srcBitmap.rows;
 
-          if(policy == CompressionPolicyType::SPEED)
-          {
-            // If policy is SPEED, we will not compress bitmap.
-            renderBuffer.compressionType = TextAbstraction::GlyphBufferData::CompressionType::NO_COMPRESSION;
-          }
-          else
-          {
-            // If small enough glyph, compress as BPP4 method.
-            if(srcBitmap.width < THRESHOLD_WIDTH_FOR_RLE4_COMPRESSION)
-            {
-              renderBuffer.compressionType = TextAbstraction::GlyphBufferData::CompressionType::BPP_4;
-            }
-            else
-            {
-              renderBuffer.compressionType = TextAbstraction::GlyphBufferData::CompressionType::RLE_4;
-            }
-          }
+  switch(srcBitmap.pixel_mode)
+  {
+    case FT_PIXEL_MODE_GRAY:
+    {
+      renderBuffer.format = Pixel::L8;
 
-          const auto compressedBufferSize = TextAbstraction::GlyphBufferData::Compress(srcBitmap.buffer, renderBuffer);
-          if(DALI_UNLIKELY(compressedBufferSize == 0u))
-          {
-            DALI_ASSERT_DEBUG(0 == "Compress failed at FT_PIXEL_MODE_GRAY");
-            DALI_LOG_ERROR("Compress failed. Ignore cache\n");
-            delete glyphData.mRenderedBuffer;
-            glyphData.mRenderedBuffer = nullptr;
-            return;
-          }
-          break;
-        }
-#ifdef FREETYPE_BITMAP_SUPPORT
-        case FT_PIXEL_MODE_BGRA:
+      if(policy == CompressionPolicyType::SPEED)
+      {
+        // If policy is SPEED, we will not compress bitmap.
+        renderBuffer.compressionType = TextAbstraction::GlyphBufferData::CompressionType::NO_COMPRESSION;
+      }
+      else
+      {
+        // If small enough glyph, compress as BPP4 method.
+        if(srcBitmap.width < THRESHOLD_WIDTH_FOR_RLE4_COMPRESSION)
         {
-          // Copy buffer without compress
-          renderBuffer.compressionType = TextAbstraction::GlyphBufferData::CompressionType::NO_COMPRESSION;
-          renderBuffer.format          = Pixel::BGRA8888;
-
-          const auto compressedBufferSize = TextAbstraction::GlyphBufferData::Compress(srcBitmap.buffer, renderBuffer);
-          if(DALI_UNLIKELY(compressedBufferSize == 0u))
-          {
-            DALI_ASSERT_DEBUG(0 == "Compress failed at FT_PIXEL_MODE_BGRA");
-            DALI_LOG_ERROR("Compress failed. Ignore cache\n");
-            delete glyphData.mRenderedBuffer;
-            glyphData.mRenderedBuffer = nullptr;
-            return;
-          }
-          break;
+          renderBuffer.compressionType = TextAbstraction::GlyphBufferData::CompressionType::BPP_4;
         }
-#endif
-        default:
+        else
         {
-          DALI_LOG_INFO(gFontClientLogFilter, Debug::General, "FontClient::Plugin::GlyphCacheManager::CacheRenderedGlyphBuffer. FontClient Unable to create Bitmap of this PixelType\n");
-          delete glyphData.mRenderedBuffer;
-          glyphData.mRenderedBuffer = nullptr;
-          break;
+          renderBuffer.compressionType = TextAbstraction::GlyphBufferData::CompressionType::RLE_4;
         }
       }
+
+      const auto compressedBufferSize = TextAbstraction::GlyphBufferData::Compress(srcBitmap.buffer, renderBuffer);
+      if(DALI_UNLIKELY(compressedBufferSize == 0u))
+      {
+        DALI_ASSERT_DEBUG(0 == "Compress failed at FT_PIXEL_MODE_GRAY");
+        DALI_LOG_ERROR("Compress failed. Ignore cache\n");
+      }
+      return compressedBufferSize;
+    }
+#ifdef FREETYPE_BITMAP_SUPPORT
+    case FT_PIXEL_MODE_BGRA:
+    {
+      // Copy buffer without compress
+      renderBuffer.compressionType = TextAbstraction::GlyphBufferData::CompressionType::NO_COMPRESSION;
+      renderBuffer.format          = Pixel::BGRA8888;
+
+      const auto compressedBufferSize = TextAbstraction::GlyphBufferData::Compress(srcBitmap.buffer, renderBuffer);
+      if(DALI_UNLIKELY(compressedBufferSize == 0u))
+      {
+        DALI_ASSERT_DEBUG(0 == "Compress failed at FT_PIXEL_MODE_BGRA");
+        DALI_LOG_ERROR("Compress failed. Ignore cache\n");
+      }
+      return compressedBufferSize;
+    }
+#endif
+    default:
+    {
+      DALI_LOG_INFO(gFontClientLogFilter, Debug::General, "FontClient::Plugin::GlyphCacheManager::CompressRenderedGlyphBuffer. FontClient Unable to create Bitmap of this PixelType\n");
+      return 0u;
     }
   }
 }
@@ -435,6 +487,19 @@ void GlyphCacheManager::RemoveGlyphFromFace(const FT_Face freeTypeFace)
     }
   }
 
+  auto distanceFieldEndIter = mLRUDistanceFieldGlyphCache.End();
+  for(auto iter = mLRUDistanceFieldGlyphCache.Begin(); iter != distanceFieldEndIter;)
+  {
+    if(mLRUDistanceFieldGlyphCache.GetKey(iter).mFreeTypeFace == freeTypeFace)
+    {
+      iter = mLRUDistanceFieldGlyphCache.Erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+
   DALI_LOG_INFO(gFontClientLogFilter, Debug::Verbose, "FontClient::Plugin::GlyphCacheManager::RemoveGlyphFromFace. Remove all cached glyph with face : %p, removed glyph count : %u\n", freeTypeFace, removedItemCount);
 }
 
@@ -444,6 +509,7 @@ void GlyphCacheManager::ClearCache(const std::size_t remainCount)
   {
     // Clear all cache.
     mLRUGlyphCache.Clear();
+    mLRUDistanceFieldGlyphCache.Clear();
   }
   else
   {
@@ -454,6 +520,10 @@ void GlyphCacheManager::ClearCache(const std::size_t remainCount)
 
       DALI_LOG_INFO(gFontClientLogFilter, Debug::Verbose, "FontClient::Plugin::GlyphCacheManager::ClearCache[%zu / %zu]. Remove oldest cache for glyph : %p\n", mLRUGlyphCache.Count(), remainCount, removedData->mGlyph);
     }
+    while(mLRUDistanceFieldGlyphCache.Count() > remainCount)
+    {
+      mLRUDistanceFieldGlyphCache.Pop();
+    }
   }
 }
 
@@ -2,7 +2,7 @@
 #define DALI_TEST_ABSTRACTION_INTERNAL_FONT_FACE_GLYPH_CACHE_MANAGER_H
 
 /*
- * Copyright (c) 2025 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 // INTERNAL INCLUDES
 #include <dali/devel-api/text-abstraction/glyph-buffer-data.h>
 #include <dali/devel-api/text-abstraction/text-abstraction-definitions.h>
+#include <dali/internal/text/text-abstraction/plugin/distance-field-glyph-generator.h>
 #include <dali/internal/text/text-abstraction/plugin/lru-cache-container.h>
 
 // EXTERNAL INCLUDES
@@ -88,6 +89,8 @@ public:
 
   using GlyphCacheDataPtr = std::shared_ptr<GlyphCacheData>;
 
+  using DistanceFieldGlyphPtr = std::shared_ptr<DistanceFieldGlyph>;
+
   // Compression priority of rendered glyph buffer.
   enum class CompressionPolicyType
   {
@@ -122,6 +125,21 @@ public:
     GlyphCacheDataPtr&    glyphDataPtr,
     FT_Error&             error);
 
+  /**
+   * @brief Load the distance field of a glyph. The result will be cached, for every point size.
+   *
+   * @param[in] freeTypeFace The freetype face handle, with its variations set.
+   * @param[in] index Index of glyph in this face.
+   * @param[in] variationsHash The hash of the variations to use key.
+   * @param[out] distanceFieldGlyphPtr Result of pointer of distance field.
+   * @return True if load successfully. False if the glyph has no outline, or the distance fields aren't supported.
+   */
+  bool GetDistanceFieldGlyphFromIndex(
+    const FT_Face          freeTypeFace,
+    const GlyphIndex       index,
+    const std::size_t      variationsHash,
+    DistanceFieldGlyphPtr& distanceFieldGlyphPtr);
+
   /**
    * @brief Resize bitmap glyph. The result will change cached glyph bitmap information.
    * If glyph is not bitmap glyph, nothing happened.
@@ -168,6 +186,19 @@ public:
     const FT_Bitmap&            srcBitmap,
     const CompressionPolicyType policy);
 
+  /**
+   * @brief Compress rendered glyph bitmap into a glyph buffer, the way CacheRenderedGlyphBuffer does.
+   *
+   * @param[in] srcBitmap Rendered glyph bitmap.
+   * @param[in] policy Compress behavior policy.
+   * @param[out] renderBuffer The compressed glyph buffer, which owns its buffer.
+   * @return The size of the compressed buffer, or 0 if the bitmap can't be compressed.
+   */
+  static std::size_t CompressRenderedGlyphBuffer(
+    const FT_Bitmap&                  srcBitmap,
+    const CompressionPolicyType       policy,
+    TextAbstraction::GlyphBufferData& renderBuffer);
+
   /**
    * @brief Cache external BGRA bitmap as rendered glyph buffer.
    * @note For injecting externally rasterized color glyph bitmaps (e.g., COLRv1).
@@ -298,9 +329,13 @@ private:
   // Private member value area.
   std::size_t mGlyphCacheMaxSize; ///< The maximum capacity of glyph cache.
 
-  using CacheContainer = LRUCacheContainer<GlyphCacheKey, GlyphCacheDataPtr, GlyphCacheKeyHash>;
+  using CacheContainer              = LRUCacheContainer<GlyphCacheKey, GlyphCacheDataPtr, GlyphCacheKeyHash>;
+  using DistanceFieldCacheContainer = LRUCacheContainer<GlyphCacheKey, DistanceFieldGlyphPtr, GlyphCacheKeyHash>;
+
+  CacheContainer              mLRUGlyphCache;              ///< LRU Cache container of glyph
+  DistanceFieldCacheContainer mLRUDistanceFieldGlyphCache; ///< LRU Cache container of distance field glyph. Keyed without point size and flag.
 
-  CacheContainer mLRUGlyphCache; ///< LRU Cache container of glyph
+  std::unique_ptr<DistanceFieldGlyphGenerator> mDistanceFieldGlyphGenerator; ///< Created when the first distance field is loaded.
 };
 
 } // namespace Dali::TextAbstraction::Internal
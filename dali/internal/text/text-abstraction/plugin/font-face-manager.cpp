@@ -105,6 +105,12 @@ void FontFaceManager::SetDpi(const uint32_t dpiHorizontal, const uint32_t dpiVer
   mDpiVertical   = dpiVertical;
 }
 
+void FontFaceManager::GetDpi(uint32_t& dpiHorizontal, uint32_t& dpiVertical) const
+{
+  dpiHorizontal = mDpiHorizontal;
+  dpiVertical   = mDpiVertical;
+}
+
 FT_Error FontFaceManager::LoadFace(const FT_Library& freeTypeLibrary, const FontPath& fontPath, const FaceIndex faceIndex, FT_Face& ftFace)
 {
   FT_Error error;
@@ -238,6 +238,14 @@ public:
    */
   void SetDpi(const uint32_t dpiHorizontal, const uint32_t dpiVertical);
 
+  /**
+   * @brief Retrieves the DPI for horizontal and vertical dimensions.
+   *
+   * @param[out] dpiHorizontal The horizontal DPI.
+   * @param[out] dpiVertical The vertical DPI.
+   */
+  void GetDpi(uint32_t& dpiHorizontal, uint32_t& dpiVertical) const;
+
   /**
    * @brief Loads a FreeType face from a font file.
    * @note The basic strategy of LoadFace is to create only one freetype face per font file.
@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali/internal/text/text-abstraction/plugin/glyph-batch-rasterizer.h>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/integration-api/debug.h>
+#include <dali/internal/system/common/environment-variables.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdlib>
+#include <thread>
+#include <unordered_map>
+
+#if defined(DEBUG_ENABLED)
+extern Dali::Integration::Log::Filter* gFontClientLogFilter;
+#endif
+
+namespace Dali::TextAbstraction::Internal
+{
+namespace
+{
+constexpr uint32_t    DEFAULT_MAXIMUM_NUMBER_OF_THREADS  = 4u;   ///< Glyphs are small, more threads mostly wait for the jobs.
+constexpr uint32_t    MAXIMUM_NUMBER_OF_THREADS          = 16u;
+constexpr std::size_t MINIMUM_NUMBER_OF_JOBS_FOR_WORKERS = 16u;  ///< Below that, waking the threads costs more than rendering.
+constexpr std::size_t WORKER_FACE_SIZE_CACHE_MAX         = 16u;  ///< Face sizes activated by a worker.
+constexpr std::size_t WORKER_GLYPH_CACHE_MAX             = 128u; ///< Glyphs loaded by a worker.
+constexpr std::size_t WORKER_FONT_CACHE_MAX              = 64u;  ///< Fonts of the FontClient copied by a worker.
+
+/**
+ * @brief Get the number of threads from environment.
+ * If not set, one less than the number of cores, up to DEFAULT_MAXIMUM_NUMBER_OF_THREADS.
+ * @note This value fixed when we call it first time.
+ * @return The number of threads.
+ */
+uint32_t GetNumberOfThreads()
+{
+  static auto numberString = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_GLYPH_RASTERIZER_THREAD_COUNT);
+  if(numberString)
+  {
+    return std::min(static_cast<uint32_t>(std::strtoul(numberString, nullptr, 10)), MAXIMUM_NUMBER_OF_THREADS);
+  }
+
+  const uint32_t numberOfCores = std::thread::hardware_concurrency();
+  return std::min(numberOfCores > 1u ? numberOfCores - 1u : 0u, DEFAULT_MAXIMUM_NUMBER_OF_THREADS);
+}
+
+/**
+ * @brief Renders the glyph of a job with a font, and makes its bitmap owned.
+ */
+void Render(const GlyphBatchRasterizer::Job& job, const FontFaceCacheItem* fontFaceCacheItem)
+{
+  TextAbstraction::GlyphBufferData& data = *job.data;
+
+  data.isColorBitmap = false;
+  data.isColorEmoji  = false;
+  if(fontFaceCacheItem)
+  {
+    const auto& request = *job.request;
+    fontFaceCacheItem->CreateBitmap(request.glyphIndex, data, request.outlineWidth, request.isItalicRequired, request.isBoldRequired);
+  }
+
+  GlyphBatchRasterizer::MakeOwnedBitmap(data);
+}
+
+} // namespace
+
+/**
+ * @brief The faces and the caches of a worker thread.
+ */
+struct GlyphBatchRasterizer::Worker
+{
+  Worker()
+  : mFreeTypeLibrary(nullptr),
+    mFontFaceManager(new FontFaceManager(WORKER_FACE_SIZE_CACHE_MAX)),
+    mGlyphCacheManager(new GlyphCacheManager(WORKER_GLYPH_CACHE_MAX)),
+    mFontFaceCache()
+  {
+    FT_Error error = FT_Init_FreeType(&mFreeTypeLibrary);
+    if(DALI_UNLIKELY(FT_Err_Ok != error))
+    {
+      DALI_LOG_ERROR("FreeType Init error: %d\n", error);
+      mFreeTypeLibrary = nullptr;
+    }
+  }
+
+  ~Worker()
+  {
+    ClearCache();
+
+    mGlyphCacheManager.reset();
+    mFontFaceManager.reset();
+    if(mFreeTypeLibrary)
+    {
+      FT_Done_FreeType(mFreeTypeLibrary);
+    }
+  }
+
+  /**
+   * @brief Releases the fonts, then their faces.
+   */
+  void ClearCache()
+  {
+    mFontFaceCache.clear();
+    mGlyphCacheManager->ClearCache();
+    mFontFaceManager->ClearCache();
+  }
+
+  /**
+   * @brief Retrieves the copy of a font of the FontClient, creating it if needed.
+   *
+   * @param[in] fontId The identifier of the font.
+   * @param[in] font The font of the FontClient.
+   * @return The font of the worker, or nullptr if its face can't be loaded.
+   */
+  const FontFaceCacheItem* GetFont(FontId fontId, const FontFaceCacheItem& font)
+  {
+    auto iter = mFontFaceCache.find(fontId);
+    if(iter != mFontFaceCache.end())
+    {
+      const FontFaceCacheItem& item = iter->second;
+      if(item.mRequestedPointSize == font.mRequestedPointSize &&
+         item.mVariationsHash == font.mVariationsHash &&
+         item.mFaceIndex == font.mFaceIndex &&
+         item.mPath == font.mPath)
+      {
+        return &item;
+      }
+
+      // The FontClient has given the id to another font.
+      mFontFaceCache.erase(iter);
+    }
+
+    if(mFontFaceCache.size() >= WORKER_FONT_CACHE_MAX)
+    {
+      mFontFaceCache.clear();
+    }
+
+    FT_Face ftFace = nullptr;
+    if(!mFreeTypeLibrary || (FT_Err_Ok != mFontFaceManager->LoadFace(mFreeTypeLibrary, font.mPath, font.mFaceIndex, ftFace)))
+    {
+      DALI_LOG_INFO(gFontClientLogFilter, Debug::General, "FontClient::Plugin::GlyphBatchRasterizer. Can't load face : %s\n", font.mPath.c_str());
+      return nullptr;
+    }
+
+    // The COLRv1 fonts are not rendered by the workers, so they don't need a rasterizer.
+    FontFaceCacheItem fontFaceCacheItem(mFreeTypeLibrary, ftFace, mFontFaceManager.get(), mGlyphCacheManager.get(), nullptr, font.mPath, font.mRequestedPointSize, font.mFaceIndex, font.mMetrics, font.mVariationsHash, font.mFreeTypeCoords, font.mHarfBuzzVariations, font.mHasColorTables, font.mColorFontInfo, font.mColorFontRenderability);
+    fontFaceCacheItem.mFontId = font.mFontId;
+
+    auto result = mFontFaceCache.emplace(fontId, std::move(fontFaceCacheItem));
+    mFontFaceManager->ReferenceFace(font.mPath);
+
+    return &result.first->second;
+  }
+
+  /**
+   * @brief Renders the glyph of a job with the faces of the worker.
+   */
+  void Render(const Job& job)
+  {
+    Internal::Render(job, GetFont(job.request->fontId, *job.fontFaceCacheItem));
+  }
+
+  FT_Library                         mFreeTypeLibrary;   ///< The FreeType library of the worker.
+  std::unique_ptr<FontFaceManager>   mFontFaceManager;   ///< The faces of the worker.
+  std::unique_ptr<GlyphCacheManager> mGlyphCacheManager; ///< The glyphs of the worker.
+
+  std::unordered_map<FontId, FontFaceCacheItem> mFontFaceCache; ///< The fonts of the worker, by the FontId of the FontClient.
+};
+
+GlyphBatchRasterizer::GlyphBatchRasterizer()
+: mWorkers(),
+  mThreadPool(),
+  mFutures(),
+  mJobs(),
+  mNextJob(0u),
+  mIsInitialized(false)
+{
+}
+
+GlyphBatchRasterizer::~GlyphBatchRasterizer() = default;
+
+bool GlyphBatchRasterizer::IsParallelizable(const FontFaceCacheItem& fontFaceCacheItem)
+{
+  return !fontFaceCacheItem.mIsFixedSizeBitmap &&
+         (fontFaceCacheItem.mColorFontRenderability != FontFaceManager::ColorFontRenderability::RenderableColrV1);
+}
+
+void GlyphBatchRasterizer::MakeOwnedBitmap(TextAbstraction::GlyphBufferData& data)
+{
+  if(data.isBufferOwned && data.compressionType == TextAbstraction::GlyphBufferData::CompressionType::NO_COMPRESSION)
+  {
+    return;
+  }
+
+  uint8_t* newBuffer = nullptr;
+
+  const std::size_t bufferSize = static_cast<std::size_t>(data.width) * data.height * Pixel::GetBytesPerPixel(data.format);
+  if(data.buffer && bufferSize > 0u)
+  {
+    newBuffer = static_cast<uint8_t*>(malloc(bufferSize));
+    if(DALI_UNLIKELY(!newBuffer))
+    {
+      DALI_LOG_ERROR("malloc is failed. request malloc size : %u x %u x %u\n", data.width, data.height, Pixel::GetBytesPerPixel(data.format));
+    }
+    else
+    {
+      TextAbstraction::GlyphBufferData::Decompress(data, newBuffer);
+    }
+  }
+
+  if(data.isBufferOwned)
+  {
+    free(data.buffer);
+  }
+
+  data.buffer          = newBuffer;
+  data.isBufferOwned   = (newBuffer != nullptr);
+  data.compressionType = TextAbstraction::GlyphBufferData::CompressionType::NO_COMPRESSION;
+  if(!newBuffer)
+  {
+    data.width  = 0u;
+    data.height = 0u;
+  }
+}
+
+uint32_t GlyphBatchRasterizer::Initialize(const TextAbstraction::FontFileManager& fontFileManager, uint32_t dpiHorizontal, uint32_t dpiVertical)
+{
+  if(!mIsInitialized)
+  {
+    mIsInitialized = true;
+
+    const uint32_t numberOfThreads = GetNumberOfThreads();
+    if(numberOfThreads > 0u && mThreadPool.Initialize(numberOfThreads))
+    {
+      for(uint32_t index = 0u; index < numberOfThreads; ++index)
+      {
+        mWorkers.emplace_back(new Worker());
+      }
+    }
+    DALI_LOG_INFO(gFontClientLogFilter, Debug::General, "FontClient::Plugin::GlyphBatchRasterizer. %zu threads\n", mWorkers.size());
+  }
+
+  // The dpi may have changed since the previous batch.
+  for(auto& worker : mWorkers)
+  {
+    worker->mFontFaceManager->SetFontFileManager(fontFileManager);
+    worker->mFontFaceManager->SetDpi(dpiHorizontal, dpiVertical);
+  }
+
+  return static_cast<uint32_t>(mWorkers.size());
+}
+
+void GlyphBatchRasterizer::Start(std::vector<Job>&& jobs, const TextAbstraction::FontFileManager& fontFileManager, uint32_t dpiHorizontal, uint32_t dpiVertical)
+{
+  mJobs    = std::move(jobs);
+  mNextJob = 0u;
+
+  if(mJobs.size() < MINIMUM_NUMBER_OF_JOBS_FOR_WORKERS)
+  {
+    return;
+  }
+
+  const uint32_t numberOfWorkers = Initialize(fontFileManager, dpiHorizontal, dpiVertical);
+  for(uint32_t workerIndex = 0u; workerIndex < numberOfWorkers; ++workerIndex)
+  {
+    // Each worker takes the next job until none is left, so the threads stay busy whatever the size of the glyphs.
+    mFutures.emplace_back(mThreadPool.SubmitTask(workerIndex, Task([this, workerIndex](uint32_t) {
+      Worker&           worker       = *mWorkers[workerIndex];
+      const std::size_t numberOfJobs = mJobs.size();
+      for(std::size_t index = mNextJob++; index < numberOfJobs; index = mNextJob++)
+      {
+        worker.Render(mJobs[index]);
+      }
+    })));
+  }
+}
+
+void GlyphBatchRasterizer::Finish()
+{
+  // The calling thread renders with the fonts of the FontClient.
+  const std::size_t numberOfJobs = mJobs.size();
+  for(std::size_t index = mNextJob++; index < numberOfJobs; index = mNextJob++)
+  {
+    const Job& job = mJobs[index];
+    Render(job, job.fontFaceCacheItem);
+  }
+
+  for(auto& future : mFutures)
+  {
+    future->Wait();
+  }
+
+  mFutures.clear();
+  mJobs.clear();
+}
+
+void GlyphBatchRasterizer::ClearCache()
+{
+  for(auto& worker : mWorkers)
+  {
+    worker->ClearCache();
+  }
+}
+
+} // namespace Dali::TextAbstraction::Internal
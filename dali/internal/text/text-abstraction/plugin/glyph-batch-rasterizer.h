@@ -0,0 +1,134 @@
+#ifndef DALI_TEXT_ABSTRACTION_INTERNAL_GLYPH_BATCH_RASTERIZER_H
+#define DALI_TEXT_ABSTRACTION_INTERNAL_GLYPH_BATCH_RASTERIZER_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/text-abstraction/font-client.h>
+#include <dali/devel-api/text-abstraction/font-file-manager.h>
+#include <dali/devel-api/text-abstraction/glyph-buffer-data.h>
+#include <dali/internal/text/text-abstraction/plugin/font-face-cache-item.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/threading/thread-pool.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace Dali::TextAbstraction::Internal
+{
+/**
+ * @brief Rasterizes the glyphs of a FontClient::CreateBitmaps() call in parallel.
+ *
+ * FreeType faces can't be used by many threads at once, so each worker thread has its own
+ * FT_Library, FontFaceManager and GlyphCacheManager, and its own FontFaceCacheItem for each font,
+ * created from the FontFaceCacheItem of the FontClient the first time the worker renders a glyph
+ * of the font. The calling thread renders glyphs too, with the FontFaceCacheItems of the FontClient.
+ *
+ * Only the glyphs of scalable fonts are rendered in parallel, see IsParallelizable().
+ * The workers keep their faces until ClearCache() is called, which is needed whenever the
+ * fonts of the FontClient are removed, as the FontIds may then be given to other fonts.
+ */
+class GlyphBatchRasterizer
+{
+public:
+  /**
+   * @brief A glyph to rasterize.
+   */
+  struct Job
+  {
+    const FontFaceCacheItem*                          fontFaceCacheItem; ///< The font of the FontClient.
+    const TextAbstraction::FontClient::BitmapRequest* request;           ///< The glyph.
+    TextAbstraction::GlyphBufferData*                 data;              ///< The bitmap to fill.
+  };
+
+  /**
+   * @brief Constructor. The threads are created by the first Start() which needs them.
+   */
+  GlyphBatchRasterizer();
+
+  /**
+   * @brief Destructor. Stops the threads and releases their faces.
+   */
+  ~GlyphBatchRasterizer();
+
+  /**
+   * @brief Whether the glyphs of a font can be rendered by the workers.
+   *
+   * Fixed size bitmap fonts and COLRv1 fonts are rendered by the calling thread,
+   * as they use caches of the FontClient which are not duplicated for the workers.
+   *
+   * @param[in] fontFaceCacheItem The font.
+   * @return @e true if the workers can render the glyphs.
+   */
+  static bool IsParallelizable(const FontFaceCacheItem& fontFaceCacheItem);
+
+  /**
+   * @brief Makes the buffer of a bitmap owned and not compressed, if it isn't yet.
+   *
+   * @param[in,out] data The bitmap.
+   */
+  static void MakeOwnedBitmap(TextAbstraction::GlyphBufferData& data);
+
+  /**
+   * @brief Starts rendering glyphs on the worker threads.
+   *
+   * Small batches are only rendered by the calling thread, in Finish().
+   *
+   * @param[in] jobs The glyphs. Their fonts and bitmaps must be valid until Finish() returns.
+   * @param[in] fontFileManager The font file manager of the FontClient, which the workers load the faces from.
+   * @param[in] dpiHorizontal The horizontal dpi of the FontClient.
+   * @param[in] dpiVertical The vertical dpi of the FontClient.
+   */
+  void Start(std::vector<Job>&& jobs, const TextAbstraction::FontFileManager& fontFileManager, uint32_t dpiHorizontal, uint32_t dpiVertical);
+
+  /**
+   * @brief Renders the glyphs not taken by the workers on the calling thread, and waits for the workers.
+   *
+   * The bitmaps are owned and not compressed once this returns.
+   */
+  void Finish();
+
+  /**
+   * @brief Releases the faces of the workers.
+   */
+  void ClearCache();
+
+private:
+  struct Worker;
+
+  /**
+   * @brief Creates the threads and their workers, once.
+   * @return The number of workers.
+   */
+  uint32_t Initialize(const TextAbstraction::FontFileManager& fontFileManager, uint32_t dpiHorizontal, uint32_t dpiVertical);
+
+  GlyphBatchRasterizer(const GlyphBatchRasterizer&)            = delete;
+  GlyphBatchRasterizer& operator=(const GlyphBatchRasterizer&) = delete;
+
+private:
+  std::vector<std::unique_ptr<Worker>> mWorkers;    ///< A worker per thread. Destroyed after the threads are stopped.
+  Dali::ThreadPool                     mThreadPool; ///< Created by the first Start() which needs it.
+  std::vector<Dali::SharedFuture>      mFutures;    ///< The tasks of the workers, for the current batch.
+  std::vector<Job>                     mJobs;       ///< The current batch.
+  std::atomic<std::size_t>             mNextJob;    ///< The index of the next job to render.
+  bool                                 mIsInitialized : 1;
+};
+
+} // namespace Dali::TextAbstraction::Internal
+
+#endif // DALI_TEXT_ABSTRACTION_INTERNAL_GLYPH_BATCH_RASTERIZER_H
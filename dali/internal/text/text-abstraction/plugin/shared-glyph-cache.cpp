@@ -0,0 +1,406 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/text/text-abstraction/plugin/shared-glyph-cache.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/images/pixel.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <atomic>
+#include <cinttypes>
+#include <cstring>
+#include <limits>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/internal/system/common/environment-variables.h>
+
+#if defined(DEBUG_ENABLED)
+extern Dali::Integration::Log::Filter* gFontClientLogFilter;
+#endif
+
+namespace Dali::TextAbstraction::Internal
+{
+namespace
+{
+constexpr uint32_t FILE_MAGIC   = 0x43474453u; ///< "SDGC"
+constexpr uint32_t FILE_VERSION = 2u;          ///< Change it when the layout of the file changes.
+
+constexpr std::size_t BYTES_PER_MEGABYTE              = 1024u * 1024u;
+constexpr std::size_t AVERAGE_GLYPH_BUFFER_SIZE       = 256u; ///< Used to share the file between the slots and the buffers. Glyphs are RLE4 compressed mostly.
+constexpr uint32_t    MINIMUM_NUMBER_OF_SLOTS         = 1024u;
+constexpr uint32_t    MAXIMUM_PROBE_LENGTH            = 32u; ///< Slots looked at before giving up.
+constexpr uint32_t    MAXIMUM_LOAD_FACTOR_NUMERATOR   = 3u;  ///< The cache is full once 3/4 of the slots are used.
+constexpr uint32_t    MAXIMUM_LOAD_FACTOR_DENOMINATOR = 4u;
+constexpr std::size_t BUFFER_ALIGNMENT                = 8u;
+
+enum SlotState : uint32_t
+{
+  EMPTY   = 0u,
+  WRITING = 1u, ///< Claimed by a writer, not readable yet.
+  READY   = 2u
+};
+
+/**
+ * @brief Get the size of the shared glyph cache file from environment. 0, the default, disables the cache.
+ * @return The size in bytes.
+ */
+std::size_t GetSharedGlyphCacheSize()
+{
+  const char* sizeString = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_SHARED_GLYPH_CACHE_SIZE);
+  return sizeString ? std::strtoul(sizeString, nullptr, 10) * BYTES_PER_MEGABYTE : 0u;
+}
+
+std::string GetSharedGlyphCachePath()
+{
+  const char* path = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_SHARED_GLYPH_CACHE_PATH);
+  if(path)
+  {
+    return std::string(path);
+  }
+  return std::string("/dev/shm/dali-glyph-cache-") + std::to_string(getuid());
+}
+
+uint64_t HashBytes(uint64_t hash, const void* data, std::size_t size)
+{
+  // FNV-1a
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+  for(std::size_t index = 0u; index < size; ++index)
+  {
+    hash = (hash ^ bytes[index]) * 1099511628211ull;
+  }
+  return hash;
+}
+
+} // namespace
+
+/**
+ * @brief The start of the file.
+ */
+struct SharedGlyphCache::Header
+{
+  uint32_t              magic;
+  uint32_t              version;
+  uint64_t              fileSize;
+  uint32_t              numberOfSlots; ///< A power of two.
+  std::atomic<uint32_t> slotsUsed;     ///< Slots claimed by the writers.
+  uint64_t              buffersSize;
+  std::atomic<uint64_t> buffersUsed; ///< Bytes of the buffers claimed by the writers.
+};
+
+/**
+ * @brief An entry of the table. Everything but the state is written before the state becomes READY.
+ */
+struct SharedGlyphCache::Slot
+{
+  std::atomic<uint32_t> state;
+  uint32_t              bufferSize;
+  uint64_t              bufferOffset;
+  uint64_t              fontKey;
+  uint64_t              variationsHash;
+  uint32_t              requestedPointSize;
+  uint32_t              horizontalDpi;
+  uint32_t              verticalDpi;
+  uint32_t              index;
+  int32_t               flag;
+  uint32_t              width;
+  uint32_t              height;
+  uint8_t               isBoldRequired;
+  uint8_t               format;
+  uint8_t               compressionType;
+  uint8_t               padding;
+
+  bool Matches(const SharedGlyphCache::Key& key) const
+  {
+    return fontKey == key.fontKey && variationsHash == key.variationsHash && requestedPointSize == key.requestedPointSize &&
+           horizontalDpi == key.horizontalDpi && verticalDpi == key.verticalDpi && index == key.index && flag == key.flag &&
+           isBoldRequired == static_cast<uint8_t>(key.isBoldRequired);
+  }
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<uint32_t>::is_always_lock_free, "The shared glyph cache needs address-free atomics");
+
+namespace
+{
+uint64_t HashKey(const SharedGlyphCache::Key& key)
+{
+  uint64_t hash = 14695981039346656037ull;
+  hash          = HashBytes(hash, &key.fontKey, sizeof(key.fontKey));
+  hash          = HashBytes(hash, &key.variationsHash, sizeof(key.variationsHash));
+  hash          = HashBytes(hash, &key.requestedPointSize, sizeof(key.requestedPointSize));
+  hash          = HashBytes(hash, &key.horizontalDpi, sizeof(key.horizontalDpi));
+  hash          = HashBytes(hash, &key.verticalDpi, sizeof(key.verticalDpi));
+  hash          = HashBytes(hash, &key.index, sizeof(key.index));
+  hash          = HashBytes(hash, &key.flag, sizeof(key.flag));
+  return hash ^ static_cast<uint64_t>(key.isBoldRequired);
+}
+} // namespace
+
+SharedGlyphCache& SharedGlyphCache::Get()
+{
+  static SharedGlyphCache cache;
+  return cache;
+}
+
+uint64_t SharedGlyphCache::GetFontKey(const std::string& path, FaceIndex faceIndex)
+{
+  uint64_t hash = 14695981039346656037ull;
+  hash          = HashBytes(hash, path.c_str(), path.size() + 1u);
+  hash          = HashBytes(hash, &faceIndex, sizeof(faceIndex));
+
+  struct stat status;
+  if(stat(path.c_str(), &status) == 0)
+  {
+    const int64_t values[] = {static_cast<int64_t>(status.st_mtime), static_cast<int64_t>(status.st_size), static_cast<int64_t>(status.st_ino)};
+    hash                   = HashBytes(hash, values, sizeof(values));
+  }
+  return hash;
+}
+
+SharedGlyphCache::SharedGlyphCache()
+: mHeader(nullptr),
+  mSlots(nullptr),
+  mBuffers(nullptr)
+{
+  const std::size_t size = GetSharedGlyphCacheSize();
+  if(size > 0u)
+  {
+    Map(GetSharedGlyphCachePath(), size);
+  }
+}
+
+void SharedGlyphCache::Map(const std::string& path, std::size_t size)
+{
+  const int fileDescriptor = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+  if(fileDescriptor < 0)
+  {
+    DALI_LOG_ERROR("Can't open shared glyph cache [%s]\n", path.c_str());
+    return;
+  }
+
+  // Only one process creates the file. The others wait for it, and map it as it is.
+  flock(fileDescriptor, LOCK_EX);
+
+  struct stat status;
+  bool        created = false;
+  if(fstat(fileDescriptor, &status) == 0 && status.st_size == 0)
+  {
+    created = (ftruncate(fileDescriptor, static_cast<off_t>(size)) == 0);
+  }
+  else
+  {
+    size = static_cast<std::size_t>(status.st_size);
+  }
+
+  void* address = (size > sizeof(Header)) ? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0) : MAP_FAILED;
+  if(address != MAP_FAILED)
+  {
+    Header* header = reinterpret_cast<Header*>(address);
+    if(created)
+    {
+      // Slots take the space of their average glyph buffer.
+      uint32_t numberOfSlots = MINIMUM_NUMBER_OF_SLOTS;
+      while((static_cast<std::size_t>(numberOfSlots) << 1u) * (sizeof(Slot) + AVERAGE_GLYPH_BUFFER_SIZE) <= size)
+      {
+        numberOfSlots <<= 1u;
+      }
+
+      header->magic         = FILE_MAGIC;
+      header->version       = FILE_VERSION;
+      header->fileSize      = size;
+      header->numberOfSlots = numberOfSlots;
+      header->slotsUsed.store(0u, std::memory_order_relaxed);
+      header->buffersSize   = size - sizeof(Header) - numberOfSlots * sizeof(Slot);
+      header->buffersUsed.store(0u, std::memory_order_relaxed);
+      // The slots are zero, so EMPTY, as the file has just been extended.
+    }
+
+    const std::size_t tableSize = sizeof(Header) + static_cast<std::size_t>(header->numberOfSlots) * sizeof(Slot);
+    if(header->magic == FILE_MAGIC && header->version == FILE_VERSION && header->fileSize == size && tableSize < size &&
+       header->buffersSize == size - tableSize && (header->numberOfSlots & (header->numberOfSlots - 1u)) == 0u)
+    {
+      mHeader  = header;
+      mSlots   = reinterpret_cast<Slot*>(reinterpret_cast<uint8_t*>(address) + sizeof(Header));
+      mBuffers = reinterpret_cast<uint8_t*>(address) + tableSize;
+
+      DALI_LOG_INFO(gFontClientLogFilter, Debug::General, "SharedGlyphCache [%s] %s, %u slots, %zu bytes of buffers\n", path.c_str(), created ? "created" : "mapped", header->numberOfSlots, static_cast<std::size_t>(header->buffersSize));
+    }
+    else
+    {
+      DALI_LOG_ERROR("Shared glyph cache [%s] has another layout. Remove it to use the cache\n", path.c_str());
+      munmap(address, size);
+    }
+  }
+
+  flock(fileDescriptor, LOCK_UN);
+  close(fileDescriptor);
+}
+
+bool SharedGlyphCache::IsFull() const
+{
+  // Keep some empty slots, or the probes get long.
+  return mHeader && (mHeader->buffersUsed.load(std::memory_order_relaxed) >= mHeader->buffersSize ||
+                     mHeader->slotsUsed.load(std::memory_order_relaxed) >= mHeader->numberOfSlots / MAXIMUM_LOAD_FACTOR_DENOMINATOR * MAXIMUM_LOAD_FACTOR_NUMERATOR);
+}
+
+bool SharedGlyphCache::Find(const Key& key, GlyphBufferData& data) const
+{
+  if(!mHeader)
+  {
+    return false;
+  }
+
+  const uint32_t mask  = mHeader->numberOfSlots - 1u;
+  uint32_t       index = static_cast<uint32_t>(HashKey(key)) & mask;
+  for(uint32_t probe = 0u; probe < MAXIMUM_PROBE_LENGTH; ++probe, index = (index + 1u) & mask)
+  {
+    const Slot&    slot  = mSlots[index];
+    const uint32_t state = slot.state.load(std::memory_order_acquire);
+    if(state == EMPTY)
+    {
+      return false;
+    }
+    if(state == READY && slot.Matches(key) && GetGlyph(slot, data))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool SharedGlyphCache::Add(const Key& key, const GlyphBufferData& compressedData, std::size_t compressedSize, GlyphBufferData& data)
+{
+  if(!mHeader || compressedSize == 0u)
+  {
+    return false;
+  }
+
+  const uint32_t mask  = mHeader->numberOfSlots - 1u;
+  uint32_t       index = static_cast<uint32_t>(HashKey(key)) & mask;
+  for(uint32_t probe = 0u; probe < MAXIMUM_PROBE_LENGTH; ++probe, index = (index + 1u) & mask)
+  {
+    Slot&    slot  = mSlots[index];
+    uint32_t state = slot.state.load(std::memory_order_acquire);
+    if(state == READY && slot.Matches(key))
+    {
+      // Another process has rendered it meanwhile.
+      return GetGlyph(slot, data);
+    }
+    if(state != EMPTY || !slot.state.compare_exchange_strong(state, WRITING, std::memory_order_acquire))
+    {
+      // Used by another glyph, or being written. A glyph written twice just takes two slots.
+      continue;
+    }
+    mHeader->slotsUsed.fetch_add(1u, std::memory_order_relaxed);
+
+    const uint64_t alignedSize = (compressedSize + BUFFER_ALIGNMENT - 1u) & ~static_cast<uint64_t>(BUFFER_ALIGNMENT - 1u);
+    const uint64_t offset      = mHeader->buffersUsed.fetch_add(alignedSize, std::memory_order_relaxed);
+    if(offset + alignedSize > mHeader->buffersSize)
+    {
+      // Full. The slot stays claimed, as readers may have passed it already.
+      DALI_LOG_INFO(gFontClientLogFilter, Debug::General, "SharedGlyphCache is full\n");
+      return false;
+    }
+
+    memcpy(mBuffers + offset, compressedData.buffer, compressedSize);
+
+    slot.bufferOffset       = offset;
+    slot.bufferSize         = static_cast<uint32_t>(compressedSize);
+    slot.fontKey            = key.fontKey;
+    slot.variationsHash     = key.variationsHash;
+    slot.requestedPointSize = key.requestedPointSize;
+    slot.horizontalDpi      = key.horizontalDpi;
+    slot.verticalDpi        = key.verticalDpi;
+    slot.index              = key.index;
+    slot.flag               = key.flag;
+    slot.isBoldRequired     = static_cast<uint8_t>(key.isBoldRequired);
+    slot.width              = compressedData.width;
+    slot.height             = compressedData.height;
+    slot.format             = static_cast<uint8_t>(compressedData.format);
+    slot.compressionType    = static_cast<uint8_t>(compressedData.compressionType);
+
+    // Publish the glyph.
+    slot.state.store(READY, std::memory_order_release);
+
+    return GetGlyph(slot, data);
+  }
+  return false;
+}
+
+bool SharedGlyphCache::GetGlyph(const Slot& slot, GlyphBufferData& data) const
+{
+  // The buffer must be within the file...
+  const uint64_t buffersSize = mHeader->buffersSize;
+  if(slot.bufferOffset > buffersSize || slot.bufferSize > buffersSize - slot.bufferOffset)
+  {
+    DALI_LOG_ERROR("Shared glyph cache entry is out of the file, offset %" PRIu64 " size %u\n", slot.bufferOffset, slot.bufferSize);
+    return false;
+  }
+
+  // ...and hold the pixels of the glyph.
+  const auto     format          = static_cast<Pixel::Format>(slot.format);
+  const auto     compressionType = static_cast<GlyphBufferData::CompressionType>(slot.compressionType);
+  const uint64_t rowSize         = static_cast<uint64_t>(slot.width) * Pixel::GetBytesPerPixel(format);
+  const uint64_t pixelsSize      = rowSize * slot.height;
+
+  uint64_t minimumBufferSize = 0u;
+  switch(compressionType)
+  {
+    case GlyphBufferData::CompressionType::NO_COMPRESSION:
+    {
+      minimumBufferSize = pixelsSize;
+      break;
+    }
+    case GlyphBufferData::CompressionType::BPP_4:
+    {
+      minimumBufferSize = ((rowSize + 1u) >> 1u) * slot.height;
+      break;
+    }
+    case GlyphBufferData::CompressionType::RLE_4:
+    {
+      minimumBufferSize = slot.height; // At least one run per scanline.
+      break;
+    }
+    default:
+    {
+      minimumBufferSize = std::numeric_limits<uint64_t>::max();
+      break;
+    }
+  }
+  const bool compressed = compressionType != GlyphBufferData::CompressionType::NO_COMPRESSION;
+  if(rowSize == 0u || (compressed && format != Pixel::L8) || pixelsSize > buffersSize || minimumBufferSize > slot.bufferSize)
+  {
+    DALI_LOG_ERROR("Shared glyph cache entry is inconsistent, %ux%u format %u compression %u size %u\n", slot.width, slot.height, slot.format, slot.compressionType, slot.bufferSize);
+    return false;
+  }
+
+  data.buffer          = mBuffers + slot.bufferOffset;
+  data.width           = slot.width;
+  data.height          = slot.height;
+  data.format          = format;
+  data.compressionType = compressionType;
+  data.isBufferOwned   = false;
+  return true;
+}
+
+} // namespace Dali::TextAbstraction::Internal
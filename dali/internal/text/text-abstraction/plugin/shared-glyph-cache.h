@@ -0,0 +1,146 @@
+#ifndef DALI_INTERNAL_TEXT_ABSTRACTION_SHARED_GLYPH_CACHE_H
+#define DALI_INTERNAL_TEXT_ABSTRACTION_SHARED_GLYPH_CACHE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/text-abstraction/glyph-buffer-data.h>
+#include <dali/devel-api/text-abstraction/text-abstraction-definitions.h>
+
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <string>
+
+namespace Dali::TextAbstraction::Internal
+{
+/**
+ * @brief Cache of rendered glyph buffers shared by all the processes of a user, in a memory mapped file.
+ *
+ * The file holds a table of slots, looked up by open addressing, and the glyph buffers. Entries are
+ * never changed nor removed once published, so readers don't lock: a slot is only read once its
+ * state is READY, which a writer stores after it has written the slot and its buffer. Writers claim
+ * an empty slot and the space of their buffer with atomic operations. Once the file is full, glyphs
+ * are not added any more. The file lives until it's deleted, e.g. when /dev/shm is cleared.
+ *
+ * The cache is disabled unless DALI_SHARED_GLYPH_CACHE_SIZE sets the size of the file in megabytes.
+ * The file is DALI_SHARED_GLYPH_CACHE_PATH, or /dev/shm/dali-glyph-cache-<uid>. It is only readable
+ * by its owner, so applications of other users can't change the glyphs.
+ */
+class SharedGlyphCache
+{
+public:
+  /**
+   * @brief Key of a glyph. Like the key of GlyphCacheManager, but using the font file instead of the FT_Face,
+   * and with the DPI of the font client, as the font clients of the processes may render at different resolutions.
+   */
+  struct Key
+  {
+    uint64_t        fontKey{0u}; ///< See GetFontKey()
+    uint64_t        variationsHash{0u};
+    PointSize26Dot6 requestedPointSize{0u};
+    uint32_t        horizontalDpi{0u};
+    uint32_t        verticalDpi{0u};
+    GlyphIndex      index{0u};
+    int32_t         flag{0};
+    bool            isBoldRequired{false};
+  };
+
+  /**
+   * @brief Retrieves the cache of the process. The file is mapped on the first call.
+   */
+  static SharedGlyphCache& Get();
+
+  /**
+   * @brief Computes the key of a font face, which changes if the font file is replaced.
+   *
+   * @param[in] path The path of the font file.
+   * @param[in] faceIndex The index of the face in the file.
+   * @return The key.
+   */
+  static uint64_t GetFontKey(const std::string& path, FaceIndex faceIndex);
+
+  /**
+   * @brief Whether the file is mapped.
+   */
+  bool IsEnabled() const
+  {
+    return nullptr != mHeader;
+  }
+
+  /**
+   * @brief Whether there is no space left for new glyphs.
+   */
+  bool IsFull() const;
+
+  /**
+   * @brief Finds a glyph.
+   *
+   * Any process of the user can write the file, so an entry whose buffer isn't within the file,
+   * or is too small for its size and format, is ignored.
+   *
+   * @param[in] key The key of the glyph.
+   * @param[out] data The glyph buffer. Its buffer is in the mapped file, and is not owned.
+   * @return @e true if the glyph is found.
+   */
+  bool Find(const Key& key, GlyphBufferData& data) const;
+
+  /**
+   * @brief Adds a glyph, which becomes visible to the other processes.
+   *
+   * @param[in] key The key of the glyph.
+   * @param[in] compressedData The rendered glyph buffer, compressed.
+   * @param[in] compressedSize The size of the buffer of compressedData.
+   * @param[out] data The glyph buffer added. Its buffer is in the mapped file, and is not owned.
+   * @return @e true if the glyph is added, or was added by someone else already. @e false if the buffer
+   * is too small for the size and format of compressedData.
+   */
+  bool Add(const Key& key, const GlyphBufferData& compressedData, std::size_t compressedSize, GlyphBufferData& data);
+
+private:
+  SharedGlyphCache();
+
+  // The mapping is kept until the process ends, as glyph buffers point into it.
+  ~SharedGlyphCache() = default;
+
+  SharedGlyphCache(const SharedGlyphCache&)            = delete;
+  SharedGlyphCache& operator=(const SharedGlyphCache&) = delete;
+
+  struct Header;
+  struct Slot;
+
+  /**
+   * @brief Maps the file, creating it if it doesn't exist.
+   */
+  void Map(const std::string& path, std::size_t size);
+
+  /**
+   * @brief Fills the glyph buffer with the entry of a slot.
+   *
+   * @return @e false, and leaves data unchanged, if the entry is inconsistent.
+   */
+  bool GetGlyph(const Slot& slot, GlyphBufferData& data) const;
+
+private:
+  Header*  mHeader; ///< The mapped file, or nullptr if the cache is disabled.
+  Slot*    mSlots;
+  uint8_t* mBuffers;
+};
+
+} // namespace Dali::TextAbstraction::Internal
+
+#endif // DALI_INTERNAL_TEXT_ABSTRACTION_SHARED_GLYPH_CACHE_H
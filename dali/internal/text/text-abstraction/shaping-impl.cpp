@@ -19,14 +19,24 @@
 #include <dali/internal/text/text-abstraction/shaping-impl.h>
 
 // INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
 #include <dali/devel-api/text-abstraction/glyph-info.h>
 #include <dali/integration-api/debug.h>
+#include <dali/internal/system/common/environment-variables.h>
+#include <dali/internal/text/text-abstraction/plugin/lru-cache-container.h>
 #include "font-client-impl.h"
 
 // EXTERNAL INCLUDES
 #include <dali/devel-api/common/singleton-service.h>
 #include <harfbuzz/hb-ft.h>
 #include <harfbuzz/hb.h>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace
 {
@@ -35,6 +45,50 @@ Dali::Integration::Log::Filter* gLogFilter = Dali::Integration::Log::Filter::New
 #endif
 
 static constexpr float FROM_266 = 1.0f / 64.0f;
+
+constexpr std::size_t DEFAULT_SHAPED_RUN_CACHE_MAX  = 256u;
+constexpr uint32_t    MAXIMUM_CACHED_RUN_LENGTH     = 256u;  ///< Longer runs are rarely shaped twice, and would make the cache large.
+constexpr uint32_t    CACHE_STATISTICS_LOG_INTERVAL = 1024u; ///< The number of lookups between logs of the hit rate.
+
+/**
+ * @brief Get maximum number of shaped runs to cache from environment.
+ * If not settuped, default as 256. 0 disables the cache.
+ * @note This value fixed when we call it first time.
+ * @return The max number of shaped runs.
+ */
+inline std::size_t GetMaxNumberOfShapedRunCache()
+{
+  static auto numberString = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_MAX_NUMBER_OF_SHAPED_RUN_CACHE);
+  static auto number       = numberString ? std::strtoul(numberString, nullptr, 10) : DEFAULT_SHAPED_RUN_CACHE_MAX;
+  return number;
+}
+
+/**
+ * @brief HarfBuzz buffer of the calling thread, so threads can shape at the same time.
+ */
+struct HarfBuzzBuffer
+{
+  ~HarfBuzzBuffer()
+  {
+    if(mBuffer)
+    {
+      hb_buffer_destroy(mBuffer);
+    }
+  }
+
+  hb_buffer_t* Get()
+  {
+    if(nullptr == mBuffer)
+    {
+      mBuffer = hb_buffer_create();
+    }
+    return mBuffer;
+  }
+
+  hb_buffer_t* mBuffer{nullptr};
+};
+
+thread_local HarfBuzzBuffer gHarfBuzzBuffer;
 } // namespace
 
 namespace Dali
@@ -114,38 +168,222 @@ const hb_script_t SCRIPT_TO_HARFBUZZ[] =
     HB_SCRIPT_UNKNOWN,  // EMOJI_COLOR
     HB_SCRIPT_UNKNOWN}; // SYMBOLS_NSLCL
 
-struct Shaping::Plugin
+namespace
+{
+/**
+ * @brief The glyphs of a shaped run of text.
+ */
+struct ShapedRun
+{
+  Vector<GlyphIndex>     indices;
+  Vector<float>          advance;
+  Vector<float>          offset; ///< The x and y offsets of each glyph
+  Vector<CharacterIndex> characterMap;
+  FontId                 fontId{0u};
+};
+
+using ShapedRunPtr = std::shared_ptr<const ShapedRun>;
+
+/**
+ * @brief Everything the glyphs of a run depend on.
+ */
+struct ShapedRunKey
+{
+  uint32_t               fontCacheId{0u}; ///< Font ids only mean something within a font cache
+  FontId                 fontId{0u};
+  PointSize26Dot6        pointSize{0u};
+  Script                 script{UNKNOWN};
+  bool                   rtlDirection{false};
+  hb_language_t          language{HB_LANGUAGE_INVALID};
+  std::size_t            textHash{0u};
+  std::vector<Character> text; ///< Compared too, so texts with the same hash don't share their glyphs
+
+  bool operator==(const ShapedRunKey& rhs) const noexcept
+  {
+    return fontCacheId == rhs.fontCacheId && fontId == rhs.fontId && pointSize == rhs.pointSize &&
+           script == rhs.script && rtlDirection == rhs.rtlDirection && language == rhs.language &&
+           textHash == rhs.textHash && text == rhs.text;
+  }
+};
+
+struct ShapedRunKeyHash
+{
+  std::size_t operator()(const ShapedRunKey& key) const noexcept
+  {
+    return key.textHash ^
+           (static_cast<std::size_t>(key.fontId) << 7) ^
+           (static_cast<std::size_t>(key.fontCacheId) << 17) ^
+           static_cast<std::size_t>(key.pointSize) ^
+           (static_cast<std::size_t>(key.script) << 23) ^
+           static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(key.language));
+  }
+};
+
+std::size_t HashText(const Character* const text, Length numberOfCharacters)
+{
+  // FNV-1a
+  std::size_t hash = 14695981039346656037ull;
+  for(Length index = 0u; index < numberOfCharacters; ++index)
+  {
+    hash = (hash ^ text[index]) * 1099511628211ull;
+  }
+  return hash;
+}
+
+/**
+ * @brief LRU cache of the shaped runs, shared by all the Shaping instances and threads.
+ */
+class ShapedRunCache
 {
-  Plugin()
-  : mIndices(),
-    mAdvance(),
-    mCharacterMap(),
-    mFontId(0u),
-    mHarfBuzzBuffer(nullptr)
+public:
+  static ShapedRunCache& Get()
   {
+    static ShapedRunCache cache;
+    return cache;
   }
 
-  ~Plugin()
+  bool IsEnabled() const
   {
-    if(mHarfBuzzBuffer)
+    return mMaxNumberOfRuns != 0u;
+  }
+
+  /**
+   * @brief Finds a run, and marks it as the most recently used one.
+   * @return The run, or nullptr if it isn't cached
+   */
+  ShapedRunPtr Find(const ShapedRunKey& key)
+  {
+    ShapedRunPtr run;
+    {
+      std::scoped_lock<std::mutex> lock(mMutex);
+      if(mCache.Find(key) != mCache.End())
+      {
+        run = mCache.Get(key);
+      }
+    }
+
+    (run ? mHitCount : mMissCount).fetch_add(1u, std::memory_order_relaxed);
+
+#if defined(DEBUG_ENABLED)
+    uint32_t hitCount, missCount;
+    GetStatistics(hitCount, missCount);
+    if((hitCount + missCount) % CACHE_STATISTICS_LOG_INTERVAL == 0u)
     {
-      hb_buffer_destroy(mHarfBuzzBuffer);
+      DALI_LOG_INFO(gLogFilter, Debug::General, "Shaped run cache : %u hits, %u misses, hit rate %.1f%%\n", hitCount, missCount, 100.0f * hitCount / (hitCount + missCount));
     }
+#endif
+    return run;
+  }
+
+  /**
+   * @brief Adds a run, dropping the least recently used one if the cache is full.
+   */
+  void Add(const ShapedRunKey& key, const ShapedRunPtr& run)
+  {
+    std::scoped_lock<std::mutex> lock(mMutex);
+    mCache.Push(key, run);
+  }
+
+  void GetStatistics(uint32_t& hitCount, uint32_t& missCount) const
+  {
+    hitCount  = mHitCount.load(std::memory_order_relaxed);
+    missCount = mMissCount.load(std::memory_order_relaxed);
+  }
+
+private:
+  ShapedRunCache()
+  : mMaxNumberOfRuns(GetMaxNumberOfShapedRunCache()),
+    mCache(mMaxNumberOfRuns)
+  {
   }
 
+  using CacheContainer = LRUCacheContainer<ShapedRunKey, ShapedRunPtr, ShapedRunKeyHash>;
+
+  const std::size_t     mMaxNumberOfRuns;
+  std::mutex            mMutex; ///< Guards mCache
+  CacheContainer        mCache;
+  std::atomic<uint32_t> mHitCount{0u};
+  std::atomic<uint32_t> mMissCount{0u};
+};
+
+} // namespace
+
+struct Shaping::Plugin
+{
   Length Shape(TextAbstraction::FontClient& fontClient,
                const Character* const       text,
                Length                       numberOfCharacters,
                FontId                       fontId,
                Script                       script)
   {
-    // Clear previoursly shaped texts.
-    mIndices.Clear();
-    mAdvance.Clear();
-    mCharacterMap.Clear();
-    mOffset.Clear();
-    mFontId = fontId;
+    ShapedRunPtr run = ShapeRun(fontClient, text, numberOfCharacters, fontId, script);
 
+    const Length numberOfGlyphs = run ? static_cast<Length>(run->indices.Count()) : 0u;
+
+    std::scoped_lock<std::mutex> lock(mCurrentRunsMutex);
+    if(run)
+    {
+      mCurrentRuns[std::this_thread::get_id()] = std::move(run);
+    }
+    else
+    {
+      mCurrentRuns.erase(std::this_thread::get_id());
+    }
+
+    return numberOfGlyphs;
+  }
+
+  void GetGlyphs(GlyphInfo*      glyphInfo,
+                 CharacterIndex* glyphToCharacterMap)
+  {
+    ShapedRunPtr run;
+    {
+      // The run is released here, so the map doesn't keep an entry for every thread which ever shaped.
+      std::scoped_lock<std::mutex> lock(mCurrentRunsMutex);
+      auto                         iter = mCurrentRuns.find(std::this_thread::get_id());
+      if(iter != mCurrentRuns.end())
+      {
+        run = std::move(iter->second);
+        mCurrentRuns.erase(iter);
+      }
+    }
+    if(!run)
+    {
+      return;
+    }
+
+    Vector<GlyphIndex>::ConstIterator     indicesIt      = run->indices.Begin();
+    Vector<float>::ConstIterator          advanceIt      = run->advance.Begin();
+    Vector<float>::ConstIterator          offsetIt       = run->offset.Begin();
+    Vector<CharacterIndex>::ConstIterator characterMapIt = run->characterMap.Begin();
+
+    for(GlyphIndex index = 0u, size = static_cast<GlyphIndex>(run->indices.Count()); index < size; ++index)
+    {
+      GlyphInfo&      glyph            = *(glyphInfo + index);
+      CharacterIndex& glyphToCharacter = *(glyphToCharacterMap + index);
+
+      glyph.fontId  = run->fontId;
+      glyph.index   = *(indicesIt + index);
+      glyph.advance = *(advanceIt + index);
+
+      const GlyphIndex offsetIndex = 2u * index;
+      glyph.xBearing               = *(offsetIt + offsetIndex);
+      glyph.yBearing               = *(offsetIt + offsetIndex + 1u);
+
+      glyphToCharacter = *(characterMapIt + index);
+    }
+  }
+
+  /**
+   * @brief Shapes the text, or finds it in the cache.
+   * @return The shaped run, or nullptr if the text can't be shaped with the font
+   */
+  ShapedRunPtr ShapeRun(TextAbstraction::FontClient& fontClient,
+                        const Character* const       text,
+                        Length                       numberOfCharacters,
+                        FontId                       fontId,
+                        Script                       script)
+  {
     TextAbstraction::Internal::FontClient& fontClientImpl = TextAbstraction::GetImplementation(fontClient);
 
     const FontDescription::Type type = fontClientImpl.GetFontType(fontId);
@@ -159,33 +397,54 @@ struct Shaping::Plugin
         if(nullptr == harfBuzzFont)
         {
           // Nothing to do if the harfBuzzFont is null.
-          return 0u;
+          return nullptr;
         }
 
-        // Reserve some space to avoid reallocations.
-        const Length numberOfGlyphs = static_cast<Length>(1.3f * static_cast<float>(numberOfCharacters));
-        mIndices.Reserve(numberOfGlyphs);
-        mAdvance.Reserve(numberOfGlyphs);
-        mCharacterMap.Reserve(numberOfGlyphs);
-        mOffset.Reserve(2u * numberOfGlyphs);
+        const bool         rtlDirection = IsRightToLeftScript(script);
+        const std::string& localeString = TextAbstraction::GetLocale();
+        hb_language_t      language     = hb_language_from_string(localeString.c_str(), static_cast<int32_t>(localeString.size()));
+
+        auto& cache    = ShapedRunCache::Get();
+        bool  useCache = cache.IsEnabled() && numberOfCharacters <= MAXIMUM_CACHED_RUN_LENGTH;
 
-        if(nullptr == mHarfBuzzBuffer)
+        ShapedRunKey key;
+        if(useCache)
         {
-          mHarfBuzzBuffer = hb_buffer_create();
+          key.fontCacheId  = fontClientImpl.GetFontCacheId();
+          key.fontId       = fontId;
+          key.pointSize    = fontClientImpl.GetPointSize(fontId);
+          key.script       = script;
+          key.rtlDirection = rtlDirection;
+          key.language     = language;
+          key.textHash     = HashText(text, numberOfCharacters);
+          key.text.assign(text, text + numberOfCharacters);
+
+          if(ShapedRunPtr cachedRun = cache.Find(key))
+          {
+            return cachedRun;
+          }
         }
 
-        hb_buffer_t* harfBuzzBuffer = mHarfBuzzBuffer;
+        auto run    = std::make_shared<ShapedRun>();
+        run->fontId = fontId;
+
+        // Reserve some space to avoid reallocations.
+        const Length numberOfGlyphs = static_cast<Length>(1.3f * static_cast<float>(numberOfCharacters));
+        run->indices.Reserve(numberOfGlyphs);
+        run->advance.Reserve(numberOfGlyphs);
+        run->characterMap.Reserve(numberOfGlyphs);
+        run->offset.Reserve(2u * numberOfGlyphs);
+
+        hb_buffer_t* harfBuzzBuffer = gHarfBuzzBuffer.Get();
         hb_buffer_reset(harfBuzzBuffer);
 
-        const bool rtlDirection = IsRightToLeftScript(script);
         hb_buffer_set_direction(harfBuzzBuffer,
                                 rtlDirection ? HB_DIRECTION_RTL : HB_DIRECTION_LTR); /* or LTR */
 
         hb_buffer_set_script(harfBuzzBuffer,
                              SCRIPT_TO_HARFBUZZ[script]); /* see hb-unicode.h */
 
-        const std::string& localeString = TextAbstraction::GetLocale();
-  hb_buffer_set_language(harfBuzzBuffer, hb_language_from_string(localeString.c_str(), static_cast<int32_t>(localeString.size())));
+        hb_buffer_set_language(harfBuzzBuffer, language);
 
         /* Layout the text */
         hb_buffer_add_utf32(harfBuzzBuffer, text, numberOfCharacters, 0u, numberOfCharacters);
@@ -234,47 +493,54 @@ struct Shaping::Plugin
             {
               const GlyphIndex index = rtlIndex + j;
 
-              mIndices.PushBack(glyphInfo[index].codepoint);
-              mAdvance.PushBack(glyphPositions[index].x_advance * FROM_266);
-              mCharacterMap.PushBack(glyphInfo[index].cluster);
-              mOffset.PushBack(glyphPositions[index].x_offset * FROM_266);
-              mOffset.PushBack(glyphPositions[index].y_offset * FROM_266);
+              run->indices.PushBack(glyphInfo[index].codepoint);
+              run->advance.PushBack(glyphPositions[index].x_advance * FROM_266);
+              run->characterMap.PushBack(glyphInfo[index].cluster);
+              run->offset.PushBack(glyphPositions[index].x_offset * FROM_266);
+              run->offset.PushBack(glyphPositions[index].y_offset * FROM_266);
             }
 
             i += numberOfGlyphsInCluster;
           }
           else
           {
-            mIndices.PushBack(glyphInfo[i].codepoint);
-            mAdvance.PushBack(glyphPositions[i].x_advance * FROM_266);
-            mCharacterMap.PushBack(glyphInfo[i].cluster);
-            mOffset.PushBack(glyphPositions[i].x_offset * FROM_266);
-            mOffset.PushBack(glyphPositions[i].y_offset * FROM_266);
+            run->indices.PushBack(glyphInfo[i].codepoint);
+            run->advance.PushBack(glyphPositions[i].x_advance * FROM_266);
+            run->characterMap.PushBack(glyphInfo[i].cluster);
+            run->offset.PushBack(glyphPositions[i].x_offset * FROM_266);
+            run->offset.PushBack(glyphPositions[i].y_offset * FROM_266);
 
             ++i;
           }
         }
 
-        break;
+        if(useCache)
+        {
+          cache.Add(key, run);
+        }
+        return run;
       }
       case FontDescription::BITMAP_FONT:
       {
+        auto run    = std::make_shared<ShapedRun>();
+        run->fontId = fontId;
+
         // Reserve some space to avoid reallocations.
         // The advance and offset tables can be initialized with zeros as it's not needed to get metrics from the bitmaps here.
-        mIndices.Resize(numberOfCharacters);
-        mAdvance.Resize(numberOfCharacters, 0u);
-        mCharacterMap.Reserve(numberOfCharacters);
-        mOffset.Resize(2u * numberOfCharacters, 0.f);
+        run->indices.Resize(numberOfCharacters);
+        run->advance.Resize(numberOfCharacters, 0u);
+        run->characterMap.Reserve(numberOfCharacters);
+        run->offset.Resize(2u * numberOfCharacters, 0.f);
 
         // The utf32 character can be used as the glyph's index.
-        std::copy(text, text + numberOfCharacters, mIndices.Begin());
+        std::copy(text, text + numberOfCharacters, run->indices.Begin());
 
         // The glyph to character map is 1 to 1.
         for(unsigned int index = 0u; index < numberOfCharacters; ++index)
         {
-          mCharacterMap.PushBack(index);
+          run->characterMap.PushBack(index);
         }
-        break;
+        return run;
       }
       default:
       {
@@ -282,44 +548,15 @@ struct Shaping::Plugin
       }
     }
 
-  return static_cast<Length>(mIndices.Count());
-  }
-
-  void GetGlyphs(GlyphInfo*      glyphInfo,
-                 CharacterIndex* glyphToCharacterMap)
-  {
-    Vector<CharacterIndex>::ConstIterator indicesIt      = mIndices.Begin();
-    Vector<float>::ConstIterator          advanceIt      = mAdvance.Begin();
-    Vector<float>::ConstIterator          offsetIt       = mOffset.Begin();
-    Vector<CharacterIndex>::ConstIterator characterMapIt = mCharacterMap.Begin();
-
-  for(GlyphIndex index = 0u, size = static_cast<GlyphIndex>(mIndices.Count()); index < size; ++index)
-    {
-      GlyphInfo&      glyph            = *(glyphInfo + index);
-      CharacterIndex& glyphToCharacter = *(glyphToCharacterMap + index);
-
-      glyph.fontId  = mFontId;
-      glyph.index   = *(indicesIt + index);
-      glyph.advance = *(advanceIt + index);
-
-      const GlyphIndex offsetIndex = 2u * index;
-      glyph.xBearing               = *(offsetIt + offsetIndex);
-      glyph.yBearing               = *(offsetIt + offsetIndex + 1u);
-
-      glyphToCharacter = *(characterMapIt + index);
-    }
+    return nullptr;
   }
 
-  Vector<CharacterIndex> mIndices;
-  Vector<float>          mAdvance;
-  Vector<float>          mOffset;
-  Vector<CharacterIndex> mCharacterMap;
-  FontId                 mFontId;
-  hb_buffer_t*           mHarfBuzzBuffer;
+  std::mutex                                        mCurrentRunsMutex; ///< Guards mCurrentRuns
+  std::unordered_map<std::thread::id, ShapedRunPtr> mCurrentRuns;      ///< The run each thread shaped last, until its GetGlyphs()
 };
 
 Shaping::Shaping()
-: mPlugin(NULL)
+: mPlugin(new Plugin())
 {
 }
 
@@ -359,8 +596,6 @@ Length Shaping::Shape(TextAbstraction::FontClient& fontClient,
                       FontId                       fontId,
                       Script                       script)
 {
-  CreatePlugin();
-
   return mPlugin->Shape(fontClient,
                         text,
                         numberOfCharacters,
@@ -371,18 +606,13 @@ Length Shaping::Shape(TextAbstraction::FontClient& fontClient,
 void Shaping::GetGlyphs(GlyphInfo*      glyphInfo,
                         CharacterIndex* glyphToCharacterMap)
 {
-  CreatePlugin();
-
   mPlugin->GetGlyphs(glyphInfo,
                      glyphToCharacterMap);
 }
 
-void Shaping::CreatePlugin()
+void Shaping::GetCacheStatistics(uint32_t& hitCount, uint32_t& missCount)
 {
-  if(!mPlugin)
-  {
-    mPlugin = new Plugin();
-  }
+  ShapedRunCache::Get().GetStatistics(hitCount, missCount);
 }
 
 } // namespace Internal
@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_TEXT_ABSTRACTION_SHAPING_IMPL_H
 
 /*
- * Copyright (c) 2025 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -67,11 +67,16 @@ public:
   void GetGlyphs(GlyphInfo*      glyphInfo,
                  CharacterIndex* glyphToCharacterMap);
 
-private:
   /**
-   * Helper for lazy initialization.
+   * @brief Retrieves how often Shape() found the text in the cache of shaped runs.
+   *
+   * The cache is shared by all the Shaping instances, and keeps the DALI_SHAPED_RUN_CACHE_MAX
+   * most recently used runs. Runs of bitmap fonts, and long runs, are not cached.
+   *
+   * @param[out] hitCount The number of runs found in the cache
+   * @param[out] missCount The number of runs shaped and added to the cache
    */
-  void CreatePlugin();
+  static void GetCacheStatistics(uint32_t& hitCount, uint32_t& missCount);
 
 private:
   // Undefined copy constructor.
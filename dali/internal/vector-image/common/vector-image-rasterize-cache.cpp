@@ -0,0 +1,485 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/vector-image/common/vector-image-rasterize-cache.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/integration-api/debug.h>
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <thread>
+
+#ifdef THORVG_SUPPORT
+#include <thorvg.h>
+#endif
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/environment-variables.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+namespace // unnamed namespace
+{
+constexpr std::size_t DEFAULT_CACHE_SIZE_KB         = 4096u;
+constexpr std::size_t DEFAULT_DISK_CACHE_SIZE_KB    = 16384u;
+constexpr std::size_t MAXIMUM_IMAGE_BUDGET_DIVISOR  = 4u;          ///< An image larger than a quarter of the budget would drop most of the others
+constexpr std::size_t DISK_EVICTION_DIVISOR         = 4u;          ///< A quarter of the disk budget is freed at once, so the directory isn't listed at every write
+constexpr uint32_t    BYTES_PER_PIXEL               = 4u;          ///< RGBA8888
+constexpr uint32_t    FILE_MAGIC                    = 0x43495644u; ///< "DVIC" (DALi Vector Image Cache), little endian
+constexpr uint32_t    FILE_VERSION                  = 2u;
+constexpr std::size_t RASTERIZER_NAME_SIZE          = 24u;         ///< Including the terminating zero
+constexpr uint32_t    CACHE_STATISTICS_LOG_INTERVAL = 256u;        ///< The number of lookups between logs of the hit rate
+constexpr const char* FILE_EXTENSION                = ".rgba";
+
+struct FileHeader
+{
+  uint32_t magic;
+  uint32_t version;
+  uint64_t dataHash;
+  uint32_t width;
+  uint32_t height;
+  char     rasterizer[RASTERIZER_NAME_SIZE]; ///< Padded with zeros
+};
+
+static_assert(sizeof(FileHeader) == 48u, "The file layout must not depend on the compiler");
+
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gVectorImageCacheLogFilter = Debug::Filter::New(Debug::NoLogging, false, "LOG_VECTOR_IMAGE_CACHE");
+#endif
+
+/**
+ * @brief Get the byte budget of the cache from environment.
+ * If not set, 4 megabytes. 0 disables the cache.
+ */
+std::size_t GetCacheByteBudget()
+{
+  const char* sizeString = EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_VECTOR_IMAGE_CACHE_SIZE);
+  return (sizeString ? static_cast<std::size_t>(std::strtoul(sizeString, nullptr, 10)) : DEFAULT_CACHE_SIZE_KB) * 1024u;
+}
+
+/**
+ * @brief Get the byte budget of the image files from environment.
+ * If not set, 16 megabytes. 0 keeps the images in memory only.
+ */
+std::size_t GetDiskCacheByteBudget()
+{
+  const char* sizeString = EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_VECTOR_IMAGE_CACHE_DISK_SIZE);
+  return (sizeString ? static_cast<std::size_t>(std::strtoul(sizeString, nullptr, 10)) : DEFAULT_DISK_CACHE_SIZE_KB) * 1024u;
+}
+
+/**
+ * @brief Get the directory of the image files from environment. Empty if not set.
+ */
+std::string GetCacheDirectory()
+{
+  const char* directory = EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_VECTOR_IMAGE_CACHE_PATH);
+  return directory ? std::string(directory) : std::string();
+}
+
+/**
+ * @brief Get the name and version of the rasterizer this library is built with.
+ */
+std::string GetRasterizerName()
+{
+#if defined(THORVG_SUPPORT) && defined(TVG_VERSION_MAJOR)
+  return "thorvg-" + std::to_string(TVG_VERSION_MAJOR) + "." + std::to_string(TVG_VERSION_MINOR) + "." + std::to_string(TVG_VERSION_MICRO);
+#elif defined(THORVG_SUPPORT)
+  return "thorvg-0";
+#else
+  return "nanosvg";
+#endif
+}
+
+/**
+ * @brief Keeps the characters of the rasterizer name which may be in a file name, and fit in the file header.
+ */
+std::string PrepareRasterizerName(std::string rasterizer)
+{
+  rasterizer.erase(std::remove_if(rasterizer.begin(), rasterizer.end(), [](char character) { return !(std::isalnum(static_cast<unsigned char>(character)) || character == '.' || character == '-' || character == '_'); }), rasterizer.end());
+  if(rasterizer.size() >= RASTERIZER_NAME_SIZE)
+  {
+    rasterizer.resize(RASTERIZER_NAME_SIZE - 1u);
+  }
+  return rasterizer;
+}
+
+/**
+ * @brief Calculates the size of the image files in the directory.
+ */
+std::size_t GetFilesSize(const std::string& directory)
+{
+  std::size_t     size = 0u;
+  std::error_code errorCode;
+  for(std::filesystem::directory_iterator it(directory, errorCode), end; !errorCode && it != end; it.increment(errorCode))
+  {
+    std::error_code fileErrorCode;
+    if(it->path().extension() == FILE_EXTENSION && it->is_regular_file(fileErrorCode))
+    {
+      const auto fileSize = it->file_size(fileErrorCode);
+      size += fileErrorCode ? 0u : static_cast<std::size_t>(fileSize);
+    }
+  }
+  return size;
+}
+
+/**
+ * @brief Creates the directory of the image files if needed.
+ * @return The directory, or an empty string if it can't be created
+ */
+std::string PrepareDirectory(std::string directory)
+{
+  if(!directory.empty())
+  {
+    std::error_code errorCode;
+    std::filesystem::create_directories(directory, errorCode);
+    if(errorCode)
+    {
+      DALI_LOG_ERROR("Can't create the vector image cache directory %s : %s\n", directory.c_str(), errorCode.message().c_str());
+      directory.clear();
+    }
+  }
+  return directory;
+}
+
+/**
+ * @brief Copies cached pixels to a new pixel buffer.
+ */
+Dali::PixelBuffer CreatePixelBuffer(uint32_t width, uint32_t height, const std::vector<uint8_t>& pixels)
+{
+  Dali::PixelBuffer pixelBuffer = Dali::PixelBuffer::New(width, height, Dali::Pixel::RGBA8888);
+  if(pixelBuffer && pixelBuffer.GetBuffer())
+  {
+    memcpy(pixelBuffer.GetBuffer(), pixels.data(), std::min(pixels.size(), static_cast<std::size_t>(pixelBuffer.GetBufferSize())));
+  }
+  return pixelBuffer;
+}
+
+} // unnamed namespace
+
+VectorImageRasterizeCache& VectorImageRasterizeCache::Get()
+{
+  static VectorImageRasterizeCache cache(GetCacheByteBudget(), GetCacheDirectory(), GetDiskCacheByteBudget(), GetRasterizerName());
+  return cache;
+}
+
+VectorImageRasterizeCache::VectorImageRasterizeCache(std::size_t byteBudget, std::string directory, std::size_t diskByteBudget, std::string rasterizer)
+: mByteBudget(byteBudget),
+  mDiskByteBudget(diskByteBudget),
+  mRasterizer(PrepareRasterizerName(std::move(rasterizer))),
+  mDirectory(byteBudget > 0u && diskByteBudget > 0u ? PrepareDirectory(std::move(directory)) : std::string()),
+  mMutex(),
+  mCache(),
+  mStatistics(),
+  mDiskMutex(),
+  mDiskByteSize(mDirectory.empty() ? 0u : GetFilesSize(mDirectory))
+{
+}
+
+uint64_t VectorImageRasterizeCache::CalculateDataHash(const uint8_t* data, std::size_t size, uint32_t parseDpi)
+{
+  // FNV-1a, so the hash of the files in the directory stays the same at every launch.
+  uint64_t hash = 14695981039346656037ull;
+  for(std::size_t index = 0u; index < size; ++index)
+  {
+    hash = (hash ^ data[index]) * 1099511628211ull;
+  }
+
+  // The same data, parsed with another DPI, is rasterized differently.
+  for(uint32_t shift = 0u; parseDpi != 0u && shift < 32u; shift += 8u)
+  {
+    hash = (hash ^ ((parseDpi >> shift) & 0xffu)) * 1099511628211ull;
+  }
+  return hash;
+}
+
+Dali::PixelBuffer VectorImageRasterizeCache::Find(uint64_t dataHash, uint32_t width, uint32_t height)
+{
+  if(!IsEnabled())
+  {
+    return Dali::PixelBuffer();
+  }
+
+  const Key key{dataHash, width, height};
+
+#if defined(DEBUG_ENABLED)
+  const Statistics statistics = GetStatistics();
+  const uint32_t   lookups    = statistics.hitCount + statistics.diskHitCount + statistics.missCount;
+  if(lookups > 0u && lookups % CACHE_STATISTICS_LOG_INTERVAL == 0u)
+  {
+    DALI_LOG_INFO(gVectorImageCacheLogFilter, Debug::General, "Vector image cache : %u hits, %u disk hits, %u misses, %u evictions, %zu bytes\n", statistics.hitCount, statistics.diskHitCount, statistics.missCount, statistics.evictionCount, statistics.byteSize);
+  }
+#endif
+
+  {
+    // The pixels are copied under the lock, as they are released when the image is dropped.
+    std::scoped_lock<std::mutex> lock(mMutex);
+    if(mCache.Find(key) != mCache.End())
+    {
+      ++mStatistics.hitCount;
+      return CreatePixelBuffer(width, height, *mCache.Get(key));
+    }
+  }
+
+  Pixels pixels = mDirectory.empty() ? nullptr : ReadFile(key);
+
+  std::scoped_lock<std::mutex> lock(mMutex);
+  if(!pixels)
+  {
+    ++mStatistics.missCount;
+    return Dali::PixelBuffer();
+  }
+
+  ++mStatistics.diskHitCount;
+  Dali::PixelBuffer pixelBuffer = CreatePixelBuffer(width, height, *pixels);
+  if(IsCacheable(pixels->size()))
+  {
+    // The file may be written by a process with a larger budget.
+    Insert(key, pixels);
+  }
+  return pixelBuffer;
+}
+
+void VectorImageRasterizeCache::Add(uint64_t dataHash, uint32_t width, uint32_t height, const Dali::PixelBuffer& pixelBuffer)
+{
+  if(!IsEnabled() || !pixelBuffer || !pixelBuffer.GetBuffer() || pixelBuffer.GetPixelFormat() != Dali::Pixel::RGBA8888)
+  {
+    return;
+  }
+
+  const std::size_t size = static_cast<std::size_t>(width) * height * BYTES_PER_PIXEL;
+  if(size == 0u || !IsCacheable(size) || pixelBuffer.GetBufferSize() != size)
+  {
+    return;
+  }
+
+  const Key key{dataHash, width, height};
+  auto      pixels = std::make_shared<std::vector<uint8_t>>(pixelBuffer.GetBuffer(), pixelBuffer.GetBuffer() + size);
+
+  if(!mDirectory.empty())
+  {
+    WriteFile(key, *pixels);
+  }
+
+  std::scoped_lock<std::mutex> lock(mMutex);
+  Insert(key, pixels);
+}
+
+VectorImageRasterizeCache::Statistics VectorImageRasterizeCache::GetStatistics() const
+{
+  std::scoped_lock<std::mutex> lock(mMutex);
+  return mStatistics;
+}
+
+bool VectorImageRasterizeCache::IsCacheable(std::size_t size) const
+{
+  return size <= mByteBudget / MAXIMUM_IMAGE_BUDGET_DIVISOR;
+}
+
+void VectorImageRasterizeCache::Insert(const Key& key, const Pixels& pixels)
+{
+  if(mCache.Find(key) != mCache.End())
+  {
+    // Rasterized by two renderers at the same time. Keep the first one.
+    mCache.Get(key);
+    return;
+  }
+
+  mCache.Push(key, pixels);
+  mStatistics.byteSize += pixels->size();
+
+  while(mStatistics.byteSize > mByteBudget && !mCache.IsEmpty())
+  {
+    Pixels evictedPixels = mCache.Pop();
+    mStatistics.byteSize -= evictedPixels->size();
+    ++mStatistics.evictionCount;
+
+    // The container keeps the popped element until its slot is used again. Release the pixels now.
+    std::vector<uint8_t>().swap(*evictedPixels);
+  }
+}
+
+std::string VectorImageRasterizeCache::GetFilePath(const Key& key) const
+{
+  // The images of another rasterizer are kept in other files, for the processes still using it.
+  char fileName[96];
+  snprintf(fileName, sizeof(fileName), "%016" PRIx64 "-%ux%u-%s%s", key.dataHash, key.width, key.height, mRasterizer.c_str(), FILE_EXTENSION);
+  return mDirectory + "/" + fileName;
+}
+
+VectorImageRasterizeCache::Pixels VectorImageRasterizeCache::ReadFile(const Key& key) const
+{
+  const std::string path = GetFilePath(key);
+
+  std::ifstream file(path, std::ios::binary);
+  if(!file)
+  {
+    return nullptr;
+  }
+
+  FileHeader header{};
+  if(!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+     header.magic != FILE_MAGIC || header.version != FILE_VERSION ||
+     header.dataHash != key.dataHash || header.width != key.width || header.height != key.height ||
+     strncmp(header.rasterizer, mRasterizer.c_str(), RASTERIZER_NAME_SIZE) != 0)
+  {
+    DALI_LOG_ERROR("Vector image cache file %s doesn't match. Ignoring it\n", path.c_str());
+    return nullptr;
+  }
+
+  auto pixels = std::make_shared<std::vector<uint8_t>>(static_cast<std::size_t>(key.width) * key.height * BYTES_PER_PIXEL);
+  if(!file.read(reinterpret_cast<char*>(pixels->data()), static_cast<std::streamsize>(pixels->size())))
+  {
+    DALI_LOG_ERROR("Vector image cache file %s is truncated. Ignoring it\n", path.c_str());
+    return nullptr;
+  }
+
+  // Mark the file as the most recently used one, so it is removed last.
+  std::error_code errorCode;
+  std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), errorCode);
+  return pixels;
+}
+
+void VectorImageRasterizeCache::WriteFile(const Key& key, const std::vector<uint8_t>& pixels)
+{
+  const std::string path = GetFilePath(key);
+
+  std::error_code errorCode;
+  if(std::filesystem::exists(path, errorCode))
+  {
+    return;
+  }
+
+  // Write a temporary file and rename it, so the readers of this or another process never see a partial image.
+  const std::string temporaryPath = path + "." + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + "-" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+
+  bool succeeded = false;
+  {
+    std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+    if(file)
+    {
+      FileHeader header{FILE_MAGIC, FILE_VERSION, key.dataHash, key.width, key.height, {}};
+      strncpy(header.rasterizer, mRasterizer.c_str(), RASTERIZER_NAME_SIZE - 1u);
+      file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+      file.write(reinterpret_cast<const char*>(pixels.data()), static_cast<std::streamsize>(pixels.size()));
+      file.close();
+      succeeded = !file.fail();
+    }
+  }
+
+  if(succeeded)
+  {
+    std::filesystem::rename(temporaryPath, path, errorCode);
+    succeeded = !errorCode;
+  }
+
+  if(!succeeded)
+  {
+    DALI_LOG_ERROR("Can't write the vector image cache file %s\n", path.c_str());
+    std::filesystem::remove(temporaryPath, errorCode);
+    return;
+  }
+
+  uint32_t evictedCount = 0u;
+  {
+    std::scoped_lock<std::mutex> lock(mDiskMutex);
+    mDiskByteSize += sizeof(FileHeader) + pixels.size();
+    if(mDiskByteSize > mDiskByteBudget)
+    {
+      evictedCount = EvictFiles();
+    }
+  }
+
+  if(evictedCount > 0u)
+  {
+    std::scoped_lock<std::mutex> lock(mMutex);
+    mStatistics.diskEvictionCount += evictedCount;
+  }
+}
+
+uint32_t VectorImageRasterizeCache::EvictFiles()
+{
+  struct CacheFile
+  {
+    std::filesystem::file_time_type lastWriteTime;
+    std::size_t                     size;
+    std::filesystem::path           path;
+  };
+
+  std::vector<CacheFile> files;
+  std::size_t            filesSize = 0u;
+  std::error_code        errorCode;
+  for(std::filesystem::directory_iterator it(mDirectory, errorCode), end; !errorCode && it != end; it.increment(errorCode))
+  {
+    std::error_code fileErrorCode;
+    if(it->path().extension() == FILE_EXTENSION && it->is_regular_file(fileErrorCode))
+    {
+      const auto fileSize      = it->file_size(fileErrorCode);
+      const auto lastWriteTime = fileErrorCode ? std::filesystem::file_time_type() : it->last_write_time(fileErrorCode);
+      if(!fileErrorCode)
+      {
+        files.push_back({lastWriteTime, static_cast<std::size_t>(fileSize), it->path()});
+        filesSize += static_cast<std::size_t>(fileSize);
+      }
+    }
+  }
+
+  // The least recently written or read first.
+  std::sort(files.begin(), files.end(), [](const CacheFile& lhs, const CacheFile& rhs) { return lhs.lastWriteTime < rhs.lastWriteTime; });
+
+  const std::size_t targetSize   = mDiskByteBudget - mDiskByteBudget / DISK_EVICTION_DIVISOR;
+  uint32_t          evictedCount = 0u;
+  for(const auto& file : files)
+  {
+    if(filesSize <= targetSize)
+    {
+      break;
+    }
+
+    // Another process may have removed it already. Either way, it is gone.
+    std::error_code removeErrorCode;
+    if(std::filesystem::remove(file.path, removeErrorCode))
+    {
+      ++evictedCount;
+    }
+    filesSize -= file.size;
+  }
+
+  DALI_LOG_INFO(gVectorImageCacheLogFilter, Debug::General, "Vector image cache : %u files removed, %zu bytes left in %s\n", evictedCount, filesSize, mDirectory.c_str());
+
+  mDiskByteSize = filesSize;
+  return evictedCount;
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,206 @@
+#ifndef DALI_INTERNAL_VECTOR_IMAGE_RASTERIZE_CACHE_H
+#define DALI_INTERNAL_VECTOR_IMAGE_RASTERIZE_CACHE_H
+
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/internal/text/text-abstraction/plugin/lru-cache-container.h>
+#include <dali/public-api/adaptor-framework/pixel-buffer.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+/**
+ * @brief Cache of the rasterized vector images, shared by all the VectorImageRenderer of the process.
+ *
+ * The images are keyed by the hash of their data and the size they are rasterized at.
+ * The cache keeps up to a budget of pixel bytes, dropping the least recently used images beyond it.
+ *
+ * If a directory is set, the rasterized images are also written there, one file per image.
+ * An icon set which doesn't change is then read back instead of rasterized at the next launch.
+ * The files keep up to a budget of bytes, dropping the least recently used ones beyond it, and are
+ * only read back by the same rasterizer, as another version may rasterize the same data differently.
+ * A rasterizer which resolves the physical units with the DPI has it in the data hash, for the same reason.
+ *
+ * All the methods may be called from any thread.
+ */
+class VectorImageRasterizeCache
+{
+public:
+  /**
+   * @brief The counters of the cache.
+   */
+  struct Statistics
+  {
+    uint32_t    hitCount{0u};          ///< The number of images found in memory
+    uint32_t    diskHitCount{0u};      ///< The number of images read from the directory
+    uint32_t    missCount{0u};         ///< The number of images which had to be rasterized
+    uint32_t    evictionCount{0u};     ///< The number of images dropped to stay within the budget
+    uint32_t    diskEvictionCount{0u}; ///< The number of files removed to stay within the disk budget
+    std::size_t byteSize{0u};          ///< The size of the cached pixels
+  };
+
+  /**
+   * @brief Retrieves the cache of the process, configured by the environment.
+   */
+  static VectorImageRasterizeCache& Get();
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] byteBudget The maximum size of the cached pixels. 0 disables the cache
+   * @param[in] directory The directory of the image files. Empty to keep the images in memory only
+   * @param[in] diskByteBudget The maximum size of the image files. 0 keeps the images in memory only
+   * @param[in] rasterizer The name and version of the rasterizer, which the image files must match
+   */
+  VectorImageRasterizeCache(std::size_t byteBudget, std::string directory, std::size_t diskByteBudget, std::string rasterizer);
+
+  /**
+   * @brief Checks whether the images are cached.
+   */
+  bool IsEnabled() const
+  {
+    return mByteBudget > 0u;
+  }
+
+  /**
+   * @brief Calculates the hash of the data of a vector image, which is the same at every launch.
+   *
+   * @param[in] data The data
+   * @param[in] size The size of the data in bytes
+   * @param[in] parseDpi The DPI the data is parsed with, if the rasterizer depends on it, e.g. nanosvg. 0 otherwise
+   * @return The hash
+   */
+  static uint64_t CalculateDataHash(const uint8_t* data, std::size_t size, uint32_t parseDpi = 0u);
+
+  /**
+   * @brief Finds a rasterized image in memory, or else in the directory. It is marked as the most recently used one.
+   * An image read from the directory is kept in memory, unless it is larger than Add() accepts.
+   *
+   * @param[in] dataHash The hash of the data of the image
+   * @param[in] width The rasterized width
+   * @param[in] height The rasterized height
+   * @return A copy of the image, which the caller may modify, or an empty handle if it isn't cached
+   */
+  Dali::PixelBuffer Find(uint64_t dataHash, uint32_t width, uint32_t height);
+
+  /**
+   * @brief Adds a rasterized image, dropping the least recently used ones beyond the budget.
+   *
+   * @param[in] dataHash The hash of the data of the image
+   * @param[in] width The rasterized width
+   * @param[in] height The rasterized height
+   * @param[in] pixelBuffer The RGBA8888 image. Its pixels are copied
+   */
+  void Add(uint64_t dataHash, uint32_t width, uint32_t height, const Dali::PixelBuffer& pixelBuffer);
+
+  /**
+   * @brief Retrieves the counters of the cache.
+   */
+  Statistics GetStatistics() const;
+
+  VectorImageRasterizeCache(const VectorImageRasterizeCache&)            = delete;
+  VectorImageRasterizeCache& operator=(const VectorImageRasterizeCache&) = delete;
+
+private:
+  struct Key
+  {
+    uint64_t dataHash;
+    uint32_t width;
+    uint32_t height;
+
+    bool operator==(const Key& rhs) const
+    {
+      return dataHash == rhs.dataHash && width == rhs.width && height == rhs.height;
+    }
+  };
+
+  struct KeyHash
+  {
+    std::size_t operator()(const Key& key) const
+    {
+      return static_cast<std::size_t>(key.dataHash ^ (static_cast<uint64_t>(key.width) << 32u) ^ key.height);
+    }
+  };
+
+  using Pixels         = std::shared_ptr<std::vector<uint8_t>>;
+  using CacheContainer = TextAbstraction::Internal::LRUCacheContainer<Key, Pixels, KeyHash>;
+
+  /**
+   * @brief Checks whether an image of this size is kept in memory.
+   */
+  bool IsCacheable(std::size_t size) const;
+
+  /**
+   * @brief Adds the pixels of an image, and drops the least recently used images beyond the budget. mMutex must be locked.
+   */
+  void Insert(const Key& key, const Pixels& pixels);
+
+  /**
+   * @brief Retrieves the path of the file of an image.
+   */
+  std::string GetFilePath(const Key& key) const;
+
+  /**
+   * @brief Reads the pixels of an image from its file.
+   * @return The pixels, or nullptr if the file doesn't exist or doesn't match the key
+   */
+  Pixels ReadFile(const Key& key) const;
+
+  /**
+   * @brief Writes the pixels of an image to its file, unless the file exists, and removes the files beyond the disk budget.
+   */
+  void WriteFile(const Key& key, const std::vector<uint8_t>& pixels);
+
+  /**
+   * @brief Removes the least recently used files, until they are well within the disk budget. mDiskMutex must be locked.
+   * The directory is listed again, as other processes may share it.
+   * @return The number of files removed
+   */
+  uint32_t EvictFiles();
+
+private:
+  const std::size_t  mByteBudget;
+  const std::size_t  mDiskByteBudget;
+  const std::string  mRasterizer;   ///< The name and version of the rasterizer, in the name and the header of the files
+  const std::string  mDirectory;    ///< Empty if the images are kept in memory only
+  mutable std::mutex mMutex;        ///< Guards mCache and mStatistics
+  CacheContainer     mCache;
+  Statistics         mStatistics;
+  std::mutex         mDiskMutex;    ///< Guards mDiskByteSize
+  std::size_t        mDiskByteSize; ///< The size of the files in the directory, as last known
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_VECTOR_IMAGE_RASTERIZE_CACHE_H
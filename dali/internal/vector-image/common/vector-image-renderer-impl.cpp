@@ -24,8 +24,9 @@
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/locale-numeric-guard.h>
 
-#ifndef THORVG_SUPPORT
 // INTERNAL INCLUDES
+#include <dali/internal/vector-image/common/vector-image-rasterize-cache.h>
+#ifndef THORVG_SUPPORT
 #include <dali/internal/window-system/common/window-system.h>
 #include <third-party/nanosvg/nanosvg.h>
 #include <third-party/nanosvg/nanosvgrast.h>
@@ -185,6 +186,8 @@ bool VectorImageRenderer::Load(const Vector<uint8_t>& data)
 {
   Mutex::ScopedLock lock(mMutex);
 
+  uint32_t parseDpi = 0u; // The DPI the physical units are resolved with, if the rasterizer depends on it
+
 #ifdef THORVG_SUPPORT
   if(!mSwCanvas)
   {
@@ -273,7 +276,8 @@ bool VectorImageRenderer::Load(const Vector<uint8_t>& data)
 
   uint32_t horizontalDpi = 0u, verticalDpi = 0u;
   WindowSystem::GetDpi(horizontalDpi, verticalDpi);
-  mParsedImage = nsvgParse(reinterpret_cast<char*>(data.Begin()), UNITS, static_cast<float>(horizontalDpi + verticalDpi) * 0.5f);
+  parseDpi     = horizontalDpi + verticalDpi; // Twice the average, so it stays an integer
+  mParsedImage = nsvgParse(reinterpret_cast<char*>(data.Begin()), UNITS, static_cast<float>(parseDpi) * 0.5f);
   if(!mParsedImage || !mParsedImage->shapes)
   {
     DALI_LOG_ERROR("VectorImageRenderer::Load: nsvgParse failed\n");
@@ -292,6 +296,11 @@ bool VectorImageRenderer::Load(const Vector<uint8_t>& data)
   mDefaultHeight = static_cast<uint32_t>(mParsedImage->height);
 #endif
 
+  if(VectorImageRasterizeCache::Get().IsEnabled())
+  {
+    mDataHash = VectorImageRasterizeCache::CalculateDataHash(data.Begin(), data.Size(), parseDpi);
+  }
+
   DALI_LOG_INFO(gVectorImageLogFilter, Debug::Verbose, "Load success! DefaultSize [%u x %u] [%p]\n", mDefaultWidth, mDefaultHeight, this);
   mIsLoaded.store(true);
 
@@ -333,6 +342,18 @@ Dali::PixelBuffer VectorImageRenderer::Rasterize(uint32_t width, uint32_t height
     }
   }
 
+  // The same image is often shown at the same size in many places.
+  auto& rasterizeCache = VectorImageRasterizeCache::Get();
+  if(rasterizeCache.IsEnabled() && IsLoaded())
+  {
+    Dali::PixelBuffer cachedPixelBuffer = rasterizeCache.Find(mDataHash, width, height);
+    if(cachedPixelBuffer)
+    {
+      DALI_LOG_INFO(gVectorImageLogFilter, Debug::Verbose, "Cached size[%d x %d]! [%p]\n", width, height, this);
+      return cachedPixelBuffer;
+    }
+  }
+
 #ifdef THORVG_SUPPORT
   if(!mSwCanvas || !mPicture)
   {
@@ -400,6 +421,10 @@ Dali::PixelBuffer VectorImageRenderer::Rasterize(uint32_t width, uint32_t height
 
   mSwCanvas->sync();
 
+  if(rasterizeCache.IsEnabled())
+  {
+    rasterizeCache.Add(mDataHash, width, height, pixelBuffer);
+  }
   return pixelBuffer;
 #else
   if(mParsedImage != nullptr)
@@ -412,6 +437,11 @@ Dali::PixelBuffer VectorImageRenderer::Rasterize(uint32_t width, uint32_t height
     int   stride = pixelBuffer.GetWidth() * Pixel::GetBytesPerPixel(Dali::Pixel::RGBA8888);
 
     nsvgRasterize(mRasterizer, mParsedImage, 0.0f, 0.0f, scale, pixelBuffer.GetBuffer(), width, height, stride);
+
+    if(rasterizeCache.IsEnabled())
+    {
+      rasterizeCache.Add(mDataHash, width, height, pixelBuffer);
+    }
     return pixelBuffer;
   }
   return Dali::PixelBuffer();
@@ -113,6 +113,7 @@ private:
   NSVGrasterizer* mRasterizer{nullptr};
 #endif
   Dali::Mutex mMutex{};          ///< The mutex
+  uint64_t    mDataHash{0u};     ///< The hash of the data, if the rasterized images are cached
   uint32_t    mDefaultWidth{0};  ///< The default width of the file
   uint32_t    mDefaultHeight{0}; ///< The default height of the file
 
@@ -97,7 +97,7 @@ Pixel::Format PixelBuffer::GetPixelFormat() const
 
 bool PixelBuffer::ApplyGaussianBlur(float blurRadius)
 {
-  return GetImplementation(*this).ApplyGaussianBlur(blurRadius);
+  return GetImplementation(*this).ApplyGaussianBlur(blurRadius, DevelPixelBuffer::GaussianBlurMode::ACCURATE);
 }
 
 bool PixelBuffer::Resize(uint16_t width, uint16_t height)